@@ -374,7 +374,8 @@ set_if_at_least_one_set(RETDEC_ENABLE_UTILS
 		RETDEC_ENABLE_PATTERNGEN
 		RETDEC_ENABLE_RTTI_FINDER
 		RETDEC_ENABLE_STACOFIN
-		RETDEC_ENABLE_UNPACKERTOOL)
+		RETDEC_ENABLE_UNPACKERTOOL
+		RETDEC_ENABLE_YARACPP)
 
 set_if_at_least_one_set(RETDEC_ENABLE_YARACPP
 		RETDEC_ENABLE_ALL
@@ -383,6 +384,9 @@ set_if_at_least_one_set(RETDEC_ENABLE_YARACPP
 		RETDEC_ENABLE_STACOFIN)
 
 # tests
+set_if_all_set(RETDEC_ENABLE_AR_EXTRACTOR_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_AR_EXTRACTOR)
 set_if_all_set(RETDEC_ENABLE_BIN2LLVMIR_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_BIN2LLVMIR)
@@ -392,6 +396,9 @@ set_if_all_set(RETDEC_ENABLE_CAPSTONE2LLVMIR_TESTS
 set_if_all_set(RETDEC_ENABLE_CONFIG_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_CONFIG)
+set_if_all_set(RETDEC_ENABLE_CPDETECT_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_CPDETECT)
 set_if_all_set(RETDEC_ENABLE_CTYPES_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_CTYPES)
@@ -413,18 +420,35 @@ set_if_all_set(RETDEC_ENABLE_LLVMIR2HLL_TESTS
 set_if_all_set(RETDEC_ENABLE_LOADER_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_LOADER)
+set_if_all_set(RETDEC_ENABLE_MACHO_EXTRACTOR_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_MACHO_EXTRACTOR)
+set_if_all_set(RETDEC_ENABLE_RETDEC_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_RETDEC)
 set_if_all_set(RETDEC_ENABLE_SERDES_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_SERDES)
+set_if_all_set(RETDEC_ENABLE_STACOFIN_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_STACOFIN)
 set_if_all_set(RETDEC_ENABLE_UNPACKER_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_UNPACKER)
+set_if_all_set(RETDEC_ENABLE_UNPACKERTOOL_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_UNPACKERTOOL
+		RETDEC_ENABLE_AR_EXTRACTOR
+		RETDEC_ENABLE_MACHO_EXTRACTOR)
 set_if_all_set(RETDEC_ENABLE_COMMON_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_COMMON)
 set_if_all_set(RETDEC_ENABLE_UTILS_TESTS
 		RETDEC_TESTS
 		RETDEC_ENABLE_UTILS)
+set_if_all_set(RETDEC_ENABLE_YARACPP_TESTS
+		RETDEC_TESTS
+		RETDEC_ENABLE_YARACPP)
 
 # src depending on tests
 set_if_at_least_one_set(RETDEC_ENABLE_LLVMIR_EMUL
@@ -442,10 +466,12 @@ set_if_at_least_one_set(RETDEC_ENABLE_ELFIO
 		RETDEC_ENABLE_FILEFORMAT)
 
 set_if_at_least_one_set(RETDEC_ENABLE_GOOGLETEST
+		RETDEC_ENABLE_AR_EXTRACTOR_TESTS
 		RETDEC_ENABLE_BIN2LLVMIR_TESTS
 		RETDEC_ENABLE_CAPSTONE2LLVMIR_TESTS
 		RETDEC_ENABLE_COMMON_TESTS
 		RETDEC_ENABLE_CONFIG_TESTS
+		RETDEC_ENABLE_CPDETECT_TESTS
 		RETDEC_ENABLE_CTYPES_TESTS
 		RETDEC_ENABLE_CTYPESPARSER_TESTS
 		RETDEC_ENABLE_DEMANGLER_TESTS
@@ -453,9 +479,14 @@ set_if_at_least_one_set(RETDEC_ENABLE_GOOGLETEST
 		RETDEC_ENABLE_LLVMIR_EMUL_TESTS
 		RETDEC_ENABLE_LLVMIR2HLL_TESTS
 		RETDEC_ENABLE_LOADER_TESTS
+		RETDEC_ENABLE_MACHO_EXTRACTOR_TESTS
+		RETDEC_ENABLE_RETDEC_TESTS
 		RETDEC_ENABLE_SERDES_TESTS
+		RETDEC_ENABLE_STACOFIN_TESTS
 		RETDEC_ENABLE_UNPACKER_TESTS
-		RETDEC_ENABLE_UTILS_TESTS)
+		RETDEC_ENABLE_UNPACKERTOOL_TESTS
+		RETDEC_ENABLE_UTILS_TESTS
+		RETDEC_ENABLE_YARACPP_TESTS)
 
 set_if_at_least_one_set(RETDEC_ENABLE_KEYSTONE
 		RETDEC_ENABLE_CAPSTONE2LLVMIRTOOL
@@ -27,6 +27,8 @@ class ArchiveWrapper : private retdec::utils::NonCopyable
 	public:
 		ArchiveWrapper(const std::string &archivePath, bool &succes,
 			std::string &errorMessage);
+		ArchiveWrapper(const std::uint8_t *data, std::size_t size,
+			bool &succes, std::string &errorMessage);
 
 		/// @brief Getters.
 		/// @{
@@ -55,6 +57,10 @@ class ArchiveWrapper : private retdec::utils::NonCopyable
 			const std::string &outputPath = "") const;
 		bool extractByIndex(const std::size_t index, std::string &errorMessage,
 			const std::string &outputPath = "") const;
+		bool extractByName(const std::string &name, std::string &errorMessage,
+			std::vector<std::uint8_t> &data) const;
+		bool extractByIndex(const std::size_t index, std::string &errorMessage,
+			std::vector<std::uint8_t> &data) const;
 		/// @}
 
 	private:
@@ -65,6 +71,12 @@ class ArchiveWrapper : private retdec::utils::NonCopyable
 
 		/// @brief Auxiliary methods.
 		/// @{
+		void init(bool &succes, std::string &errorMessage);
+		bool getChildByName(const std::string &name,
+			llvm::StringRef &content, std::string &errorMessage) const;
+		bool getChildByIndex(const std::size_t index,
+			llvm::StringRef &content, std::string &childName,
+			std::string &errorMessage) const;
 		bool getNames(std::vector<std::string> &result,
 			std::string &errorMessage) const;
 		bool getCount(std::size_t &count, std::string &errorMessage) const;
@@ -7,6 +7,8 @@
 #ifndef RETDEC_AR_EXTRACTOR_DETECTION_H
 #define RETDEC_AR_EXTRACTOR_DETECTION_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace retdec {
@@ -14,6 +16,8 @@ namespace ar_extractor {
 
 bool isArchive(const std::string &path);
 
+bool isArchive(const std::uint8_t *data, std::size_t size);
+
 bool isThinArchive(const std::string &path);
 
 bool isNormalArchive(const std::string &path);
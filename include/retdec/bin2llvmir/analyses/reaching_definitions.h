@@ -3,9 +3,10 @@
 * @brief Reaching definitions analysis (RDA) builds UD and DU chains.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 *
-* Right now, this works on an entire module. But we could insert an another layer
-* that represents functions. Then it would be possible to associate BBs with
-* functions that own them and recompute RDA only for the selected function.
+* Functions are solved independently of each other: definitions are numbered
+* per function and the data-flow sets are dense bit vectors indexed by these
+* numbers. Therefore, functions can be solved in parallel, and a single
+* function can be recomputed without touching the others.
 */
 
 #ifndef RETDEC_BIN2LLVMIR_ANALYSES_REACHING_DEFINITIONS_H
@@ -17,6 +18,7 @@
 #include <unordered_set>
 #include <vector>
 
+#include <llvm/ADT/BitVector.h>
 #include <llvm/ADT/SmallPtrSet.h>
 #include <llvm/IR/Module.h>
 
@@ -29,6 +31,7 @@ namespace bin2llvmir {
 class Definition;
 class Use;
 class BasicBlockEntry;
+class FunctionEntry;
 class ReachingDefinitionsAnalysis;
 
 using Changed = bool;
@@ -59,6 +62,8 @@ class Definition
 		/// Definition instruction position in its BB.
 		/// Can be used to find out if def dominates its uses in the same BB.
 		unsigned posInBb = 0;
+		/// Definition number in its function -- index to the bit vectors.
+		unsigned id = 0;
 };
 
 class Use
@@ -90,7 +95,7 @@ class BasicBlockEntry
 				std::ostream& out,
 				const BasicBlockEntry& bbe);
 
-		void initializeKillDefSets();
+		void initializeKillDefSets(const FunctionEntry& fe);
 		Changed initDefsOut();
 
 		const DefSet& defsFromUse(const llvm::Instruction* I) const;
@@ -105,25 +110,43 @@ class BasicBlockEntry
 		UseVector uses;
 
 		BBEntrySet prevBBs;
+		BBEntrySet nextBBs;
 
+		// Sets of definition numbers.
 		// defsIn is union of prevBBs' defsOuts
-		DefSet defsOut;
-		DefSet genDefs;
-		std::unordered_set<llvm::Value*> killDefs;
+		llvm::BitVector defsOut;
+		llvm::BitVector genDefs;
+		llvm::BitVector killDefs;
 
-		bool changed = false;
+		/// Is the entry in the propagation worklist?
+		bool inWorkList = false;
 
 	private:
 		unsigned id;
 };
 
+/**
+ * RDA data of a single function.
+ */
+class FunctionEntry
+{
+	public:
+		std::map<const llvm::BasicBlock*, BasicBlockEntry> bbs;
+
+		/// All the definitions in the function, indexed by their numbers.
+		std::vector<Definition*> defs;
+		/// Numbers of all the definitions of the given source.
+		std::unordered_map<const llvm::Value*, llvm::BitVector> sourceDefs;
+};
+
 class ReachingDefinitionsAnalysis
 {
 	public:
 		bool runOnModule(
 				llvm::Module& M,
 				Abi* abi = nullptr,
-				bool trackFlagRegs = false);
+				bool trackFlagRegs = false,
+				std::size_t threads = 1);
 		bool runOnFunction(
 				llvm::Function& F,
 				Abi* abi = nullptr,
@@ -152,18 +175,18 @@ class ReachingDefinitionsAnalysis
 				llvm::Instruction* I);
 
 	private:
-		void run();
+		void run(llvm::Function& F, FunctionEntry& fe) const;
 		const BasicBlockEntry& getBasicBlockEntry(const llvm::Instruction* I) const;
-		void initializeBasicBlocks(llvm::Module& M);
-		void initializeBasicBlocks(llvm::Function& F);
-		void initializeBasicBlocksPrev();
-		void initializeKillGenSets();
-		void propagate();
-		void initializeDefsAndUses();
-		void clearInternal();
+		void initializeBasicBlocks(llvm::Function& F, FunctionEntry& fe) const;
+		void initializeBasicBlocksPrev(FunctionEntry& fe) const;
+		void initializeDefinitionNumbers(FunctionEntry& fe) const;
+		void initializeKillGenSets(FunctionEntry& fe) const;
+		void propagate(const llvm::Function& F, FunctionEntry& fe) const;
+		void initializeDefsAndUses(FunctionEntry& fe) const;
+		void clearInternal(FunctionEntry& fe) const;
 
 	private:
-		std::map<const llvm::Function*, std::map<const llvm::BasicBlock*, BasicBlockEntry>> bbMap;
+		std::map<const llvm::Function*, FunctionEntry> fncMap;
 		bool _trackFlagRegs = false;
 		const llvm::GlobalVariable* _specialGlobal = nullptr;
 		bool _run = false;
@@ -11,6 +11,7 @@
 #ifndef RETDEC_BIN2LLVMIR_ANALYSES_SYMBOLIC_TREE_H
 #define RETDEC_BIN2LLVMIR_ANALYSES_SYMBOLIC_TREE_H
 
+#include <map>
 #include <set>
 #include <unordered_set>
 #include <vector>
@@ -31,13 +32,18 @@ namespace bin2llvmir {
  * analysis.
  *
  * For optimization reasons, some data members of this structure are static,
- * i.e. common for all instances.
+ * i.e. common for all instances. They are thread-local, so decompilations
+ * running in different threads do not affect each other.
  * The typical usage of this class is: creation -> simplification -> pattern
  * detection -> action based on pattern -> throwing away the current instance
  * before creating and processing the new one.
  * In such a case, global data members and global behaviour configuration is
  * not a problem. If you, for whatever reason, want to store instances, keep
  * this in mind.
+ *
+ * Subtrees reached several times during a single construction (e.g. the same
+ * definition reaching a use through different paths) are expanded at most
+ * twice and copied afterwards.
  */
 class SymbolicTree
 {
@@ -147,23 +153,21 @@ class SymbolicTree
 		static void setNaryLimit(unsigned n);
 
 	private:
-		static Abi* _abi;
-		static Config* _config;
-		static bool _val2valUsed;
-		static bool _trackThroughAllocaLoads;
-		static bool _trackThroughGeneralRegisterLoads;
-		static bool _trackOnlyFlagRegisters;
-		static bool _simplifyAtCreation;
-		static unsigned _naryLimit;
+		static thread_local Abi* _abi;
+		static thread_local Config* _config;
+		static thread_local bool _val2valUsed;
+		static thread_local bool _trackThroughAllocaLoads;
+		static thread_local bool _trackThroughGeneralRegisterLoads;
+		static thread_local bool _trackOnlyFlagRegisters;
+		static thread_local bool _simplifyAtCreation;
+		static thread_local unsigned _naryLimit;
 
 	// Private methods.
 	//
 	private:
-		void expandNode(
-				ReachingDefinitionsAnalysis* RDA,
-				std::map<llvm::Value*, llvm::Value*>* val2val,
-				unsigned maxNodeLevel,
-				bool linear);
+		struct Expansion;
+
+		void expandNode(Expansion& e);
 
 		void _simplifyNode();
 		void fixLevel(unsigned level = 0);
@@ -179,13 +183,10 @@ class SymbolicTree
 		 * so it can be used in std::vector<>::emplace_back().
 		 */
 		SymbolicTree(
-				ReachingDefinitionsAnalysis* rda,
+				Expansion& e,
 				llvm::Value* v,
 				llvm::Value* u,
-				unsigned nodeLevel,
-				unsigned maxNodeLevel,
-				std::map<llvm::Value*, llvm::Value*>* v2v,
-				bool linear);
+				unsigned nodeLevel);
 
 	// Private data.
 	//
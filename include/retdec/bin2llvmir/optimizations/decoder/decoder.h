@@ -98,6 +98,8 @@ class Decoder : public llvm::ModulePass
 						ByteData& bytes,
 						common::Address& addr,
 						llvm::IRBuilder<>& irb);
+		void addCapstoneInsn(
+				capstone2llvmir::Capstone2LlvmIrTranslator::TranslationResultOne& tr);
 
 		bool getJumpTargetsFromInstruction(
 				common::Address addr,
@@ -294,7 +296,6 @@ class Decoder : public llvm::ModulePass
 		FileImage* _image = nullptr;
 		DebugFormat* _debug = nullptr;
 		NameContainer* _names = nullptr;
-		Llvm2CapstoneInsnMap* _llvm2capstone = nullptr;
 		Abi* _abi = nullptr;
 
 		std::unique_ptr<capstone2llvmir::Capstone2LlvmIrTranslator> _c2l;
@@ -9,6 +9,7 @@
 
 #include <optional>
 #include <set>
+#include <string>
 
 #include "retdec/bin2llvmir/optimizations/decoder/decoder_debug.h"
 #include "retdec/capstone2llvmir/capstone2llvmir.h"
@@ -72,8 +73,6 @@ class JumpTarget
 		cs_mode getMode() const;
 		void setMode(cs_mode m) const;
 
-	friend std::ostream& operator<<(std::ostream &out, const JumpTarget& jt);
-
 	private:
 		// This address will be tried to be decoded.
 		retdec::common::Address _address;
@@ -85,9 +84,6 @@ class JumpTarget
 		retdec::common::Address _fromAddress;
 		/// Disassembler mode that should be used for this jump target.
 		mutable cs_mode _mode = CS_MODE_BIG_ENDIAN;
-
-	public:
-		static Config* config;
 };
 
 /**
@@ -96,6 +92,8 @@ class JumpTarget
 class JumpTargets
 {
 	public:
+		void setConfig(Config* c);
+
 		auto begin();
 		auto end();
 
@@ -112,13 +110,17 @@ class JumpTargets
 				retdec::common::Address f,
 				std::optional<std::size_t> sz = std::nullopt);
 
+		std::string toString(const JumpTarget& jt) const;
+
 	friend std::ostream& operator<<(std::ostream &out, const JumpTargets& jts);
 
 	public:
 		std::set<JumpTarget> _data;
 
-	public:
-		static Config* config;
+	private:
+		/// Config of the decoded module. It is kept per container, so that
+		/// several modules can be decoded at the same time.
+		Config* _config = nullptr;
 };
 
 } // namespace bin2llvmir
@@ -7,7 +7,10 @@
 #ifndef RETDEC_BIN2LLVMIR_OPTIMIZATIONS_IDIOMS_IDIOMS_ANALYSIS_H
 #define RETDEC_BIN2LLVMIR_OPTIMIZATIONS_IDIOMS_IDIOMS_ANALYSIS_H
 
+#include <bitset>
 #include <cstdio>
+#include <initializer_list>
+#include <vector>
 
 #include <llvm/ADT/Statistic.h>
 #include <llvm/IR/BasicBlock.h>
@@ -40,15 +43,31 @@ class IdiomsAnalysis:
 	public IdiomsOWatcom,
 	public IdiomsVStudio  {
 public:
-	IdiomsAnalysis(llvm::Module * M, CC_compiler cc, CC_arch arch)
-	{
-		init(M, cc, arch);
-	}
+	IdiomsAnalysis(llvm::Module * M, CC_compiler cc, CC_arch arch);
 	virtual bool doAnalysis(llvm::Function & f, llvm::Pass * p) override;
 
 private:
+	using Exchanger = llvm::Instruction * (IdiomsAnalysis::*)(llvm::BasicBlock::iterator) const;
+	using OpcodeSet = std::bitset<llvm::Instruction::OtherOpsEnd>;
+
+	/**
+	 * @brief Basic-block instruction idiom enabled for the analysed module.
+	 */
+	struct Idiom {
+		Exchanger exchanger = nullptr; ///< instruction idiom exchanger
+		const char * name = nullptr;   ///< exchanger name (for debug purpose only)
+		OpcodeSet rootOpcodes;         ///< opcodes of instructions the idiom can be rooted in
+	};
+
+	void initIdioms();
+	static OpcodeSet getOpcodes(llvm::BasicBlock & bb);
+
 	bool analyse(llvm::Function & f, llvm::Pass * p, int (IdiomsAnalysis::*exchanger)(llvm::Function &, llvm::Pass *) const, const char * fname);
-	bool analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname);
+	bool analyse(llvm::BasicBlock & bb, const Idiom & idiom);
+
+private:
+	/// Basic-block idioms in the order in which they are exchanged.
+	std::vector<Idiom> m_idioms;
 };
 
 } // namespace bin2llvmir
@@ -61,7 +61,11 @@ class ValueProtect : public llvm::ModulePass
 		llvm::Module* _module = nullptr;
 		Config* _config = nullptr;
 		Abi* _abi = nullptr;
-		static std::map<llvm::Type*, llvm::Function*> _type2fnc;
+		/// Protection functions created by the last protect() in this thread,
+		/// they are removed by the following unprotect().
+		static thread_local std::map<llvm::Type*, llvm::Function*> _type2fnc;
+		/// Module the functions in @c _type2fnc were created in.
+		static thread_local llvm::Module* _type2fncModule;
 };
 
 } // namespace bin2llvmir
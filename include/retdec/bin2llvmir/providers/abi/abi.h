@@ -165,9 +165,6 @@ class AbiProvider
 		static Abi* getAbi(llvm::Module* m);
 		static bool getAbi(llvm::Module* m, Abi*& abi);
 		static void clear();
-
-	private:
-		static std::map<llvm::Module*, std::unique_ptr<Abi>> _module2abi;
 };
 
 } // namespace bin2llvmir
@@ -7,6 +7,8 @@
 #ifndef RETDEC_BIN2LLVMIR_PROVIDERS_ASM_INSTRUCTION_H
 #define RETDEC_BIN2LLVMIR_PROVIDERS_ASM_INSTRUCTION_H
 
+#include <unordered_map>
+
 #include <capstone/capstone.h>
 #include "retdec/capstone2llvmir/arm/arm_defs.h"
 #include "retdec/capstone2llvmir/mips/mips_defs.h"
@@ -15,6 +17,7 @@
 
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/Module.h>
+#include <llvm/IR/ValueHandle.h>
 
 #include "retdec/bin2llvmir/utils/llvm.h"
 #include "retdec/common/address.h"
@@ -22,7 +25,14 @@
 namespace retdec {
 namespace bin2llvmir {
 
-using Llvm2CapstoneInsnMap = typename std::map<llvm::StoreInst*, cs_insn*>;
+class CapstoneInsnStore;
+
+/**
+ * Index of LLVM to ASM mapping instructions by ASM instruction addresses.
+ * Erased instructions are automatically removed (handles become null).
+ */
+using Address2LlvmToAsmMap =
+		typename std::unordered_map<uint64_t, llvm::WeakVH>;
 
 /**
  * Assembly instruction representation.
@@ -152,8 +162,12 @@ class AsmInstruction
 		}
 
 	public:
-		static Llvm2CapstoneInsnMap& getLlvmToCapstoneInsnMap(
-				const llvm::Module* m);
+		static CapstoneInsnStore& getCapstoneInsnStore(const llvm::Module* m);
+		static void addCapstoneInsn(
+				const llvm::Module* m,
+				llvm::StoreInst* llvmToAsm,
+				cs_insn* insn,
+				cs_mode mode);
 		static llvm::GlobalVariable* getLlvmToAsmGlobalVariable(
 				const llvm::Module* m);
 		static void setLlvmToAsmGlobalVariable(
@@ -174,25 +188,19 @@ class AsmInstruction
 		static retdec::common::Address getFunctionEndAddress(
 				llvm::Function* f);
 		static bool isLlvmToAsmInstruction(const llvm::Value* inst);
+		static void clear(const llvm::Module* m);
 		static void clear();
 
 	private:
 		const llvm::GlobalVariable* getLlvmToAsmGlobalVariablePrivate(
 				llvm::Module* m) const;
 		bool isLlvmToAsmInstructionPrivate(llvm::Value* inst) const;
-
-	private:
-		using ModuleGlobalPair = std::pair<
-				const llvm::Module*,
-				llvm::GlobalVariable*>;
-		using ModuleInstructionMap = std::pair<
-				const llvm::Module*,
-				std::map<llvm::StoreInst*, cs_insn*>>;
+		static llvm::StoreInst* getIndexedLlvmToAsmInstruction(
+				const llvm::Module* m,
+				retdec::common::Address addr);
 
 	private:
 		llvm::StoreInst* _llvmToAsmInstr = nullptr;
-		static std::vector<ModuleGlobalPair> _module2global;
-		static std::vector<ModuleInstructionMap> _module2instMap;
 
 	public:
 		template<
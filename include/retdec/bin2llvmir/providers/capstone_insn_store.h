@@ -0,0 +1,127 @@
+/**
+ * @file include/retdec/bin2llvmir/providers/capstone_insn_store.h
+ * @brief Compact storage of Capstone instructions of LLVM to ASM mappings.
+ * @copyright (c) 2021 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_PROVIDERS_CAPSTONE_INSN_STORE_H
+#define RETDEC_BIN2LLVMIR_PROVIDERS_CAPSTONE_INSN_STORE_H
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <vector>
+
+#include <capstone/capstone.h>
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/IR/Instructions.h>
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Capstone instructions of LLVM to ASM mapping instructions.
+ *
+ * A fully decoded @c cs_insn (with details) takes more than a kilobyte, but
+ * only a few of them are needed at any given time. Therefore, the store keeps
+ * just the address, mode and bytes of each instruction in a contiguous array,
+ * and a bounded cache of the most recently requested fully decoded
+ * instructions. Instructions that are not in the cache are decoded again by
+ * the store's own Capstone engine, see setEngine().
+ *
+ * Some instructions decode differently on their own than they did in the
+ * decoder, e.g. Thumb instructions in IT blocks, whose condition is kept in
+ * the Capstone engine. Before an instruction drops out of the cache, it is
+ * therefore decoded again and compared with the cached one. If they differ,
+ * or if it cannot be decoded again at all, the instruction is kept for good.
+ * IT instructions themselves are always kept, so that the store's engine
+ * never enters an IT block. This way, get() returns the same details as the
+ * decoder saw, and it never fails for an added instruction.
+ *
+ * Pointers returned by get() stay valid until the instruction drops out of
+ * the cache, i.e. until @c cacheSize other instructions are requested or
+ * added. If the cache size is set to zero, all the pointers stay valid until
+ * the store is cleared. Without an engine, nothing can be decoded again and
+ * all the added instructions are kept.
+ *
+ * All methods are thread-safe.
+ */
+class CapstoneInsnStore
+{
+	public:
+		/// Default number of fully decoded instructions kept in the cache.
+		static const std::size_t defaultCacheSize = 1024;
+
+	public:
+		CapstoneInsnStore(std::size_t cacheSize = defaultCacheSize);
+		~CapstoneInsnStore();
+
+		CapstoneInsnStore(const CapstoneInsnStore&) = delete;
+		CapstoneInsnStore& operator=(const CapstoneInsnStore&) = delete;
+
+		bool setEngine(cs_arch arch, cs_mode mode);
+		void setCacheSize(std::size_t cacheSize);
+
+		void add(const llvm::StoreInst* llvmToAsm, cs_insn* insn, cs_mode mode);
+		cs_insn* get(const llvm::StoreInst* llvmToAsm);
+		void erase(const llvm::StoreInst* llvmToAsm);
+		void clear();
+
+		std::size_t size() const;
+		bool empty() const;
+
+	private:
+		/// Everything needed to decode the instruction again.
+		struct Insn
+		{
+			std::uint64_t address = 0;
+			std::uint32_t mode = 0;
+			std::uint8_t size = 0;
+			std::uint8_t bytes[sizeof(cs_insn::bytes)] = {};
+		};
+		/// Fully decoded instruction and its position in the LRU list.
+		/// Kept instructions are not in the LRU list.
+		struct CachedInsn
+		{
+			cs_insn* insn = nullptr;
+			std::list<std::uint32_t>::iterator lruIt;
+			bool kept = false;
+		};
+
+	private:
+		cs_insn* decode(const Insn& i);
+		bool decodesAgain(const Insn& i, const cs_insn* insn);
+		void cache(std::uint32_t slot, cs_insn* insn);
+		void keep(std::uint32_t slot);
+		void uncache(std::uint32_t slot);
+		void shrinkCache();
+		void closeEngine();
+
+	private:
+		csh _engine = 0;
+		bool _hasEngine = false;
+		cs_arch _arch = CS_ARCH_ALL;
+		cs_mode _engineMode = CS_MODE_LITTLE_ENDIAN;
+
+		/// Instructions, indexed by slots.
+		std::vector<Insn> _insns;
+		/// Slots of erased instructions, reused by the following additions.
+		std::vector<std::uint32_t> _freeSlots;
+		/// <LLVM to ASM mapping instruction, slot>
+		llvm::DenseMap<const llvm::StoreInst*, std::uint32_t> _slots;
+
+		/// Maximum number of cached instructions, zero means unlimited. Kept
+		/// instructions are not counted.
+		std::size_t _cacheSize = defaultCacheSize;
+		/// Slots of cached instructions, the most recently used first.
+		std::list<std::uint32_t> _lru;
+		/// <slot, cached instruction>
+		llvm::DenseMap<std::uint32_t, CachedInsn> _cache;
+
+		mutable std::mutex _mutex;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
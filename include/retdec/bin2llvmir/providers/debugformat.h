@@ -25,6 +25,7 @@ class DebugFormat : public debugformat::DebugFormat
  * Completely static object -- all members and methods are static -> it can be
  * used by anywhere in bin2llvmirl. It provides mapping of modules to debug info
  * associated with them.
+ * The data are stored in the module's @c ProviderContext.
  *
  * @attention Even though this is accessible anywhere in bin2llvmirl, use it only
  * in LLVM passes' prologs to initialize pass-local demangler object. All
@@ -49,10 +50,6 @@ class DebugFormatProvider
 		static bool getDebugFormat(llvm::Module* m, DebugFormat*& df);
 
 		static void clear();
-
-	private:
-		/// Mapping of modules to debug info associated with them.
-		static std::map<llvm::Module*, DebugFormat> _module2debug;
 };
 
 } // namespace bin2llvmir
@@ -87,6 +87,7 @@ public:
  * Completely static object -- all members and methods are static -> it can be
  * used by anywhere in bin2llvmirl. It provides mapping of modules to demanglers
  * associated with them.
+ * The data are stored in the module's @c ProviderContext.
  *
  * @attention Even though this is accessible anywhere in bin2llvmirl, use it only
  * in LLVM passes' prologs to initialize pass-local demangler object. All
@@ -107,10 +108,6 @@ public:
 		Demangler *&d);
 
 	static void clear();
-
-private:
-	/// Mapping of modules to demanglers associated with them.
-	static std::map<llvm::Module *, std::unique_ptr<Demangler>> _module2demangler;
 };
 
 } // namespace bin2llvmir
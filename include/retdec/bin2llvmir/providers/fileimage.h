@@ -109,6 +109,7 @@ class FileImage
  * Completely static object -- all members and methods are static -> it can be
  * used by anywhere in bin2llvmirl. It provides mapping of modules to file
  * images associated with them.
+ * The data are stored in the module's @c ProviderContext.
  *
  * @attention Even though this is accessible anywhere in bin2llvmirl, use it only
  * in LLVM passes' prologs to initialize pass-local file image object. All
@@ -139,10 +140,6 @@ class FileImageProvider
 		static FileImage* addFileImage(
 				llvm::Module* m,
 				FileImage img);
-
-	private:
-		/// Mapping of modules to file images associated with them.
-		static std::map<llvm::Module*, FileImage> _module2image;
 };
 
 } // namespace bin2llvmir
@@ -7,7 +7,11 @@
 #ifndef RETDEC_BIN2LLVMIR_PROVIDERS_LTI_H
 #define RETDEC_BIN2LLVMIR_PROVIDERS_LTI_H
 
+#include <memory>
+#include <vector>
+
 #include <llvm/IR/Module.h>
+#include <llvm/Support/MemoryBuffer.h>
 
 #include "retdec/ctypesparser/json_ctypes_parser.h"
 #include "retdec/bin2llvmir/providers/config.h"
@@ -50,7 +54,8 @@ class Lti
 		std::shared_ptr<ctypesparser::TypeConfig> _typeConfig;
 		retdec::loader::Image* _image = nullptr;
 		std::unique_ptr<retdec::ctypes::Module> _ltiModule;
-		ctypesparser::JSONCTypesParser _ltiParser;
+		std::vector<std::unique_ptr<llvm::MemoryBuffer>> _ltiFiles;
+		std::vector<std::unique_ptr<ctypesparser::JSONCTypesParser>> _ltiParsers;
 };
 
 class LtiProvider
@@ -64,9 +69,6 @@ class LtiProvider
 		static Lti* getLti(llvm::Module* m);
 		static bool getLti(llvm::Module* m, Lti*& lti);
 		static void clear();
-
-	private:
-		static std::map<llvm::Module*, Lti> _module2lti;
 };
 
 } // namespace bin2llvmir
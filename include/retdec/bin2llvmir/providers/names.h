@@ -177,12 +177,7 @@ class NameContainer
 
 		std::string getNameFromImportLibAndOrd(
 				const std::string& libName,
-				int ord);
-		bool loadImportOrds(const std::string& libName);
-
-	private:
-		/// <ordinal number, function name>
-		using ImportOrdMap = std::map<int, std::string>;
+				std::uint64_t ord);
 
 	private:
 		Config* _config = nullptr;
@@ -191,8 +186,6 @@ class NameContainer
 		Lti* _lti = nullptr;
 
 		std::map<retdec::common::Address, Names> _data;
-		/// <library name without suffix ".dll", map with ordinals>
-		std::map<std::string, ImportOrdMap> _dllOrds;
 };
 
 /**
@@ -211,9 +204,6 @@ class NamesProvider
 		static NameContainer* getNames(llvm::Module* m);
 		static bool getNames(llvm::Module* m, NameContainer*& names);
 		static void clear();
-
-	private:
-		static std::map<llvm::Module*, NameContainer> _module2names;
 };
 
 } // namespace bin2llvmir
@@ -0,0 +1,103 @@
+/**
+ * @file include/retdec/bin2llvmir/providers/provider_context.h
+ * @brief Per-module storage of all the provider data.
+ * @copyright (c) 2021 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_PROVIDERS_PROVIDER_CONTEXT_H
+#define RETDEC_BIN2LLVMIR_PROVIDERS_PROVIDER_CONTEXT_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+
+#include <llvm/IR/Module.h>
+
+#include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/capstone_insn_store.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+class Abi;
+class Config;
+class DebugFormat;
+class Demangler;
+class FileImage;
+class Lti;
+class NameContainer;
+
+/**
+ * All the data the providers (@c ConfigProvider, @c FileImageProvider,
+ * @c AbiProvider, ...) hold for a single LLVM module, i.e. for a single
+ * decompilation.
+ *
+ * Contexts are owned by a process-wide registry that maps modules to their
+ * contexts. The registry itself is thread-safe, so different modules can be
+ * processed from different threads at the same time. A single context is
+ * not synchronized -- all the work on one module must be done from one
+ * thread at a time (which is what LLVM requires anyway).
+ *
+ * The providers keep their static interfaces. They only use the context of
+ * the given module instead of their own global maps.
+ */
+class ProviderContext
+{
+	public:
+		~ProviderContext();
+
+		static ProviderContext* get(const llvm::Module* m);
+		static ProviderContext& getOrCreate(const llvm::Module* m);
+		static void release(const llvm::Module* m);
+		static void forEach(const std::function<void(ProviderContext&)>& f);
+		static void clear();
+
+	public:
+		// Members are destroyed in the reverse order of declaration, so
+		// objects using other objects must be declared after them.
+		std::unique_ptr<Config> config;
+		std::unique_ptr<FileImage> fileImage;
+		std::unique_ptr<Abi> abi;
+		std::unique_ptr<Demangler> demangler;
+		std::unique_ptr<DebugFormat> debugFormat;
+		std::unique_ptr<Lti> lti;
+		std::unique_ptr<NameContainer> names;
+
+		llvm::GlobalVariable* llvmToAsmGlobal = nullptr;
+		CapstoneInsnStore capstoneInsns;
+		Address2LlvmToAsmMap addressToLlvmToAsm;
+
+	private:
+		static std::shared_mutex _mutex;
+		static std::map<const llvm::Module*, std::unique_ptr<ProviderContext>>
+				_module2context;
+};
+
+/**
+ * Releases the provider context of a module when it goes out of scope.
+ *
+ * Usage:
+ * @code
+ * auto module = createLlvmModule(context);
+ * ProviderContextGuard guard(module.get());
+ * pm.run(*module);
+ * @endcode
+ */
+class ProviderContextGuard
+{
+	public:
+		explicit ProviderContextGuard(const llvm::Module* m);
+		~ProviderContextGuard();
+
+		ProviderContextGuard(const ProviderContextGuard&) = delete;
+		ProviderContextGuard& operator=(const ProviderContextGuard&) = delete;
+
+	private:
+		const llvm::Module* _module = nullptr;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
@@ -0,0 +1,73 @@
+/**
+ * @file include/retdec/bin2llvmir/utils/ordinals.h
+ * @brief Database of names of functions imported by ordinal numbers.
+ * @copyright (c) 2021 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_BIN2LLVMIR_UTILS_ORDINALS_H
+#define RETDEC_BIN2LLVMIR_UTILS_ORDINALS_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <llvm/Support/MemoryBuffer.h>
+
+namespace retdec {
+namespace bin2llvmir {
+
+/**
+ * Names of functions exported from libraries by ordinal numbers.
+ *
+ * The database reads a directory with ordinal numbers of a single
+ * architecture (e.g. @c support/ordinals/x86). If the directory contains an
+ * index created by @c support/index-ordinals.py during the build, the index
+ * is mapped into memory and names are looked up right in it. Otherwise, the
+ * @c <library>.ord text files are parsed, each of them at most once.
+ *
+ * Databases are shared by all users in the process, use get() to obtain them.
+ * Lookups are thread-safe.
+ */
+class OrdinalDatabase
+{
+	public:
+		/// Name of the index file in the ordinals directory.
+		static const std::string indexFileName;
+
+	public:
+		static OrdinalDatabase& get(const std::string& ordinalsDir);
+
+		std::string getName(const std::string& libName, std::uint64_t ord);
+
+	private:
+		/// <ordinal number, function name>
+		using OrdMap = std::map<std::uint64_t, std::string>;
+
+	private:
+		OrdinalDatabase(const std::string& ordinalsDir);
+
+		bool loadIndex();
+		std::string getNameFromIndex(
+				const std::string& libName,
+				std::uint64_t ord) const;
+		const char* getIndexString(std::uint32_t offset) const;
+
+		const OrdMap& getOrdMap(const std::string& libName);
+
+	private:
+		std::string _ordinalsDir;
+
+		std::unique_ptr<llvm::MemoryBuffer> _index;
+		std::uint32_t _indexSlotCount = 0;
+
+		/// <library name, ordinals from its .ord file (empty if missing)>
+		std::map<std::string, OrdMap> _ordFiles;
+		std::mutex _ordFilesMutex;
+};
+
+} // namespace bin2llvmir
+} // namespace retdec
+
+#endif
@@ -64,6 +64,7 @@ class Parameters
 		void setMaxMemoryLimit(uint64_t limit);
 		void setIsMaxMemoryLimitHalfRam(bool f);
 		void setTimeout(uint64_t seconds);
+		void setThreads(uint64_t threads);
 		void setEntryPoint(const retdec::common::Address& a);
 		void setMainAddress(const retdec::common::Address& a);
 		void setSectionVMA(const retdec::common::Address& a);
@@ -99,6 +100,7 @@ class Parameters
 		const std::string& getErrFile() const;
 		uint64_t getMaxMemoryLimit() const;
 		uint64_t getTimeout() const;
+		uint64_t getThreads() const;
 		retdec::common::Address getEntryPoint() const;
 		retdec::common::Address getMainAddress() const;
 		retdec::common::Address getSectionVMA() const;
@@ -166,6 +168,12 @@ class Parameters
 		bool _maxMemoryLimitHalfRam = true;
 		uint64_t _timeout = 0;
 
+		/// Number of threads used by the analyses that can run in parallel
+		/// (reaching definitions, reference solving of static code detection,
+		/// backend optimizations of single functions). The LLVM passes always
+		/// run on a single thread. Zero means all the hardware threads.
+		uint64_t _threads = 1;
+
 		bool _detectStaticCode = true;
 		std::string _backendDisabledOpts;
 		std::string _backendEnabledOpts;
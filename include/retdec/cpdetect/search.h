@@ -7,6 +7,8 @@
 #ifndef RETDEC_CPDETECT_SEARCH_H
 #define RETDEC_CPDETECT_SEARCH_H
 
+#include <string_view>
+
 #include "retdec/cpdetect/cptypes.h"
 #include "retdec/fileformat/file_format/file_format.h"
 
@@ -40,11 +42,35 @@ class Search
 				/// @}
 		};
 	private:
+		/**
+		 * Signature pattern without slashes compiled for matching directly
+		 * on the loaded bytes
+		 */
+		struct CompiledPattern
+		{
+			/// number of significant (not variable) nibbles
+			std::size_t fixedNibbles = 0;
+			/// @c false if pattern contains slashes or other characters
+			/// which cannot be matched on bytes
+			bool compiled = true;
+			/// values of bytes for pattern starting on the high nibble
+			/// (index 0) and on the low nibble (index 1) of byte
+			std::vector<std::uint8_t> values[2];
+			/// masks of significant nibbles of @c values
+			std::vector<std::uint8_t> masks[2];
+			/// index of byte used for quick search of candidate positions
+			/// or @c masks size if pattern has no fully significant byte
+			std::size_t anchors[2] = {0, 0};
+		};
+
 		retdec::fileformat::FileFormat &parser;
-		/// content of file in hexadecimal string representation
+		/// content of file as plain string (view of the loaded bytes)
+		std::string_view plain;
+		/// content of file in hexadecimal string representation, stored
+		/// only if it cannot be computed directly from the loaded bytes
 		std::string nibbles;
-		/// content of file as plain string
-		std::string plain;
+		/// length of content of file in hexadecimal string representation
+		std::size_t nibblesLength;
 		/// representation of supported relative jumps
 		std::vector<RelativeJump> jumps;
 		/// average length of one slash representation
@@ -60,6 +86,22 @@ class Search
 		bool haveSlashes() const;
 		std::size_t nibblesFromBytes(std::size_t nBytes) const;
 		std::size_t bytesFromNibbles(std::size_t nNibbles) const;
+		char getNibble(std::size_t index) const;
+		bool hasNibblesOnPosition(
+				const std::string &str,
+				std::size_t position) const;
+		bool canMatchBytes() const;
+		CompiledPattern compilePattern(
+				const std::string &signPattern,
+				std::size_t length) const;
+		bool matchesBytes(
+				const CompiledPattern &pattern,
+				std::size_t form,
+				std::size_t byteOffset) const;
+		std::size_t countSameNibbles(
+				const CompiledPattern &pattern,
+				std::size_t form,
+				std::size_t byteOffset) const;
 		/// @}
 	public:
 		Search(retdec::fileformat::FileFormat &fileParser);
@@ -72,8 +114,8 @@ class Search
 
 		/// @name Getters
 		/// @{
-		const std::string& getNibbles() const;
-		const std::string& getPlainString() const;
+		std::string getNibbles() const;
+		std::string_view getPlainString() const;
 		/// @}
 
 		/// @name Jump methods
@@ -7,9 +7,11 @@
 #ifndef RETDEC_CTYPESPARSER_JSON_CTYPES_PARSER_H
 #define RETDEC_CTYPESPARSER_JSON_CTYPES_PARSER_H
 
+#include <cstddef>
 #include <functional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 #include <rapidjson/document.h>
 
@@ -20,6 +22,10 @@ namespace ctypesparser {
 
 /**
 * @brief Parser for C-types represented in JSON.
+*
+* The whole JSON can be parsed at once by parse() or parseInto(). Alternatively,
+* the JSON can only be indexed by index(), and its functions are then parsed
+* one by one, upon request, by parseIndexedFunction().
 */
 class JSONCTypesParser: public CTypesParser
 {
@@ -37,6 +43,19 @@ class JSONCTypesParser: public CTypesParser
 			const TypeWidths &typeWidths = {},
 			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention());
 
+		/// @name Lazy parsing.
+		/// @{
+		void index(
+			const char *json,
+			std::size_t size,
+			const std::shared_ptr<retdec::ctypes::Context> &context,
+			const TypeWidths &typeWidths = {},
+			const retdec::ctypes::CallConvention &callConvention = retdec::ctypes::CallConvention());
+		bool hasIndexedFunction(const std::string &name) const;
+		std::shared_ptr<retdec::ctypes::Function> parseIndexedFunction(
+			const std::string &name);
+		/// @}
+
 	private:
 		std::string loadJson(std::istream &stream) const;
 		std::unique_ptr<rapidjson::Document> parseJson(char *buffer) const;
@@ -44,6 +63,8 @@ class JSONCTypesParser: public CTypesParser
 			const std::unique_ptr<rapidjson::Document> &root,
 			std::unique_ptr<retdec::ctypes::Module> &module);
 		void addTypesToMap(const rapidjson::Value &types);
+		std::unique_ptr<rapidjson::Document> parseIndexedJson(
+			const std::pair<std::size_t, std::size_t> &part) const;
 
 		/// @name Parsing methods.
 		/// @{
@@ -129,6 +150,8 @@ class JSONCTypesParser: public CTypesParser
 	private:
 		using ParserContext = std::unordered_map<std::string, std::shared_ptr<retdec::ctypes::Type>>;
 		using TypesMap = std::unordered_map<std::string, rapidjson::Value::ConstMemberIterator>;
+		/// Mapping of names into parts (offset, length) of the indexed JSON.
+		using JSONIndex = std::unordered_map<std::string, std::pair<std::size_t, std::size_t>>;
 
 	private:
 		/// Context for the parser (to speedup the parsing).
@@ -137,6 +160,15 @@ class JSONCTypesParser: public CTypesParser
 		/// Map used to store pointers to JSON types (to speedup the parsing).
 		TypesMap typesMap;
 
+		/// JSON indexed by index() (not owned by the parser).
+		const char *indexedJson = nullptr;
+
+		/// Functions in the indexed JSON.
+		JSONIndex indexedFunctions;
+
+		/// Types in the indexed JSON.
+		JSONIndex indexedTypes;
+
 		/// Call convention used when JSON does not contain one.
 		retdec::ctypes::CallConvention defaultCallConv;
 };
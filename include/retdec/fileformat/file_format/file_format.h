@@ -10,6 +10,7 @@
 #include <fstream>
 #include <initializer_list>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <utility>
@@ -53,14 +54,20 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		void initStream();
 		/// @}
 
+		void computeHashes(bool wantCrc32, bool wantMd5, bool wantSha256) const;
+		const std::vector<unsigned char>& restoreOriginalBytes() const;
+
 		/// @name Pure virtual initialization methods
 		/// @{
 		virtual std::size_t initSectionTableHashOffsets() = 0;
 		/// @}
 	protected:
-		std::string crc32;                                                ///< CRC32 of file content
-		std::string md5;                                                  ///< MD5 of file content
-		std::string sha256;                                               ///< SHA256 of file content
+		mutable std::string crc32;                                        ///< CRC32 of file content
+		mutable std::string md5;                                          ///< MD5 of file content
+		mutable std::string sha256;                                       ///< SHA256 of file content
+		mutable std::mutex hashesMutex;                                   ///< guards lazy computation of file hashes and original bytes
+		std::vector<std::pair<std::size_t, std::vector<unsigned char>>> overwrittenBytes; ///< original content of overwritten file bytes
+		mutable std::vector<unsigned char> originalBytes;                 ///< content of file with overwrites undone
 		std::string sectionCrc32;                                         ///< CRC32 of section table
 		std::string sectionMd5;                                           ///< MD5 of section table
 		std::string sectionSha256;                                        ///< SHA256 of section table
@@ -177,6 +184,8 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		bool isRawData() const;
 		bool isUnknownFormat() const;
 		bool isWindowsDriver() const;
+		void computeHashes() const;
+		void keepOriginalBytes(const unsigned char *data, std::size_t size);
 		bool hasCrc32() const;
 		bool hasMd5() const;
 		bool hasSha256() const;
@@ -260,6 +269,7 @@ class FileFormat : public retdec::utils::ByteValueStorage, private retdec::utils
 		const std::vector<RelocationTable*>& getRelocationTables() const;
 		const std::vector<DynamicTable*>& getDynamicTables() const;
 		const std::vector<unsigned char>& getBytes() const;
+		const std::vector<unsigned char>& getOriginalBytes() const;
 		const std::vector<unsigned char>& getLoadedBytes() const;
 		const unsigned char* getBytesData() const;
 		const unsigned char* getLoadedBytesData() const;
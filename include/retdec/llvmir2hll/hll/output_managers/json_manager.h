@@ -11,7 +11,6 @@
 
 #include <rapidjson/writer.h>
 #include <rapidjson/prettywriter.h>
-#include <rapidjson/stringbuffer.h>
 #include <rapidjson/encodings.h>
 
 #include <llvm/Support/raw_ostream.h>
@@ -23,6 +22,31 @@ namespace llvmir2hll {
 
 class OutputManager;
 
+/**
+ * Adapts an LLVM output stream to the rapidjson output stream concept, so that
+ * the JSON is written right away instead of being built in memory.
+ */
+class JsonOutputStream
+{
+	public:
+		using Ch = char;
+
+	public:
+		JsonOutputStream(llvm::raw_ostream& out) : _out(out) {}
+
+		void Put(Ch c) { _out << c; }
+		void Flush() {}
+
+	private:
+		llvm::raw_ostream& _out;
+};
+
+// The encodings of rapidjson call PutUnsafe() before its generic version is
+// declared (encodings.h is included by stream.h above that declaration), so
+// for a stream outside of the rapidjson namespace, only this overload can be
+// found by argument-dependent lookup.
+inline void PutUnsafe(JsonOutputStream& os, char c) { os.Put(c); }
+
 template <typename Writer>
 class JsonOutputManager : public OutputManager
 {
@@ -63,9 +87,7 @@ class JsonOutputManager : public OutputManager
 		void generateAddressEntry(Address a);
 
 	private:
-		llvm::raw_ostream& _out;
-
-		rapidjson::StringBuffer sb;
+		JsonOutputStream _out;
 		Writer writer;
 
 		std::stack<std::pair<Address, bool>> _addrs;
@@ -87,10 +109,10 @@ class JsonOutputManager : public OutputManager
 };
 
 using JsonOutputManagerPlain =
-		JsonOutputManager<rapidjson::Writer<rapidjson::StringBuffer, rapidjson::ASCII<>>>;
+		JsonOutputManager<rapidjson::Writer<JsonOutputStream, rapidjson::ASCII<>>>;
 
 using JsonOutputManagerPretty =
-		JsonOutputManager<rapidjson::PrettyWriter<rapidjson::StringBuffer, rapidjson::ASCII<>>>;
+		JsonOutputManager<rapidjson::PrettyWriter<JsonOutputStream, rapidjson::ASCII<>>>;
 
 } // namespace llvmir2hll
 } // namespace retdec
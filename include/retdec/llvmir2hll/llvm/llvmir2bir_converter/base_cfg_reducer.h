@@ -82,7 +82,7 @@ private:
     using CFGNodeStack = std::stack<ShPtr<CFGNode>>;
     using MapCFGNodeToSwitchClause = std::unordered_map<ShPtr<CFGNode>, ShPtr<SwitchClause>>;
 
-private:
+protected:
     StructureConverter *sc;
 
 public:
@@ -80,6 +80,33 @@ private:
 	using MapTargetToGoto = std::unordered_map<ShPtr<CFGNode>, std::vector<ShPtr<GotoStmt>>>;
 	using MapStmtToClones = std::unordered_map<ShPtr<Statement>, std::vector<ShPtr<Statement>>>;
 
+	/// Nodes of a CFG reduction in progress that need not be inspected.
+	struct CFGReductionState {
+		/// Nodes whose inspection has failed and whose neighborhood has not
+		/// changed since then.
+		CFGNode::CFGNodeSet unchangedNodes;
+
+		/// Has the current traversal skipped any node?
+		bool skippedNodes = false;
+	};
+
+public:
+	/**
+	* @brief A CFG reduction in progress, i.e. a loop calling reduceCFG() until
+	*        nothing can be reduced.
+	*
+	* While the scope exists, nodes whose inspection has failed are not
+	* inspected again until some reduction changes their neighborhood.
+	*/
+	class CFGReductionScope: private retdec::utils::NonCopyable {
+	public:
+		explicit CFGReductionScope(StructureConverter *sc);
+		~CFGReductionScope();
+
+	private:
+		StructureConverter *sc;
+	};
+
 public:
 	StructureConverter(llvm::Pass *basePass, ShPtr<LLVMValueConverter> conv, ShPtr<Module> module);
 
@@ -101,6 +128,12 @@ private:
 		llvm::Loop *loop) const;
 	bool BFSTraverse(ShPtr<CFGNode> cfg,
 		std::function<bool (ShPtr<CFGNode>)> inspectFunc) const;
+	bool BFSReduce(ShPtr<CFGNode> cfg,
+		std::function<bool (ShPtr<CFGNode>)> inspectFunc);
+	bool inspectChangedCFGNode(const ShPtr<CFGNode> &node,
+		const std::function<bool (ShPtr<CFGNode>)> &inspectFunc);
+	CFGNode::CFGNodeSet getNeighborhood(const ShPtr<CFGNode> &node) const;
+	void markChanged(const CFGNode::CFGNodeSet &nodes);
 	bool BFSTraverseLoop(ShPtr<CFGNode> cfg,
 		std::function<bool (ShPtr<CFGNode>)> inspectFunc) const;
 	ShPtr<CFGNode> BFSFindFirst(ShPtr<CFGNode> cfg,
@@ -322,6 +355,9 @@ private:
 	ShPtr<Module> resModule;
 
 	ShPtr<PoRECFGReducer> cfgReducer;
+
+	// States of the CFG reductions in progress, from the outermost one.
+	std::vector<CFGReductionState> cfgReductions;
 };
 
 } // namespace llvmir2hll
@@ -109,7 +109,7 @@ public:
 	virtual bool runOnModule(llvm::Module &m) override;
 
 	void setConfig(retdec::config::Config* c);
-	void setOutputString(std::string* outString);
+	void setOutputStream(llvm::raw_ostream* out);
 
 private:
 	bool initialize(llvm::Module &m);
@@ -178,8 +178,8 @@ private:
 	/// Output file stream.
 	std::unique_ptr<llvm::ToolOutputFile> outFile;
 
-	/// Output string stream.
-	std::unique_ptr<llvm::raw_string_ostream> outStringStream;
+	/// Output stream used instead of the output file (if set).
+	llvm::raw_ostream* outStream = nullptr;
 };
 
 } // namespace llvmir2hll
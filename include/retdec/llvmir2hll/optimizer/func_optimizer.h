@@ -37,11 +37,17 @@ class Module;
 *    (blocks).
 *
 * The functions are not optimized in any particular order. Optimizations for a
-* single function should not affect optimizations of other functions.
+* single function should not affect optimizations of other functions. Hence, by
+* default, canOptimizePartsSeparately() returns @c true, so the functions may
+* be optimized separately (and in parallel). Optimizers that need the whole
+* module have to override it.
 *
 * Instances of this class have reference object semantics.
 */
 class FuncOptimizer: public Optimizer {
+public:
+	virtual bool canOptimizePartsSeparately() const override;
+
 protected:
 	FuncOptimizer(ShPtr<Module> module);
 
@@ -54,7 +60,7 @@ protected:
 	*
 	* This function is very handy in subclasses. Typical usage:
 	* @code
-	* void ForLoopOptimizer::visit(ShPtr<WhileLoopStmt> stmt) {
+	* void ForLoopOptimizer::visit(const ShPtr<WhileLoopStmt> &stmt) {
 	*     visitNestedAndSuccessorStatements(stmt);
 	*     tryConversionToForLoop(stmt);
 	* }
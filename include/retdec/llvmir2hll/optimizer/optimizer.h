@@ -10,6 +10,7 @@
 #include <string>
 
 #include "retdec/llvmir2hll/support/smart_ptr.h"
+#include "retdec/llvmir2hll/support/types.h"
 #include "retdec/llvmir2hll/support/visitors/ordered_all_visitor.h"
 #include "retdec/utils/non_copyable.h"
 
@@ -38,6 +39,13 @@ namespace llvmir2hll {
 * optimize() in it, or use any of the templated optimize() static functions as
 * a shorthand.
 *
+* Optimizers whose canOptimizePartsSeparately() returns @c true can also
+* optimize a single function (optimizeFunc()) or just the initializers of
+* global variables (optimizeGlobalVars()). Such optimizers have to look only at
+* the currently optimized part of the module (see optimizesWholeModule(),
+* getFuncDefinitionsToOptimize(), and shouldOptimizeGlobalVars()), so different
+* parts can be optimized in parallel.
+*
 * Instances of this class have reference object semantics.
 */
 class Optimizer: public OrderedAllVisitor, private retdec::utils::NonCopyable {
@@ -50,6 +58,10 @@ public:
 	virtual std::string getId() const = 0;
 
 	ShPtr<Module> optimize();
+	void optimizeFunc(ShPtr<Function> func);
+	void optimizeGlobalVars();
+	virtual bool canOptimizePartsSeparately() const;
+	void setFuncDeclarations(ShPtr<const FuncSet> funcDeclarations);
 
 	/**
 	* @brief Creates an instance of OptimizerType with the given arguments and
@@ -74,9 +86,25 @@ protected:
 	virtual void doOptimization();
 	virtual void doFinalization();
 
+	bool optimizesWholeModule() const;
+	bool shouldOptimizeGlobalVars() const;
+	FuncVector getFuncDefinitionsToOptimize() const;
+	bool isDeclaration(ShPtr<Function> func) const;
+
 protected:
 	/// The module that is being optimized.
 	ShPtr<Module> module;
+
+	/// If non-null, only this function is optimized (see optimizeFunc()).
+	ShPtr<Function> onlyFunc;
+
+	/// Are only the initializers of global variables optimized (see
+	/// optimizeGlobalVars())?
+	bool onlyGlobalVars;
+
+	/// If non-null, the functions declared in the module before the
+	/// optimization has started (see setFuncDeclarations()).
+	ShPtr<const FuncSet> funcDeclarations;
 };
 
 } // namespace llvmir2hll
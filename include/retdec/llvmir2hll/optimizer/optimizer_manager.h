@@ -7,10 +7,17 @@
 #ifndef RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZER_MANAGER_H
 #define RETDEC_LLVMIR2HLL_OPTIMIZER_OPTIMIZER_MANAGER_H
 
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "retdec/llvmir2hll/optimizer/optimizer.h"
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 #include "retdec/llvmir2hll/support/types.h"
 #include "retdec/utils/non_copyable.h"
+#include "retdec/utils/thread_pool.h"
 
 namespace retdec {
 namespace llvmir2hll {
@@ -24,6 +31,12 @@ class ValueAnalysis;
 /**
 * @brief A manager managing optimizations.
 *
+* When more than one thread is requested, consecutive optimizations that can
+* optimize functions separately (see Optimizer::canOptimizePartsSeparately())
+* are not run one by one over the whole module. Instead, every function is run
+* through all of them at once, and functions are optimized in parallel. The
+* other optimizations wait until all the functions are optimized.
+*
 * Instances of this class have reference object semantics. This class is not
 * meant to be subclassed.
 */
@@ -32,19 +45,49 @@ public:
 	OptimizerManager(const StringSet &enabledOpts, const StringSet &disabledOpts,
 		ShPtr<HLLWriter> hllWriter, ShPtr<ValueAnalysis> va,
 		ShPtr<CallInfoObtainer> cio, ShPtr<ArithmExprEvaluator> arithmExprEvaluator,
-		bool enableDebug = false);
+		bool enableDebug = false, std::size_t threads = 1);
 
 	void optimize(ShPtr<Module> m);
 
+private:
+	/// Analyses used by optimizers running in parallel with other optimizers.
+	struct LocalAnalyses {
+		ShPtr<ValueAnalysis> va;
+		ShPtr<CallInfoObtainer> cio;
+		ShPtr<ArithmExprEvaluator> arithmExprEvaluator;
+	};
+
+	/// Creates an optimizer that uses the given local analyses.
+	using LocalOptimizerCreator = std::function<
+		ShPtr<Optimizer>(const LocalAnalyses &)>;
+
+	/// Optimization waiting to be run in parallel (its ID and creator).
+	using PostponedOptimization = std::pair<std::string, LocalOptimizerCreator>;
+
 private:
 	void printOptimization(const std::string &optName) const;
 	bool optShouldBeRun(const std::string &optName) const;
 	void runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimizer);
+	void postponeOptimizationProvidedItShouldBeRun(const std::string &optId,
+		LocalOptimizerCreator createOptimizer);
+	void runPostponedOptimizations(ShPtr<Module> m);
+	void runAndRecoverFromOutOfMemory(const std::function<void ()> &optimize);
+	LocalAnalyses createLocalAnalyses() const;
 	bool shouldSecondCopyPropagationBeRun() const;
 
 	template<typename Optimization, typename... Args>
 	void run(ShPtr<Module> m, Args &&... args);
 
+	template<typename T>
+	static const T &toLocal(const T &arg, const LocalAnalyses &local);
+	static ShPtr<ValueAnalysis> toLocal(const ShPtr<ValueAnalysis> &va,
+		const LocalAnalyses &local);
+	static ShPtr<CallInfoObtainer> toLocal(const ShPtr<CallInfoObtainer> &cio,
+		const LocalAnalyses &local);
+	static ShPtr<ArithmExprEvaluator> toLocal(
+		const ShPtr<ArithmExprEvaluator> &arithmExprEvaluator,
+		const LocalAnalyses &local);
+
 private:
 	/// No other optimization than these will be run.
 	const StringSet enabledOpts;
@@ -72,6 +115,13 @@ private:
 
 	/// List of our optimizations that were run.
 	StringSet backendRunOpts;
+
+	/// Threads optimizing functions in parallel.
+	retdec::utils::ThreadPool threadPool;
+
+	/// Optimizations waiting to be run in parallel (in the order in which they
+	/// have to be run).
+	std::vector<PostponedOptimization> postponedOpts;
 };
 
 } // namespace llvmir2hll
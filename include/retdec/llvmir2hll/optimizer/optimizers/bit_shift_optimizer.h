@@ -61,6 +61,7 @@ public:
 	BitShiftOptimizer(ShPtr<Module> module);
 
 	virtual std::string getId() const override { return "BitShift"; }
+	virtual bool canOptimizePartsSeparately() const override { return true; }
 
 private:
 	void doOptimization() override;
@@ -68,8 +69,8 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<BitShlOpExpr> expr) override;
-	virtual void visit(ShPtr<BitShrOpExpr> expr) override;
+	virtual void visit(const ShPtr<BitShlOpExpr> &expr) override;
+	virtual void visit(const ShPtr<BitShrOpExpr> &expr) override;
 	/// @}
 };
 
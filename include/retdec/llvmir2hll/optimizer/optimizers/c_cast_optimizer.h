@@ -92,14 +92,16 @@ public:
 		ShPtr<Expression> src);
 
 	virtual std::string getId() const override { return "CCast"; }
+	// It inspects parameters of the called functions.
+	virtual bool canOptimizePartsSeparately() const override { return false; }
 
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<CallExpr> expr) override;
-	virtual void visit(ShPtr<AssignStmt> stmt) override;
-	virtual void visit(ShPtr<VarDefStmt> stmt) override;
-	virtual void visit(ShPtr<ReturnStmt> stmt) override;
+	virtual void visit(const ShPtr<CallExpr> &expr) override;
+	virtual void visit(const ShPtr<AssignStmt> &stmt) override;
+	virtual void visit(const ShPtr<VarDefStmt> &stmt) override;
+	virtual void visit(const ShPtr<ReturnStmt> &stmt) override;
 	/// @}
 
 private:
@@ -142,6 +142,9 @@ private:
 
 	/// Has the code changed?
 	bool codeChanged;
+
+	/// Have statements been moved without updating the CFG?
+	bool cfgIsOutdated;
 };
 
 } // namespace llvmir2hll
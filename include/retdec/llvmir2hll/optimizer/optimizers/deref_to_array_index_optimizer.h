@@ -54,6 +54,7 @@ public:
 	DerefToArrayIndexOptimizer(ShPtr<Module> module);
 
 	virtual std::string getId() const override { return "DerefToArrayIndex"; }
+	virtual bool canOptimizePartsSeparately() const override { return true; }
 
 private:
 	/// Structure that stores the base and index for creating a new
@@ -69,7 +70,7 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<DerefOpExpr> expr) override;
+	virtual void visit(const ShPtr<DerefOpExpr> &expr) override;
 	/// @}
 
 	std::optional<BaseAndIndex> getBaseAndIndexFromExprIfPossible(ShPtr<AddOpExpr> expr);
@@ -72,6 +72,7 @@ public:
 	EmptyArrayToStringOptimizer(ShPtr<Module> module);
 
 	virtual std::string getId() const override { return "EmptyArrayToString"; }
+	virtual bool canOptimizePartsSeparately() const override { return true; }
 
 private:
 	virtual void doOptimization() override;
@@ -140,7 +140,7 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<IfStmt> stmt) override;
+	virtual void visit(const ShPtr<IfStmt> &stmt) override;
 	/// @}
 
 	bool tryOptimization1(ShPtr<IfStmt> stmt);
@@ -34,6 +34,8 @@ public:
 	LLVMIntrinsicsOptimizer(ShPtr<Module> module);
 
 	virtual std::string getId() const override { return "LLVMIntrinsics"; }
+	// It removes declarations of unused functions from the module.
+	virtual bool canOptimizePartsSeparately() const override { return false; }
 
 private:
 	virtual void doOptimization() override;
@@ -43,8 +45,8 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<CallExpr> expr) override;
-	virtual void visit(ShPtr<CallStmt> stmt) override;
+	virtual void visit(const ShPtr<CallExpr> &expr) override;
+	virtual void visit(const ShPtr<CallStmt> &stmt) override;
 	/// @}
 
 private:
@@ -7,33 +7,56 @@
 #ifndef RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_C_HEADER_FILE_FOR_FUNC_H
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_C_HEADER_FILE_FOR_FUNC_H
 
+#include <array>
 #include <cstddef>
 #include <optional>
+#include <string>
+#include <string_view>
 
-#include "retdec/llvmir2hll/support/types.h"
-#include "retdec/utils/array.h"
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/sorted_table.h"
+
+namespace retdec {
+namespace llvmir2hll {
+namespace semantics {
 
 /**
-* @brief Maps all the functions from array @a funcs into @a header by adding
-*        them into @a map.
-*
-* @param[in] funcs Statically allocated array of function names
-*                  (<tt>const char *</tt>).
-* @param[in] header The name of the header file (<tt>const char *</tt>).
-* @param[out] map A map into which the mappings will be stored.
+* @brief A header file in which a function is declared.
 */
-#define ADD_FUNCS_TO_C_HEADER_MAP(funcs, header, map) \
-	for (std::size_t i = 0, e = retdec::utils::arraySize(funcs); i != e; ++i) { \
-		map[funcs[i]] = header; \
+struct FuncCHeader {
+	/// Returns the key by which the entries are sorted.
+	constexpr std::string_view key() const {
+		return funcName;
 	}
 
-namespace retdec {
-namespace llvmir2hll {
-namespace semantics {
+	/// Name of the function.
+	std::string_view funcName;
+
+	/// Name of the header file.
+	std::string_view header;
+};
+
+/// Mapping of function names into their header files.
+using FuncCHeaderTable = SortedTable<FuncCHeader>;
+
+/**
+* @brief Maps all the functions from @a funcs into @a header.
+*
+* @param[in] funcs Statically allocated array of function names.
+* @param[in] header The name of the header file.
+*/
+template<std::size_t N>
+constexpr std::array<FuncCHeader, N> funcsInCHeader(
+		const std::string_view (&funcs)[N], std::string_view header) {
+	std::array<FuncCHeader, N> entries{};
+	for (std::size_t i = 0; i < N; ++i) {
+		entries[i] = FuncCHeader{funcs[i], header};
+	}
+	return entries;
+}
 
-std::optional<std::string> getCHeaderFileForFuncFromMap(
+std::optional<std::string> getCHeaderFileForFuncFromTable(
 		const std::string &funcName,
-		const StringStringUMap &map);
+		const FuncCHeaderTable &table);
 
 } // namespace semantics
 } // namespace llvmir2hll
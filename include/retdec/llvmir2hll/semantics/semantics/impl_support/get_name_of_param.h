@@ -7,40 +7,45 @@
 #ifndef RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_NAME_OF_PARAM_H
 #define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_GET_NAME_OF_PARAM_H
 
-#include <cstddef>
 #include <optional>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <utility>
 
-/**
-* @brief Sets a name of the given parameter for the given function.
-*/
-#define ADD_PARAM_NAME(funcName, paramPos, paramName) \
-	funcParamNamesMap[FuncParamPosPair(funcName, paramPos)] = paramName;
+#include "retdec/llvmir2hll/semantics/semantics/impl_support/sorted_table.h"
 
 namespace retdec {
 namespace llvmir2hll {
 namespace semantics {
 
 /// A pair of function name and parameter position.
-using FuncParamPosPair = std::pair<std::string, unsigned>;
+using FuncParamPosPair = std::pair<std::string_view, unsigned>;
 
 /**
-* @brief A hashing functor for FuncParamPosPair.
+* @brief A name of a parameter of a function.
 */
-struct FuncParamPosPairHasher {
-	std::size_t operator()(const FuncParamPosPair &p) const {
-		return std::hash<std::string>()(p.first) + p.second;
+struct FuncParamName {
+	/// Returns the key by which the entries are sorted.
+	constexpr FuncParamPosPair key() const {
+		return FuncParamPosPair(funcName, paramPos);
 	}
+
+	/// Name of the function.
+	std::string_view funcName;
+
+	/// Position of the parameter (starting from 1).
+	unsigned paramPos;
+
+	/// Name of the parameter.
+	std::string_view paramName;
 };
 
 /// Mapping of a function name and parameter position into the name of this
 /// parameter.
-using FuncParamNamesMap = std::unordered_map<FuncParamPosPair, std::string,
-	FuncParamPosPairHasher>;
+using FuncParamNamesTable = SortedTable<FuncParamName>;
 
-std::optional<std::string> getNameOfParamFromMap(const std::string &funcName,
-	unsigned paramPos, const FuncParamNamesMap &map);
+std::optional<std::string> getNameOfParamFromTable(const std::string &funcName,
+	unsigned paramPos, const FuncParamNamesTable &table);
 
 } // namespace semantics
 } // namespace llvmir2hll
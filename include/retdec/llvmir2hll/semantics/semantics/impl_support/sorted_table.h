@@ -0,0 +1,170 @@
+/**
+* @file include/retdec/llvmir2hll/semantics/semantics/impl_support/sorted_table.h
+* @brief Read-only tables whose entries are sorted at compile time.
+* @copyright (c) 2021 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_SORTED_TABLE_H
+#define RETDEC_LLVMIR2HLL_SEMANTICS_SEMANTICS_IMPL_SUPPORT_SORTED_TABLE_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace retdec {
+namespace llvmir2hll {
+namespace semantics {
+
+/**
+* @brief Copies @a entries into @a result, starting at index @a i.
+*
+* @return The index past the last copied entry.
+*/
+template<typename Result, typename Entries>
+constexpr std::size_t appendEntries(Result &result, std::size_t i,
+		const Entries &entries) {
+	for (const auto &entry : entries) {
+		result[i++] = entry;
+	}
+	return i;
+}
+
+/**
+* @brief Returns all the given entries in a single array.
+*
+* The entries are stored in the order in which they are given.
+*/
+template<typename Entry, std::size_t... Ns>
+constexpr std::array<Entry, (Ns + ...)> concatEntries(
+		const std::array<Entry, Ns> &... entries) {
+	std::array<Entry, (Ns + ...)> result{};
+	std::size_t i = 0;
+	((i = appendEntries(result, i, entries)), ...);
+	return result;
+}
+
+/**
+* @brief Returns the given entries sorted by their keys.
+*
+* @tparam Entry Type of the entries. It has to provide a constexpr member
+*               function @c key() whose results can be compared by @c <.
+*
+* The sort is stable, so entries with equal keys keep their relative order.
+* It is intended to be evaluated at compile time. Since it is a natural merge
+* sort, it needs only a few passes over data that are already (almost)
+* sorted, which keeps the compile-time evaluation cheap.
+*/
+template<typename Entry, std::size_t N>
+constexpr std::array<Entry, N> sortEntries(std::array<Entry, N> entries) {
+	std::array<Entry, N> merged{};
+	for (;;) {
+		// Merge every two consecutive sorted runs into a single run.
+		std::size_t runs = 0;
+		for (std::size_t begin = 0; begin < N; ++runs) {
+			std::size_t mid = begin + 1;
+			while (mid < N && !(entries[mid].key() < entries[mid - 1].key())) {
+				++mid;
+			}
+			std::size_t end = mid;
+			if (end < N) {
+				++end;
+				while (end < N && !(entries[end].key() < entries[end - 1].key())) {
+					++end;
+				}
+			}
+
+			std::size_t l = begin, r = mid, o = begin;
+			while (l < mid && r < end) {
+				merged[o++] = entries[r].key() < entries[l].key() ?
+					entries[r++] : entries[l++];
+			}
+			while (l < mid) {
+				merged[o++] = entries[l++];
+			}
+			while (r < end) {
+				merged[o++] = entries[r++];
+			}
+			begin = end;
+		}
+
+		entries = merged;
+		if (runs <= 1) {
+			return entries;
+		}
+	}
+}
+
+/**
+* @brief Returns the given entries sorted by their keys.
+*
+* See the overload for @c std::array for more details.
+*/
+template<typename Entry, std::size_t N>
+constexpr std::array<Entry, N> sortEntries(const Entry (&entries)[N]) {
+	std::array<Entry, N> result{};
+	appendEntries(result, 0, entries);
+	return sortEntries(result);
+}
+
+/**
+* @brief A read-only view of entries sorted by sortEntries().
+*
+* @tparam Entry Type of the entries (see sortEntries()).
+*
+* The table does not own the entries. It is meant to be constructed from a
+* constexpr array, so both the table and its entries are stored in read-only
+* data and no code has to be run to initialize them.
+*/
+template<typename Entry>
+class SortedTable {
+public:
+	/**
+	* @brief Creates an empty table.
+	*/
+	constexpr SortedTable(): first(nullptr), last(nullptr) {}
+
+	/**
+	* @brief Creates a table of the given entries.
+	*
+	* @par Preconditions
+	*  - @a entries are sorted by their keys
+	*/
+	template<std::size_t N>
+	constexpr SortedTable(const std::array<Entry, N> &entries):
+		first(entries.data()), last(entries.data() + N) {}
+
+	/**
+	* @brief Returns the entry with the given key, or @c nullptr if there is no
+	*        such entry.
+	*
+	* If there are more entries with @a key, the last one of them is returned.
+	* That is, the result is the same as if the entries were inserted into a
+	* map one after another.
+	*/
+	template<typename Key>
+	const Entry *find(const Key &key) const {
+		if (first == last || key < first->key() || (last - 1)->key() < key) {
+			return nullptr;
+		}
+
+		auto i = std::upper_bound(first, last, key,
+			[](const Key &key, const Entry &entry) {
+				return key < entry.key();
+			}
+		);
+		return (i - 1)->key() < key ? nullptr : i - 1;
+	}
+
+private:
+	/// The first entry.
+	const Entry *first;
+
+	/// The entry past the last entry.
+	const Entry *last;
+};
+
+} // namespace semantics
+} // namespace llvmir2hll
+} // namespace retdec
+
+#endif
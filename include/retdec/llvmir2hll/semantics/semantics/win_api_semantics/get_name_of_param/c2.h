@@ -1,6 +1,6 @@
 /**
 * @file include/retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/c2.h
-* @brief Initializes FuncParamNamesMap for WinAPI functions starting with C
+* @brief Provides FuncParamNamesTable for WinAPI functions starting with C
 *        (second part).
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
@@ -15,7 +15,7 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-void initFuncParamNamesMap_C2(FuncParamNamesMap &funcParamNamesMap);
+const FuncParamNamesTable &getFuncParamNamesTable_C2();
 
 } // namespace win_api
 } // namespace semantics
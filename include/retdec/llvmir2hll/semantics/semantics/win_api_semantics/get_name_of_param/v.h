@@ -1,6 +1,6 @@
 /**
 * @file include/retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/v.h
-* @brief Initializes FuncParamNamesMap for WinAPI functions starting with V.
+* @brief Provides FuncParamNamesTable for WinAPI functions starting with V.
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
@@ -14,7 +14,7 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-void initFuncParamNamesMap_V(FuncParamNamesMap &funcParamNamesMap);
+const FuncParamNamesTable &getFuncParamNamesTable_V();
 
 } // namespace win_api
 } // namespace semantics
@@ -106,7 +106,9 @@ ShPtr<To> ucast(const ShPtr<From> &ptr) noexcept {
 */
 template<typename To, typename From>
 bool isa(const ShPtr<From> &ptr) noexcept {
-	return cast<To>(ptr) != nullptr;
+	// Check the raw pointer. Going through cast<>() would create a temporary
+	// shared pointer, i.e. two atomic updates of the reference count.
+	return dynamic_cast<const To *>(ptr.get()) != nullptr;
 }
 
 /**
@@ -8,7 +8,11 @@
 #define RETDEC_LLVMIR2HLL_SUPPORT_SUBJECT_H
 
 #include <algorithm>
-#include <vector>
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+#include <llvm/ADT/SmallVector.h>
 
 #include "retdec/llvmir2hll/support/smart_ptr.h"
 
@@ -37,6 +41,11 @@ namespace llvmir2hll {
 * };
 * @endcode
 *
+* Adding, removing, and notifying observers is thread-safe, so subjects that are
+* shared by several functions (types, global variables) can be used while the
+* functions are optimized in parallel. The iteration over observers by
+* observer_begin() and observer_end() is not synchronized.
+*
 * @see Observer
 */
 template<typename SubjectType, typename ArgType = SubjectType>
@@ -89,6 +98,7 @@ public:
 	* @param[in] observer Observer to be added.
 	*/
 	void addObserver(ObserverPtr observer) {
+		std::lock_guard<std::mutex> lock(getObserversMutex());
 		observers.push_back(observer);
 	}
 
@@ -105,6 +115,7 @@ public:
 	* @brief Removes all observers.
 	*/
 	void removeObservers() {
+		std::lock_guard<std::mutex> lock(getObserversMutex());
 		observers.clear();
 	}
 
@@ -125,7 +136,7 @@ public:
 	void notifyObservers(ShPtr<ArgType> arg = nullptr) {
 		// We have to iterate over a copy of the container because it can be
 		// modified during the iteration (either by us or in an update() call).
-		for (const auto &observer : ObserverContainer(observers)) {
+		for (const auto &observer : getObserversCopy()) {
 			notifyObserverOrRemoveItIfNotExists(observer, arg);
 		}
 	}
@@ -133,8 +144,10 @@ public:
 protected:
 	/// A container to store observers.
 	// Note that the used container has to preserve the order in which
-	// observers are added to it.
-	using ObserverContainer = std::vector<ObserverPtr>;
+	// observers are added to it. Most subjects (expressions and statements)
+	// have just a single observer (their parent), which is stored inline, so
+	// there is no extra heap allocation per IR node.
+	using ObserverContainer = llvm::SmallVector<ObserverPtr, 1>;
 
 	// Observer iterator.
 	using observer_iterator = typename ObserverContainer::const_iterator;
@@ -155,6 +168,27 @@ protected:
 	}
 
 private:
+	/**
+	* @brief Returns the mutex guarding the observers of this subject.
+	*
+	* To keep subjects small, they share a fixed pool of mutexes instead of
+	* having one mutex each. The mutex is never held while an observer is
+	* notified, so a subject whose observers are being notified can be
+	* modified (even if it shares the mutex with another subject).
+	*/
+	std::mutex &getObserversMutex() const {
+		static std::array<std::mutex, 64> mutexes;
+		auto address = reinterpret_cast<std::uintptr_t>(this);
+		return mutexes[(address / alignof(Subject)) % mutexes.size()];
+	}
+
+	/**
+	* @brief Returns a copy of the list of observers.
+	*/
+	ObserverContainer getObserversCopy() const {
+		std::lock_guard<std::mutex> lock(getObserversMutex());
+		return observers;
+	}
 
 	/**
 	* @brief Notifies the given observer (if it exists) or removes it (if it
@@ -189,11 +223,16 @@ private:
 	* @brief Removes the given observer and all the non-existing observers.
 	*/
 	void removeObserverAndNonExistingObservers(ObserverPtr observer) {
+		std::lock_guard<std::mutex> lock(getObserversMutex());
+		// Observers are compared by their owners rather than by locking them.
+		// A locked observer could be destroyed here (when it is the last owner),
+		// and its destructor must not run while the mutex is held.
 		observers.erase(std::remove_if(observers.begin(), observers.end(),
 			[&observer](const auto &other) {
-				return other.expired() || observer.lock() == other.lock();
+				return other.expired() || (!observer.owner_before(other) &&
+					!other.owner_before(observer));
 			}
-		));
+		), observers.end());
 	}
 
 private:
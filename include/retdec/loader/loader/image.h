@@ -7,7 +7,9 @@
 #ifndef RETDEC_LOADER_RETDEC_LOADER_IMAGE_H
 #define RETDEC_LOADER_RETDEC_LOADER_IMAGE_H
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include "retdec/utils/byte_value_storage.h"
 #include "retdec/fileformat/fftypes.h"
@@ -80,10 +82,25 @@ protected:
 	void removeSegment(Segment* segment);
 	void nameSegment(Segment* segment);
 	void sortSegments();
+	void invalidateSegmentIndex();
 
 	void setStatusMessage(const std::string& message);
 
 private:
+	/**
+	 * Entry of the address index of segments.
+	 */
+	struct SegmentIndexEntry
+	{
+		std::uint64_t start;      ///< Address of the segment.
+		std::uint64_t end;        ///< End address of the segment.
+		std::uint64_t maxEnd;     ///< Maximal end address of this and all preceding entries.
+		std::size_t order;        ///< Position of the segment in the list of segments.
+		const Segment* segment;
+		bool overlapped;          ///< Is the segment overlapped by some other segment?
+	};
+
+	void _buildSegmentIndex() const;
 	const Segment* _getSegment(std::size_t index) const;
 	const Segment* _getSegment(const std::string& name) const;
 	const Segment* _getSegmentWithIndex(std::size_t index) const;
@@ -91,6 +108,10 @@ private:
 
 	std::shared_ptr<retdec::fileformat::FileFormat> _fileFormat;
 	std::vector<std::unique_ptr<Segment>> _segments;
+	mutable std::vector<SegmentIndexEntry> _segmentIndex;
+	mutable std::atomic<bool> _segmentIndexValid;
+	mutable std::mutex _segmentIndexMutex;
+	mutable std::atomic<const Segment*> _lastSegment;
 	std::uint64_t _baseAddress;
 	NameGenerator _namelessSegNameGen;
 	std::string _statusMessage;
@@ -31,9 +31,17 @@ class BreakMachOUniversal
 		bool getByArchFamily(
 				std::uint32_t cpuType,
 				llvm::object::MachOUniversalBinary::object_iterator &res);
+		bool getBestArchive(
+				llvm::object::MachOUniversalBinary::object_iterator &res);
+		bool getArchiveForFamily(
+				const std::string &familyName,
+				llvm::object::MachOUniversalBinary::object_iterator &res);
 		bool extract(
 				llvm::object::MachOUniversalBinary::object_iterator &object,
 				const std::string &outPath);
+		bool extract(
+				llvm::object::MachOUniversalBinary::object_iterator &object,
+				std::vector<std::uint8_t> &data);
 		bool getObjectNamesForArchive(
 				std::uintptr_t archOffset ,
 				std::size_t archSize,
@@ -66,6 +74,11 @@ class BreakMachOUniversal
 		bool extractArchiveForFamily(
 				const std::string &familyName,
 				const std::string &outPath);
+		bool extractBestArchive(
+				std::vector<std::uint8_t> &data);
+		bool extractArchiveForFamily(
+				const std::string &familyName,
+				std::vector<std::uint8_t> &data);
 		bool extractArchiveForArchitecture(
 				const std::string &machoArchName,
 				const std::string &outPath);
@@ -0,0 +1,44 @@
+/**
+ * \file include/retdec/retdec/callback_ostream.h
+ * \brief Output stream that hands the written data to a callback.
+ * \copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#ifndef RETDEC_RETDEC_CALLBACK_OSTREAM_H
+#define RETDEC_RETDEC_CALLBACK_OSTREAM_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include <llvm/Support/raw_ostream.h>
+
+#include "retdec/retdec/retdec.h"
+
+namespace retdec {
+
+/**
+ * Output stream that hands the written data to a callback in chunks of at
+ * most \c BufferSize bytes. It lets the decompilation output be consumed
+ * while it is generated instead of being collected in memory first.
+ */
+class CallbackOstream : public llvm::raw_ostream
+{
+	public:
+		static constexpr std::size_t BufferSize = 64 * 1024;
+
+	public:
+		CallbackOstream(const OutputCallback& callback);
+		~CallbackOstream() override;
+
+	private:
+		void write_impl(const char* ptr, std::size_t size) override;
+		uint64_t current_pos() const override;
+
+	private:
+		const OutputCallback& _callback;
+		uint64_t _pos = 0;
+};
+
+} // namespace retdec
+
+#endif
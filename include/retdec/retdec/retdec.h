@@ -7,6 +7,15 @@
 #ifndef RETDEC_RETDEC_RETDEC_H
 #define RETDEC_RETDEC_RETDEC_H
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <capstone/capstone.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
@@ -17,38 +26,139 @@
 
 namespace retdec {
 
+namespace cpdetect {
+struct ToolInformation;
+} // namespace cpdetect
+namespace fileformat {
+class FileFormat;
+} // namespace fileformat
+
+/**
+ * Result of a disassembly. It owns the module, its context, and all the data
+ * the bin2llvmir providers hold for the module.
+ */
 struct LlvmModuleContextPair
 {
 	LlvmModuleContextPair(LlvmModuleContextPair&&) = default;
-	~LlvmModuleContextPair()
-	{
-		// Order matters: module destructor uses context.
-		module.reset();
-		context.reset();
-	}
+	~LlvmModuleContextPair();
 	std::unique_ptr<llvm::Module> module;
 	std::unique_ptr<llvm::LLVMContext> context;
 };
 
+/**
+ * Flag that stops a running decompilation or disassembly when it is set from
+ * another thread. The work is stopped between two passes, a running pass is
+ * always finished.
+ */
+using CancelFlag = std::atomic<bool>;
+
+/**
+ * Set the process-wide loggers according to \p params. Loggers are replaced
+ * only if \p params ask for a different logging setup (log file, error file,
+ * verbosity) than the previous call, because other decompilations running at
+ * the same time may be using them.
+ */
+void setLogsFrom(const retdec::config::Parameters& params);
+
 /**
  * \param[in]  inputPath Path the the input file to disassemble.
  * \param[out] fs        Set of functions to fill.
+ * \param[in]  cancel    If set, the disassembly is aborted with
+ *                       \c std::runtime_error once \p cancel becomes true.
  * \return Pointer to LLVM module created by the disassembly,
  *         or \c nullptr if the disassembly failed.
+ *
+ * This function may be called concurrently from several threads, see
+ * decompile().
  */
 LlvmModuleContextPair disassemble(
 		const std::string& inputPath,
-		retdec::common::FunctionSet* fs = nullptr
+		retdec::common::FunctionSet* fs = nullptr,
+		const CancelFlag* cancel = nullptr
 );
 
+/**
+ * Names and durations (in seconds) of decompilation phases in the order in
+ * which they were run.
+ */
+using PhaseTimes = std::vector<std::pair<std::string, double>>;
+
+/**
+ * Consumer of a decompilation output. It is called repeatedly with
+ * consecutive chunks of the output (\p data of \p size bytes, not
+ * null-terminated) as the output is generated. It must not throw.
+ */
+using OutputCallback = std::function<void(const char* data, std::size_t size)>;
+
+/**
+ * Input of a decompilation that is already in memory, e.g. because it was
+ * extracted from an archive or unpacked. It is used instead of the input file
+ * from the config. Only the members that are set are used:
+ * - \c fileFormat is the parsed input. If it is not set, \c bytes are parsed.
+ *   If neither of them is set, the input file from the config is parsed.
+ * - \c tools are the tools detected in the input. They are used only with
+ *   \c fileFormat, otherwise the tools are detected during the decompilation.
+ *
+ * If \c fileFormat was parsed from \c bytes, they must be kept here as well.
+ */
+struct DecompilationInput
+{
+	std::vector<std::uint8_t> bytes;
+	std::shared_ptr<retdec::fileformat::FileFormat> fileFormat;
+	std::shared_ptr<const retdec::cpdetect::ToolInformation> tools;
+};
+
 /**
  * Run a decompilation according to a \p config configuration.
  * If \p outString is set, decompilation output will be returned
  * in this string. Otherwise, output file is expected to be set in \p config.
+ * Prefer the overload taking an OutputCallback for large outputs, it does not
+ * keep the whole output in memory.
+ * If \p phaseTimes is set, durations of the decompilation phases are
+ * appended to it.
+ * If \p input is set, it is decompiled instead of the input file from
+ * \p config, see DecompilationInput.
+ *
+ * The passes run one after another on a single thread. The number of threads
+ * from \p config is used only inside the analyses that can run in parallel,
+ * see retdec::config::Parameters::getThreads().
+ *
+ * If a timeout is set in \p config, the decompilation is aborted with
+ * \c std::runtime_error when it expires. The same happens when \p cancel is
+ * set and becomes true. Both are checked between the passes, a running pass
+ * is always finished.
+ *
+ * Thread safety: decompile() and disassemble() may be called concurrently
+ * from several threads, each call with its own \p config and input. Every
+ * call creates its own LLVM context and module, and all the data the
+ * bin2llvmir providers hold for the module are stored in the module's own
+ * bin2llvmir::ProviderContext. The remaining process-wide state (LLVM pass
+ * registry, caches of created types, loggers) is either initialized once or
+ * guarded. Loggers are replaced only if a call asks for a different logging
+ * setup (log file, error file, verbosity) than the previous one, so
+ * concurrent calls should use the same logging parameters.
+ */
+bool decompile(
+		retdec::config::Config& config,
+		std::string* outString = nullptr,
+		PhaseTimes* phaseTimes = nullptr,
+		const DecompilationInput* input = nullptr,
+		const CancelFlag* cancel = nullptr
+);
+
+/**
+ * Run a decompilation according to a \p config configuration and pass its
+ * output to \p output chunk by chunk while it is generated, instead of writing
+ * it into the output file. The output is buffered only up to a fixed chunk
+ * size, so the memory needed for it does not grow with its total size.
+ * Otherwise, it works in the same way as the overload above.
  */
 bool decompile(
 		retdec::config::Config& config,
-		std::string* outString = nullptr
+		const OutputCallback& output,
+		PhaseTimes* phaseTimes = nullptr,
+		const DecompilationInput* input = nullptr,
+		const CancelFlag* cancel = nullptr
 );
 
 } // namespace retdec
@@ -9,6 +9,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -22,6 +23,10 @@ namespace loader {
 	class Image;
 } // namespace loader
 
+namespace yaracpp {
+	class YaraDetector;
+} // namespace yaracpp
+
 namespace stacofin {
 
 struct DetectedFunction;
@@ -141,47 +146,88 @@ class Finder
 
 		DetectedFunctionsMultimap _allDetections;
 		DetectedFunctionsPtrMap _confirmedDetections;
-		DetectedFunctionsPtrMultimap _rejectedDetections;
 
-		struct DetectedFunctionComp
+		/// State of a detection in confirmation.
+		enum class DetectionState : std::uint8_t
+		{
+			WORKLIST,
+			CONFIRMED,
+			REJECTED
+		};
+		/// Detections sorted by address and name, without duplicates, i.e.
+		/// detections with the same address and name as a previous one.
+		std::vector<DetectedFunction*> _detections;
+		/// States of @c _detections.
+		std::vector<DetectionState> _states;
+		/// <detection, index of it or its duplicate in @c _detections>
+		std::unordered_map<const DetectedFunction*, std::size_t> _indexes;
+		/// The biggest size of all the detections.
+		std::size_t _maxDetectionSize = 0;
+
+		/// Reference of some detection, see @c _refIndex.
+		struct RefEntry
 		{
-			bool operator()(
-					const DetectedFunction* a,
-					const DetectedFunction* b) const
+			bool operator<(const RefEntry& o) const
 			{
-				return *a < *b;
+				return target == o.target
+						? *name < *o.name
+						: target < o.target;
 			}
+
+			common::Address target;
+			const std::string* name = nullptr;
+			Reference* ref = nullptr;
 		};
-		std::set<DetectedFunction*, DetectedFunctionComp> _worklistDetections;
+		/// References of all the detections sorted by target and name.
+		std::vector<RefEntry> _refIndex;
 
 	private:
 		using ByteData = typename std::pair<const std::uint8_t*, std::size_t>;
 
+		/// Capstone engine, each thread solving references needs its own.
+		struct Disassembler;
+
 	private:
+		void searchCode(
+				const retdec::loader::Image& image,
+				yaracpp::YaraDetector& detector,
+				const std::string& yaraFile = std::string());
+
 		bool initDisassembler();
+		void initDetections();
+		void initReferenceIndex();
 		void solveReferences();
+		void solveReferences(Disassembler& d, DetectedFunction& f);
 
-		common::Address getAddressFromRef(common::Address ref);
+		common::Address getAddressFromRef(
+				Disassembler& d,
+				common::Address ref);
 		common::Address getAddressFromRef_x86(common::Address ref);
-		common::Address getAddressFromRef_mips(common::Address ref);
-		common::Address getAddressFromRef_arm(common::Address ref);
-		common::Address getAddressFromRef_ppc(common::Address ref);
-
-		void checkRef(Reference& ref);
-		void checkRef_x86(Reference& ref);
-
+		common::Address getAddressFromRef_mips(
+				Disassembler& d,
+				common::Address ref);
+		common::Address getAddressFromRef_arm(
+				Disassembler& d,
+				common::Address ref);
+		common::Address getAddressFromRef_ppc(
+				Disassembler& d,
+				common::Address ref);
+
+		void checkRef(Disassembler& d, Reference& ref);
+		void checkRef_x86(Disassembler& d, Reference& ref);
+
+		bool isInWorklist(const DetectedFunction* f) const;
 		void confirmWithoutRefs();
 		void confirmAllRefsOk(std::size_t minFncSzWithoutRefs = 0x20);
 		void confirmPartialRefsOk(float okShare = 0.5);
-		void confirmFunction(DetectedFunction* f);
+		void confirmFunction(std::size_t i);
 
 	private:
 		const retdec::config::Config* _config = nullptr;
 		const retdec::loader::Image* _image = nullptr;
 
-		csh _ce = 0;
+		cs_arch _ceArch = CS_ARCH_ALL;
 		cs_mode _ceMode = CS_MODE_LITTLE_ENDIAN;
-		cs_insn* _ceInsn = nullptr;
 
 		std::map<common::Address, std::string> _imports;
 		std::set<std::string> _sectionNames;
@@ -7,9 +7,53 @@
 #ifndef RETDEC_UNPACKERTOOL_UNPACKERTOOL_H
 #define RETDEC_UNPACKERTOOL_UNPACKERTOOL_H
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "retdec/cpdetect/cptypes.h"
+#include "retdec/fileformat/file_format/file_format.h"
+
 namespace retdec {
 namespace unpackertool {
 
+/**
+ * Possible exit codes of the unpacker as program.
+ */
+enum ExitCode
+{
+	EXIT_CODE_OK = 0, ///< Unpacker ended successfully.
+	EXIT_CODE_NOTHING_TO_DO, ///< There was not found matching plugin.
+	EXIT_CODE_UNPACKING_FAILED, ///< At least one plugin failed at the unpacking of the file.
+	EXIT_CODE_PREPROCESSING_ERROR, ///< Error with preprocessing of input file before unpacking.
+	EXIT_CODE_MEMORY_LIMIT_ERROR ///< There was an error when setting the memory limit.
+};
+
+/**
+ * Result of unpack().
+ */
+struct UnpackResult
+{
+	/// Result of the unpacking.
+	ExitCode code = EXIT_CODE_PREPROCESSING_ERROR;
+	/// Parsed input file, @c nullptr if it could not be parsed.
+	std::shared_ptr<retdec::fileformat::FileFormat> input;
+	/// Tools detected in the input file, @c nullptr if it could not be parsed.
+	std::shared_ptr<retdec::cpdetect::ToolInformation> inputTools;
+	/// Result of the detection of @c inputTools.
+	retdec::cpdetect::ReturnCode inputToolsStatus
+			= retdec::cpdetect::ReturnCode::FILE_PROBLEM;
+	/// Content of the unpacked file if @c code is @c EXIT_CODE_OK.
+	std::vector<std::uint8_t> unpacked;
+};
+
+UnpackResult unpack(
+		const std::string& inputFile,
+		const std::vector<std::uint8_t>* inputBytes,
+		const std::string& workFile,
+		bool brute = false);
+
 int _main(int argc, char** argv);
 
 } // namespace unpackertool
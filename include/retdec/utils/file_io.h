@@ -123,6 +123,23 @@ template <typename N> bool readFile(
 		desiredSize = FILE_BURST_READ_LENGTH;
 
 	result.clear();
+
+	// Reserve the whole remaining size of seekable streams up front, so that
+	// the result is not reallocated (and temporarily held twice) while
+	// large files are read.
+	if (untilEof)
+	{
+		fileStream.seekg(0, std::ios::end);
+		const auto end = fileStream.tellg();
+		fileStream.clear();
+		fileStream.seekg(start, std::ios::beg);
+		if (!fileStream.good())
+			return false;
+
+		if (end != std::istream::pos_type(-1)
+				&& static_cast<std::size_t>(end) > start)
+			result.reserve(static_cast<std::size_t>(end) - start);
+	}
 	std::size_t alreadyRead = 0;
 	while ((alreadyRead < desiredSize || untilEof) && !fileStream.eof())
 	{
@@ -0,0 +1,142 @@
+/**
+* @file include/retdec/utils/thread_pool.h
+* @brief A simple pool of worker threads.
+* @copyright (c) 2021 Avast Software, licensed under the MIT license
+*/
+
+#ifndef RETDEC_UTILS_THREAD_POOL_H
+#define RETDEC_UTILS_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "retdec/utils/non_copyable.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief A fixed-size pool of worker threads executing submitted tasks.
+*
+* Tasks are executed in FIFO order, but they may finish in any order. A pool
+* with a single thread does not create any worker thread at all; all the tasks
+* are then executed synchronously in the thread that submits them. This makes
+* the serial mode behave exactly like code that does not use the pool.
+*
+* Usage:
+* @code
+* ThreadPool pool(4);
+* std::vector<Result> results(items.size());
+* pool.parallelFor(items.size(), [&](std::size_t i) {
+*     results[i] = process(items[i]);
+* });
+* @endcode
+*/
+class ThreadPool: private NonCopyable {
+public:
+	explicit ThreadPool(std::size_t threads = 0);
+	~ThreadPool();
+
+	std::size_t getThreadCount() const;
+	bool isParallel() const;
+
+	template<typename Function>
+	auto submit(Function &&f) -> std::future<std::invoke_result_t<Function>>;
+	void wait();
+
+	template<typename Function>
+	void parallelFor(std::size_t count, Function &&f);
+
+	static std::size_t getHardwareThreadCount();
+
+private:
+	void enqueue(std::function<void()> task);
+	void workerLoop();
+
+private:
+	/// Number of threads executing tasks (including the synchronous mode).
+	std::size_t threadCount = 1;
+	/// Worker threads.
+	std::vector<std::thread> workers;
+	/// Tasks waiting for execution.
+	std::queue<std::function<void()>> tasks;
+	/// Number of submitted tasks that have not finished yet.
+	std::size_t unfinished = 0;
+	/// Is the pool being destroyed?
+	bool stopping = false;
+
+	std::mutex mutex;
+	std::condition_variable taskAvailable;
+	std::condition_variable allFinished;
+};
+
+/**
+* @brief Submits the given function for execution.
+*
+* @return Future holding the result of the function (or the exception it has
+*         thrown).
+*/
+template<typename Function>
+auto ThreadPool::submit(Function &&f)
+		-> std::future<std::invoke_result_t<Function>> {
+	using Result = std::invoke_result_t<Function>;
+
+	auto task = std::make_shared<std::packaged_task<Result()>>(
+		std::forward<Function>(f)
+	);
+	auto future = task->get_future();
+	enqueue([task]() { (*task)(); });
+	return future;
+}
+
+/**
+* @brief Calls @a f(i) for every @c i in <tt>[0, count)</tt> and waits until
+*        all the calls finish.
+*
+* Indexes are distributed among the threads dynamically, so calls with very
+* different running times are balanced. If any of the calls throws, the first
+* thrown exception (in the order of indexes) is rethrown after all the calls
+* have finished.
+*
+* In the synchronous mode, the calls are done in the increasing order of
+* indexes in the calling thread.
+*
+* Do not call this function from a task running in the same pool; it would
+* wait for tasks that cannot be scheduled.
+*/
+template<typename Function>
+void ThreadPool::parallelFor(std::size_t count, Function &&f) {
+	if (!isParallel() || count < 2) {
+		for (std::size_t i = 0; i < count; ++i) {
+			f(i);
+		}
+		return;
+	}
+
+	std::vector<std::future<void>> futures;
+	futures.reserve(count);
+	for (std::size_t i = 0; i < count; ++i) {
+		futures.push_back(submit([&f, i]() { f(i); }));
+	}
+
+	// Wait for everything before rethrowing so that no task outlives @a f.
+	for (auto &future : futures) {
+		future.wait();
+	}
+	for (auto &future : futures) {
+		future.get();
+	}
+}
+
+} // namespace utils
+} // namespace retdec
+
+#endif
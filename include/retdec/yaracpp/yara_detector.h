@@ -7,6 +7,8 @@
 #ifndef RETDEC_YARACPP_YARA_DETECTOR_H
 #define RETDEC_YARACPP_YARA_DETECTOR_H
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -22,6 +24,11 @@ namespace yaracpp {
 
 /**
  * Interpret of YARA rules
+ *
+ * Rules from files are compiled only once and shared by all the instances
+ * (and threads) while some instance uses them. A few most recently used rules
+ * are kept afterwards (see setCacheCapacity()). If a cache directory is set,
+ * compiled rules are also stored there and reused by other processes.
  */
 class YaraDetector
 {
@@ -70,22 +77,20 @@ class YaraDetector
 		};
 
 	private:
-		/// compiler or text rules
+		/// compiler of text rules added as strings
 		YR_COMPILER *compiler = nullptr;
-		/// representation of files with rules
-		std::vector<FILE*> files;
 		/// representation of detected rules
 		std::vector<YaraRule> detectedRules;
 		/// representation of undetected rules
 		std::vector<YaraRule> undetectedRules;
-		/// rules from input text files
-		YR_RULES* textFilesRules = nullptr;
-		/// rules from precompiled files
-		std::vector<YR_RULES*> precompiledRules;
+		/// rules from input text strings
+		YR_RULES* textRules = nullptr;
+		/// rules from files (shared with other instances)
+		std::vector<std::shared_ptr<YR_RULES>> fileRules;
 		/// internal state of instance
 		bool stateIsValid = true;
-		/// indicates whether text files need recompilation
-		bool needsRecompilation = true;
+		/// indicates whether text strings need recompilation
+		bool needsRecompilation = false;
 
 		/// @name Static auxiliary methods
 		/// @{
@@ -116,7 +121,16 @@ class YaraDetector
 				const std::string &pathToFile,
 				const std::string &nameSpace = std::string()
 		);
+		bool addRuleFiles(const std::vector<std::string> &pathsToFiles);
+		bool addRuleFiles(
+				const std::vector<std::string> &pathsToFiles,
+				const std::vector<std::string> &nameSpaces
+		);
 		bool isInValidState() const;
+		static bool isPrecompiledRuleFile(const std::string &pathToFile);
+		static void setCacheDirectory(const std::string &pathToDirectory);
+		static void setCacheCapacity(std::size_t capacity);
+		static std::size_t getNumberOfCachedRules();
 		/// @}
 
 		/// @name Detection methods
@@ -126,7 +140,12 @@ class YaraDetector
 				bool storeAllRules = false
 		);
 		bool analyze(
-				std::vector<std::uint8_t> &bytes,
+				const std::vector<std::uint8_t> &bytes,
+				bool storeAllRules = false
+		);
+		bool analyze(
+				const std::uint8_t *data,
+				std::size_t size,
 				bool storeAllRules = false
 		);
 		const std::vector<YaraRule>& getDetectedRules() const;
@@ -110,21 +110,30 @@ ArchiveWrapper::ArchiveWrapper(
 	std::string &errorMessage)
 	: buffer(MemoryBuffer::getFile(llvm::Twine(archivePath)))
 {
-	succes = false;
-	if (!buffer) {
-		errorMessage = "Could not create file buffer";
-		return;
-	}
-
-	Error error = Error::success();
-	archive = std::make_unique<Archive>(buffer.get()->getMemBufferRef(), error);
-	if (error) {
-		errorMessage = llvm::toString(std::move(error));
-		return;
-	}
+	init(succes, errorMessage);
+}
 
-	// Get object count - this iterates over all objects.
-	succes = getCount(objectCount, errorMessage);
+/**
+ * Constructor.
+ *
+ * The archive is read directly from @p data, which must outlive the object.
+ *
+ * @param data input archive content
+ * @param size size of @p data
+ * @param succes result of object construction
+ * @param errorMessage possible error message if @p success is set to false
+ */
+ArchiveWrapper::ArchiveWrapper(
+	const std::uint8_t *data,
+	std::size_t size,
+	bool &succes,
+	std::string &errorMessage)
+	: buffer(MemoryBuffer::getMemBuffer(
+		llvm::StringRef(reinterpret_cast<const char*>(data), size),
+		"",
+		false))
+{
+	init(succes, errorMessage);
 }
 
 /**
@@ -312,6 +321,133 @@ bool ArchiveWrapper::extractByName(
 	const std::string &name,
 	std::string &errorMessage,
 	const std::string &outputPath) const
+{
+	llvm::StringRef content;
+	if (!getChildByName(name, content, errorMessage)) {
+		return false;
+	}
+
+	auto path = outputPath.empty() ? name : outputPath;
+	return writeFile(path, content, errorMessage);
+}
+
+/**
+ * Extract object file by its index.
+ *
+ * If output path is not given, object name and current directory is used. If
+ * multiple files with the same name are present, only first one is extracted.
+ *
+ * @param index index of target file
+ * @param errorMessage possible error message if @c false is returned
+ * @param outputPath optional output path
+ *
+ * @return @c true if no errors occurred, @c false otherwise
+ */
+bool ArchiveWrapper::extractByIndex(
+	const std::size_t index,
+	std::string &errorMessage,
+	const std::string &outputPath) const
+{
+	llvm::StringRef content;
+	std::string childName;
+	if (!getChildByIndex(index, content, childName, errorMessage)) {
+		return false;
+	}
+
+	auto path = outputPath.empty() ? childName : outputPath;
+	return writeFile(path, content, errorMessage);
+}
+
+/**
+ * Extract object file by its name into memory.
+ *
+ * If multiple files with the same name are present, only first one is
+ * extracted.
+ *
+ * @param name target name
+ * @param errorMessage possible error message if @c false is returned
+ * @param data extracted content
+ *
+ * @return @c true if no errors occurred, @c false otherwise
+ */
+bool ArchiveWrapper::extractByName(
+	const std::string &name,
+	std::string &errorMessage,
+	std::vector<std::uint8_t> &data) const
+{
+	llvm::StringRef content;
+	if (!getChildByName(name, content, errorMessage)) {
+		return false;
+	}
+
+	data.assign(content.bytes_begin(), content.bytes_end());
+	return true;
+}
+
+/**
+ * Extract object file by its index into memory.
+ *
+ * @param index index of target file
+ * @param errorMessage possible error message if @c false is returned
+ * @param data extracted content
+ *
+ * @return @c true if no errors occurred, @c false otherwise
+ */
+bool ArchiveWrapper::extractByIndex(
+	const std::size_t index,
+	std::string &errorMessage,
+	std::vector<std::uint8_t> &data) const
+{
+	llvm::StringRef content;
+	std::string childName;
+	if (!getChildByIndex(index, content, childName, errorMessage)) {
+		return false;
+	}
+
+	data.assign(content.bytes_begin(), content.bytes_end());
+	return true;
+}
+
+/**
+ * Parse archive from buffer and count its objects.
+ *
+ * @param succes result of initialization
+ * @param errorMessage possible error message if @p success is set to false
+ */
+void ArchiveWrapper::init(
+	bool &succes,
+	std::string &errorMessage)
+{
+	succes = false;
+	if (!buffer) {
+		errorMessage = "Could not create file buffer";
+		return;
+	}
+
+	Error error = Error::success();
+	archive = std::make_unique<Archive>(buffer.get()->getMemBufferRef(), error);
+	if (error) {
+		errorMessage = llvm::toString(std::move(error));
+		return;
+	}
+
+	// Get object count - this iterates over all objects.
+	succes = getCount(objectCount, errorMessage);
+}
+
+/**
+ * Get content of the first object file with the given name.
+ *
+ * @param name target name
+ * @param content content of the object file
+ * @param errorMessage possible error message if @c false is returned
+ *
+ * @return @c true if no errors occurred, @c false otherwise
+ */
+bool ArchiveWrapper::getChildByName(
+	const std::string &name,
+	llvm::StringRef &content,
+	std::string &errorMessage) const
 {
 	Error error = Error::success();
 	for (const auto &child : archive->children(error)) {
@@ -330,16 +466,14 @@ bool ArchiveWrapper::extractByName(
 			continue;
 		}
 
-		// Get buffer and try to write to a file.
 		auto bufferOrErr = child.getBuffer();
 		if (!bufferOrErr) {
 			errorMessage = "Could not get file buffer";
 			return false;
 		}
-		else {
-			auto path = outputPath.empty() ? name : outputPath;
-			return writeFile(path, *bufferOrErr, errorMessage);
-		}
+
+		content = *bufferOrErr;
+		return true;
 	}
 
 	if (checkError(error, errorMessage)) {
@@ -351,21 +485,20 @@ bool ArchiveWrapper::extractByName(
 }
 
 /**
- * Extract object file by its index.
- *
- * If output path is not given, object name and current directory is used. If
- * name cannot be retrieved, name 'invalid_name' is used.
+ * Get content and name of the object file with the given index.
  *
- * @param index target index
+ * @param index index of target file
+ * @param content content of the object file
+ * @param childName name of the object file
  * @param errorMessage possible error message if @c false is returned
- * @param outputPath optional output path
  *
  * @return @c true if no errors occurred, @c false otherwise
  */
-bool ArchiveWrapper::extractByIndex(
+bool ArchiveWrapper::getChildByIndex(
 	const std::size_t index,
-	std::string &errorMessage,
-	const std::string &outputPath) const
+	llvm::StringRef &content,
+	std::string &childName,
+	std::string &errorMessage) const
 {
 	Error error = Error::success();
 	std::size_t counter = 0;
@@ -379,24 +512,16 @@ bool ArchiveWrapper::extractByIndex(
 			continue;
 		}
 
-		// Get buffer and try to write to a file.
 		auto bufferOrErr = child.getBuffer();
 		if (!bufferOrErr) {
 			errorMessage = "Could not get file buffer";
 			return false;
 		}
-		else {
-			std::string path;
-			if (outputPath.empty()) {
-				// No path given - use object name.
-				auto nameOrErr = child.getName();
-				path = nameOrErr ? fixName(nameOrErr->str()) : "invalid_name";
-			}
-			else {
-				path = outputPath;
-			}
-			return writeFile(path, *bufferOrErr, errorMessage);
-		}
+
+		auto nameOrErr = child.getName();
+		childName = nameOrErr ? fixName(nameOrErr->str()) : "invalid_name";
+		content = *bufferOrErr;
+		return true;
 	}
 
 	if (checkError(error, errorMessage)) {
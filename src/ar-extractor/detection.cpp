@@ -111,6 +111,26 @@ bool isArchive(
 	return false;
 }
 
+/**
+ * Check if file content in memory is an archive (normal or thin).
+ *
+ * @param data input file content
+ * @param size size of @p data
+ *
+ * @return @c true if content is an archive, @c false otherwise
+ */
+bool isArchive(
+	const std::uint8_t *data,
+	std::size_t size)
+{
+	if (size < arMagicSize) {
+		return false;
+	}
+
+	std::string start(reinterpret_cast<const char*>(data), arMagicSize);
+	return start == archMagic || start == thinMagic;
+}
+
 /**
  * Check if file is a thin archive.
  *
@@ -4,7 +4,9 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <deque>
 #include <iomanip>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <string>
@@ -16,6 +18,7 @@
 #include <llvm/IR/Instructions.h>
 #include <llvm/Support/raw_ostream.h>
 
+#include "retdec/utils/thread_pool.h"
 #include "retdec/utils/time.h"
 #include "retdec/bin2llvmir/analyses/reaching_definitions.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
@@ -38,15 +41,29 @@ namespace bin2llvmir {
 bool ReachingDefinitionsAnalysis::runOnModule(
 		Module& M,
 		Abi* abi,
-		bool trackFlagRegs)
+		bool trackFlagRegs,
+		std::size_t threads)
 {
 	_trackFlagRegs = trackFlagRegs;
 	_abi = abi;
 	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(&M);
 
 	clear();
-	initializeBasicBlocks(M);
-	run();
+
+	// Create all the entries first, functions are then solved independently.
+	std::vector<std::pair<Function*, FunctionEntry*>> fncs;
+	for (Function& F : M)
+	{
+		fncs.emplace_back(&F, &fncMap[&F]);
+	}
+
+	ThreadPool pool(threads);
+	pool.parallelFor(fncs.size(), [this, &fncs](std::size_t i)
+	{
+		run(*fncs[i].first, *fncs[i].second);
+	});
+
+	LOG << *this << "\n";
 
 	_run = true;
 	return false;
@@ -62,38 +79,41 @@ bool ReachingDefinitionsAnalysis::runOnFunction(
 	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(F.getParent());
 
 	clear();
-	initializeBasicBlocks(F);
-	run();
-
-	_run = true;
-	return false;
-}
-
-void ReachingDefinitionsAnalysis::run()
-{
-	initializeBasicBlocksPrev();
-	initializeKillGenSets();
-	propagate();
-	initializeDefsAndUses();
+	run(F, fncMap[&F]);
 
 	LOG << *this << "\n";
 
-	clearInternal();
+	_run = true;
+	return false;
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Module& M)
+/**
+ * Compute RDA of the function @a F into its empty entry @a fe.
+ * Only @a fe is modified, so different functions can be solved in parallel.
+ */
+void ReachingDefinitionsAnalysis::run(Function& F, FunctionEntry& fe) const
 {
-	for (Function& F : M)
+	if (F.empty())
 	{
-		initializeBasicBlocks(F);
+		return;
 	}
+
+	initializeBasicBlocks(F, fe);
+	initializeBasicBlocksPrev(fe);
+	initializeDefinitionNumbers(fe);
+	initializeKillGenSets(fe);
+	propagate(F, fe);
+	initializeDefsAndUses(fe);
+	clearInternal(fe);
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Function& F)
+void ReachingDefinitionsAnalysis::initializeBasicBlocks(
+		llvm::Function& F,
+		FunctionEntry& fe) const
 {
 	for (BasicBlock& B : F)
 	{
-		BasicBlockEntry bbe(&B, bbMap.size());
+		BasicBlockEntry bbe(&B, fe.bbs.size());
 
 		int insnPos = -1;
 		for (Instruction& I : B)
@@ -200,13 +220,13 @@ void ReachingDefinitionsAnalysis::initializeBasicBlocks(llvm::Function& F)
 			}
 		}
 
-		bbMap[&F][&B] = bbe;
+		fe.bbs[&B] = bbe;
 	}
 }
 
 void ReachingDefinitionsAnalysis::clear()
 {
-	bbMap.clear();
+	fncMap.clear();
 	_run = false;
 }
 
@@ -219,22 +239,22 @@ bool ReachingDefinitionsAnalysis::wasRun() const
  * Clear internal structures used to compute RDA, but not needed to use it once
  * it is computed.
  */
-void ReachingDefinitionsAnalysis::clearInternal()
+void ReachingDefinitionsAnalysis::clearInternal(FunctionEntry& fe) const
 {
-	for (auto& pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : fe.bbs)
 	{
 		BasicBlockEntry& bb = pair.second;
 		bb.defsOut.clear();
 		bb.genDefs.clear();
 		bb.killDefs.clear();
 	}
+	fe.sourceDefs.clear();
 }
 
-void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev()
+void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev(
+		FunctionEntry& fe) const
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : fe.bbs)
 	{
 		auto B = pair.first;
 		auto &entry = pair.second;
@@ -242,63 +262,97 @@ void ReachingDefinitionsAnalysis::initializeBasicBlocksPrev()
 		for (auto PI = pred_begin(B), E = pred_end(B); PI != E; ++PI)
 		{
 			auto* pred = *PI;
-			auto p = pair1.second.find(pred);
+			auto p = fe.bbs.find(pred);
 
-			assert(p != pair1.second.end() && "we should have all BBs stored in bbMap");
+			assert(p != fe.bbs.end() && "we should have all BBs stored in bbs");
 
 			entry.prevBBs.insert( &p->second );
+			p->second.nextBBs.insert( &entry );
 		}
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeKillGenSets()
+/**
+ * Number all the definitions in the function and create sets of definitions
+ * of all the defined sources.
+ */
+void ReachingDefinitionsAnalysis::initializeDefinitionNumbers(
+		FunctionEntry& fe) const
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : fe.bbs)
+	for (Definition& d : pair.second.defs)
 	{
-		pair.second.initializeKillDefSets();
+		d.id = fe.defs.size();
+		fe.defs.push_back(&d);
+	}
+
+	for (auto* d : fe.defs)
+	{
+		auto& sDefs = fe.sourceDefs[d->getSource()];
+		if (sDefs.empty())
+		{
+			sDefs.resize(fe.defs.size());
+		}
+		sDefs.set(d->id);
 	}
 }
 
-void ReachingDefinitionsAnalysis::propagate()
+void ReachingDefinitionsAnalysis::initializeKillGenSets(FunctionEntry& fe) const
 {
-	for (auto &pair1 : bbMap)
+	for (auto& pair : fe.bbs)
 	{
-		const Function* fnc = pair1.first;
+		pair.second.initializeKillDefSets(fe);
+	}
+}
 
-		std::vector<BasicBlockEntry*> workList;
-		workList.reserve(pair1.second.size());
-		ReversePostOrderTraversal<const Function*> RPOT(fnc); // Expensive to create
-		for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
-		{
-			const BasicBlock* bb = *I;
-			auto fIt = pair1.second.find(bb);
-			assert(fIt != pair1.second.end());
-			workList.push_back(&(fIt->second));
+/**
+ * Iterate until a fixed point is reached. Basic blocks start in RPO, then
+ * only successors of basic blocks whose REACH_out changed are revisited.
+ */
+void ReachingDefinitionsAnalysis::propagate(
+		const Function& F,
+		FunctionEntry& fe) const
+{
+	std::deque<BasicBlockEntry*> workList;
+	ReversePostOrderTraversal<const Function*> RPOT(&F); // Expensive to create
+	for (auto I = RPOT.begin(); I != RPOT.end(); ++I)
+	{
+		const BasicBlock* bb = *I;
+		auto fIt = fe.bbs.find(bb);
+		assert(fIt != fe.bbs.end());
+		workList.push_back(&(fIt->second));
+		fIt->second.inWorkList = true;
+	}
 
-			fIt->second.changed = true;
-		}
+	while (!workList.empty())
+	{
+		auto* bbe = workList.front();
+		workList.pop_front();
+		bbe->inWorkList = false;
 
-		bool changed = true;
-		while (changed)
+		if (bbe->initDefsOut())
 		{
-			changed = false;
-
-			for (auto* bbe : workList)
+			for (auto* next : bbe->nextBBs)
 			{
-				changed |= bbe->initDefsOut();
+				if (!next->inWorkList)
+				{
+					next->inWorkList = true;
+					workList.push_back(next);
+				}
 			}
 		}
 	}
 }
 
-void ReachingDefinitionsAnalysis::initializeDefsAndUses()
+void ReachingDefinitionsAnalysis::initializeDefsAndUses(FunctionEntry& fe) const
 {
-	for (auto &pair1 : bbMap)
-	for (auto& pair : pair1.second)
+	for (auto& pair : fe.bbs)
 	{
 		BasicBlockEntry &bb = pair.second;
 
+		// REACH_in[B], computed only if needed.
+		std::optional<BitVector> defsIn;
+
 		for (Use &u : bb.uses)
 		{
 			for (auto dIt = bb.defs.rbegin(); dIt != bb.defs.rend(); ++dIt)
@@ -320,11 +374,26 @@ void ReachingDefinitionsAnalysis::initializeDefsAndUses()
 
 			if (u.defs.empty())
 			{
-				for (auto p : bb.prevBBs)
-				for (auto d : p->defsOut)
+				auto sDefs = fe.sourceDefs.find(u.src);
+				if (sDefs == fe.sourceDefs.end())
+				{
+					continue;
+				}
+
+				if (!defsIn)
 				{
-					if (d->getSource() == u.src)
+					defsIn = BitVector(fe.defs.size());
+					for (auto p : bb.prevBBs)
 					{
+						*defsIn |= p->defsOut;
+					}
+				}
+
+				for (unsigned i : sDefs->second.set_bits())
+				{
+					if (defsIn->test(i))
+					{
+						auto* d = fe.defs[i];
 						d->uses.insert(&u);
 						u.defs.insert(d);
 					}
@@ -338,12 +407,12 @@ const BasicBlockEntry& ReachingDefinitionsAnalysis::getBasicBlockEntry(
 		const Instruction* I) const
 {
 	auto* F = I->getFunction();
-	auto pair1 = bbMap.find(F);
-	assert(pair1 != bbMap.end() && "we do not have this function in bbMap");
+	auto pair1 = fncMap.find(F);
+	assert(pair1 != fncMap.end() && "we do not have this function in fncMap");
 
 	auto* BB = I->getParent();
-	auto pair = pair1->second.find(BB);
-	assert(pair != pair1->second.end() && "we do not have this basic block in bbMap");
+	auto pair = pair1->second.bbs.find(BB);
+	assert(pair != pair1->second.bbs.end() && "we do not have this basic block in fncMap");
 
 	return pair->second;
 }
@@ -370,8 +439,8 @@ const Use* ReachingDefinitionsAnalysis::getUse(const Instruction* I) const
 
 std::ostream& operator<<(std::ostream& out, const ReachingDefinitionsAnalysis& rda)
 {
-	for (auto &pair1 : rda.bbMap)
-	for (auto& pair : pair1.second)
+	for (auto &pair1 : rda.fncMap)
+	for (auto& pair : pair1.second.bbs)
 	{
 		out << pair.second;
 	}
@@ -391,19 +460,26 @@ BasicBlockEntry::BasicBlockEntry(const llvm::BasicBlock* b, std::size_t _id) :
 
 }
 
-void BasicBlockEntry::initializeKillDefSets()
+/**
+ * GEN[B] = the last definition of each source defined in B
+ * KILL[B] = all the definitions (in the function) of sources defined in B
+ */
+void BasicBlockEntry::initializeKillDefSets(const FunctionEntry& fe)
 {
-	killDefs.clear();
-	genDefs.clear();
+	auto n = fe.defs.size();
+	killDefs = BitVector(n);
+	genDefs = BitVector(n);
+	defsOut = BitVector(n);
 
 	for (auto dIt = defs.rbegin(); dIt != defs.rend(); ++dIt)
 	{
 		Definition& d = *dIt;
 
-		bool added = (killDefs.insert(d.getSource())).second;
-		if (added)
+		// Source already killed -> there is a later definition of it.
+		if (!killDefs.test(d.id))
 		{
-			genDefs.insert(&d);
+			killDefs |= fe.sourceDefs.at(d.getSource());
+			genDefs.set(d.id);
 		}
 	}
 }
@@ -411,32 +487,25 @@ void BasicBlockEntry::initializeKillDefSets()
 /**
  * REACH_in[B] = Sum (p in pred[B]) (REACH_out[p])
  * REACH_out[B] = GEN[B] + ( REACH_in[B] - KILL[B] )
+ * @return @c True if REACH_out[B] changed.
  */
 Changed BasicBlockEntry::initDefsOut()
 {
-	auto oldSz = defsOut.size();
-
-	if (defsOut.empty() && !genDefs.empty())
+	BitVector out(genDefs.size());
+	for (auto* p : prevBBs)
 	{
-		defsOut = std::move(genDefs);
+		out |= p->defsOut;
 	}
+	out.reset(killDefs);
+	out |= genDefs;
 
-	for (auto* p : prevBBs)
+	if (out == defsOut)
 	{
-		if (p->changed)
-		{
-			for (auto* d : p->defsOut)
-			{
-				if (killDefs.find(d->getSource()) == killDefs.end())
-				{
-					defsOut.insert(d);
-				}
-			}
-		}
+		return false;
 	}
 
-	changed = oldSz != defsOut.size();
-	return changed;
+	defsOut = std::move(out);
+	return true;
 }
 
 std::string BasicBlockEntry::getName() const
@@ -6,6 +6,8 @@
 
 #include <ostream>
 #include <sstream>
+#include <tuple>
+#include <unordered_map>
 
 #include <llvm/IR/Constants.h>
 #include <llvm/IR/LLVMContext.h>
@@ -27,12 +29,46 @@ using namespace retdec::bin2llvmir::st_match;
 namespace retdec {
 namespace bin2llvmir {
 
+/**
+ * State shared by all the nodes of a single tree construction.
+ */
+struct SymbolicTree::Expansion
+{
+	ReachingDefinitionsAnalysis* rda = nullptr;
+	std::map<llvm::Value*, llvm::Value*>* val2val = nullptr;
+	unsigned maxNodeLevel = 0;
+	bool linear = false;
+
+	using Key = std::tuple<llvm::Value*, llvm::Value*, unsigned>;
+	struct KeyHash
+	{
+		std::size_t operator()(const Key& k) const
+		{
+			auto h = std::hash<llvm::Value*>()(std::get<0>(k));
+			h = h * 31 + std::hash<llvm::Value*>()(std::get<1>(k));
+			return h * 31 + std::get<2>(k);
+		}
+	};
+
+	/// Subtrees that have already been expanded during this construction,
+	/// keyed by value, user, and the number of levels left to expand.
+	std::unordered_set<Key, KeyHash> reached;
+	/// Subtrees that have been reached more than once. Reaching definitions
+	/// often lead to the same definition through different paths. Such
+	/// subtrees are copied instead of expanded again. Subtrees reached only
+	/// once are not copied at all.
+	std::unordered_map<Key, SymbolicTree, KeyHash> expanded;
+};
+
 SymbolicTree SymbolicTree::PrecomputedRda(
 		ReachingDefinitionsAnalysis& rda,
 		llvm::Value* v,
 		unsigned maxNodeLevel)
 {
-	return SymbolicTree(&rda, v, nullptr, 0, maxNodeLevel, nullptr, false);
+	Expansion e;
+	e.rda = &rda;
+	e.maxNodeLevel = maxNodeLevel;
+	return SymbolicTree(e, v, nullptr, 0);
 }
 
 SymbolicTree SymbolicTree::PrecomputedRdaWithValueMap(
@@ -42,42 +78,46 @@ SymbolicTree SymbolicTree::PrecomputedRdaWithValueMap(
 		unsigned maxNodeLevel)
 {
 	_val2valUsed = false;
-	return SymbolicTree(&rda, v, nullptr, 0, maxNodeLevel, val2val, false);
+	Expansion e;
+	e.rda = &rda;
+	e.val2val = val2val;
+	e.maxNodeLevel = maxNodeLevel;
+	return SymbolicTree(e, v, nullptr, 0);
 }
 
 SymbolicTree SymbolicTree::OnDemandRda(
 		llvm::Value* v,
 		unsigned maxNodeLevel)
 {
-	return SymbolicTree(nullptr, v, nullptr, 0, maxNodeLevel, nullptr, false);
+	Expansion e;
+	e.maxNodeLevel = maxNodeLevel;
+	return SymbolicTree(e, v, nullptr, 0);
 }
 
 SymbolicTree SymbolicTree::Linear(
 		llvm::Value* v,
 		unsigned maxNodeLevel)
 {
-	return SymbolicTree(nullptr, v, nullptr, 0, maxNodeLevel, nullptr, true);
+	Expansion e;
+	e.maxNodeLevel = maxNodeLevel;
+	e.linear = true;
+	return SymbolicTree(e, v, nullptr, 0);
 }
 
 SymbolicTree::SymbolicTree(
-		ReachingDefinitionsAnalysis* rda,
+		Expansion& e,
 		llvm::Value* v,
 		llvm::Value* u,
-		unsigned nodeLevel,
-		unsigned maxNodeLevel,
-		std::map<llvm::Value*, llvm::Value*>* val2val,
-		bool linear)
+		unsigned nodeLevel)
 		:
 		value(v),
 		user(u),
 		_level(nodeLevel)
 {
-	ops.reserve(_naryLimit);
-
-	if (val2val)
+	if (e.val2val)
 	{
-		auto fIt = val2val->find(value);
-		if (fIt != val2val->end())
+		auto fIt = e.val2val->find(value);
+		if (fIt != e.val2val->end())
 		{
 			value = fIt->second;
 			_val2valUsed = true;
@@ -85,12 +125,30 @@ SymbolicTree::SymbolicTree(
 		}
 	}
 
-	if (getLevel() == maxNodeLevel)
+	if (getLevel() == e.maxNodeLevel)
 	{
 		return;
 	}
 
-	expandNode(rda, val2val, maxNodeLevel, linear);
+	auto key = std::make_tuple(v, u, e.maxNodeLevel - nodeLevel);
+	auto fIt = e.expanded.find(key);
+	if (fIt != e.expanded.end())
+	{
+		value = fIt->second.value;
+		user = fIt->second.user;
+		// Trees are not copy-assignable, copy the operands into a new vector.
+		ops = std::vector<SymbolicTree>(fIt->second.ops);
+		fixLevel();
+		return;
+	}
+
+	ops.reserve(_naryLimit);
+	expandNode(e);
+
+	if (!ops.empty() && !e.reached.insert(key).second)
+	{
+		e.expanded.emplace(key, *this);
+	}
 }
 
 unsigned SymbolicTree::getLevel() const
@@ -138,12 +196,11 @@ bool SymbolicTree::operator!=(const SymbolicTree& o) const
 	return !(*this == o);
 }
 
-void SymbolicTree::expandNode(
-		ReachingDefinitionsAnalysis* RDA,
-		std::map<llvm::Value*, llvm::Value*>* val2val,
-		unsigned maxNodeLevel,
-		bool linear)
+void SymbolicTree::expandNode(Expansion& e)
 {
+	auto* RDA = e.rda;
+	bool linear = e.linear;
+
 	if (auto* l = dyn_cast<LoadInst>(value))
 	{
 		if (!_trackThroughAllocaLoads
@@ -178,13 +235,10 @@ void SymbolicTree::expandNode(
 				if (s && s->getPointerOperand() == l->getPointerOperand())
 				{
 					ops.emplace_back(
-							RDA,
+							e,
 							s,
 							l,
-							getLevel() + 1,
-							maxNodeLevel,
-							val2val,
-							linear);
+							getLevel() + 1);
 					break;
 				}
 
@@ -209,26 +263,20 @@ void SymbolicTree::expandNode(
 			{
 // TODO!!! replace with invalid tree
 				ops.emplace_back(
-						RDA,
+						e,
 						UndefValue::get(l->getType()),
 						l,
-						getLevel() + 1,
-						maxNodeLevel,
-						val2val,
-						linear);
+						getLevel() + 1);
 				return;
 			}
 			else
 			for (auto* d : defs)
 			{
 				ops.emplace_back(
-						RDA,
+						e,
 						d->def,
 						l,
-						getLevel() + 1,
-						maxNodeLevel,
-						val2val,
-						linear);
+						getLevel() + 1);
 			}
 		}
 		else
@@ -238,26 +286,20 @@ void SymbolicTree::expandNode(
 			{
 // TODO!!! replace with invalid tree
 				ops.emplace_back(
-						RDA,
+						e,
 						UndefValue::get(l->getType()),
 						l,
-						getLevel() + 1,
-						maxNodeLevel,
-						val2val,
-						linear);
+						getLevel() + 1);
 				return;
 			}
 
 			for (auto* d : defs)
 			{
 				ops.emplace_back(
-						RDA,
+						e,
 						d,
 						l,
-						getLevel() + 1,
-						maxNodeLevel,
-						val2val,
-						linear);
+						getLevel() + 1);
 			}
 		}
 
@@ -265,13 +307,10 @@ void SymbolicTree::expandNode(
 		if (!linear && ops.empty())
 		{
 			ops.emplace_back(
-					RDA,
+					e,
 					l->getPointerOperand(),
 					l,
-					getLevel() + 1,
-					maxNodeLevel,
-					val2val,
-					linear);
+					getLevel() + 1);
 		}
 	}
 	else if (auto* s = dyn_cast<StoreInst>(value))
@@ -279,24 +318,18 @@ void SymbolicTree::expandNode(
 		if (_simplifyAtCreation)
 		{
 			*this = SymbolicTree(
-					RDA,
+					e,
 					s->getValueOperand(),
 					s,
-					getLevel(),
-					maxNodeLevel,
-					val2val,
-					linear);
+					getLevel());
 		}
 		else
 		{
 			ops.emplace_back(
-					RDA,
+					e,
 					s->getValueOperand(),
 					s,
-					getLevel() + 1,
-					maxNodeLevel,
-					val2val,
-					linear);
+					getLevel() + 1);
 		}
 	}
 	else if (isa<AllocaInst>(value)
@@ -314,26 +347,20 @@ void SymbolicTree::expandNode(
 	{
 		auto* U = cast<User>(value);
 		*this = SymbolicTree(
-				RDA,
+				e,
 				U->getOperand(0),
 				U,
-				getLevel(),
-				maxNodeLevel,
-				val2val,
-				linear);
+				getLevel());
 	}
 	else if (User* U = dyn_cast<User>(value))
 	{
 		for (unsigned i = 0; i < U->getNumOperands(); ++i)
 		{
 			ops.emplace_back(
-					RDA,
+					e,
 					U->getOperand(i),
 					U,
-					getLevel() + 1,
-					maxNodeLevel,
-					val2val,
-					linear);
+					getLevel() + 1);
 		}
 	}
 }
@@ -699,14 +726,14 @@ bool SymbolicTree::isNary(unsigned N) const
 //==============================================================================
 //
 
-Abi* SymbolicTree::_abi = nullptr;
-Config* SymbolicTree::_config = nullptr;
-bool SymbolicTree::_val2valUsed = false;
-bool SymbolicTree::_trackThroughAllocaLoads = true;
-bool SymbolicTree::_trackThroughGeneralRegisterLoads = true;
-bool SymbolicTree::_trackOnlyFlagRegisters = false;
-bool SymbolicTree::_simplifyAtCreation = true;
-unsigned SymbolicTree::_naryLimit = 3;
+thread_local Abi* SymbolicTree::_abi = nullptr;
+thread_local Config* SymbolicTree::_config = nullptr;
+thread_local bool SymbolicTree::_val2valUsed = false;
+thread_local bool SymbolicTree::_trackThroughAllocaLoads = true;
+thread_local bool SymbolicTree::_trackThroughGeneralRegisterLoads = true;
+thread_local bool SymbolicTree::_trackOnlyFlagRegisters = false;
+thread_local bool SymbolicTree::_simplifyAtCreation = true;
+thread_local unsigned SymbolicTree::_naryLimit = 3;
 
 void SymbolicTree::clear()
 {
@@ -7,6 +7,7 @@
 
 #include "retdec/bin2llvmir/optimizations/asm_inst_remover/asm_inst_remover.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/capstone_insn_store.h"
 #include "retdec/bin2llvmir/providers/names.h"
 
 using namespace llvm;
@@ -75,12 +76,7 @@ bool AsmInstructionRemover::run(Module& M)
 
 	// Free Capstone instructions.
 	//
-	auto& insnMap = AsmInstruction::getLlvmToCapstoneInsnMap(&M);
-	for (auto& p : insnMap)
-	{
-		cs_free(p.second, 1);
-	}
-	insnMap.clear();
+	AsmInstruction::getCapstoneInsnStore(&M).clear();
 
 	// Remove special global variable.
 	//
@@ -64,7 +64,12 @@ bool CondBranchOpt::run()
 	bool changed = false;
 
 	ReachingDefinitionsAnalysis RDA;
-	RDA.runOnModule(*_module, _abi, true);
+	RDA.runOnModule(
+			*_module,
+			_abi,
+			true,
+			_config->getConfig().parameters.getThreads()
+	);
 
 	SymbolicTree::setTrackThroughAllocaLoads(false);
 	SymbolicTree::setTrackOnlyFlagRegisters(true);
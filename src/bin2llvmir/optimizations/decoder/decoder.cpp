@@ -54,7 +54,6 @@ bool Decoder::runOnModule(llvm::Module& m)
 	_debug = DebugFormatProvider::getDebugFormat(_module);
 	_names = NamesProvider::getNames(_module);
 	_abi = AbiProvider::getAbi(_module);
-	_llvm2capstone = &AsmInstruction::getLlvmToCapstoneInsnMap(_module);
 	return runCatcher();
 }
 
@@ -72,7 +71,6 @@ bool Decoder::runOnModuleCustom(
 	_debug = d;
 	_names = n;
 	_abi = a;
-	_llvm2capstone = &AsmInstruction::getLlvmToCapstoneInsnMap(_module);
 	return runCatcher();
 }
 
@@ -148,7 +146,8 @@ void Decoder::decode()
 	JumpTarget jt;
 	while (getJumpTarget(jt))
 	{
-		LOG << "\t" << "processing : " << jt << std::endl;
+		LOG << "\t" << "processing : " << _jumpTargets.toString(jt)
+				<< std::endl;
 		decodeJumpTarget(jt);
 	}
 
@@ -168,11 +167,14 @@ bool Decoder::getJumpTarget(JumpTarget& jt)
 	}
 	else if (!_ranges.primaryEmpty())
 	{
-		jt = JumpTarget(
-				_ranges.primaryFront().getStart(),
-				JumpTarget::eType::LEFTOVER,
-				_c2l->getBasicMode(),
-				Address());
+		Address a = _ranges.primaryFront().getStart();
+		cs_mode m = _c2l->getBasicMode();
+		if (_config->getConfig().architecture.isArm32OrThumb() && a % 2)
+		{
+			m = CS_MODE_THUMB;
+			a -= 1;
+		}
+		jt = JumpTarget(a, JumpTarget::eType::LEFTOVER, m, Address());
 		return true;
 	}
 	return false;
@@ -326,7 +328,7 @@ void Decoder::decodeJumpTarget(const JumpTarget& jt)
 		}
 		_somethingDecoded = true;
 
-		_llvm2capstone->emplace(res.llvmInsn, res.capstoneInsn);
+		addCapstoneInsn(res);
 
 		bbEnd |= getJumpTargetsFromInstruction(oldAddr, res, bytes.second);
 		bbEnd |= instructionBreaksBasicBlock(oldAddr, res);
@@ -365,6 +367,19 @@ Decoder::translate(ByteData& bytes, common::Address& addr, llvm::IRBuilder<>& ir
 	return res;
 }
 
+/**
+ * Hand the Capstone instruction of translation result @a tr over to the
+ * module. It is stored together with the mode the translator currently uses,
+ * so that it can be decoded again later.
+ */
+void Decoder::addCapstoneInsn(
+		capstone2llvmir::Capstone2LlvmIrTranslator::TranslationResultOne& tr)
+{
+	auto mode = static_cast<cs_mode>(
+			_c2l->getBasicMode() | _c2l->getExtraMode());
+	AsmInstruction::addCapstoneInsn(_module, tr.llvmInsn, tr.capstoneInsn, mode);
+}
+
 /**
  * Check if the given jump targets and bytes can/should be decoded.
  * \return The number of bytes to skip from decoding. If zero, then dry run was
@@ -1402,7 +1417,7 @@ void Decoder::handleDelaySlotTypical(
 		{
 			break;
 		}
-		_llvm2capstone->emplace(r.llvmInsn, r.capstoneInsn);
+		addCapstoneInsn(r);
 	}
 
 	irb.SetInsertPoint(oldIp);
@@ -1459,7 +1474,7 @@ void Decoder::handleDelaySlotLikely(
 			{
 				break;
 			}
-			_llvm2capstone->emplace(res.llvmInsn, res.capstoneInsn);
+			addCapstoneInsn(res);
 		}
 
 		_likelyBb2Target.emplace(newBb, target);
@@ -5,6 +5,7 @@
 */
 
 #include "retdec/bin2llvmir/optimizations/decoder/decoder.h"
+#include "retdec/bin2llvmir/providers/capstone_insn_store.h"
 #include "retdec/utils/string.h"
 
 #include "retdec/loader/loader/elf/elf_image.h"
@@ -84,6 +85,11 @@ void Decoder::initTranslator()
 			_module,
 			basicMode,
 			extraMode);
+
+	// Capstone instructions of the module are decoded again on demand.
+	AsmInstruction::getCapstoneInsnStore(_module).setEngine(
+			arch,
+			static_cast<cs_mode>(basicMode | extraMode));
 }
 
 /**
@@ -182,8 +188,7 @@ void Decoder::initEnvironmentRegisters()
  */
 void Decoder::initRanges()
 {
-	JumpTarget::config = _config;
-	JumpTargets::config = _config;
+	_jumpTargets.setConfig(_config);
 
 	auto& arch = _config->getConfig().architecture;
 	unsigned a = 0;
@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <sstream>
+
 #include "retdec/bin2llvmir/optimizations/decoder/jump_targets.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
@@ -18,8 +20,6 @@ namespace bin2llvmir {
 //==============================================================================
 //
 
-Config* JumpTarget::config = nullptr;
-
 JumpTarget::JumpTarget()
 {
 
@@ -38,11 +38,7 @@ JumpTarget::JumpTarget(
 		_fromAddress(f),
 		_mode(m)
 {
-	if (config->getConfig().architecture.isArm32OrThumb() && _address % 2)
-	{
-		_mode = CS_MODE_THUMB;
-		_address -= 1;
-	}
+
 }
 
 bool JumpTarget::operator<(const JumpTarget& o) const
@@ -99,8 +95,60 @@ void JumpTarget::setMode(cs_mode m) const
 	_mode = m;
 }
 
-std::ostream& operator<<(std::ostream &out, const JumpTarget& jt)
+//
+//==============================================================================
+// JumpTargets
+//==============================================================================
+//
+
+void JumpTargets::setConfig(Config* c)
+{
+	_config = c;
+}
+
+const JumpTarget* JumpTargets::push(
+		retdec::common::Address a,
+		JumpTarget::eType t,
+		cs_mode m,
+		retdec::common::Address f,
+		std::optional<std::size_t> sz)
+{
+	auto& arch = _config->getConfig().architecture;
+
+	if (arch.isArm64() && m == CS_MODE_THUMB)
+	{
+		m = CS_MODE_ARM;
+	}
+
+	if (a.isDefined())
+	{
+		if (arch.isArm32OrThumb() && a % 2)
+		{
+			m = CS_MODE_THUMB;
+			a -= 1;
+		}
+
+		if ((arch.isArm32OrThumb() && m == CS_MODE_ARM && a % 4)
+				|| (arch.isArm32OrThumb() && m == CS_MODE_THUMB && a % 2)
+				|| (arch.isArm64() && a % 4)
+				|| (arch.isMipsOrPic32() && a % 4)
+				|| (arch.isPpc() && a % 4))
+		{
+			LOG << "\t\t" << "[-] JT not aligned @ " << a << std::endl;
+		}
+		else
+		{
+			LOG << "\t\t" << "[+] JT @ " << a << std::endl;
+			return &(*_data.emplace(a, t, m, f, sz).first);
+		}
+	}
+
+	return nullptr;
+}
+
+std::string JumpTargets::toString(const JumpTarget& jt) const
 {
+	std::stringstream out;
 	std::string t;
 	switch (jt.getType())
 	{
@@ -157,7 +205,7 @@ std::ostream& operator<<(std::ostream &out, const JumpTarget& jt)
 
 	out << jt.getAddress() << " (" << t << ")";
 
-	auto& arch = jt.config->getConfig().architecture;
+	auto& arch = _config->getConfig().architecture;
 	out << " (" << capstone_utils::mode2string(arch, jt.getMode()) << ")";
 
 	if (jt.getFromAddress().isDefined())
@@ -169,55 +217,7 @@ std::ostream& operator<<(std::ostream &out, const JumpTarget& jt)
 		out << ", size = " << jt.getSize().value();
 	}
 
-	return out;
-}
-
-//
-//==============================================================================
-// JumpTargets
-//==============================================================================
-//
-
-Config* JumpTargets::config = nullptr;
-
-const JumpTarget* JumpTargets::push(
-		retdec::common::Address a,
-		JumpTarget::eType t,
-		cs_mode m,
-		retdec::common::Address f,
-		std::optional<std::size_t> sz)
-{
-	auto& arch = config->getConfig().architecture;
-
-	if (arch.isArm64() && m == CS_MODE_THUMB)
-	{
-		m = CS_MODE_ARM;
-	}
-
-	if (a.isDefined())
-	{
-		if (arch.isArm32OrThumb() && a % 2)
-		{
-			m = CS_MODE_THUMB;
-			a -= 1;
-		}
-
-		if ((arch.isArm32OrThumb() && m == CS_MODE_ARM && a % 4)
-				|| (arch.isArm32OrThumb() && m == CS_MODE_THUMB && a % 2)
-				|| (arch.isArm64() && a % 4)
-				|| (arch.isMipsOrPic32() && a % 4)
-				|| (arch.isPpc() && a % 4))
-		{
-			LOG << "\t\t" << "[-] JT not aligned @ " << a << std::endl;
-		}
-		else
-		{
-			LOG << "\t\t" << "[+] JT @ " << a << std::endl;
-			return &(*_data.emplace(a, t, m, f, sz).first);
-		}
-	}
-
-	return nullptr;
+	return out.str();
 }
 
 std::size_t JumpTargets::size() const
@@ -260,7 +260,7 @@ std::ostream& operator<<(std::ostream &out, const JumpTargets& jts)
 	out << "Jump targets:" << std::endl;
 	for (auto& jt : jts._data)
 	{
-		out << "\t" << jt << std::endl;
+		out << "\t" << jts.toString(jt) << std::endl;
 	}
 	return out;
 }
@@ -11,23 +11,256 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
+/**
+ * Create instruction idioms analysis for the given module, compiler and
+ * architecture. Only idioms produced by the compiler for the architecture
+ * are going to be searched for.
+ */
+IdiomsAnalysis::IdiomsAnalysis(llvm::Module * M, CC_compiler cc, CC_arch arch)
+{
+	init(M, cc, arch);
+	initIdioms();
+}
+
+/**
+ * Build the list of basic-block idioms enabled for the current compiler and
+ * architecture, together with opcodes of their root instructions.
+ */
+void IdiomsAnalysis::initIdioms()
+{
+	/*
+	 * Instruction idioms are inspected in a tree of Instructions. Every
+	 * instruction idiom has to be called on a basic block. Position of
+	 * instruction idiom exchangers is IMPORTANT! More complicated instruction
+	 * idioms have to be exchanged before simplier ones. They can consist of
+	 * other instruction idioms (the simple ones), so they have to be exchanged
+	 * at first place!
+	 */
+	CC_compiler cc = getCompiler();
+	CC_arch arch = getArch();
+
+	m_idioms.clear();
+	auto add = [this](Exchanger exchanger, const char * name,
+			std::initializer_list<unsigned> opcodes) {
+		Idiom idiom;
+		idiom.exchanger = exchanger;
+		idiom.name = name;
+		for (auto opcode : opcodes)
+			idiom.rootOpcodes.set(opcode);
+		m_idioms.push_back(idiom);
+	};
+
+	if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_x86 || arch == ARCH_THUMB || arch == ARCH_ANY)
+		if (cc == CC_GCC || cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY) {
+			add(&IdiomsMagicDivMod::signedMod1,
+					"IdiomsMagicDivMod::signedMod1", {Instruction::Add});
+
+			add(&IdiomsMagicDivMod::signedMod2,
+					"IdiomsMagicDivMod::signedMod2", {Instruction::Add});
+
+			add(&IdiomsMagicDivMod::magicUnsignedDiv2,
+					"IdiomsMagicDivMod::magicUnsignedDiv2", {Instruction::LShr});
+
+			add(&IdiomsMagicDivMod::magicUnsignedDiv1,
+					"IdiomsMagicDivMod::magicUnsignedDiv1", {Instruction::Trunc});
+
+			add(&IdiomsMagicDivMod::magicSignedDiv1,
+					"IdiomsMagicDivMod::magicSignedDiv1", {Instruction::Sub});
+
+			add(&IdiomsMagicDivMod::magicSignedDiv2,
+					"IdiomsMagicDivMod::magicSignedDiv2", {Instruction::Sub});
+
+			add(&IdiomsMagicDivMod::magicSignedDiv3,
+					"IdiomsMagicDivMod::magicSignedDiv3", {Instruction::Sub});
+
+			add(&IdiomsMagicDivMod::magicSignedDiv4,
+					"IdiomsMagicDivMod::magicSignedDiv4", {Instruction::Sub});
+
+			add(&IdiomsMagicDivMod::magicSignedDiv5,
+					"IdiomsMagicDivMod::magicSignedDiv5", {Instruction::Sub});
+
+			add(&IdiomsMagicDivMod::magicSignedDiv6,
+					"IdiomsMagicDivMod::magicSignedDiv6", {Instruction::Sub});
+
+			// Found in PowerPC - div 10
+			add(&IdiomsMagicDivMod::magicSignedDiv7pos,
+					"IdiomsMagicDivMod::magicSignedDiv7pos", {Instruction::Sub});
+
+			// Found in PowerPC - the same as previous, but the divisor
+			// is negative, i.e. div -10
+			add(&IdiomsMagicDivMod::magicSignedDiv7neg,
+					"IdiomsMagicDivMod::magicSignedDiv7neg", {Instruction::Sub});
+
+			// Found in PowerPC - div 6
+			add(&IdiomsMagicDivMod::magicSignedDiv8pos,
+					"IdiomsMagicDivMod::magicSignedDiv8pos", {Instruction::Sub});
+
+			// Found in PowerPC - the same as previous, but the divisor
+			// is negative, i.e. div -3
+			add(&IdiomsMagicDivMod::magicSignedDiv8neg,
+					"IdiomsMagicDivMod::magicSignedDiv8neg", {Instruction::Sub});
+
+			add(&IdiomsMagicDivMod::unsignedMod,
+					"IdiomsMagicDivMod::unsignedMod", {Instruction::Sub});
+	}
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		add(&IdiomsGCC::exchangeSignedModuloByTwo,
+				"IdiomsGCC::exchangeSignedModuloByTwo", {Instruction::Sub});
+
+	// PowerPC model lacks FPU and x86 uses x87.
+	if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
+		if (cc == CC_GCC || cc == CC_ANY)
+			add(&IdiomsGCC::exchangeCopysign,
+					"IdiomsGCC::exchangeCopysign", {Instruction::Or});
+
+	// PowerPC model lacks FPU and x86 uses x87.
+	if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
+		if (cc == CC_GCC || cc == CC_ANY)
+			add(&IdiomsGCC::exchangeFloatAbs,
+					"IdiomsGCC::exchangeFloatAbs", {Instruction::And});
+
+	if (arch == ARCH_x86 || arch == ARCH_ANY)
+		if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
+			add(&IdiomsVStudio::exchangeOrMinusOneAssign,
+					"IdiomsVStudio::exchangeOrMinusOneAssign", {Instruction::Or});
+
+	if (arch == ARCH_x86 || arch == ARCH_ANY)
+		if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
+			add(&IdiomsVStudio::exchangeAndZeroAssign,
+					"IdiomsVStudio::exchangeAndZeroAssign", {Instruction::And});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		add(&IdiomsGCC::exchangeCondBitShiftDiv1,
+				"IdiomsGCC::exchangeCondBitShiftDiv1", {Instruction::AShr});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		add(&IdiomsGCC::exchangeCondBitShiftDiv2,
+				"IdiomsGCC::exchangeCondBitShiftDiv2", {Instruction::Sub});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		add(&IdiomsGCC::exchangeCondBitShiftDiv3,
+				"IdiomsGCC::exchangeCondBitShiftDiv3", {Instruction::Sub});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
+		add(&IdiomsCommon::exchangeSignedModulo2n,
+				"IdiomsCommon::exchangeSignedModulo2n", {Instruction::Sub});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_Intel || cc == CC_ANY)
+		add(&IdiomsCommon::exchangeGreaterEqualZero,
+				"IdiomsCommon::exchangeGreaterEqualZero",
+				{Instruction::Xor, Instruction::LShr});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
+		add(&IdiomsGCC::exchangeXorMinusOne,
+				"IdiomsGCC::exchangeXorMinusOne", {Instruction::Xor});
+
+	if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
+		if (cc == CC_GCC || cc == CC_ANY)
+			add(&IdiomsCommon::exchangeDivByMinusTwo,
+					"IdiomsCommon::exchangeDivByMinusTwo", {Instruction::Sub});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_ANY)
+		add(&IdiomsCommon::exchangeLessThanZero,
+				"IdiomsCommon::exchangeLessThanZero", {Instruction::LShr});
+
+	// PowerPC model lacks FPU and x86 uses x87.
+	if (cc == CC_GCC || cc == CC_ANY)
+		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
+			add(&IdiomsGCC::exchangeFloatNeg,
+					"IdiomsGCC::exchangeFloatNeg", {Instruction::Xor});
+
+	// all arch
+	if (cc == CC_GCC || cc == CC_ANY)
+		add(&IdiomsCommon::exchangeUnsignedModulo2n,
+				"IdiomsCommon::exchangeUnsignedModulo2n", {Instruction::And});
+
+	// all arch
+	if (cc == CC_LLVM || cc == CC_ANY)
+		add(&IdiomsLLVM::exchangeIsGreaterThanMinusOne,
+				"IdiomsLLVM::exchangeIsGreaterThanMinusOne", {Instruction::ICmp});
+
+	// all arch
+	// all compilers
+	add(&IdiomsCommon::exchangeBitShiftSDiv1,
+			"IdiomsCommon::exchangeBitShiftSDiv1", {Instruction::Or});
+
+	// all arch
+	// all compilers
+	add(&IdiomsCommon::exchangeBitShiftUDiv,
+			"IdiomsCommon::exchangeBitShiftUDiv", {Instruction::LShr});
+
+	// all arch
+	// all compilers
+	add(&IdiomsCommon::exchangeBitShiftMul,
+			"IdiomsCommon::exchangeBitShiftMul", {Instruction::Shl});
+
+	// all arch
+	if (cc == CC_LLVM || cc == CC_ANY) {
+		add(&IdiomsLLVM::exchangeIsGreaterThanMinusOne,
+				"IdiomsLLVM::exchangeIsGreaterThanMinusOne", {Instruction::ICmp});
+	}
+
+	// all arch
+	if (cc == CC_LLVM || cc == CC_ANY) {
+		add(&IdiomsLLVM::exchangeCompareEq,
+				"IdiomsLLVM::exchangeCompareEq", {Instruction::Xor});
+
+#if 0
+		/* We do not recognize this well */
+		add(&IdiomsLLVM::exchangeCompareNeq,
+				"IdiomsLLVM::exchangeCompareNeq", {Instruction::Xor});
+#endif
+
+		add(&IdiomsLLVM::exchangeCompareSlt,
+				"IdiomsLLVM::exchangeCompareSlt", {Instruction::And});
+
+		add(&IdiomsLLVM::exchangeCompareSle,
+				"IdiomsLLVM::exchangeCompareSle", {Instruction::Or});
+	}
+}
+
+/**
+ * Get opcodes of all the instructions in the given BasicBlock
+ */
+IdiomsAnalysis::OpcodeSet IdiomsAnalysis::getOpcodes(llvm::BasicBlock & bb)
+{
+	OpcodeSet opcodes;
+	for (Instruction & insn : bb)
+		opcodes.set(insn.getOpcode());
+	return opcodes;
+}
+
 /**
  * Analyse given BasicBlock and use instruction exchanger to transform
  * instruction idioms
  *
+ * The exchanger is called only on instructions whose opcode is one of root
+ * opcodes of the idiom. It would not match any other instruction.
+ *
  * @param bb BasicBlock to analyse
- * @param exchanger instruction idiom exchanger
- * @param fname instruction idiom exchanger name (for debug purpose only)
+ * @param idiom instruction idiom to search for
  */
-bool IdiomsAnalysis::analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsAnalysis::*exchanger)(llvm::BasicBlock::iterator) const, const char * fname) {
+bool IdiomsAnalysis::analyse(llvm::BasicBlock & bb, const Idiom & idiom) {
 	bool change_made = false;
 
 	for (BasicBlock::iterator iter = bb.begin(), end = bb.end(); iter != end; /**/) {
 		BasicBlock::iterator insn = iter;
 		++iter; // go to next instruction to use valid iterator in next loop
 
-		// call exchanger on every instruction
-		Instruction * res = (this->*exchanger)(insn);
+		if (! idiom.rootOpcodes.test((*insn).getOpcode()))
+			continue;
+
+		// call exchanger on every possible root instruction
+		Instruction * res = (this->*idiom.exchanger)(insn);
 
 		if (res) {
 			change_made = true;
@@ -57,23 +290,18 @@ bool IdiomsAnalysis::analyse(llvm::BasicBlock & bb, llvm::Instruction * (IdiomsA
 /**
  * Do instruction idioms analysis pass
  *
+ * Idioms are tried in the order given by initIdioms(), every idiom on the
+ * whole basic block. Idioms whose root opcode does not occur in the basic
+ * block are skipped without visiting its instructions.
+ *
  * @param f Function to analyse for instruction idioms
  * @param p actual pass
  * @return true whenever an exchange has been made, otherwise 0
  */
 bool IdiomsAnalysis::doAnalysis(Function & f, Pass * p) {
-	/*
-	 * Instruction idioms are inspected in a tree of Instructions. Every
-	 * instruction idiom has to be called on a basic block. Position of
-	 * instruction idiom exchangers is IMPORTANT! More complicated instruction
-	 * idioms have to be exchanged before simplier ones. They can consist of
-	 * other instruction idioms (the simple ones), so they have to be exchanged
-	 * at first place!
-	 */
 	bool change_made = false; // was there any exchange?
 
 	CC_compiler cc = getCompiler();
-	CC_arch arch = getArch();
 
 	// Inspect multi-basic block idioms
 	if (cc == CC_GCC || cc == CC_ANY) {
@@ -84,180 +312,17 @@ bool IdiomsAnalysis::doAnalysis(Function & f, Pass * p) {
 	// Inspect basic-block idioms
 	for (Function::iterator b = f.begin(); b != f.end(); ++b) {
 		BasicBlock & bb = *b;
-		if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_x86 || arch == ARCH_THUMB || arch == ARCH_ANY)
-			if (cc == CC_GCC || cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY) {
-				change_made |= analyse(bb, &IdiomsMagicDivMod::signedMod1,
-											"IdiomsMagicDivMod::signedMod1");
-
-				change_made |= analyse(bb, &IdiomsMagicDivMod::signedMod2,
-											"IdiomsMagicDivMod::signedMod2");
-
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicUnsignedDiv2,
-											"IdiomsMagicDivMod::magicUnsignedDiv2");
-
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicUnsignedDiv1,
-											"IdiomsMagicDivMod::magicUnsignedDiv1");
-
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv1,
-											"IdiomsMagicDivMod::magicSignedDiv1");
-
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv2,
-											"IdiomsMagicDivMod::magicSignedDiv2");
-
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv3,
-											"IdiomsMagicDivMod::magicSignedDiv3");
-
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv4,
-											"IdiomsMagicDivMod::magicSignedDiv4");
-
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv5,
-											"IdiomsMagicDivMod::magicSignedDiv5");
-
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv6,
-											"IdiomsMagicDivMod::magicSignedDiv6");
-
-				// Found in PowerPC - div 10
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv7pos,
-											"IdiomsMagicDivMod::magicSignedDiv7pos");
-
-				// Found in PowerPC - the same as previous, but the divisor
-				// is negative, i.e. div -10
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv7neg,
-											"IdiomsMagicDivMod::magicSignedDiv7neg");
-
-				// Found in PowerPC - div 6
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv8pos,
-											"IdiomsMagicDivMod::magicSignedDiv8pos");
-
-				// Found in PowerPC - the same as previous, but the divisor
-				// is negative, i.e. div -3
-				change_made |= analyse(bb, &IdiomsMagicDivMod::magicSignedDiv8neg,
-											"IdiomsMagicDivMod::magicSignedDiv8neg");
-
-				change_made |= analyse(bb, &IdiomsMagicDivMod::unsignedMod,
-											"IdiomsMagicDivMod::unsignedMod");
-		}
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeSignedModuloByTwo,
-										"IdiomsGCC::exchangeSignedModuloByTwo");
-
-		// PowerPC model lacks FPU and x86 uses x87.
-		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
-			if (cc == CC_GCC || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsGCC::exchangeCopysign,
-											"IdiomsGCC::exchangeCopysign");
-
-		// PowerPC model lacks FPU and x86 uses x87.
-		if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
-			if (cc == CC_GCC || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsGCC::exchangeFloatAbs,
-											"IdiomsGCC::exchangeFloatAbs");
-
-		if (arch == ARCH_x86 || arch == ARCH_ANY)
-			if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsVStudio::exchangeOrMinusOneAssign,
-											"IdiomsVStudio::exchangeOrMinusOneAssign");
-
-		if (arch == ARCH_x86 || arch == ARCH_ANY)
-			if (cc == CC_Intel || cc == CC_VStudio || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsVStudio::exchangeAndZeroAssign,
-										"IdiomsVStudio::exchangeAndZeroAssign");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv1,
-										"IdiomsGCC::exchangeCondBitShiftDiv1");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv2,
-										"IdiomsGCC::exchangeCondBitShiftDiv2");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeCondBitShiftDiv3,
-										"IdiomsGCC::exchangeCondBitShiftDiv3");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsCommon::exchangeSignedModulo2n,
-										"IdiomsCommon::exchangeSignedModulo2n");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_Intel || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsCommon::exchangeGreaterEqualZero,
-										"IdiomsCommon::exchangeGreaterEqualZero");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_LLVM || cc == CC_VStudio || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsGCC::exchangeXorMinusOne,
-										"IdiomsGCC::exchangeXorMinusOne");
-
-		if (arch == ARCH_POWERPC || arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
-			if (cc == CC_GCC || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsCommon::exchangeDivByMinusTwo,
-											"IdiomsCommon::exchangeDivByMinusTwo");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_Intel || cc == CC_LLVM || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsCommon::exchangeLessThanZero,
-										"IdiomsCommon::exchangeLessThanZero");
-
-		// PowerPC model lacks FPU and x86 uses x87.
-		if (cc == CC_GCC || cc == CC_ANY)
-			if (arch == ARCH_ARM || arch == ARCH_THUMB || arch == ARCH_MIPS || arch == ARCH_ANY)
-				change_made |= analyse(bb, &IdiomsGCC::exchangeFloatNeg,
-											"IdiomsGCC::exchangeFloatNeg");
-
-		// all arch
-		if (cc == CC_GCC || cc == CC_ANY)
-			change_made |= analyse(bb, &IdiomsCommon::exchangeUnsignedModulo2n,
-										"IdiomsCommon::exchangeUnsignedModulo2n");
-
-		// all arch
-		if (cc == CC_LLVM || cc == CC_ANY)
-				change_made |= analyse(bb, &IdiomsLLVM::exchangeIsGreaterThanMinusOne,
-											"IdiomsLLVM::exchangeIsGreaterThanMinusOne");
-
-		// all arch
-		// all compilers
-		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftSDiv1,
-									"IdiomsCommon::exchangeBitShiftSDiv1");
-
-		// all arch
-		// all compilers
-		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftUDiv,
-									"IdiomsCommon::exchangeBitShiftUDiv");
-
-		// all arch
-		// all compilers
-		change_made |= analyse(bb, &IdiomsCommon::exchangeBitShiftMul,
-									"IdiomsCommon::exchangeBitShiftMul");
-
-		// all arch
-		if (cc == CC_LLVM || cc == CC_ANY) {
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeIsGreaterThanMinusOne,
-										"IdiomsLLVM::exchangeIsGreaterThanMinusOne");
-		}
-
-		// all arch
-		if (cc == CC_LLVM || cc == CC_ANY) {
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareEq,
-										"IdiomsLLVM::exchangeCompareEq");
-
-	#if 0
-			/* We do not recognize this well */
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareNeq,
-										"IdiomsLLVM::exchangeCompareNeq");
-	#endif
+		OpcodeSet opcodes = getOpcodes(bb);
 
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareSlt,
-										"IdiomsLLVM::exchangeCompareSlt");
+		for (const Idiom & idiom : m_idioms) {
+			if ((opcodes & idiom.rootOpcodes).none())
+				continue;
 
-			change_made |= analyse(bb, &IdiomsLLVM::exchangeCompareSle,
-									"IdiomsLLVM::exchangeCompareSle");
+			if (analyse(bb, idiom)) {
+				change_made = true;
+				// Exchangers may insert arbitrary new instructions.
+				opcodes = getOpcodes(bb);
+			}
 		}
 	}
 
@@ -20,6 +20,7 @@
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/bin2llvmir/providers/lti.h"
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/cpdetect/cpdetect.h"
 #include "retdec/utils/string.h"
 #include "retdec/yaracpp/yara_detector.h"
@@ -168,19 +169,28 @@ void ProviderInitialization::setConfig(retdec::config::Config* c)
 	_config = c;
 }
 
+/**
+ * Use an already parsed input file instead of parsing the input file from
+ * the config. This way, the input does not need to be a file at all.
+ * @param ff    Parsed input file.
+ * @param tools Tools already detected in @a ff, or @c nullptr to detect them.
+ */
+void ProviderInitialization::setInput(
+		const std::shared_ptr<retdec::fileformat::FileFormat>& ff,
+		const std::shared_ptr<const retdec::cpdetect::ToolInformation>& tools)
+{
+	_inputFormat = ff;
+	_inputTools = tools;
+}
+
 /**
  * @return Always @c false -- this pass does not modify module.
  */
 bool ProviderInitialization::runOnModule(Module& m)
 {
-	AbiProvider::clear();
-	AsmInstruction::clear();
-	ConfigProvider::clear();
-	DebugFormatProvider::clear();
-	DemanglerProvider::clear();
-	FileImageProvider::clear();
-	LtiProvider::clear();
-	NamesProvider::clear();
+	// Only data of this module are dropped, decompilations of other modules
+	// may be running in other threads.
+	ProviderContext::release(&m);
 	SymbolicTree::clear();
 	CallingConventionProvider::clear();
 
@@ -199,10 +209,12 @@ bool ProviderInitialization::runOnModule(Module& m)
 
 	// Fileimage.
 	//
-	auto* f = FileImageProvider::addFileImage(
-			&m,
-			c->getConfig().parameters.getInputFile(),
-			c);
+	auto* f = _inputFormat
+			? FileImageProvider::addFileImage(&m, _inputFormat, c)
+			: FileImageProvider::addFileImage(
+					&m,
+					c->getConfig().parameters.getInputFile(),
+					c);
 	if (f == nullptr)
 	{
 		throw std::runtime_error("ProviderInitialization: f == nullptr");
@@ -267,23 +279,38 @@ bool ProviderInitialization::runOnModule(Module& m)
 	}
 
 	// Run cpdetect and set info to config.
-	// TODO: we could probably be using cpdetect results.
+	// Tools detected before are used, unless the architecture of the input
+	// was set from the config above, which may change the detection.
 	//
-	cpdetect::ToolInformation tools;
-	cpdetect::DetectParams searchParams(
-			cpdetect::SearchType::MOST_SIMILAR,
-			true, // internal database
-			false,
-			50 // ep bytes size
-	);
-	cpdetect::CompilerDetector cd(
-			*f->getFileFormat(),
-			searchParams,
-			tools
-	);
-	if (cd.getAllInformation() == cpdetect::ReturnCode::OK)
+	cpdetect::ToolInformation detectedTools;
+	const cpdetect::ToolInformation* tools = nullptr;
+	if (_inputTools
+			&& !f->getFileFormat()->isIntelHex()
+			&& !f->getFileFormat()->isRawData())
+	{
+		tools = _inputTools.get();
+	}
+	else
+	{
+		cpdetect::DetectParams searchParams(
+				cpdetect::SearchType::MOST_SIMILAR,
+				true, // internal database
+				false,
+				50 // ep bytes size
+		);
+		cpdetect::CompilerDetector cd(
+				*f->getFileFormat(),
+				searchParams,
+				detectedTools
+		);
+		if (cd.getAllInformation() == cpdetect::ReturnCode::OK)
+		{
+			tools = &detectedTools;
+		}
+	}
+	if (tools)
 	{
-		for (auto& t : tools.detectedTools)
+		for (auto& t : tools->detectedTools)
 		{
 			common::ToolInfo ci;
 
@@ -337,7 +364,7 @@ bool ProviderInitialization::runOnModule(Module& m)
 
 			c->getConfig().tools.push_back(ci);
 		}
-		for (auto& l : tools.detectedLanguages)
+		for (auto& l : tools->detectedLanguages)
 		{
 			if (l.bytecode)
 			{
@@ -354,14 +381,15 @@ bool ProviderInitialization::runOnModule(Module& m)
 		c->getConfig().architecture.setIsPic32();
 	}
 
-	// YARA crypto patterns scanning.
+	// YARA crypto patterns scanning. The loader has already applied
+	// relocations to the file content, the original content is scanned.
 	//
 	yaracpp::YaraDetector yara;
 	for (auto& crypto : c->getConfig().parameters.cryptoPatternPaths)
 	{
 		yara.addRuleFile(crypto);
 	}
-	yara.analyze(c->getConfig().parameters.getInputFile());
+	yara.analyze(f->getFileFormat()->getOriginalBytes());
 	for(const auto &rule : yara.getDetectedRules())
 	{
 		common::Pattern p = saveCryptoRule(
@@ -403,7 +431,7 @@ bool ProviderInitialization::runOnModule(Module& m)
 
 	NamesProvider::addNames(&m, c, debug, f, d, lti);
 
-	AsmInstruction::clear();
+	AsmInstruction::clear(&m);
 
 	return false;
 }
@@ -82,11 +82,13 @@ bool SimpleTypesAnalysis::runOnModule(Module& M)
 	module = &M;
 	_specialGlobal = AsmInstruction::getLlvmToAsmGlobalVariable(module);
 
-	static bool first = true;
+	// The pass runs twice per decompilation. Decompilations running in other
+	// threads must not switch the phase of this one.
+	static thread_local Module* firstRunModule = nullptr;
 
-	if (first)
+	if (firstRunModule != &M)
 	{
-		first = false;
+		firstRunModule = &M;
 
 		RDA.runOnModule(M, AbiProvider::getAbi(&M));
 		buildEqSets(M);
@@ -99,7 +101,7 @@ bool SimpleTypesAnalysis::runOnModule(Module& M)
 	}
 	else
 	{
-		first = true;
+		firstRunModule = nullptr;
 
 		instToErase.clear();
 
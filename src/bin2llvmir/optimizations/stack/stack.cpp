@@ -70,7 +70,12 @@ bool StackAnalysis::run()
 	}
 
 	ReachingDefinitionsAnalysis RDA;
-	RDA.runOnModule(*_module, _abi);
+	RDA.runOnModule(
+			*_module,
+			_abi,
+			false,
+			_config->getConfig().parameters.getThreads()
+	);
 
 	for (auto& f : *_module)
 	{
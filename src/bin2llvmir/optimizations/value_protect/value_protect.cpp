@@ -259,7 +259,8 @@ llvm::Function* getWriteUndefQword(llvm::Module* m)
 
 char ValueProtect::ID = 0;
 
-std::map<llvm::Type*, llvm::Function*> ValueProtect::_type2fnc;
+thread_local std::map<llvm::Type*, llvm::Function*> ValueProtect::_type2fnc;
+thread_local llvm::Module* ValueProtect::_type2fncModule = nullptr;
 
 static RegisterPass<ValueProtect> X(
 		"retdec-value-protect",
@@ -303,7 +304,9 @@ bool ValueProtect::run()
 
 	bool changed = false;
 
-	if (!_type2fnc.empty() && _type2fnc.begin()->second->getParent() != _module)
+	// Functions from another module cannot be touched -- the module may not
+	// exist anymore.
+	if (!_type2fnc.empty() && _type2fncModule != _module)
 	{
 		_type2fnc.clear();
 	}
@@ -639,6 +642,7 @@ llvm::Function* ValueProtect::createFunction(llvm::Type* t)
 			names::generateFunctionNameUndef(_type2fnc.size()),
 			_module);
 	_type2fnc[t] = fnc;
+	_type2fncModule = _module;
 
 	return fnc;
 }
@@ -11,6 +11,7 @@
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/debug.h"
 #include "retdec/bin2llvmir/utils/ir_modifier.h"
 #include "retdec/bin2llvmir/utils/llvm.h"
@@ -20,9 +21,6 @@ using namespace llvm;
 namespace retdec {
 namespace bin2llvmir {
 
-std::vector<AsmInstruction::ModuleGlobalPair> AsmInstruction::_module2global;
-std::vector<AsmInstruction::ModuleInstructionMap> AsmInstruction::_module2instMap;
-
 AsmInstruction::AsmInstruction()
 {
 
@@ -30,13 +28,26 @@ AsmInstruction::AsmInstruction()
 
 AsmInstruction::AsmInstruction(llvm::Instruction* inst)
 {
-	if (inst == nullptr)
+	if (inst == nullptr || inst->getFunction() == nullptr)
 	{
 		return;
 	}
 
+	// The mapping global variable is looked up only once, the walk itself
+	// only compares pointers.
+	auto* gv = getLlvmToAsmGlobalVariable(inst->getModule());
+	if (gv == nullptr)
+	{
+		return;
+	}
+	auto isLlvmToAsm = [gv](Instruction* i)
+	{
+		auto* s = dyn_cast<StoreInst>(i);
+		return s && s->getPointerOperand() == gv;
+	};
+
 	auto* bb = inst->getParent();
-	while (inst && !isLlvmToAsmInstructionPrivate(inst))
+	while (!isLlvmToAsm(inst))
 	{
 		if (&bb->front() == inst)
 		{
@@ -56,8 +67,7 @@ AsmInstruction::AsmInstruction(llvm::Instruction* inst)
 		}
 	}
 
-	auto* s = dyn_cast_or_null<StoreInst>(inst);
-	_llvmToAsmInstr = isLlvmToAsmInstructionPrivate(s) ? s : nullptr;
+	_llvmToAsmInstr = cast<StoreInst>(inst);
 }
 
 AsmInstruction::AsmInstruction(llvm::BasicBlock* bb)
@@ -95,6 +105,15 @@ AsmInstruction::AsmInstruction(llvm::Module* m, retdec::common::Address addr)
 		return;
 	}
 
+	if (auto* s = getIndexedLlvmToAsmInstruction(m, addr))
+	{
+		_llvmToAsmInstr = s;
+		return;
+	}
+
+	// Not indexed (e.g. not created by the decoder) -> search the users of
+	// the address constant.
+	//
 	ConstantInt* ci = ConstantInt::get(
 			Type::getInt64Ty(m->getContext()),
 			addr,
@@ -183,41 +202,75 @@ const llvm::GlobalVariable* AsmInstruction::getLlvmToAsmGlobalVariablePrivate(
 	}
 }
 
-Llvm2CapstoneInsnMap& AsmInstruction::getLlvmToCapstoneInsnMap(
-		const llvm::Module* m)
+CapstoneInsnStore& AsmInstruction::getCapstoneInsnStore(const llvm::Module* m)
 {
-	for (auto& p : _module2instMap)
+	return ProviderContext::getOrCreate(m).capstoneInsns;
+}
+
+/**
+ * Register Capstone instruction @a insn, which was translated to LLVM
+ * instructions starting with LLVM to ASM mapping instruction @a llvmToAsm.
+ * This makes both the Capstone instruction and the mapping instruction
+ * (by its address) available in constant time. The module takes over the
+ * ownership of @a insn, see @c CapstoneInsnStore.
+ * @param m         Module the instruction belongs to.
+ * @param llvmToAsm LLVM to ASM mapping instruction.
+ * @param insn      Capstone instruction allocated by @c cs_malloc().
+ * @param mode      Capstone mode @a insn was decoded in.
+ */
+void AsmInstruction::addCapstoneInsn(
+		const llvm::Module* m,
+		llvm::StoreInst* llvmToAsm,
+		cs_insn* insn,
+		cs_mode mode)
+{
+	auto& ctx = ProviderContext::getOrCreate(m);
+	ctx.capstoneInsns.add(llvmToAsm, insn, mode);
+
+	if (auto* ci = dyn_cast<ConstantInt>(llvmToAsm->getValueOperand()))
 	{
-		if (p.first == m)
-		{
-			return p.second;
-		}
+		ctx.addressToLlvmToAsm[ci->getZExtValue()] = llvmToAsm;
 	}
+}
 
-	auto it = _module2instMap.emplace(_module2instMap.end(), std::make_pair(
-			m,
-			std::map<llvm::StoreInst*, cs_insn*>()));
-	return it->second;
+/**
+ * @return LLVM to ASM mapping instruction for address @a addr from the index
+ *         of module @a m, or @c nullptr if there is no such instruction in
+ *         the index.
+ */
+llvm::StoreInst* AsmInstruction::getIndexedLlvmToAsmInstruction(
+		const llvm::Module* m,
+		retdec::common::Address addr)
+{
+	auto* ctx = ProviderContext::get(m);
+	if (ctx == nullptr || addr.isUndefined())
+	{
+		return nullptr;
+	}
+
+	auto it = ctx->addressToLlvmToAsm.find(addr);
+	if (it == ctx->addressToLlvmToAsm.end())
+	{
+		return nullptr;
+	}
+
+	// Handle is null if the instruction was erased.
+	auto* s = dyn_cast_or_null<StoreInst>(static_cast<Value*>(it->second));
+	return s && s->getParent() ? s : nullptr;
 }
 
 llvm::GlobalVariable* AsmInstruction::getLlvmToAsmGlobalVariable(
 		const llvm::Module* m)
 {
-	for (auto& p : _module2global)
-	{
-		if (p.first == m)
-		{
-			return p.second;
-		}
-	}
-	return nullptr;
+	auto* ctx = ProviderContext::get(m);
+	return ctx ? ctx->llvmToAsmGlobal : nullptr;
 }
 
 void AsmInstruction::setLlvmToAsmGlobalVariable(
 		const llvm::Module* m,
 		llvm::GlobalVariable* gv)
 {
-	_module2global.emplace_back(m, gv);
+	ProviderContext::getOrCreate(m).llvmToAsmGlobal = gv;
 }
 
 retdec::common::Address AsmInstruction::getInstructionAddress(
@@ -326,10 +379,31 @@ bool AsmInstruction::isLlvmToAsmInstruction(const llvm::Value* inst)
 	return s->getPointerOperand() == getLlvmToAsmGlobalVariable(m);
 }
 
+/**
+ * Clear the mapping of LLVM instructions to ASM instructions of the given
+ * module @a m. Mappings of other modules are not affected.
+ */
+void AsmInstruction::clear(const llvm::Module* m)
+{
+	if (auto* ctx = ProviderContext::get(m))
+	{
+		ctx->llvmToAsmGlobal = nullptr;
+		ctx->capstoneInsns.clear();
+		ctx->addressToLlvmToAsm.clear();
+	}
+}
+
+/**
+ * Clear the mappings of all the modules.
+ */
 void AsmInstruction::clear()
 {
-	_module2global.clear();
-	_module2instMap.clear();
+	ProviderContext::forEach([](ProviderContext& ctx)
+	{
+		ctx.llvmToAsmGlobal = nullptr;
+		ctx.capstoneInsns.clear();
+		ctx.addressToLlvmToAsm.clear();
+	});
 }
 
 bool AsmInstruction::isValid() const
@@ -342,18 +416,21 @@ bool AsmInstruction::isInvalid() const
 	return !isValid();
 }
 
+/**
+ * @return Capstone instruction of this ASM instruction, or @c nullptr if there
+ *         is none. It is never @c nullptr for instructions created by the
+ *         decoder. The instruction may be decoded again on demand, so do not
+ *         hold the pointer for long -- see @c CapstoneInsnStore.
+ */
 cs_insn* AsmInstruction::getCapstoneInsn() const
 {
-	for (auto& p : _module2instMap)
+	auto* ctx = ProviderContext::get(_llvmToAsmInstr->getModule());
+	if (ctx == nullptr)
 	{
-		if (p.first == _llvmToAsmInstr->getModule())
-		{
-			auto it =  p.second.find(_llvmToAsmInstr);
-			return it != p.second.end() ? it->second : nullptr;
-		}
+		return nullptr;
 	}
 
-	return nullptr;
+	return ctx->capstoneInsns.get(_llvmToAsmInstr);
 }
 
 std::string AsmInstruction::getDsm() const
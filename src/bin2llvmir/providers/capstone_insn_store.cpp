@@ -0,0 +1,360 @@
+/**
+ * @file src/bin2llvmir/providers/capstone_insn_store.cpp
+ * @brief Compact storage of Capstone instructions of LLVM to ASM mappings.
+ * @copyright (c) 2021 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "retdec/bin2llvmir/providers/capstone_insn_store.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+CapstoneInsnStore::CapstoneInsnStore(std::size_t cacheSize) :
+		_cacheSize(cacheSize)
+{
+
+}
+
+CapstoneInsnStore::~CapstoneInsnStore()
+{
+	clear();
+	closeEngine();
+}
+
+/**
+ * Open Capstone engine used to decode instructions that are no longer in the
+ * cache. Until there is an engine, no instruction is dropped from the cache.
+ * @param arch Architecture of all the stored instructions.
+ * @param mode Initial mode of the engine. It is switched to the mode of each
+ *             decoded instruction as needed.
+ * @return @c True if the engine was opened, @c false otherwise.
+ */
+bool CapstoneInsnStore::setEngine(cs_arch arch, cs_mode mode)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	closeEngine();
+	if (cs_open(arch, mode, &_engine) != CS_ERR_OK)
+	{
+		return false;
+	}
+	if (cs_option(_engine, CS_OPT_DETAIL, CS_OPT_ON) != CS_ERR_OK)
+	{
+		cs_close(&_engine);
+		return false;
+	}
+
+	_hasEngine = true;
+	_arch = arch;
+	_engineMode = mode;
+	shrinkCache();
+	return true;
+}
+
+/**
+ * Set the maximum number of fully decoded instructions kept in the cache.
+ * Zero means unlimited -- use it when pointers returned by get() need to stay
+ * valid, e.g. when they are handed over to another component.
+ */
+void CapstoneInsnStore::setCacheSize(std::size_t cacheSize)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_cacheSize = cacheSize;
+	shrinkCache();
+}
+
+/**
+ * Add Capstone instruction @a insn translated to LLVM instructions starting
+ * with LLVM to ASM mapping instruction @a llvmToAsm. The store takes over
+ * the ownership of @a insn, which must have been allocated by @c cs_malloc().
+ * The instruction is kept as the most recently used one.
+ * @param llvmToAsm LLVM to ASM mapping instruction.
+ * @param insn      Capstone instruction.
+ * @param mode      Capstone mode @a insn was decoded in.
+ */
+void CapstoneInsnStore::add(
+		const llvm::StoreInst* llvmToAsm,
+		cs_insn* insn,
+		cs_mode mode)
+{
+	assert(insn->size <= sizeof(Insn::bytes));
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	std::uint32_t slot = 0;
+	auto it = _slots.find(llvmToAsm);
+	if (it != _slots.end())
+	{
+		slot = it->second;
+		uncache(slot);
+	}
+	else if (!_freeSlots.empty())
+	{
+		slot = _freeSlots.back();
+		_freeSlots.pop_back();
+		_slots[llvmToAsm] = slot;
+	}
+	else
+	{
+		slot = _insns.size();
+		_insns.emplace_back();
+		_slots[llvmToAsm] = slot;
+	}
+
+	auto& i = _insns[slot];
+	i.address = insn->address;
+	i.mode = mode;
+	i.size = insn->size;
+	std::memcpy(i.bytes, insn->bytes, i.size);
+
+	cache(slot, insn);
+	// Decoding an IT instruction would start an IT block in the store's
+	// engine and change the following decodings.
+	if (_arch == CS_ARCH_ARM && insn->id == ARM_INS_IT)
+	{
+		keep(slot);
+	}
+	shrinkCache();
+}
+
+/**
+ * Get Capstone instruction of LLVM to ASM mapping instruction @a llvmToAsm,
+ * or @c nullptr if there is no such instruction.
+ */
+cs_insn* CapstoneInsnStore::get(const llvm::StoreInst* llvmToAsm)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto it = _slots.find(llvmToAsm);
+	if (it == _slots.end())
+	{
+		return nullptr;
+	}
+	auto slot = it->second;
+
+	auto cIt = _cache.find(slot);
+	if (cIt != _cache.end())
+	{
+		if (!cIt->second.kept)
+		{
+			_lru.splice(_lru.begin(), _lru, cIt->second.lruIt);
+		}
+		return cIt->second.insn;
+	}
+
+	// Only instructions which were successfully decoded again are dropped
+	// from the cache, see shrinkCache().
+	auto* insn = decode(_insns[slot]);
+	assert(insn);
+	cache(slot, insn);
+	shrinkCache();
+	return insn;
+}
+
+void CapstoneInsnStore::erase(const llvm::StoreInst* llvmToAsm)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto it = _slots.find(llvmToAsm);
+	if (it == _slots.end())
+	{
+		return;
+	}
+
+	uncache(it->second);
+	_freeSlots.push_back(it->second);
+	_slots.erase(it);
+}
+
+/**
+ * Remove all the instructions. Cached instructions are freed, the engine and
+ * the cache size are kept.
+ */
+void CapstoneInsnStore::clear()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	for (auto& p : _cache)
+	{
+		cs_free(p.second.insn, 1);
+	}
+	_cache.clear();
+	_lru.clear();
+	_slots.clear();
+	_freeSlots.clear();
+	_insns.clear();
+}
+
+std::size_t CapstoneInsnStore::size() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _slots.size();
+}
+
+bool CapstoneInsnStore::empty() const
+{
+	return size() == 0;
+}
+
+/**
+ * Decode the given instruction again.
+ * @return Newly allocated instruction, or @c nullptr if decoding failed.
+ */
+cs_insn* CapstoneInsnStore::decode(const Insn& i)
+{
+	if (!_hasEngine)
+	{
+		return nullptr;
+	}
+
+	auto decodeIn = [this, &i](cs_mode mode, cs_insn* insn)
+	{
+		if (_engineMode != mode)
+		{
+			cs_option(_engine, CS_OPT_MODE, mode);
+			_engineMode = mode;
+		}
+
+		const std::uint8_t* code = i.bytes;
+		std::size_t size = i.size;
+		std::uint64_t address = i.address;
+		return cs_disasm_iter(_engine, &code, &size, &address, insn);
+	};
+
+	auto* insn = cs_malloc(_engine);
+	auto mode = static_cast<cs_mode>(i.mode);
+	bool ok = decodeIn(mode, insn);
+
+	// The decoder tries MIPS 64-bit mode for instructions that fail to decode
+	// in the 32-bit mode. Do the same here.
+	//
+	if (!ok && _arch == CS_ARCH_MIPS && (mode & CS_MODE_MIPS32))
+	{
+		auto mips64 = static_cast<cs_mode>(
+				(mode & ~CS_MODE_MIPS32) | CS_MODE_MIPS64);
+		ok = decodeIn(mips64, insn);
+	}
+
+	if (!ok)
+	{
+		cs_free(insn, 1);
+		return nullptr;
+	}
+	return insn;
+}
+
+/**
+ * Check that the given instruction decodes again to the same instruction as
+ * @a insn, including the details which depend on the engine's state.
+ */
+bool CapstoneInsnStore::decodesAgain(const Insn& i, const cs_insn* insn)
+{
+	auto* again = decode(i);
+	if (again == nullptr)
+	{
+		return false;
+	}
+
+	bool same = again->id == insn->id
+			&& again->size == insn->size
+			&& std::strcmp(again->mnemonic, insn->mnemonic) == 0
+			&& std::strcmp(again->op_str, insn->op_str) == 0;
+	if (same && insn->detail)
+	{
+		auto* d1 = insn->detail;
+		auto* d2 = again->detail;
+		same = d1->regs_read_count == d2->regs_read_count
+				&& d1->regs_write_count == d2->regs_write_count
+				&& d1->groups_count == d2->groups_count
+				&& std::equal(d1->regs_read, d1->regs_read + d1->regs_read_count, d2->regs_read)
+				&& std::equal(d1->regs_write, d1->regs_write + d1->regs_write_count, d2->regs_write)
+				&& std::equal(d1->groups, d1->groups + d1->groups_count, d2->groups);
+		if (same && _arch == CS_ARCH_ARM)
+		{
+			same = d1->arm.cc == d2->arm.cc
+					&& d1->arm.update_flags == d2->arm.update_flags
+					&& d1->arm.op_count == d2->arm.op_count;
+		}
+	}
+
+	cs_free(again, 1);
+	return same;
+}
+
+void CapstoneInsnStore::cache(std::uint32_t slot, cs_insn* insn)
+{
+	_lru.push_front(slot);
+	_cache[slot] = CachedInsn{insn, _lru.begin()};
+}
+
+/**
+ * Keep the cached instruction in the given slot until it is erased.
+ */
+void CapstoneInsnStore::keep(std::uint32_t slot)
+{
+	auto& c = _cache[slot];
+	if (!c.kept)
+	{
+		_lru.erase(c.lruIt);
+		c.kept = true;
+	}
+}
+
+void CapstoneInsnStore::uncache(std::uint32_t slot)
+{
+	auto it = _cache.find(slot);
+	if (it == _cache.end())
+	{
+		return;
+	}
+
+	cs_free(it->second.insn, 1);
+	if (!it->second.kept)
+	{
+		_lru.erase(it->second.lruIt);
+	}
+	_cache.erase(it);
+}
+
+/**
+ * Drop the least recently used instructions from the cache until it fits into
+ * its size. Nothing is dropped if the instructions could not be decoded again.
+ * Instructions which do not decode again to the same instruction are kept.
+ */
+void CapstoneInsnStore::shrinkCache()
+{
+	if (!_hasEngine || _cacheSize == 0)
+	{
+		return;
+	}
+
+	while (_lru.size() > _cacheSize)
+	{
+		auto slot = _lru.back();
+		if (decodesAgain(_insns[slot], _cache[slot].insn))
+		{
+			uncache(slot);
+		}
+		else
+		{
+			keep(slot);
+		}
+	}
+}
+
+void CapstoneInsnStore::closeEngine()
+{
+	if (_hasEngine)
+	{
+		cs_close(&_engine);
+		_hasEngine = false;
+	}
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
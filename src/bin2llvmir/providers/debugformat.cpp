@@ -5,6 +5,7 @@
  */
 
 #include "retdec/bin2llvmir/providers/debugformat.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 
 using namespace llvm;
 
@@ -23,8 +24,6 @@ namespace bin2llvmir {
 //=============================================================================
 //
 
-std::map<Module*, DebugFormat> DebugFormatProvider::_module2debug;
-
 /**
  * Create and add to provider a debug info for the given module @a m, file
  * image @a objf, pdb file path @a pdbFile, and demangler @a demangler.
@@ -42,16 +41,17 @@ DebugFormat* DebugFormatProvider::addDebugFormat(
 		return nullptr;
 	}
 
-	auto p = _module2debug.emplace(
-			m,
-			DebugFormat(
-					objf,
-					pdbFile,
-					nullptr, // symbol table -- not needed.
-					demangler ? demangler->getDemangler() : nullptr
-			)
-	);
-	return &p.first->second;
+	auto& ctx = ProviderContext::getOrCreate(m);
+	if (ctx.debugFormat == nullptr)
+	{
+		ctx.debugFormat = std::make_unique<DebugFormat>(
+				objf,
+				pdbFile,
+				nullptr, // symbol table -- not needed.
+				demangler ? demangler->getDemangler() : nullptr
+		);
+	}
+	return ctx.debugFormat.get();
 }
 
 /**
@@ -61,8 +61,8 @@ DebugFormat* DebugFormatProvider::addDebugFormat(
 DebugFormat* DebugFormatProvider::getDebugFormat(
 		llvm::Module* m)
 {
-	auto f = _module2debug.find(m);
-	return f != _module2debug.end() ? &f->second : nullptr;
+	auto* ctx = ProviderContext::get(m);
+	return ctx ? ctx->debugFormat.get() : nullptr;
 }
 
 /**
@@ -84,7 +84,10 @@ bool DebugFormatProvider::getDebugFormat(llvm::Module* m, DebugFormat*& df)
  */
 void DebugFormatProvider::clear()
 {
-	_module2debug.clear();
+	ProviderContext::forEach([](ProviderContext& ctx)
+	{
+		ctx.debugFormat.reset();
+	});
 }
 
 } // namespace bin2llvmir
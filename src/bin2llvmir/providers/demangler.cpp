@@ -6,6 +6,7 @@
 
 #include <retdec/loader/loader/image.h>
 #include "retdec/bin2llvmir/providers/demangler.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/bin2llvmir/utils/ctypes2llvm.h"
 #include "retdec/ctypes/module.h"
@@ -118,8 +119,6 @@ std::unique_ptr<Demangler> DemanglerFactory::getBorlandDemangler(
 /******************************************************************/
 /********************** Demangler Provider ************************/
 /******************************************************************/
-std::map<Module *, std::unique_ptr<Demangler>> DemanglerProvider::_module2demangler;
-
 /**
  * Create and add to provider a demangler for the given module @a m
  * and tools @a t.
@@ -144,9 +143,13 @@ Demangler *DemanglerProvider::addDemangler(
 		d = DemanglerFactory::getItaniumDemangler(llvmModule, config, typeConfig);
 	}
 
-	auto p = _module2demangler.insert(std::make_pair(llvmModule, std::move(d)));
+	auto& ctx = ProviderContext::getOrCreate(llvmModule);
+	if (ctx.demangler == nullptr)
+	{
+		ctx.demangler = std::move(d);
+	}
 
-	return p.first->second.get();
+	return ctx.demangler.get();
 }
 
 /**
@@ -155,8 +158,8 @@ Demangler *DemanglerProvider::addDemangler(
  */
 Demangler *DemanglerProvider::getDemangler(llvm::Module *m)
 {
-	auto f = _module2demangler.find(m);
-	return f != _module2demangler.end() ? f->second.get() : nullptr;
+	auto* ctx = ProviderContext::get(m);
+	return ctx ? ctx->demangler.get() : nullptr;
 }
 
 /**
@@ -180,7 +183,10 @@ bool DemanglerProvider::getDemangler(
  */
 void DemanglerProvider::clear()
 {
-	_module2demangler.clear();
+	ProviderContext::forEach([](ProviderContext& ctx)
+	{
+		ctx.demangler.reset();
+	});
 }
 
 } // namespace bin2llvmir
@@ -4,8 +4,6 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
-#include <fstream>
-
 #include "retdec/ctypes/floating_point_type.h"
 #include "retdec/ctypes/function_type.h"
 #include "retdec/ctypes/integral_type.h"
@@ -18,6 +16,7 @@
 #include "retdec/ctypes/void_type.h"
 #include "retdec/utils/string.h"
 #include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/ctypes2llvm.h"
 
 using namespace llvm;
@@ -45,9 +44,6 @@ Lti::Lti(
 	_ltiModule = std::make_unique<retdec::ctypes::Module>(
 			std::make_shared<retdec::ctypes::Context>());
 
-	_ltiParser = ctypesparser::JSONCTypesParser(
-			static_cast<unsigned>(c->getConfig().architecture.getBitSize()));
-
 	for (auto& l : _config->getConfig().parameters.libraryTypeInfoPaths)
 	{
 		if (retdec::utils::endsWith(l, "cstdlib.json"))
@@ -91,29 +87,78 @@ Lti::Lti(
 	}
 }
 
+/**
+ * Index the given LTI file. Its functions are parsed only when they are
+ * requested by getLtiFunction(). Most binaries use only a small fraction of
+ * the functions, so this is much cheaper than parsing the whole file.
+ */
 void Lti::loadLtiFile(const std::string& filePath)
 {
-	std::ifstream file(filePath);
-	if (file)
+	auto file = llvm::MemoryBuffer::getFile(filePath);
+	if (!file)
 	{
-		std::string cc = "cdecl";
-		if (retdec::utils::containsCaseInsensitive(filePath, "win"))
-		{
-			cc = "stdcall";
-		}
-		_ltiParser.parseInto(file, _ltiModule, _typeConfig->typeWidths(), cc);
+		return;
 	}
+
+	std::string cc = "cdecl";
+	if (retdec::utils::containsCaseInsensitive(filePath, "win"))
+	{
+		cc = "stdcall";
+	}
+
+	auto parser = std::make_unique<ctypesparser::JSONCTypesParser>(
+			static_cast<unsigned>(
+					_config->getConfig().architecture.getBitSize()));
+	parser->index(
+			(*file)->getBufferStart(),
+			(*file)->getBufferSize(),
+			_ltiModule->getContext(),
+			_typeConfig->typeWidths(),
+			cc);
+
+	_ltiFiles.push_back(std::move(*file));
+	_ltiParsers.push_back(std::move(parser));
 }
 
 bool Lti::hasLtiFunction(const std::string& name)
 {
-	return getLtiFunction(name) != nullptr;
+	if (_ltiModule->hasFunctionWithName(name))
+	{
+		return true;
+	}
+
+	for (auto& parser : _ltiParsers)
+	{
+		if (parser->hasIndexedFunction(name))
+		{
+			return true;
+		}
+	}
+	return false;
 }
 
+/**
+ * Get LTI function with @c name. The function is parsed from the first
+ * loaded LTI file that contains it when it is requested for the first time.
+ * @return LTI function, or @c nullptr if there is no such function.
+ */
 std::shared_ptr<retdec::ctypes::Function> Lti::getLtiFunction(
 		const std::string& name)
 {
-	return _ltiModule->getFunctionWithName(name);
+	if (auto f = _ltiModule->getFunctionWithName(name))
+	{
+		return f;
+	}
+
+	for (auto& parser : _ltiParsers)
+	{
+		if (auto f = parser->parseIndexedFunction(name))
+		{
+			_ltiModule->addFunction(f);
+			return f;
+		}
+	}
+	return nullptr;
 }
 
 /**
@@ -234,8 +279,6 @@ llvm::Type* Lti::getLlvmType(std::shared_ptr<retdec::ctypes::Type> type)
 //=============================================================================
 //
 
-std::map<llvm::Module*, Lti> LtiProvider::_module2lti;
-
 Lti* LtiProvider::addLti(
 	llvm::Module *m,
 	Config *c,
@@ -247,14 +290,18 @@ Lti* LtiProvider::addLti(
 		return nullptr;
 	}
 
-	auto p = _module2lti.emplace(m, Lti(m, c, typeConfig, objf));
-	return &p.first->second;
+	auto& ctx = ProviderContext::getOrCreate(m);
+	if (ctx.lti == nullptr)
+	{
+		ctx.lti = std::make_unique<Lti>(m, c, typeConfig, objf);
+	}
+	return ctx.lti.get();
 }
 
 Lti* LtiProvider::getLti(llvm::Module* m)
 {
-	auto f = _module2lti.find(m);
-	return f != _module2lti.end() ? &f->second : nullptr;
+	auto* ctx = ProviderContext::get(m);
+	return ctx ? ctx->lti.get() : nullptr;
 }
 
 bool LtiProvider::getLti(llvm::Module* m, Lti*& lti)
@@ -265,7 +312,10 @@ bool LtiProvider::getLti(llvm::Module* m, Lti*& lti)
 
 void LtiProvider::clear()
 {
-	_module2lti.clear();
+	ProviderContext::forEach([](ProviderContext& ctx)
+	{
+		ctx.lti.reset();
+	});
 }
 
 } // namespace bin2llvmir
@@ -5,6 +5,8 @@
 */
 
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
+#include "retdec/bin2llvmir/utils/ordinals.h"
 #include "retdec/utils/string.h"
 
 using namespace retdec::common;
@@ -476,66 +478,15 @@ void NameContainer::initFromImage()
 
 std::string NameContainer::getNameFromImportLibAndOrd(
 		const std::string& libName,
-		int ord)
-{
-	auto it = _dllOrds.find(libName);
-	if (it == _dllOrds.end())
-	{
-		if (!loadImportOrds(libName))
-		{
-			return std::string();
-		}
-		else
-		{
-			it = _dllOrds.find(libName);
-		}
-	}
-
-	const ImportOrdMap& ords = it->second;
-	auto ordIt = ords.find(ord);
-	if (ordIt != ords.end())
-	{
-		return ordIt->second;
-	}
-
-	return std::string();
-}
-
-bool NameContainer::loadImportOrds(const std::string& libName)
+		std::uint64_t ord)
 {
 	std::string arch;
 	if (_config->getConfig().architecture.isArm()) arch = "arm";
 	else if (_config->getConfig().architecture.isX86()) arch = "x86";
-	else return false;
+	else return std::string();
 
 	auto dir = _config->getConfig().parameters.getOrdinalNumbersDirectory();
-	auto filePath = dir + "/" + arch + "/" + libName + ".ord";
-
-	std::ifstream inputFile;
-	inputFile.open(filePath);
-	if (!inputFile)
-	{
-		return false;
-	}
-
-	std::string line;
-	ImportOrdMap ordMap;
-	while (!getline(inputFile, line).eof())
-	{
-		std::stringstream ordDecl(line);
-
-		int ord = -1;
-		std::string funcName;
-		ordDecl >> ord >> funcName;
-		if (ord >= 0)
-		{
-			ordMap[ord] = funcName;
-		}
-	}
-	inputFile.close();
-	_dllOrds.emplace(libName, ordMap);
-
-	return true;
+	return OrdinalDatabase::get(dir + "/" + arch).getName(libName, ord);
 }
 
 //
@@ -544,8 +495,6 @@ bool NameContainer::loadImportOrds(const std::string& libName)
 //==============================================================================
 //
 
-std::map<llvm::Module*, NameContainer> NamesProvider::_module2names;
-
 NameContainer* NamesProvider::addNames(
 		llvm::Module* m,
 		Config* c,
@@ -563,14 +512,18 @@ NameContainer* NamesProvider::addNames(
 		return nullptr;
 	}
 
-	auto p = _module2names.emplace(m, NameContainer(m, c, d, i, dm, lti));
-	return &p.first->second;
+	auto& ctx = ProviderContext::getOrCreate(m);
+	if (ctx.names == nullptr)
+	{
+		ctx.names = std::make_unique<NameContainer>(m, c, d, i, dm, lti);
+	}
+	return ctx.names.get();
 }
 
 NameContainer* NamesProvider::getNames(llvm::Module* m)
 {
-	auto f = _module2names.find(m);
-	return f != _module2names.end() ? &f->second : nullptr;
+	auto* ctx = ProviderContext::get(m);
+	return ctx ? ctx->names.get() : nullptr;
 }
 
 bool NamesProvider::getNames(llvm::Module* m, NameContainer*& names)
@@ -581,7 +534,10 @@ bool NamesProvider::getNames(llvm::Module* m, NameContainer*& names)
 
 void NamesProvider::clear()
 {
-	_module2names.clear();
+	ProviderContext::forEach([](ProviderContext& ctx)
+	{
+		ctx.names.reset();
+	});
 }
 
 } // namespace bin2llvmir
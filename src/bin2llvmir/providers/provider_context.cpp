@@ -0,0 +1,134 @@
+/**
+ * @file src/bin2llvmir/providers/provider_context.cpp
+ * @brief Per-module storage of all the provider data.
+ * @copyright (c) 2021 Avast Software, licensed under the MIT license
+ */
+
+#include <mutex>
+
+#include "retdec/bin2llvmir/providers/abi/abi.h"
+#include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/debugformat.h"
+#include "retdec/bin2llvmir/providers/demangler.h"
+#include "retdec/bin2llvmir/providers/fileimage.h"
+#include "retdec/bin2llvmir/providers/lti.h"
+#include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+//
+//=============================================================================
+//  ProviderContext
+//=============================================================================
+//
+
+std::shared_mutex ProviderContext::_mutex;
+std::map<const llvm::Module*, std::unique_ptr<ProviderContext>>
+		ProviderContext::_module2context;
+
+// Defined here, where all the owned types are complete.
+ProviderContext::~ProviderContext() = default;
+
+/**
+ * @return Context of the given module @a m or @c nullptr if there is none.
+ *         The returned context is valid until it is released.
+ */
+ProviderContext* ProviderContext::get(const llvm::Module* m)
+{
+	std::shared_lock<std::shared_mutex> lock(_mutex);
+
+	auto f = _module2context.find(m);
+	return f != _module2context.end() ? f->second.get() : nullptr;
+}
+
+/**
+ * @return Context of the given module @a m. If there is none, an empty one
+ *         is created.
+ */
+ProviderContext& ProviderContext::getOrCreate(const llvm::Module* m)
+{
+	if (auto* ctx = get(m))
+	{
+		return *ctx;
+	}
+
+	std::unique_lock<std::shared_mutex> lock(_mutex);
+
+	auto& ctx = _module2context[m];
+	if (ctx == nullptr)
+	{
+		ctx = std::make_unique<ProviderContext>();
+	}
+	return *ctx;
+}
+
+/**
+ * Destroy the context of the given module @a m together with all the data
+ * the providers hold for it. Contexts of other modules are not affected.
+ */
+void ProviderContext::release(const llvm::Module* m)
+{
+	std::unique_ptr<ProviderContext> ctx;
+	{
+		std::unique_lock<std::shared_mutex> lock(_mutex);
+
+		auto f = _module2context.find(m);
+		if (f == _module2context.end())
+		{
+			return;
+		}
+		ctx = std::move(f->second);
+		_module2context.erase(f);
+	}
+	// The context is destroyed here, outside of the lock.
+}
+
+/**
+ * Call @a f for all the existing contexts.
+ * This is meant only for clearing of a single provider in all the contexts.
+ * It must not be used while modules are processed from other threads.
+ */
+void ProviderContext::forEach(const std::function<void(ProviderContext&)>& f)
+{
+	std::unique_lock<std::shared_mutex> lock(_mutex);
+
+	for (auto& p : _module2context)
+	{
+		f(*p.second);
+	}
+}
+
+/**
+ * Destroy contexts of all the modules.
+ * It must not be used while modules are processed from other threads.
+ */
+void ProviderContext::clear()
+{
+	std::map<const llvm::Module*, std::unique_ptr<ProviderContext>> contexts;
+	{
+		std::unique_lock<std::shared_mutex> lock(_mutex);
+		contexts.swap(_module2context);
+	}
+}
+
+//
+//=============================================================================
+//  ProviderContextGuard
+//=============================================================================
+//
+
+ProviderContextGuard::ProviderContextGuard(const llvm::Module* m) :
+		_module(m)
+{
+
+}
+
+ProviderContextGuard::~ProviderContextGuard()
+{
+	ProviderContext::release(_module);
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
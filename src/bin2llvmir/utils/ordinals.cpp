@@ -0,0 +1,246 @@
+/**
+ * @file src/bin2llvmir/utils/ordinals.cpp
+ * @brief Database of names of functions imported by ordinal numbers.
+ * @copyright (c) 2021 Avast Software, licensed under the MIT license
+ */
+
+#include <cctype>
+#include <cstring>
+#include <tuple>
+
+#include <llvm/ADT/StringRef.h>
+
+#include "retdec/bin2llvmir/utils/ordinals.h"
+
+namespace retdec {
+namespace bin2llvmir {
+
+namespace {
+
+// The index format is described in support/index-ordinals.py.
+const char indexMagic[] = {'R', 'D', 'O', 'R', 'D', 'I', 'D', 'X'};
+const std::uint32_t indexVersion = 1;
+const std::size_t indexHeaderSize = sizeof(indexMagic) + 2 * 4;
+const std::size_t indexSlotSize = 4 * 4;
+
+const std::uint32_t fnvOffsetBasis = 0x811c9dc5;
+const std::uint32_t fnvPrime = 0x01000193;
+
+std::uint32_t readUint32(const char* data)
+{
+	auto* bytes = reinterpret_cast<const unsigned char*>(data);
+	return std::uint32_t(bytes[0])
+			| std::uint32_t(bytes[1]) << 8
+			| std::uint32_t(bytes[2]) << 16
+			| std::uint32_t(bytes[3]) << 24;
+}
+
+std::uint32_t fnv1a(const char* data, std::size_t size, std::uint32_t h)
+{
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		h = (h ^ static_cast<unsigned char>(data[i])) * fnvPrime;
+	}
+	return h;
+}
+
+std::uint32_t keyHash(const std::string& libName, std::uint32_t ord)
+{
+	const char ordBytes[] = {
+			char(ord & 0xff),
+			char((ord >> 8) & 0xff),
+			char((ord >> 16) & 0xff),
+			char((ord >> 24) & 0xff)};
+	auto h = fnv1a(libName.data(), libName.size(), fnvOffsetBasis);
+	return fnv1a(ordBytes, sizeof(ordBytes), h);
+}
+
+} // anonymous namespace
+
+const std::string OrdinalDatabase::indexFileName = "ordinals.idx";
+
+/**
+ * Get the database of ordinal numbers stored in the given directory.
+ * The database is created on the first request and then shared by all the
+ * subsequent requests for the same directory.
+ */
+OrdinalDatabase& OrdinalDatabase::get(const std::string& ordinalsDir)
+{
+	static std::map<std::string, std::unique_ptr<OrdinalDatabase>> dbs;
+	static std::mutex dbsMutex;
+
+	std::lock_guard<std::mutex> lock(dbsMutex);
+	auto& db = dbs[ordinalsDir];
+	if (db == nullptr)
+	{
+		db.reset(new OrdinalDatabase(ordinalsDir));
+	}
+	return *db;
+}
+
+OrdinalDatabase::OrdinalDatabase(const std::string& ordinalsDir) :
+		_ordinalsDir(ordinalsDir)
+{
+	loadIndex();
+}
+
+/**
+ * Get the name of the function exported from library @a libName by ordinal
+ * number @a ord.
+ * @param libName Library name without the @c .dll suffix.
+ * @param ord     Ordinal number.
+ * @return Function name, or an empty string if it is not known.
+ */
+std::string OrdinalDatabase::getName(
+		const std::string& libName,
+		std::uint64_t ord)
+{
+	if (_index)
+	{
+		return getNameFromIndex(libName, ord);
+	}
+
+	std::lock_guard<std::mutex> lock(_ordFilesMutex);
+	auto& ords = getOrdMap(libName);
+	auto it = ords.find(ord);
+	return it != ords.end() ? it->second : std::string();
+}
+
+/**
+ * Map the index of the ordinals directory (if any) into memory.
+ * @return @c True if the index was loaded, @c false otherwise.
+ */
+bool OrdinalDatabase::loadIndex()
+{
+	auto buff = llvm::MemoryBuffer::getFile(
+			_ordinalsDir + "/" + indexFileName);
+	if (!buff)
+	{
+		return false;
+	}
+
+	auto* data = (*buff)->getBufferStart();
+	auto size = (*buff)->getBufferSize();
+	if (size < indexHeaderSize
+			|| std::memcmp(data, indexMagic, sizeof(indexMagic)) != 0
+			|| readUint32(data + sizeof(indexMagic)) != indexVersion)
+	{
+		return false;
+	}
+
+	// Slot count has to be a non-zero power of two, and all slots have to fit
+	// into the file.
+	auto slotCount = readUint32(data + sizeof(indexMagic) + 4);
+	if (slotCount == 0
+			|| (slotCount & (slotCount - 1)) != 0
+			|| (size - indexHeaderSize) / indexSlotSize < slotCount)
+	{
+		return false;
+	}
+
+	_index = std::move(*buff);
+	_indexSlotCount = slotCount;
+	return true;
+}
+
+std::string OrdinalDatabase::getNameFromIndex(
+		const std::string& libName,
+		std::uint64_t ord) const
+{
+	if (ord > UINT32_MAX)
+	{
+		return std::string();
+	}
+
+	auto* slots = _index->getBufferStart() + indexHeaderSize;
+	auto mask = _indexSlotCount - 1;
+	auto h = keyHash(libName, ord);
+	for (std::uint32_t i = h & mask, probes = 0;
+			probes < _indexSlotCount;
+			i = (i + 1) & mask, ++probes)
+	{
+		auto* slot = slots + i * indexSlotSize;
+		auto nameOffset = readUint32(slot + 12);
+		if (nameOffset == 0)
+		{
+			break;
+		}
+
+		if (readUint32(slot) != h || readUint32(slot + 4) != ord)
+		{
+			continue;
+		}
+
+		auto* lib = getIndexString(readUint32(slot + 8));
+		auto* name = getIndexString(nameOffset);
+		if (lib && name && libName == lib)
+		{
+			return name;
+		}
+	}
+
+	return std::string();
+}
+
+/**
+ * Get the null-terminated string at the given offset of the index string pool,
+ * or @c nullptr if the offset is invalid.
+ */
+const char* OrdinalDatabase::getIndexString(std::uint32_t offset) const
+{
+	auto poolOffset = indexHeaderSize + std::size_t(_indexSlotCount) * indexSlotSize;
+	auto size = _index->getBufferSize();
+	if (poolOffset + offset >= size)
+	{
+		return nullptr;
+	}
+
+	auto* str = _index->getBufferStart() + poolOffset + offset;
+	return std::memchr(str, '\0', size - poolOffset - offset) ? str : nullptr;
+}
+
+/**
+ * Get ordinals of the given library from its @c .ord file. The file is parsed
+ * only on the first request. Libraries without the file get an empty map, so
+ * the file system is not asked for them again.
+ */
+const OrdinalDatabase::OrdMap& OrdinalDatabase::getOrdMap(
+		const std::string& libName)
+{
+	auto it = _ordFiles.find(libName);
+	if (it != _ordFiles.end())
+	{
+		return it->second;
+	}
+
+	auto& ords = _ordFiles[libName];
+	auto buff = llvm::MemoryBuffer::getFile(
+			_ordinalsDir + "/" + libName + ".ord");
+	if (!buff)
+	{
+		return ords;
+	}
+
+	llvm::StringRef rest = (*buff)->getBuffer();
+	while (!rest.empty())
+	{
+		llvm::StringRef line;
+		std::tie(line, rest) = rest.split('\n');
+
+		auto isSpace = [](char c) { return std::isspace(c); };
+		line = line.ltrim();
+		auto ordStr = line.take_until(isSpace);
+		auto funcName = line.drop_front(ordStr.size()).ltrim().take_until(isSpace);
+
+		std::uint64_t ord = 0;
+		if (!ordStr.getAsInteger(10, ord) && !funcName.empty())
+		{
+			ords[ord] = funcName.str();
+		}
+	}
+
+	return ords;
+}
+
+} // namespace bin2llvmir
+} // namespace retdec
@@ -84,10 +84,9 @@ void Capstone2LlvmIrTranslatorArm_impl::translateInstruction(
 	cs_detail* d = i->detail;
 	cs_arm* ai = &d->arm;
 
-	auto fIt = _i2fm.find(i->id);
-	if (fIt != _i2fm.end() && fIt->second != nullptr)
+	auto f = i->id < _i2fm.size() ? _i2fm[i->id] : nullptr;
+	if (f != nullptr)
 	{
-		auto f = fIt->second;
 
 		bool branchInsn = i->id == ARM_INS_B || i->id == ARM_INS_BX
 				|| i->id == ARM_INS_BL || i->id == ARM_INS_BLX
@@ -123,12 +123,12 @@ class Capstone2LlvmIrTranslatorArm_impl :
 //==============================================================================
 //
 	protected:
-		static std::map<
-			std::size_t,
-			void (Capstone2LlvmIrTranslatorArm_impl::*)(
-					cs_insn* i,
-					cs_arm*,
-					llvm::IRBuilder<>&)> _i2fm;
+		using _translator_fnc = void (Capstone2LlvmIrTranslatorArm_impl::*)(
+				cs_insn* i,
+				cs_arm*,
+				llvm::IRBuilder<>&);
+		/// Translation methods indexed by Capstone instruction IDs.
+		static const std::array<_translator_fnc, ARM_INS_ENDING> _i2fm;
 //
 //==============================================================================
 // ARM instruction translation methods.
@@ -374,13 +374,10 @@ void Capstone2LlvmIrTranslatorArm_impl::initializePseudoCallInstructionIDs()
 //==============================================================================
 //
 
-std::map<
-	std::size_t,
-	void (Capstone2LlvmIrTranslatorArm_impl::*)(
-			cs_insn* i,
-			cs_arm*,
-			llvm::IRBuilder<>&)>
-Capstone2LlvmIrTranslatorArm_impl::_i2fm =
+const std::array<Capstone2LlvmIrTranslatorArm_impl::_translator_fnc, ARM_INS_ENDING>
+Capstone2LlvmIrTranslatorArm_impl::_i2fm = makeInstructionTable<
+		Capstone2LlvmIrTranslatorArm_impl::_translator_fnc,
+		ARM_INS_ENDING>(
 {
 		{ARM_INS_INVALID, nullptr},
 
@@ -821,7 +818,7 @@ Capstone2LlvmIrTranslatorArm_impl::_i2fm =
 		{ARM_INS_VPOP, nullptr},
 
 		{ARM_INS_ENDING, nullptr},
-};
+});
 
 } // namespace capstone2llvmir
 } // namespace retdec
@@ -1609,13 +1609,10 @@ void Capstone2LlvmIrTranslatorArm64_impl::initializeRegistersParentMap()
 //==============================================================================
 //
 
-std::map<
-	std::size_t,
-	void (Capstone2LlvmIrTranslatorArm64_impl::*)(
-			cs_insn* i,
-			cs_arm64*,
-			llvm::IRBuilder<>&)>
-Capstone2LlvmIrTranslatorArm64_impl::_i2fm =
+const std::array<Capstone2LlvmIrTranslatorArm64_impl::_translator_fnc, ARM64_INS_ENDING>
+Capstone2LlvmIrTranslatorArm64_impl::_i2fm = makeInstructionTable<
+		Capstone2LlvmIrTranslatorArm64_impl::_translator_fnc,
+		ARM64_INS_ENDING>(
 {
 	{ARM_INS_INVALID, nullptr},
 
@@ -2087,7 +2084,7 @@ Capstone2LlvmIrTranslatorArm64_impl::_i2fm =
 	{ARM64_INS_NGCS, &Capstone2LlvmIrTranslatorArm64_impl::translateNgc},
 
 	{ARM64_INS_ENDING, nullptr}
-};
+});
 
 } // namespace capstone2llvmir
 } // namespace retdec
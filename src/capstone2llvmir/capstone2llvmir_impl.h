@@ -8,12 +8,40 @@
 #ifndef CAPSTONE2LLVMIR_CAPSTONE2LLVMIR_IMPL_H
 #define CAPSTONE2LLVMIR_CAPSTONE2LLVMIR_IMPL_H
 
+#include <array>
+#include <initializer_list>
+#include <utility>
+
 #include "capstone2llvmir/llvmir_utils.h"
 #include "retdec/capstone2llvmir/capstone2llvmir.h"
 
 namespace retdec {
 namespace capstone2llvmir {
 
+/**
+ * Create a table of translation methods indexed by Capstone instruction IDs
+ * from the given <ID, method> pairs. The table is built at compile time, so
+ * a translator finds the method of an instruction by a single array access.
+ * IDs that are not listed (or do not fit into the table) get @c nullptr.
+ * If an ID is listed more than once, its first method is used.
+ */
+template <typename Method, std::size_t N>
+constexpr std::array<Method, N> makeInstructionTable(
+		std::initializer_list<std::pair<std::size_t, Method>> entries)
+{
+	std::array<Method, N> table{};
+	std::array<bool, N> used{};
+	for (auto& e : entries)
+	{
+		if (e.first < N && !used[e.first])
+		{
+			table[e.first] = e.second;
+			used[e.first] = true;
+		}
+	}
+	return table;
+}
+
 /**
  * Private implementation class.
  *
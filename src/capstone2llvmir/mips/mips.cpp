@@ -167,10 +167,9 @@ void Capstone2LlvmIrTranslatorMips_impl::translateInstruction(
 	cs_detail* d = i->detail;
 	cs_mips* mi = &d->mips;
 
-	auto fIt = _i2fm.find(i->id);
-	if (fIt != _i2fm.end() && fIt->second != nullptr)
+	auto f = i->id < _i2fm.size() ? _i2fm[i->id] : nullptr;
+	if (f != nullptr)
 	{
-		auto f = fIt->second;
 		(this->*f)(i, mi, irb);
 	}
 	else
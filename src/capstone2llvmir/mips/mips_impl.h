@@ -106,12 +106,12 @@ class Capstone2LlvmIrTranslatorMips_impl :
 //==============================================================================
 //
 	protected:
-		static std::map<
-			std::size_t,
-			void (Capstone2LlvmIrTranslatorMips_impl::*)(
-					cs_insn* i,
-					cs_mips*,
-					llvm::IRBuilder<>&)> _i2fm;
+		using _translator_fnc = void (Capstone2LlvmIrTranslatorMips_impl::*)(
+				cs_insn* i,
+				cs_mips*,
+				llvm::IRBuilder<>&);
+		/// Translation methods indexed by Capstone instruction IDs.
+		static const std::array<_translator_fnc, MIPS_INS_ENDING> _i2fm;
 //
 //==============================================================================
 // MIPS instruction translation methods.
@@ -317,13 +317,10 @@ void Capstone2LlvmIrTranslatorMips_impl::initializePseudoCallInstructionIDs()
 //==============================================================================
 //
 
-std::map<
-	std::size_t,
-	void (Capstone2LlvmIrTranslatorMips_impl::*)(
-			cs_insn* i,
-			cs_mips*,
-			llvm::IRBuilder<>&)>
-Capstone2LlvmIrTranslatorMips_impl::_i2fm =
+const std::array<Capstone2LlvmIrTranslatorMips_impl::_translator_fnc, MIPS_INS_ENDING>
+Capstone2LlvmIrTranslatorMips_impl::_i2fm = makeInstructionTable<
+		Capstone2LlvmIrTranslatorMips_impl::_translator_fnc,
+		MIPS_INS_ENDING>(
 {
 		{MIPS_INS_INVALID, nullptr},
 
@@ -960,7 +957,7 @@ Capstone2LlvmIrTranslatorMips_impl::_i2fm =
 		{MIPS_INS_JR_HB, nullptr}, // jump register with Hazard Barrier
 
 		{MIPS_INS_ENDING, nullptr},
-};
+});
 
 } // namespace capstone2llvmir
 } // namespace retdec
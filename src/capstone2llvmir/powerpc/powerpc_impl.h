@@ -106,12 +106,12 @@ class Capstone2LlvmIrTranslatorPowerpc_impl :
 //==============================================================================
 //
 	protected:
-		static std::map<
-			std::size_t,
-			void (Capstone2LlvmIrTranslatorPowerpc_impl::*)(
-					cs_insn* i,
-					cs_ppc*,
-					llvm::IRBuilder<>&)> _i2fm;
+		using _translator_fnc = void (Capstone2LlvmIrTranslatorPowerpc_impl::*)(
+				cs_insn* i,
+				cs_ppc*,
+				llvm::IRBuilder<>&);
+		/// Translation methods indexed by Capstone instruction IDs.
+		static const std::array<_translator_fnc, PPC_INS_ENDING> _i2fm;
 //
 //==============================================================================
 // PowerPC instruction translation methods.
@@ -588,13 +588,10 @@ void Capstone2LlvmIrTranslatorPowerpc_impl::initializePseudoCallInstructionIDs()
 //==============================================================================
 //
 
-std::map<
-	std::size_t,
-	void (Capstone2LlvmIrTranslatorPowerpc_impl::*)(
-			cs_insn* i,
-			cs_ppc*,
-			llvm::IRBuilder<>&)>
-Capstone2LlvmIrTranslatorPowerpc_impl::_i2fm =
+const std::array<Capstone2LlvmIrTranslatorPowerpc_impl::_translator_fnc, PPC_INS_ENDING>
+Capstone2LlvmIrTranslatorPowerpc_impl::_i2fm = makeInstructionTable<
+		Capstone2LlvmIrTranslatorPowerpc_impl::_translator_fnc,
+		PPC_INS_ENDING>(
 {
 		{PPC_INS_INVALID, nullptr},
 
@@ -1852,7 +1849,7 @@ Capstone2LlvmIrTranslatorPowerpc_impl::_i2fm =
 		//PPC_INS_BNULR   => PPC_INS_BNSLR  
 		//PPC_INS_BNULRL  => PPC_INS_BNSLRL   
 
-};
+});
 
 } // namespace capstone2llvmir
 } // namespace retdec
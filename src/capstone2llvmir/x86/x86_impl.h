@@ -208,13 +208,12 @@ class Capstone2LlvmIrTranslatorX86_impl :
 		/// map -- it will deal with added enums.
 		std::vector<uint32_t> _reg2parentMap;
 
-		/// Mapping of Capstone instruction IDs to their translation functions.
-		static std::map<
-			std::size_t,
-			void (Capstone2LlvmIrTranslatorX86_impl::*)(
-					cs_insn* i,
-					cs_x86*,
-					llvm::IRBuilder<>&)> _i2fm;
+		using _translator_fnc = void (Capstone2LlvmIrTranslatorX86_impl::*)(
+				cs_insn* i,
+				cs_x86*,
+				llvm::IRBuilder<>&);
+		/// Translation methods indexed by Capstone instruction IDs.
+		static const std::array<_translator_fnc, X86_INS_ENDING> _i2fm;
 
 		llvm::Value* top = nullptr;
 		llvm::Value* idx = nullptr;
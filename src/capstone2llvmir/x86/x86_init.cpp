@@ -603,13 +603,10 @@ void Capstone2LlvmIrTranslatorX86_impl::initializeRegistersParentMap64()
 //==============================================================================
 //
 
-std::map<
-	std::size_t,
-	void (Capstone2LlvmIrTranslatorX86_impl::*)(
-			cs_insn* i,
-			cs_x86*,
-			llvm::IRBuilder<>&)>
-Capstone2LlvmIrTranslatorX86_impl::_i2fm =
+const std::array<Capstone2LlvmIrTranslatorX86_impl::_translator_fnc, X86_INS_ENDING>
+Capstone2LlvmIrTranslatorX86_impl::_i2fm = makeInstructionTable<
+		Capstone2LlvmIrTranslatorX86_impl::_translator_fnc,
+		X86_INS_ENDING>(
 {
 		{X86_INS_INVALID, nullptr},
 
@@ -1958,7 +1955,7 @@ Capstone2LlvmIrTranslatorX86_impl::_i2fm =
 		{X86_INS_ENDBR64, &Capstone2LlvmIrTranslatorX86_impl::translateNop},
 
 		{X86_INS_ENDING, nullptr}, // mark the end of the list of insn
-};
+});
 
 } // namespace capstone2llvmir
 } // namespace retdec
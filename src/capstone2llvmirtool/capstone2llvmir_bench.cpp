@@ -0,0 +1,229 @@
+/**
+ * @file src/capstone2llvmirtool/capstone2llvmir_bench.cpp
+ * @brief Measures translation throughput of capstone2llvmir translators.
+ * @copyright (c) 2021 Avast Software, licensed under the MIT license
+ */
+
+#include <chrono>
+#include <iomanip>
+
+#include <llvm/IR/Module.h>
+
+#include "retdec/utils/conversion.h"
+#include "retdec/utils/io/log.h"
+
+#include "retdec/capstone2llvmir/capstone2llvmir.h"
+
+using namespace retdec::capstone2llvmir;
+using namespace retdec::utils::io;
+
+/**
+ * Fixed corpus of instructions translated by a single translator.
+ * It contains common instructions of function bodies -- prologue, epilogue,
+ * memory accesses, arithmetic, comparisons, branches and calls.
+ */
+struct Corpus
+{
+	std::string name;
+	cs_arch arch;
+	cs_mode basicMode;
+	cs_mode extraMode;
+	std::string code;
+};
+
+std::vector<Corpus> CORPORA =
+{
+	{"x86", CS_ARCH_X86, CS_MODE_32, CS_MODE_LITTLE_ENDIAN,
+		// push ebp; mov ebp, esp; sub esp, 0x10; mov eax, [ebp+8];
+		// add eax, ebx; xor ecx, ecx; test eax, eax; je +2;
+		// imul eax, ecx; lea eax, [esp+4]; call +0; leave; ret
+		"55 89 e5 83 ec 10 8b 45 08 01 d8 31 c9 85 c0 74 02 0f af c1"
+		"8d 44 24 04 e8 00 00 00 00 c9 c3"},
+	{"x64", CS_ARCH_X86, CS_MODE_64, CS_MODE_LITTLE_ENDIAN,
+		// push rbp; mov rbp, rsp; sub rsp, 0x10; mov rax, [rbp+8];
+		// add rax, rbx; xor ecx, ecx; test rax, rax; je +2;
+		// imul rax, rcx; lea rax, [rsp+4]; call +0; leave; ret
+		"55 48 89 e5 48 83 ec 10 48 8b 45 08 48 01 d8 31 c9 48 85 c0"
+		"74 02 48 0f af c1 48 8d 44 24 04 e8 00 00 00 00 c9 c3"},
+	{"arm", CS_ARCH_ARM, CS_MODE_ARM, CS_MODE_LITTLE_ENDIAN,
+		// push {r11, lr}; mov r11, sp; sub sp, sp, #8; ldr r0, [r11, #-8];
+		// add r0, r0, r1; cmp r0, #0; beq +8; mul r0, r1, r0;
+		// str r0, [sp]; bl +0; pop {r11, pc}
+		"00 48 2d e9 0d b0 a0 e1 08 d0 4d e2 08 00 1b e5 01 00 80 e0"
+		"00 00 50 e3 00 00 00 0a 91 00 00 e0 00 00 8d e5 fe ff ff eb"
+		"00 88 bd e8"},
+	{"thumb", CS_ARCH_ARM, CS_MODE_THUMB, CS_MODE_LITTLE_ENDIAN,
+		// push {r7, lr}; mov r7, sp; ldr r0, [r7, #4]; adds r0, r0, r1;
+		// cmp r0, #0; beq +4; pop {r7, pc}
+		"80 b5 6f 46 78 68 40 18 00 28 00 d0 80 bd"},
+	{"arm64", CS_ARCH_ARM64, CS_MODE_ARM, CS_MODE_LITTLE_ENDIAN,
+		// stp x29, x30, [sp, #-16]!; mov x29, sp; ldr x0, [sp, #8];
+		// add x0, x0, x1; sub x0, x0, #1; cmp x0, #0; b.eq +8;
+		// mul x0, x0, x1; bl +0; ldp x29, x30, [sp], #16; ret
+		"fd 7b bf a9 fd 03 00 91 e0 07 40 f9 00 00 01 8b 00 04 00 d1"
+		"1f 00 00 f1 40 00 00 54 00 7c 01 9b 00 00 00 94 fd 7b c1 a8"
+		"c0 03 5f d6"},
+	{"mips", CS_ARCH_MIPS, CS_MODE_MIPS32, CS_MODE_BIG_ENDIAN,
+		// addiu sp, sp, -32; sw ra, 28(sp); lw v0, 8(sp); addu v0, v0, a0;
+		// lui at, 0x1234; ori at, at, 0x5678; beq v0, zero, +12; nop;
+		// jal 0; nop; jr ra; nop
+		"27 bd ff e0 af bf 00 1c 8f a2 00 08 00 44 10 21 3c 01 12 34"
+		"34 21 56 78 10 40 00 02 00 00 00 00 0c 00 00 00 00 00 00 00"
+		"03 e0 00 08 00 00 00 00"},
+	{"ppc", CS_ARCH_PPC, CS_MODE_32, CS_MODE_BIG_ENDIAN,
+		// stwu r1, -16(r1); mflr r0; stw r0, 20(r1); lwz r3, 8(r1);
+		// add r3, r3, r4; addi r3, r3, 1; cmpwi r3, 0; beq +8;
+		// mullw r3, r3, r4; bl +0; mtlr r0; blr
+		"94 21 ff f0 7c 08 02 a6 90 01 00 14 80 61 00 08 7c 63 22 14"
+		"38 63 00 01 2c 03 00 00 41 82 00 08 7c 63 21 d6 48 00 00 01"
+		"7c 08 03 a6 4e 80 00 20"},
+};
+
+class ProgramOptions
+{
+	public:
+		ProgramOptions(int argc, char *argv[])
+		{
+			if (argc > 0)
+			{
+				_programName = argv[0];
+			}
+
+			for (int i = 1; i < argc; ++i)
+			{
+				std::string c = argv[i];
+
+				if (c == "-a")
+				{
+					corpus = getParamOrDie(argc, argv, i);
+				}
+				else if (c == "-n")
+				{
+					auto n = getParamOrDie(argc, argv, i);
+					if (!retdec::utils::strToNum(n, rounds) || rounds == 0)
+					{
+						printHelpAndDie();
+					}
+				}
+				else
+				{
+					printHelpAndDie();
+				}
+			}
+		}
+
+		std::string getParamOrDie(int argc, char *argv[], int& i)
+		{
+			if (argc > i+1)
+			{
+				return argv[++i];
+			}
+			else
+			{
+				printHelpAndDie();
+				return std::string();
+			}
+		}
+
+		void printHelpAndDie()
+		{
+			Log::info() << _programName << ":\n"
+				"\t-h|--help Show this help.\n"
+				"\t-a name   Benchmark only the given corpus.\n"
+				"\t          Possible values: x86, x64, arm, thumb, arm64, mips, ppc\n"
+				"\t          Default value: all of them.\n"
+				"\t-n rounds Number of times each corpus is translated.\n"
+				"\t          Default value: 10000.\n";
+
+			exit(0);
+		}
+
+	public:
+		std::string corpus;
+		std::size_t rounds = 10000;
+
+	private:
+		std::string _programName = "capstone2llvmir-bench";
+};
+
+/**
+ * Translate the given corpus @a rounds times and print the number of
+ * instructions translated per second. Each round is translated into a new
+ * function, which is erased afterwards, so that the module does not grow.
+ * Only the translation itself is measured.
+ */
+void benchmark(const Corpus& corpus, std::size_t rounds)
+{
+	auto code = retdec::utils::hexStringToBytes(corpus.code);
+
+	llvm::LLVMContext ctx;
+	llvm::Module module("bench", ctx);
+	auto c2l = Capstone2LlvmIrTranslator::createArch(
+			corpus.arch,
+			&module,
+			corpus.basicMode,
+			corpus.extraMode);
+
+	std::size_t insns = 0;
+	std::chrono::steady_clock::duration elapsed{};
+	for (std::size_t r = 0; r < rounds; ++r)
+	{
+		auto* f = llvm::Function::Create(
+				llvm::FunctionType::get(llvm::Type::getVoidTy(ctx), false),
+				llvm::GlobalValue::ExternalLinkage,
+				"root",
+				&module);
+		llvm::BasicBlock::Create(ctx, "entry", f);
+		llvm::IRBuilder<> irb(&f->front());
+		irb.SetInsertPoint(irb.CreateRetVoid());
+
+		auto start = std::chrono::steady_clock::now();
+		auto res = c2l->translate(code.data(), code.size(), 0x1000, irb);
+		elapsed += std::chrono::steady_clock::now() - start;
+
+		insns += res.count;
+		for (auto& p : res.insns)
+		{
+			cs_free(p.second, 1);
+		}
+		f->dropAllReferences();
+		f->eraseFromParent();
+	}
+
+	auto seconds = std::chrono::duration<double>(elapsed).count();
+	Log::info() << std::left << std::setw(8) << corpus.name
+			<< std::right << std::setw(12) << insns << " insns  "
+			<< std::fixed << std::setprecision(3) << seconds << " s  "
+			<< std::setprecision(0) << (seconds > 0 ? insns / seconds : 0)
+			<< " insns/s" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+	ProgramOptions po(argc, argv);
+
+	bool found = false;
+	for (auto& c : CORPORA)
+	{
+		if (po.corpus.empty() || po.corpus == c.name)
+		{
+			found = true;
+			try
+			{
+				benchmark(c, po.rounds);
+			}
+			catch (const BaseError& e)
+			{
+				Log::error() << c.name << ": " << e.what() << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+	}
+
+	if (!found)
+	{
+		po.printHelpAndDie();
+	}
+
+	return EXIT_SUCCESS;
+}
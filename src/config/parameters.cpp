@@ -59,6 +59,7 @@ const std::string JSON_backendNoCompoundOperators = "backendNoCompoundOperators"
 const std::string JSON_backendNoSymbolicNames   = "backendNoSymbolicNames";
 
 const std::string JSON_timeout                  = "timeout";
+const std::string JSON_threads                  = "threads";
 const std::string JSON_maxMemoryLimit           = "maxMemoryLimit";
 const std::string JSON_maxMemoryLimitHalfRam    = "maxMemoryLimitHalfRam";
 
@@ -251,6 +252,11 @@ void Parameters::setTimeout(uint64_t seconds)
 	_timeout = seconds;
 }
 
+void Parameters::setThreads(uint64_t threads)
+{
+	_threads = threads;
+}
+
 void Parameters::setEntryPoint(const retdec::common::Address& a)
 {
 	_entryPoint = a;
@@ -405,6 +411,11 @@ uint64_t Parameters::getTimeout() const
 	return _timeout;
 }
 
+uint64_t Parameters::getThreads() const
+{
+	return _threads;
+}
+
 retdec::common::Address Parameters::getEntryPoint() const
 {
 	return _entryPoint;
@@ -515,6 +526,7 @@ void Parameters::serialize(Writer& writer) const
 	serdes::serializeBool(writer, JSON_backendNoSymbolicNames, isBackendNoSymbolicNames());
 
 	serdes::serializeUint64(writer, JSON_timeout, getTimeout());
+	serdes::serializeUint64(writer, JSON_threads, getThreads());
 	serdes::serializeUint64(writer, JSON_maxMemoryLimit, getMaxMemoryLimit());
 	serdes::serializeBool(writer, JSON_maxMemoryLimitHalfRam, isMaxMemoryLimitHalfRam());
 
@@ -583,6 +595,7 @@ void Parameters::deserialize(const rapidjson::Value& val)
 	setIsBackendNoSymbolicNames( serdes::deserializeBool(val, JSON_backendNoSymbolicNames, false) );
 
 	setTimeout( serdes::deserializeUint64(val, JSON_timeout, 0) );
+	setThreads( serdes::deserializeUint64(val, JSON_threads, 1) );
 	setMaxMemoryLimit( serdes::deserializeUint64(val, JSON_maxMemoryLimit, 0) );
 	setIsMaxMemoryLimitHalfRam( serdes::deserializeBool(val, JSON_maxMemoryLimitHalfRam, true) );
 
@@ -499,13 +499,15 @@ void CompilerDetector::getAllHeuristics()
 ReturnCode CompilerDetector::getAllSignatures()
 {
 	YaraDetector yara;
+	std::vector<std::string> ruleFiles;
+	std::vector<std::string> nameSpaces;
 
 	// Add internal paths.
 	unsigned iCntr = 0;
 	for (const auto &ruleFile : internalPaths)
 	{
-		std::string nameSpace = "internal_" + std::to_string(iCntr++);
-		yara.addRuleFile(ruleFile, nameSpace);
+		ruleFiles.push_back(ruleFile);
+		nameSpaces.push_back("internal_" + std::to_string(iCntr++));
 	}
 
 	unsigned eCntr = 0;
@@ -513,13 +515,24 @@ ReturnCode CompilerDetector::getAllSignatures()
 	{
 		for (const auto &item : externalDatabase)
 		{
-			std::string nameSpace = "external_" + std::to_string(eCntr++);
-			yara.addRuleFile(item, nameSpace);
+			ruleFiles.push_back(item);
+			nameSpaces.push_back("external_" + std::to_string(eCntr++));
 		}
 	}
 
+	// Scan the file only once for all the rule files. If some of them are
+	// broken, do not let them hide the others.
+	if (!yara.addRuleFiles(ruleFiles, nameSpaces))
+	{
+		for (std::size_t i = 0, e = ruleFiles.size(); i < e; ++i)
+		{
+			yara.addRuleFile(ruleFiles[i], nameSpaces[i]);
+		}
+	}
+
+	// The loader may have applied relocations to the file content.
 	yara.analyze(
-			fileParser.getPathToFile(),
+			fileParser.getOriginalBytes(),
 			cpParams.searchType != SearchType::EXACT_MATCH
 	);
 	const auto &detected = yara.getDetectedRules();
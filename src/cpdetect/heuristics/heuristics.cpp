@@ -688,16 +688,15 @@ void Heuristics::getDwarfInfo()
 	std::vector<std::string> languages;
 	std::vector<std::size_t> modulesCounter;
 
-	// Open input file as buffer.
+	// Use the input file content as buffer. The input may exist only in
+	// memory, and the loader may have overwritten some of its bytes.
 	//
-	llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffOrErr =
-			llvm::MemoryBuffer::getFileOrSTDIN(fileParser.getPathToFile());
-	if (buffOrErr.getError())
-	{
-		return;
-	}
-	std::unique_ptr<llvm::MemoryBuffer> bufferPtr = std::move(buffOrErr.get());
-	llvm::MemoryBufferRef buffer = *bufferPtr;
+	const auto& bytes = fileParser.getOriginalBytes();
+	llvm::MemoryBufferRef buffer(
+			llvm::StringRef(
+				reinterpret_cast<const char*>(bytes.data()),
+				bytes.size()),
+			fileParser.getPathToFile());
 
 	// Open buffer as a binary file.
 	//
@@ -953,7 +952,8 @@ std::string Heuristics::getUpxVersion()
 		const std::size_t versionLen = 4;
 		if (pos <= content.length() - pattern.length() - versionLen)
 		{
-			return content.substr(pos + pattern.length(), versionLen);
+			return std::string(
+					content.substr(pos + pattern.length(), versionLen));
 		}
 	}
 
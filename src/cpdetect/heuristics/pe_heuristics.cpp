@@ -8,6 +8,7 @@
 #include <limits>
 #include <map>
 #include <regex>
+#include <string_view>
 
 #include <tinyxml2/tinyxml2.h>
 
@@ -118,13 +119,13 @@ const std::vector<PeHeaderStyle> headerStyles =
  * @param content Content of file
  * @return @c true if string is found, @c false otherwise
  */
-bool findAutoIt(const std::string &content)
+bool findAutoIt(std::string_view content)
 {
 	const std::string prefix = "AU3!EA";
 	const std::regex regExp(prefix + "[0-9]{2}");
 	const auto offset = content.find(prefix);
-	return offset != std::string::npos
-			&& regex_match(content.substr(offset, 8), regExp);
+	return offset != std::string_view::npos
+			&& regex_match(std::string(content.substr(offset, 8)), regExp);
 }
 
 /**
@@ -405,7 +406,7 @@ void PeHeuristics::getHeaderStyleHeuristics()
 	// Must have at least IMAGE_DOS_HEADER
 	if (content.length() > 0x40)
 	{
-		const char * e_cblp = content.c_str() + 0x02;
+		const char * e_cblp = content.data() + 0x02;
 
 		for (size_t i = 0; i < headerStyles.size(); i++)
 		{
@@ -680,7 +681,7 @@ void PeHeuristics::getSecuROMHeuristics()
 		if (loadedLength >= declaredLength)
 		{
 			// Retrieve the offset of the securom header
-			fileData = search.getPlainString().c_str();
+			fileData = search.getPlainString().data();
 			memcpy(
 					&SecuromOffs,
 					fileData + loadedLength - sizeof(uint32_t),
@@ -721,7 +722,7 @@ void PeHeuristics::getMPRMMGVAHeuristics()
 {
 	const auto &content = search.getPlainString();
 	const uint8_t * fileData = reinterpret_cast<const uint8_t *>(
-			content.c_str());
+			content.data());
 	const uint8_t * filePtr = fileData + toolInfo.epOffset;
 	const uint8_t * fileEnd = fileData + content.length();
 	unsigned long long offset1;
@@ -941,8 +942,8 @@ void PeHeuristics::getUpxHeuristics()
 	{
 		std::string version;
 		std::size_t num;
-		if (strToNum(content.substr(pos - minPos, 1), num)
-				&& strToNum(content.substr(pos - minPos + 2, 2), num))
+		if (strToNum(std::string(content.substr(pos - minPos, 1)), num)
+				&& strToNum(std::string(content.substr(pos - minPos + 2, 2)), num))
 		{
 			version = content.substr(pos - minPos, verLen);
 		}
@@ -1057,7 +1058,7 @@ void PeHeuristics::getEnigmaHeuristics()
 						source,
 						strength,
 						"Enigma",
-						content.substr(pos + pattern.length(), 4)
+						std::string(content.substr(pos + pattern.length(), 4))
 				);
 				return;
 			}
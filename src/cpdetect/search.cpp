@@ -5,6 +5,7 @@
  */
 
 #include <algorithm>
+#include <cstring>
 #include <map>
 
 #include "retdec/utils/container.h"
@@ -48,11 +49,27 @@ Search::Search(retdec::fileformat::FileFormat &fileParser)
 		, averageSlashLen(0)
 {
 	const auto &bytes = parser.getLoadedBytes();
-	bytesToHexString(bytes, nibbles);
-	bytesToString(bytes, plain);
+	plain = std::string_view(
+			reinterpret_cast<const char*>(bytes.data()),
+			bytes.size());
 	fileLoaded = !bytes.empty();
-	fileSupported = parser.hexToLittle(nibbles)
-			&& parser.getNumberOfNibblesInByte();
+
+	// Hexadecimal representation of little endian files is the same as the
+	// representation of the loaded bytes, so it is not stored at all and
+	// nibbles are computed from the loaded bytes when needed.
+	if (parser.isBigEndian())
+	{
+		bytesToHexString(bytes, nibbles);
+		fileSupported = parser.hexToLittle(nibbles);
+		nibblesLength = nibbles.length();
+	}
+	else
+	{
+		std::string empty;
+		fileSupported = parser.hexToLittle(empty);
+		nibblesLength = bytes.size() * 2;
+	}
+	fileSupported = fileSupported && parser.getNumberOfNibblesInByte();
 	jumps = mapGetValueOrDefault(
 			jumpMap,
 			parser.getTargetArchitecture(),
@@ -145,6 +162,202 @@ std::size_t Search::bytesFromNibbles(std::size_t nNibbles) const
 	return parser.bytesFromNibbles(nNibbles);
 }
 
+/**
+ * Get nibble of file on the given index
+ * @param index Index of nibble in hexadecimal representation of file
+ * @return Nibble as an uppercase hexadecimal digit
+ *
+ * @a index must be less than number of nibbles in file
+ */
+char Search::getNibble(std::size_t index) const
+{
+	if (!nibbles.empty())
+	{
+		return nibbles[index];
+	}
+
+	static const char hexDigits[] = "0123456789ABCDEF";
+	const auto byte = static_cast<unsigned char>(plain[index / 2]);
+	return hexDigits[index % 2 ? byte & 0x0F : byte >> 4];
+}
+
+/**
+ * Check if hexadecimal representation of file has substring @a str on
+ * nibble position @a position
+ * @param str Coveted substring
+ * @param position Index of nibble in hexadecimal representation of file
+ * @return @c true if file has @a str on @a position, @c false otherwise
+ */
+bool Search::hasNibblesOnPosition(
+		const std::string &str,
+		std::size_t position) const
+{
+	if (position >= nibblesLength || nibblesLength - position < str.length())
+	{
+		return false;
+	}
+
+	for (std::size_t i = 0, e = str.length(); i < e; ++i)
+	{
+		if (getNibble(position + i) != str[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Check if signature patterns can be matched directly on the loaded bytes
+ * @return @c true if hexadecimal representation of file is the same as the
+ *    representation of the loaded bytes, @c false otherwise
+ */
+bool Search::canMatchBytes() const
+{
+	return nibbles.empty() && parser.getNumberOfNibblesInByte() == 2;
+}
+
+/**
+ * Compile signature pattern for matching directly on the loaded bytes
+ * @param signPattern Signature pattern
+ * @param length Number of compiled characters of @a signPattern
+ * @return Compiled pattern
+ *
+ * Semicolons are compiled as variable nibbles. If the pattern contains
+ * slashes, member @c compiled of the result is set to @c false.
+ */
+Search::CompiledPattern Search::compilePattern(
+		const std::string &signPattern,
+		std::size_t length) const
+{
+	CompiledPattern result;
+	for (std::size_t form = 0; form < 2; ++form)
+	{
+		const auto size = (length + form + 1) / 2;
+		result.values[form].assign(size, 0);
+		result.masks[form].assign(size, 0);
+	}
+
+	for (std::size_t i = 0; i < length; ++i)
+	{
+		const auto c = signPattern[i];
+		std::uint8_t value = 0;
+		if (c == '-' || c == '?' || c == ';')
+		{
+			continue;
+		}
+		else if (c >= '0' && c <= '9')
+		{
+			value = c - '0';
+		}
+		else if (c >= 'A' && c <= 'F')
+		{
+			value = c - 'A' + 10;
+		}
+		else
+		{
+			result.compiled = false;
+			return result;
+		}
+
+		++result.fixedNibbles;
+		for (std::size_t form = 0; form < 2; ++form)
+		{
+			const auto position = i + form;
+			const auto shift = position % 2 ? 0 : 4;
+			result.values[form][position / 2] |= value << shift;
+			result.masks[form][position / 2] |= 0x0F << shift;
+		}
+	}
+
+	// Prefer anchor bytes which are not too common in files.
+	for (std::size_t form = 0; form < 2; ++form)
+	{
+		const auto &values = result.values[form];
+		const auto &masks = result.masks[form];
+		result.anchors[form] = masks.size();
+		for (std::size_t i = 0, e = masks.size(); i < e; ++i)
+		{
+			if (masks[i] != 0xFF)
+			{
+				continue;
+			}
+			if (result.anchors[form] == e)
+			{
+				result.anchors[form] = i;
+			}
+			if (values[i] != 0x00 && values[i] != 0xFF)
+			{
+				result.anchors[form] = i;
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+ * Check if compiled pattern matches the loaded bytes
+ * @param pattern Compiled pattern
+ * @param form Index of the pattern form (@c 0 if pattern starts on the high
+ *    nibble of byte, @c 1 if it starts on the low nibble)
+ * @param byteOffset Offset of the first byte of pattern in file
+ * @return @c true if pattern matches, @c false otherwise
+ *
+ * All bytes of pattern must be inside of file.
+ */
+bool Search::matchesBytes(
+		const CompiledPattern &pattern,
+		std::size_t form,
+		std::size_t byteOffset) const
+{
+	const auto *data = reinterpret_cast<const std::uint8_t*>(plain.data())
+			+ byteOffset;
+	const auto &values = pattern.values[form];
+	const auto &masks = pattern.masks[form];
+	for (std::size_t i = 0, e = masks.size(); i < e; ++i)
+	{
+		if ((data[i] & masks[i]) != values[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Count significant nibbles of compiled pattern which agree with the loaded
+ * bytes
+ * @param pattern Compiled pattern
+ * @param form Index of the pattern form (see @c matchesBytes())
+ * @param byteOffset Offset of the first byte of pattern in file
+ * @return Number of agreeing nibbles
+ *
+ * All bytes of pattern must be inside of file.
+ */
+std::size_t Search::countSameNibbles(
+		const CompiledPattern &pattern,
+		std::size_t form,
+		std::size_t byteOffset) const
+{
+	const auto *data = reinterpret_cast<const std::uint8_t*>(plain.data())
+			+ byteOffset;
+	const auto &values = pattern.values[form];
+	const auto &masks = pattern.masks[form];
+	std::size_t result = 0;
+	for (std::size_t i = 0, e = masks.size(); i < e; ++i)
+	{
+		const auto diff = (data[i] ^ values[i]) & masks[i];
+		result += (masks[i] & 0xF0) && !(diff & 0xF0);
+		result += (masks[i] & 0x0F) && !(diff & 0x0F);
+	}
+
+	return result;
+}
+
 /**
  * Check if input file was successfully loaded
  * @return @c true if file was successfully loaded, @c false otherwise
@@ -166,17 +379,32 @@ bool Search::isFileSupported() const
 /**
  * Get content of file in hexadecimal string representation
  * @return Content of file in hexadecimal string representation
+ *
+ * The representation is created on each call, use it sparingly.
  */
-const std::string& Search::getNibbles() const
+std::string Search::getNibbles() const
 {
-	return nibbles;
+	if (!nibbles.empty())
+	{
+		return nibbles;
+	}
+
+	std::string result(nibblesLength, '\0');
+	for (std::size_t i = 0; i < nibblesLength; ++i)
+	{
+		result[i] = getNibble(i);
+	}
+	return result;
 }
 
 /**
  * Get content of file as plain string
  * @return Content of file as plain string
+ *
+ * Returned view refers to the loaded bytes of file, so it is valid as long
+ * as the file parser is.
  */
-const std::string& Search::getPlainString() const
+std::string_view Search::getPlainString() const
 {
 	return plain;
 }
@@ -201,9 +429,9 @@ const Search::RelativeJump* Search::getRelativeJump(
 	for (const auto &jump : jumps)
 	{
 		const auto nibblesAfter = nibblesFromBytes(jump.getBytesAfter());
-		if (!hasSubstringOnPosition(nibbles, jump.getSlash(), nibbleOffset)
+		if (!hasNibblesOnPosition(jump.getSlash(), nibbleOffset)
 				|| (nibbleOffset + jump.getSlashNibbleSize() + nibblesAfter - 1
-						>= nibbles.length()))
+						>= nibblesLength))
 		{
 			continue;
 		}
@@ -287,26 +515,96 @@ unsigned long long Search::findUnslashedSignature(
 		return 0;
 	}
 
-	const auto startIterator = nibbles.begin() + nibblesFromBytes(startOffset);
-	const auto stopIndex = nibblesFromBytes(stopOffset) + 1;
-	const auto stopIterator = stopIndex < nibbles.size()
-			? nibbles.begin() + stopIndex
-			: nibbles.end();
-	const auto it = std::search(
-			startIterator,
-			stopIterator,
-			signPattern.begin(),
-			signPattern.end(),
-			[] (const char fileNibble, const char signatureNibble)
+	const auto startIndex = nibblesFromBytes(startOffset);
+	const auto stopIndex = std::min(
+			nibblesFromBytes(stopOffset) + 1,
+			nibblesLength);
+	const auto patternLength = signPattern.length();
+	if (startIndex >= stopIndex || stopIndex - startIndex < patternLength)
+	{
+		return 0;
+	}
+
+	const auto lastIndex = stopIndex - patternLength;
+	if (canMatchBytes())
+	{
+		const auto compiled = compilePattern(signPattern, patternLength);
+		if (!compiled.compiled)
+		{
+			// Slashes never agree with nibbles of file.
+			return 0;
+		}
+
+		const auto *data = reinterpret_cast<const std::uint8_t*>(plain.data());
+		for (std::size_t form = 0; form < 2; ++form)
+		{
+			const auto firstIndex = startIndex + (startIndex % 2 != form);
+			if (firstIndex > lastIndex)
 			{
-				return fileNibble == signatureNibble
-						|| signatureNibble == '-'
-						|| signatureNibble == '?'
-						|| signatureNibble == ';';
+				continue;
 			}
-	);
 
-	return (it != stopIterator) ? countImpNibbles(signPattern) : 0;
+			const auto firstByte = firstIndex / 2;
+			const auto lastByte = (lastIndex - form) / 2;
+			const auto anchor = compiled.anchors[form];
+			if (anchor == compiled.masks[form].size())
+			{
+				for (auto b = firstByte; b <= lastByte; ++b)
+				{
+					if (matchesBytes(compiled, form, b))
+					{
+						return countImpNibbles(signPattern);
+					}
+				}
+				continue;
+			}
+
+			// Jump right to the candidate positions.
+			const auto anchorValue = compiled.values[form][anchor];
+			for (auto b = firstByte; b <= lastByte; ++b)
+			{
+				const auto *hit = static_cast<const std::uint8_t*>(std::memchr(
+						data + b + anchor,
+						anchorValue,
+						lastByte - b + 1));
+				if (!hit)
+				{
+					break;
+				}
+
+				b = hit - data - anchor;
+				if (matchesBytes(compiled, form, b))
+				{
+					return countImpNibbles(signPattern);
+				}
+			}
+		}
+
+		return 0;
+	}
+
+	for (std::size_t i = startIndex; i <= lastIndex; ++i)
+	{
+		std::size_t j = 0;
+		for (; j < patternLength; ++j)
+		{
+			const auto signatureNibble = signPattern[j];
+			if (signatureNibble != '-'
+					&& signatureNibble != '?'
+					&& signatureNibble != ';'
+					&& signatureNibble != getNibble(i + j))
+			{
+				break;
+			}
+		}
+
+		if (j == patternLength)
+		{
+			return countImpNibbles(signPattern);
+		}
+	}
+
+	return 0;
 }
 
 /**
@@ -363,7 +661,7 @@ unsigned long long Search::exactComparison(
 {
 	for (std::size_t sigIndex = 0,
 			fileIndex = nibblesFromBytes(fileOffset) + shift,
-			fileLen = nibbles.length()
+			fileLen = nibblesLength
 			;
 			fileIndex < fileLen
 			;
@@ -398,7 +696,7 @@ unsigned long long Search::exactComparison(
 					+ moveSize
 					- 1;
 		}
-		else if (signPattern[sigIndex] != nibbles[fileIndex]
+		else if (signPattern[sigIndex] != getNibble(fileIndex)
 				&& signPattern[sigIndex] != '-'
 				&& signPattern[sigIndex] != '?')
 		{
@@ -430,7 +728,7 @@ bool Search::countSimilarity(
 
 	for (std::size_t sigIndex = 0,
 			fileIndex = nibblesFromBytes(fileOffset) + shift,
-			fileLen = nibbles.length()
+			fileLen = nibblesLength
 			;
 			fileIndex < fileLen
 			;
@@ -475,7 +773,7 @@ bool Search::countSimilarity(
 			}
 			continue;
 		}
-		else if (signPattern[sigIndex] == nibbles[fileIndex])
+		else if (signPattern[sigIndex] == getNibble(fileIndex))
 		{
 			++result.same;
 		}
@@ -520,6 +818,44 @@ bool Search::areaSimilarity(
 	auto result = false;
 	Similarity act, max;
 
+	if (canMatchBytes())
+	{
+		const auto length = std::min(
+				signPattern.find(';'),
+				signPattern.length());
+		const auto compiled = compilePattern(signPattern, length);
+		if (compiled.compiled && compiled.fixedNibbles)
+		{
+			act.total = compiled.fixedNibbles;
+			for (std::size_t i = 0; i < iters; ++i)
+			{
+				// The same condition as in countSimilarity().
+				const auto index = nibblesFromBytes(startOffset) + i;
+				if (index + length >= nibblesLength)
+				{
+					continue;
+				}
+
+				const auto form = index % 2;
+				act.same = countSameNibbles(compiled, form, index / 2);
+				act.ratio = static_cast<double>(act.same) / act.total;
+				if (act.ratio > max.ratio
+						|| (areEqual(act.ratio, max.ratio)
+								&& act.total > max.total))
+				{
+					max = act;
+					result = true;
+				}
+			}
+
+			if (result)
+			{
+				sim = max;
+			}
+			return result;
+		}
+	}
+
 	for (std::size_t i = 0; i < iters; ++i)
 	{
 		if (countSimilarity(signPattern, act, startOffset, i)
@@ -551,7 +887,7 @@ bool Search::areaSimilarity(
  */
 bool Search::hasString(const std::string &str) const
 {
-	return contains(plain, str);
+	return plain.find(str) != std::string_view::npos;
 }
 
 /**
@@ -563,7 +899,9 @@ bool Search::hasString(const std::string &str) const
  */
 bool Search::hasString(const std::string &str, std::size_t fileOffset) const
 {
-	return hasSubstringOnPosition(plain, str, fileOffset);
+	return fileOffset < plain.length()
+			&& plain.length() - fileOffset >= str.length()
+			&& plain.compare(fileOffset, str.length(), str) == 0;
 }
 
 /**
@@ -579,7 +917,13 @@ bool Search::hasString(
 		std::size_t startOffset,
 		std::size_t stopOffset) const
 {
-	return hasSubstringInArea(plain, str, startOffset, stopOffset);
+	if (startOffset > stopOffset || startOffset >= plain.length())
+	{
+		return false;
+	}
+
+	const auto area = plain.substr(startOffset, stopOffset - startOffset + 1);
+	return area.find(str) != std::string_view::npos;
 }
 
 /**
@@ -641,7 +985,7 @@ bool Search::createSignature(
 
 	for (std::size_t i = 0,
 			fileIndex = nibblesFromBytes(fileOffset),
-			fileLen = nibbles.length(),
+			fileLen = nibblesLength,
 			nibbleSize = nibblesFromBytes(size)
 			;
 			fileIndex < fileLen && i < nibbleSize
@@ -664,7 +1008,7 @@ bool Search::createSignature(
 		}
 		else
 		{
-			pattern += nibbles[fileIndex];
+			pattern += getNibble(fileIndex);
 		}
 	}
 
@@ -10,6 +10,8 @@
 #include <sstream>
 
 #include <rapidjson/error/en.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
 
 #include "retdec/ctypes/ctypes.h"
 #include "retdec/ctypesparser/json_ctypes_parser.h"
@@ -53,6 +55,122 @@ const std::string JSON_union                = "union";
 const std::string JSON_unknown_type         = "unknown";
 const std::string JSON_void                 = "void";
 
+/**
+* @brief Handler of SAX events that finds functions and types in JSON.
+*
+* For every function and type, it stores the part of the JSON in which the
+* function or type is described, so it can be parsed later.
+*/
+class JSONIndexHandler: public rapidjson::BaseReaderHandler<
+		rapidjson::UTF8<>, JSONIndexHandler>
+{
+	public:
+		/// Mapping of names into parts (offset, length) of the JSON.
+		using Index = std::unordered_map<std::string, std::pair<std::size_t, std::size_t>>;
+
+	public:
+		JSONIndexHandler(const rapidjson::MemoryStream &stream,
+				Index &functions, Index &types):
+			stream(stream), functions(functions), types(types) {}
+
+		bool Key(const char *str, rapidjson::SizeType length, bool)
+		{
+			if (depth == 1)
+			{
+				std::string key(str, length);
+				currentIndex = key == JSON_functions ? &functions :
+					key == JSON_types ? &types : nullptr;
+				objectExpected = currentIndex != nullptr;
+			}
+			else if (depth == 2)
+			{
+				currentName.assign(str, length);
+			}
+			return true;
+		}
+
+		bool StartObject()
+		{
+			++depth;
+			if (depth == 2 && objectExpected)
+			{
+				(currentIndex == &functions ? hasFunctions : hasTypes) = true;
+				objectExpected = false;
+			}
+			else if (depth == 3 && currentIndex)
+			{
+				// The opening brace has already been read.
+				currentBegin = stream.Tell() - 1;
+			}
+			return true;
+		}
+
+		bool EndObject(rapidjson::SizeType)
+		{
+			if (depth == 3 && currentIndex)
+			{
+				currentIndex->emplace(currentName,
+					std::make_pair(currentBegin, stream.Tell() - currentBegin));
+			}
+			else if (depth == 2)
+			{
+				currentIndex = nullptr;
+			}
+			--depth;
+			return true;
+		}
+
+		bool StartArray()
+		{
+			if (depth == 1)
+			{
+				skipValueOfKey();
+			}
+			++depth;
+			return true;
+		}
+
+		bool EndArray(rapidjson::SizeType)
+		{
+			--depth;
+			return true;
+		}
+
+		bool Default()
+		{
+			if (depth == 1)
+			{
+				skipValueOfKey();
+			}
+			return true;
+		}
+
+	public:
+		/// Has the JSON contained an object with functions?
+		bool hasFunctions = false;
+
+		/// Has the JSON contained an object with types?
+		bool hasTypes = false;
+
+	private:
+		/// Ignores a value of a top-level key that is not an object.
+		void skipValueOfKey()
+		{
+			currentIndex = nullptr;
+			objectExpected = false;
+		}
+
+	private:
+		const rapidjson::MemoryStream &stream;
+		Index &functions;
+		Index &types;
+		Index *currentIndex = nullptr;
+		bool objectExpected = false;
+		std::string currentName;
+		std::size_t currentBegin = 0;
+		unsigned depth = 0;
+};
+
 } // anonymous namespace
 
 namespace retdec {
@@ -232,6 +350,114 @@ void JSONCTypesParser::parseInto(
 	parseJsonIntoModule(root, module);
 }
 
+/**
+* @brief Indexes C-types in JSON representation so that functions can be parsed
+*        later by parseIndexedFunction().
+*
+* @param[in] json C-types in JSON.
+* @param[in] size Size of @a json.
+* @param[in] context Context into which the functions and types are parsed.
+* @param[in] typeWidths C-types' bit widths.
+* @param[in] callConvention Function call convention.
+*
+* @throw CTypesParseError when the input JSON is invalid.
+*
+* Only the positions of the functions and types in @a json are stored, so
+* @a json has to exist as long as functions are parsed from it. Nothing is
+* copied or parsed into C-types until a function is requested, so indexing is
+* much cheaper than parseInto() when only a few functions are used.
+*
+* Call convention is used when function itself does not specify its call
+* convention.
+*/
+void JSONCTypesParser::index(
+	const char *json,
+	std::size_t size,
+	const std::shared_ptr<retdec::ctypes::Context> &context,
+	const CTypesParser::TypeWidths &typeWidths,
+	const retdec::ctypes::CallConvention &callConvention)
+{
+	assert(context && "violated precondition - context cannot be null");
+
+	this->context = context;
+	defaultCallConv = callConvention;
+	this->typeWidths = typeWidths;
+
+	// We need a clean context for each JSON because types may have different keys.
+	parserContext.clear();
+	typesMap.clear();
+	indexedFunctions.clear();
+	indexedTypes.clear();
+	indexedJson = json;
+
+	rapidjson::MemoryStream stream(json, size);
+	JSONIndexHandler handler(stream, indexedFunctions, indexedTypes);
+	rapidjson::Reader reader;
+	rapidjson::ParseResult res = reader.Parse(stream, handler);
+	if (!res)
+	{
+		handleParsingFailure(res);
+	}
+	else if (!handler.hasFunctions)
+	{
+		throw CTypesParseError(JSON_functions + " must be an object value");
+	}
+	else if (!handler.hasTypes)
+	{
+		throw CTypesParseError(JSON_types + " must be an object value");
+	}
+}
+
+/**
+* @brief Checks if a function with the given name is in the indexed JSON.
+*/
+bool JSONCTypesParser::hasIndexedFunction(const std::string &name) const
+{
+	return indexedFunctions.find(name) != indexedFunctions.end();
+}
+
+/**
+* @brief Parses a function with the given name from the indexed JSON.
+*
+* @return The parsed function, or @c nullptr if there is no such function.
+*
+* @throw CTypesParseError when the JSON representation of the function or of
+*        its types is invalid.
+*
+* Only the function and the types it uses are parsed. If the function has
+* already been parsed into the context, the existing function is returned.
+*/
+std::shared_ptr<retdec::ctypes::Function> JSONCTypesParser::parseIndexedFunction(
+	const std::string &name)
+{
+	auto i = indexedFunctions.find(name);
+	if (i == indexedFunctions.end())
+	{
+		return nullptr;
+	}
+
+	auto jsonFunction = parseIndexedJson(i->second);
+	return getOrParseFunction(name, *jsonFunction);
+}
+
+/**
+* @brief Parses the given part (offset, length) of the indexed JSON.
+*
+* @throw CTypesParseError when the JSON is invalid.
+*/
+std::unique_ptr<rapidjson::Document> JSONCTypesParser::parseIndexedJson(
+	const std::pair<std::size_t, std::size_t> &part) const
+{
+	auto root = std::make_unique<rapidjson::Document>();
+	rapidjson::ParseResult res = root->Parse(
+		indexedJson + part.first, part.second);
+	if (!res)
+	{
+		handleParsingFailure(res);
+	}
+	return root;
+}
+
 /**
 * @brief Loads JSON from the input stream to a string.
 */
@@ -276,6 +502,8 @@ void JSONCTypesParser::parseJsonIntoModule(
 {
 	// We need a clean context for each JSON because types may have different keys.
 	parserContext.clear();
+	indexedFunctions.clear();
+	indexedTypes.clear();
 	const rapidjson::Value &functions = safeGetObject(*root, JSON_functions);
 
 	addTypesToMap(safeGetObject(*root, JSON_types));
@@ -504,7 +732,15 @@ std::shared_ptr<retdec::ctypes::Type> JSONCTypesParser::getOrParseType(
 std::shared_ptr<retdec::ctypes::Type> JSONCTypesParser::parseType(
 	const std::string &typeKey)
 {
-	const rapidjson::Value &jsonType = retdec::utils::mapGetValueOrDefault(typesMap, typeKey)->value;
+	// Types from the indexed JSON are parsed only when they are needed.
+	std::unique_ptr<rapidjson::Document> indexedType;
+	auto indexedTypeIt = indexedTypes.find(typeKey);
+	if (indexedTypeIt != indexedTypes.end())
+	{
+		indexedType = parseIndexedJson(indexedTypeIt->second);
+	}
+	const rapidjson::Value &jsonType = indexedType ? *indexedType :
+		retdec::utils::mapGetValueOrDefault(typesMap, typeKey)->value;
 	std::string typeOfType = safeGetString(jsonType, JSON_type);
 	std::shared_ptr<retdec::ctypes::Type> parsedType;
 
@@ -27,17 +27,15 @@ namespace debugformat {
 
 void DebugFormat::loadDwarf()
 {
-	// Open input file as buffer.
+	// Use the input file content as buffer. The input may exist only in
+	// memory, and the loader may have overwritten some of its bytes.
 	//
-	llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> buffOrErr =
-			llvm::MemoryBuffer::getFileOrSTDIN(
-				_inFile->getFileFormat()->getPathToFile());
-	if (buffOrErr.getError())
-	{
-		return;
-	}
-	std::unique_ptr<llvm::MemoryBuffer> bufferPtr = std::move(buffOrErr.get());
-	llvm::MemoryBufferRef buffer = *bufferPtr;
+	const auto& bytes = _inFile->getFileFormat()->getOriginalBytes();
+	llvm::MemoryBufferRef buffer(
+			llvm::StringRef(
+				reinterpret_cast<const char*>(bytes.data()),
+				bytes.size()),
+			_inFile->getFileFormat()->getPathToFile());
 
 	// Open buffer as a binary file.
 	//
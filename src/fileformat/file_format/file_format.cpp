@@ -191,19 +191,93 @@ void FileFormat::init()
 	elfCoreInfo = nullptr;
 	fileFormat = Format::UNDETECTABLE;
 	stateIsValid = readFile(fileStream, bytes) && stateIsValid;
+	crc32.clear();
+	md5.clear();
+	sha256.clear();
+	overwrittenBytes.clear();
+	originalBytes.clear();
+	initStream();
+}
+
+/**
+ * Compute requested hashes of file content which have not been computed yet
+ * @param wantCrc32 @c true if CRC32 should be computed
+ * @param wantMd5 @c true if MD5 should be computed
+ * @param wantSha256 @c true if SHA256 should be computed
+ *
+ * All the requested hashes are computed together in a single pass over the
+ * file content. Nothing is computed if hashes were disabled by
+ * @c LoadFlags::NO_FILE_HASHES.
+ */
+void FileFormat::computeHashes(bool wantCrc32, bool wantMd5, bool wantSha256) const
+{
 	if (getLoadFlags() & LoadFlags::NO_FILE_HASHES)
 	{
-		crc32.clear();
-		md5.clear();
-		sha256.clear();
+		return;
 	}
-	else
+
+	std::lock_guard<std::mutex> lock(hashesMutex);
+	auto *crc32Result = wantCrc32 && crc32.empty() ? &crc32 : nullptr;
+	auto *md5Result = wantMd5 && md5.empty() ? &md5 : nullptr;
+	auto *sha256Result = wantSha256 && sha256.empty() ? &sha256 : nullptr;
+	if (!crc32Result && !md5Result && !sha256Result)
 	{
-		crc32 = retdec::fileformat::getCrc32(bytes.data(), bytes.size());
-		md5 = retdec::fileformat::getMd5(bytes.data(), bytes.size());
-		sha256 = retdec::fileformat::getSha256(bytes.data(), bytes.size());
+		return;
 	}
-	initStream();
+
+	const auto &original = restoreOriginalBytes();
+	retdec::fileformat::getHashes(original.data(), original.size(), crc32Result, md5Result, sha256Result);
+}
+
+/**
+ * Get content of input file before the loader overwrote some of its bytes
+ * @return Original content of input file, see getOriginalBytes()
+ *
+ * The caller must hold @c hashesMutex.
+ */
+const std::vector<unsigned char>& FileFormat::restoreOriginalBytes() const
+{
+	if (overwrittenBytes.empty())
+	{
+		return bytes;
+	}
+
+	if (originalBytes.empty())
+	{
+		// The latest overwrite is undone first.
+		originalBytes = bytes;
+		for (auto it = overwrittenBytes.rbegin(), end = overwrittenBytes.rend(); it != end; ++it)
+		{
+			std::copy(it->second.begin(), it->second.end(), originalBytes.begin() + it->first);
+		}
+	}
+
+	return originalBytes;
+}
+
+/**
+ * Keep original content of file bytes which are going to be overwritten
+ * @param data Pointer to the first overwritten byte
+ * @param size Number of overwritten bytes
+ *
+ * The loader calls this method before it writes into the file content (e.g.
+ * when it applies relocations). File hashes, signature scans and debug
+ * information then use the original bytes, see getOriginalBytes(). Bytes
+ * outside of the file content are ignored.
+ */
+void FileFormat::keepOriginalBytes(const unsigned char *data, std::size_t size)
+{
+	if (data < bytes.data() || data >= bytes.data() + bytes.size())
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(hashesMutex);
+	const std::size_t offset = data - bytes.data();
+	size = std::min(size, bytes.size() - offset);
+	overwrittenBytes.emplace_back(offset, std::vector<unsigned char>(data, data + size));
+	originalBytes.clear();
+	originalBytes.shrink_to_fit();
 }
 
 /**
@@ -873,30 +947,44 @@ bool FileFormat::isWindowsDriver() const
 }
 
 /**
- * Check if CRC32 was computed
- * @return @c true if CRC32 was computed, @c false otherwise
+ * Compute all the hashes of file content at once
+ *
+ * Getters of file hashes compute only the queried hash. Call this method
+ * before querying several of them to read the file content only once.
+ */
+void FileFormat::computeHashes() const
+{
+	computeHashes(true, true, true);
+}
+
+/**
+ * Check if CRC32 of file content is available
+ * @return @c true if CRC32 is available, @c false if file hashes were disabled
+ *    by @c LoadFlags::NO_FILE_HASHES
  */
 bool FileFormat::hasCrc32() const
 {
-	return !crc32.empty();
+	return !(getLoadFlags() & LoadFlags::NO_FILE_HASHES);
 }
 
 /**
- * Check if MD5 was computed
- * @return @c true if MD5 was computed, @c false otherwise
+ * Check if MD5 of file content is available
+ * @return @c true if MD5 is available, @c false if file hashes were disabled
+ *    by @c LoadFlags::NO_FILE_HASHES
  */
 bool FileFormat::hasMd5() const
 {
-	return !md5.empty();
+	return !(getLoadFlags() & LoadFlags::NO_FILE_HASHES);
 }
 
 /**
- * Check if SHA256 was computed
- * @return @c true if SHA256 was computed, @c false otherwise
+ * Check if SHA256 of file content is available
+ * @return @c true if SHA256 is available, @c false if file hashes were disabled
+ *    by @c LoadFlags::NO_FILE_HASHES
  */
 bool FileFormat::hasSha256() const
 {
-	return !sha256.empty();
+	return !(getLoadFlags() & LoadFlags::NO_FILE_HASHES);
 }
 
 /**
@@ -929,27 +1017,39 @@ bool FileFormat::hasSectionTableSha256() const
 /**
  * Get CRC32
  * @return CRC32 of file content
+ *
+ * The hash is computed when it is queried for the first time.
  */
 std::string FileFormat::getCrc32() const
 {
+	computeHashes(true, false, false);
+	std::lock_guard<std::mutex> lock(hashesMutex);
 	return crc32;
 }
 
 /**
  * Get MD5
  * @return MD5 of file content
+ *
+ * The hash is computed when it is queried for the first time.
  */
 std::string FileFormat::getMd5() const
 {
+	computeHashes(false, true, false);
+	std::lock_guard<std::mutex> lock(hashesMutex);
 	return md5;
 }
 
 /**
  * Get SHA256
  * @return SHA256 of file content
+ *
+ * The hash is computed when it is queried for the first time.
  */
 std::string FileFormat::getSha256() const
 {
+	computeHashes(false, false, true);
+	std::lock_guard<std::mutex> lock(hashesMutex);
 	return sha256;
 }
 
@@ -1883,6 +1983,21 @@ const std::vector<unsigned char>& FileFormat::getBytes() const
 	return bytes;
 }
 
+/**
+ * Get content of input file as it was read, without the bytes which were
+ * overwritten by the loader
+ * @return Original content of input file as bytes
+ *
+ * If nothing was overwritten, this is the same as getBytes(). Otherwise, a
+ * copy with the overwrites undone is created on the first call. The returned
+ * reference is valid until the next overwrite.
+ */
+const std::vector<unsigned char>& FileFormat::getOriginalBytes() const
+{
+	std::lock_guard<std::mutex> lock(hashesMutex);
+	return restoreOriginalBytes();
+}
+
 /**
  * Get serialized loaded content of input file as bytes
  * @return Serialized content of input file as bytes
@@ -4,8 +4,10 @@
  * @copyright (c) 2020 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <climits>
 #include <cmath>
+#include <functional>
 #include <vector>
 
 #include <openssl/md5.h>
@@ -14,10 +16,57 @@
 #include "retdec/fileformat/utils/crypto.h"
 #include "retdec/utils/conversion.h"
 #include "retdec/utils/crc32.h"
+#include "retdec/utils/thread_pool.h"
 
 namespace retdec {
 namespace fileformat {
 
+namespace {
+
+/// Size of chunks in which data are fed to all the digests in a single pass.
+/// The chunk stays in L2 cache while all the digests process it.
+const std::uint64_t HASH_CHUNK_SIZE = 64 * 1024;
+/// Minimal size of data for which the digests are computed in parallel.
+const std::uint64_t PARALLEL_HASH_MIN_SIZE = 4 * 1024 * 1024;
+
+void computeCrc32(const unsigned char *data, std::uint64_t length, std::string *out)
+{
+	retdec::utils::CRC32 crc;
+	for (std::uint64_t offset = 0; offset < length; offset += HASH_CHUNK_SIZE)
+	{
+		crc.add(data + offset, std::min(HASH_CHUNK_SIZE, length - offset));
+	}
+	*out = crc.getHash();
+}
+
+void computeMd5(const unsigned char *data, std::uint64_t length, std::string *out)
+{
+	std::vector<unsigned char> digest(MD5_DIGEST_LENGTH);
+	MD5_CTX ctx;
+	MD5_Init(&ctx);
+	for (std::uint64_t offset = 0; offset < length; offset += HASH_CHUNK_SIZE)
+	{
+		MD5_Update(&ctx, data + offset, std::min(HASH_CHUNK_SIZE, length - offset));
+	}
+	MD5_Final(digest.data(), &ctx);
+	retdec::utils::bytesToHexString(digest, *out, 0, 0, false);
+}
+
+void computeSha256(const unsigned char *data, std::uint64_t length, std::string *out)
+{
+	std::vector<unsigned char> digest(SHA256_DIGEST_LENGTH);
+	SHA256_CTX ctx;
+	SHA256_Init(&ctx);
+	for (std::uint64_t offset = 0; offset < length; offset += HASH_CHUNK_SIZE)
+	{
+		SHA256_Update(&ctx, data + offset, std::min(HASH_CHUNK_SIZE, length - offset));
+	}
+	SHA256_Final(digest.data(), &ctx);
+	retdec::utils::bytesToHexString(digest, *out, 0, 0, false);
+}
+
+} // anonymous namespace
+
 /**
  * @brief Count CRC32 of @a data.
  * @param[in] data Input data.
@@ -78,5 +127,104 @@ std::string getSha256(const unsigned char *data, std::uint64_t length)
 	return sha;
 }
 
+/**
+ * @brief Count several hashes of @a data at once.
+ * @param[in] data Input data.
+ * @param[in] length Length of input data.
+ * @param[out] crc32 Into this parameter is stored CRC32 of input data.
+ * @param[out] md5 Into this parameter is stored MD5 of input data.
+ * @param[out] sha256 Into this parameter is stored SHA256 of input data.
+ *
+ * Hashes whose output parameter is @c nullptr are not computed. Small inputs
+ * are read only once, in chunks which are passed to all the requested
+ * digests before the next chunk is read. Large inputs are hashed by all the
+ * requested digests in parallel, each of them streaming over the data in its
+ * own thread.
+ */
+void getHashes(
+		const unsigned char *data,
+		std::uint64_t length,
+		std::string *crc32,
+		std::string *md5,
+		std::string *sha256)
+{
+	const std::size_t requested = (crc32 != nullptr) + (md5 != nullptr)
+			+ (sha256 != nullptr);
+	if (requested == 0)
+	{
+		return;
+	}
+
+	if (length >= PARALLEL_HASH_MIN_SIZE && requested > 1)
+	{
+		std::vector<std::function<void()>> jobs;
+		if (crc32)
+		{
+			jobs.push_back([=]() { computeCrc32(data, length, crc32); });
+		}
+		if (md5)
+		{
+			jobs.push_back([=]() { computeMd5(data, length, md5); });
+		}
+		if (sha256)
+		{
+			jobs.push_back([=]() { computeSha256(data, length, sha256); });
+		}
+
+		retdec::utils::ThreadPool pool(std::min(
+				jobs.size(),
+				retdec::utils::ThreadPool::getHardwareThreadCount()));
+		pool.parallelFor(jobs.size(), [&](std::size_t i) { jobs[i](); });
+		return;
+	}
+
+	retdec::utils::CRC32 crcCtx;
+	MD5_CTX md5Ctx;
+	SHA256_CTX sha256Ctx;
+	if (md5)
+	{
+		MD5_Init(&md5Ctx);
+	}
+	if (sha256)
+	{
+		SHA256_Init(&sha256Ctx);
+	}
+
+	for (std::uint64_t offset = 0; offset < length; offset += HASH_CHUNK_SIZE)
+	{
+		const auto *chunk = data + offset;
+		const auto chunkSize = std::min(HASH_CHUNK_SIZE, length - offset);
+		if (crc32)
+		{
+			crcCtx.add(chunk, chunkSize);
+		}
+		if (md5)
+		{
+			MD5_Update(&md5Ctx, chunk, chunkSize);
+		}
+		if (sha256)
+		{
+			SHA256_Update(&sha256Ctx, chunk, chunkSize);
+		}
+	}
+
+	if (crc32)
+	{
+		*crc32 = crcCtx.getHash();
+	}
+	if (md5)
+	{
+		std::vector<unsigned char> digest(MD5_DIGEST_LENGTH);
+		MD5_Final(digest.data(), &md5Ctx);
+		retdec::utils::bytesToHexString(digest, *md5, 0, 0, false);
+	}
+	if (sha256)
+	{
+		std::vector<unsigned char> digest(SHA256_DIGEST_LENGTH);
+		SHA256_Final(digest.data(), &sha256Ctx);
+		retdec::utils::bytesToHexString(digest, *sha256, 0, 0, false);
+	}
+}
+
 } // namespace fileformat
 } // namespace retdec
@@ -188,6 +188,7 @@ void FileDetector::getExports()
  */
 void FileDetector::getHashes()
 {
+	fileParser->computeHashes();
 	fileInfo.setCrc32(fileParser->getCrc32());
 	fileInfo.setMd5(fileParser->getMd5());
 	fileInfo.setSha256(fileParser->getSha256());
@@ -340,12 +340,26 @@ void PatternDetector::analyze()
 	{
 		YaraDetector yara;
 
-		for(const auto &item : category.second)
+		// All rules of the category are in the default namespace, so they
+		// may refer to each other. If some files are broken, do not let them
+		// hide the others.
+		const std::vector<std::string> ruleFiles(category.second.begin(), category.second.end());
+		if(!yara.addRuleFiles(ruleFiles, std::vector<std::string>(ruleFiles.size())))
 		{
-			yara.addRuleFile(item);
+			for(const auto &item : ruleFiles)
+			{
+				yara.addRuleFile(item);
+			}
 		}
 
-		yara.analyze(fileinfo.getPathToFile());
+		if(fileParser)
+		{
+			yara.analyze(fileParser->getOriginalBytes());
+		}
+		else
+		{
+			yara.analyze(fileinfo.getPathToFile());
+		}
 
 		for(const auto &rule : yara.getDetectedRules())
 		{
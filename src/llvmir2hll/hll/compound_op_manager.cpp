@@ -169,43 +169,43 @@ CompoundOpManager::CompoundOp CompoundOpManager::tryOptimizeToCompoundOp(
 	return compoundOp;
 }
 
-void CompoundOpManager::visit(ShPtr<AddOpExpr> expr) {
+void CompoundOpManager::visit(const ShPtr<AddOpExpr> &expr) {
 	tryOptimizeWhenOneOfOperandsEqWithLhsOfAssignStmt(expr);
 }
 
-void CompoundOpManager::visit(ShPtr<SubOpExpr> expr) {
+void CompoundOpManager::visit(const ShPtr<SubOpExpr> &expr) {
 	tryOptimizeWhenLeftOperandEqWithLhsOfAssignStmt(expr);
 }
 
-void CompoundOpManager::visit(ShPtr<MulOpExpr> expr) {
+void CompoundOpManager::visit(const ShPtr<MulOpExpr> &expr) {
 	tryOptimizeWhenOneOfOperandsEqWithLhsOfAssignStmt(expr);
 }
 
-void CompoundOpManager::visit(ShPtr<DivOpExpr> expr) {
+void CompoundOpManager::visit(const ShPtr<DivOpExpr> &expr) {
 	tryOptimizeWhenLeftOperandEqWithLhsOfAssignStmt(expr);
 }
 
-void CompoundOpManager::visit(ShPtr<ModOpExpr> expr) {
+void CompoundOpManager::visit(const ShPtr<ModOpExpr> &expr) {
 	tryOptimizeWhenLeftOperandEqWithLhsOfAssignStmt(expr);
 }
 
-void CompoundOpManager::visit(ShPtr<BitShlOpExpr> expr) {
+void CompoundOpManager::visit(const ShPtr<BitShlOpExpr> &expr) {
 	tryOptimizeWhenLeftOperandEqWithLhsOfAssignStmt(expr);
 }
 
-void CompoundOpManager::visit(ShPtr<BitShrOpExpr> expr) {
+void CompoundOpManager::visit(const ShPtr<BitShrOpExpr> &expr) {
 	tryOptimizeWhenLeftOperandEqWithLhsOfAssignStmt(expr);
 }
 
-void CompoundOpManager::visit(ShPtr<BitAndOpExpr> expr) {
+void CompoundOpManager::visit(const ShPtr<BitAndOpExpr> &expr) {
 	tryOptimizeWhenOneOfOperandsEqWithLhsOfAssignStmt(expr);
 }
 
-void CompoundOpManager::visit(ShPtr<BitOrOpExpr> expr) {
+void CompoundOpManager::visit(const ShPtr<BitOrOpExpr> &expr) {
 	tryOptimizeWhenOneOfOperandsEqWithLhsOfAssignStmt(expr);
 }
 
-void CompoundOpManager::visit(ShPtr<BitXorOpExpr> expr) {
+void CompoundOpManager::visit(const ShPtr<BitXorOpExpr> &expr) {
 	tryOptimizeWhenOneOfOperandsEqWithLhsOfAssignStmt(expr);
 }
 
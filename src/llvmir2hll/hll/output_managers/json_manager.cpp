@@ -59,7 +59,7 @@ const std::string JSON_TOKEN_COMMENT       = "cmnt";
 template <typename Writer>
 JsonOutputManager<Writer>::JsonOutputManager(llvm::raw_ostream& out) :
 		_out(out),
-		writer(sb)
+		writer(_out)
 {
 	writer.StartObject();
 
@@ -78,8 +78,6 @@ void JsonOutputManager<Writer>::finalize()
 	writer.String(getOutputLanguage());
 
 	writer.EndObject();
-
-	_out << sb.GetString();
 }
 
 template <typename Writer>
@@ -344,8 +342,8 @@ void JsonOutputManager<Writer>::jsonToken(
 	writer.EndObject();
 }
 
-template class JsonOutputManager<rapidjson::Writer<rapidjson::StringBuffer, rapidjson::ASCII<>>>;
-template class JsonOutputManager<rapidjson::PrettyWriter<rapidjson::StringBuffer, rapidjson::ASCII<>>>;
+template class JsonOutputManager<rapidjson::Writer<JsonOutputStream, rapidjson::ASCII<>>>;
+template class JsonOutputManager<rapidjson::PrettyWriter<JsonOutputStream, rapidjson::ASCII<>>>;
 
 } // namespace llvmir2hll
 } // namespace retdec
@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <mutex>
+
 #include "retdec/llvmir2hll/ir/int_type.h"
 #include "retdec/llvmir2hll/support/debug.h"
 #include "retdec/llvmir2hll/support/visitor.h"
@@ -11,6 +13,13 @@
 namespace retdec {
 namespace llvmir2hll {
 
+namespace {
+
+/// Guards the created types, which are shared by all decompilations.
+std::mutex createdTypesMutex;
+
+} // anonymous namespace
+
 /**
 * @brief Constructs a new integer type.
 *
@@ -77,6 +86,7 @@ bool IntType::isBool() const {
 */
 ShPtr<IntType> IntType::create(unsigned size, bool isSigned) {
 	PRECONDITION(size > 0, "invalid size " << size);
+	std::lock_guard<std::mutex> lock(createdTypesMutex);
 
 	// There are two maps, one for signed integers and one for unsigned integers.
 	if (isSigned) {
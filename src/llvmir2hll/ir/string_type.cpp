@@ -4,6 +4,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <mutex>
+
 #include "retdec/llvmir2hll/ir/string_type.h"
 #include "retdec/llvmir2hll/support/debug.h"
 #include "retdec/llvmir2hll/support/visitor.h"
@@ -11,6 +13,13 @@
 namespace retdec {
 namespace llvmir2hll {
 
+namespace {
+
+/// Guards the created types, which are shared by all decompilations.
+std::mutex createdTypesMutex;
+
+} // anonymous namespace
+
 /**
 * @brief Constructs a new string type.
 *
@@ -48,6 +57,7 @@ std::size_t StringType::getCharSize() const {
 */
 ShPtr<StringType> StringType::create(std::size_t charSize) {
 	PRECONDITION(charSize > 0, "invalid charSize " << charSize);
+	std::lock_guard<std::mutex> lock(createdTypesMutex);
 
 	auto it = createdTypes.find(charSize);
 	if (it != createdTypes.end()) {
@@ -36,7 +36,7 @@ using retdec::utils::removeItem;
 bool BaseCFGReducer::reduceCFG(ShPtr<CFGNode> cfg) {
   PRECONDITION_NON_NULL(cfg);
 
-  return sc->BFSTraverse(
+  return sc->BFSReduce(
       cfg, [this](const auto &node) { return this->inspectCFGNode(node); });
 }
 
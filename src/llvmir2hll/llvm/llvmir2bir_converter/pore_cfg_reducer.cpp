@@ -150,7 +150,10 @@ bool PoRECFGReducer::tryReduceLoop(ShPtr<CFGNode> node) {
         LOG << "Try reduce loop: " << node->getDebugStr() << "\n";
 		enterLoop(node);
 		
-        while (!isLoopReduced(node) && reduceCFG(node)) {}
+        {
+            StructureConverter::CFGReductionScope reductionScope(sc);
+            while (!isLoopReduced(node) && reduceCFG(node)) {}
+        }
 
         if (!isLoopReduced(node)) {
             reduceCFGComplete(node);
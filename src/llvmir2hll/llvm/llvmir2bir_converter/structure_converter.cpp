@@ -81,6 +81,21 @@ StructureConverter::StructureConverter(llvm::Pass *basePass,
 		reducedLoops(), reducedSwitches(), resModule(module),
 		cfgReducer(std::make_shared<PoRECFGReducer>(this)) {}
 
+/**
+* @brief Starts a new CFG reduction of the given structure converter @a sc.
+*/
+StructureConverter::CFGReductionScope::CFGReductionScope(
+		StructureConverter *sc): sc(sc) {
+	sc->cfgReductions.emplace_back();
+}
+
+/**
+* @brief Finishes the CFG reduction.
+*/
+StructureConverter::CFGReductionScope::~CFGReductionScope() {
+	sc->cfgReductions.pop_back();
+}
+
 
 ShPtr<Statement> StructureConverter::convertFuncBodyPoRE(llvm::Function &func) {
 	PRECONDITION(!func.isDeclaration(), "func cannot be a declaration");
@@ -89,8 +104,11 @@ ShPtr<Statement> StructureConverter::convertFuncBodyPoRE(llvm::Function &func) {
 	auto cfg = createCFG(func.getEntryBlock());
 	detectBackEdges(cfg);
 
-	while (cfg->getSuccNum() != 0 && cfgReducer->reduceCFG(cfg)) {
-		// Keep looping until the CFG is reduced.
+	{
+		CFGReductionScope reductionScope(this);
+		while (cfg->getSuccNum() != 0 && cfgReducer->reduceCFG(cfg)) {
+			// Keep looping until the CFG is reduced.
+		}
 	}
 
 	cfgReducer->reduceCFGComplete(cfg);
@@ -122,8 +140,11 @@ ShPtr<Statement> StructureConverter::convertFuncBody(llvm::Function &func) {
 	auto cfg = createCFG(func.getEntryBlock());
 	detectBackEdges(cfg);
 
-	while (cfg->getSuccNum() != 0 && reduceCFG(cfg)) {
-		// Keep looping until the CFG is reduced.
+	{
+		CFGReductionScope reductionScope(this);
+		while (cfg->getSuccNum() != 0 && reduceCFG(cfg)) {
+			// Keep looping until the CFG is reduced.
+		}
 	}
 
 	if (cfg->getSuccNum() != 0) {
@@ -431,7 +452,7 @@ void StructureConverter::detectBackEdges(ShPtr<CFGNode> cfg) const {
 bool StructureConverter::reduceCFG(ShPtr<CFGNode> cfg) {
 	PRECONDITION_NON_NULL(cfg);
 
-	return BFSTraverse(cfg, [this](const auto &node) {
+	return BFSReduce(cfg, [this](const auto &node) {
 		return this->inspectCFGNode(node);
 	});
 }
@@ -617,6 +638,136 @@ bool StructureConverter::BFSTraverse(ShPtr<CFGNode> cfg,
 	return anyTrueResult;
 }
 
+/**
+* @brief Traverses the given control-flow graph @a cfg using breadth-first
+*        search and tries to reduce its nodes by function @a inspectFunc.
+*
+* Inside a CFG reduction scope, nodes that could not be reduced by a previous
+* traversal and whose neighborhood has not changed since then are skipped.
+* If nothing is reduced while some nodes were skipped, the graph is traversed
+* once more with all the nodes inspected. Therefore, when this function
+* returns @c false, no node of the graph can be reduced, exactly as when all
+* the nodes are inspected every time.
+*
+* @returns Returns @c true if any node have been reduced.
+*
+* @par Preconditions
+*  - @a cfg is non-null
+*/
+bool StructureConverter::BFSReduce(ShPtr<CFGNode> cfg,
+		std::function<bool (ShPtr<CFGNode>)> inspectFunc) {
+	PRECONDITION_NON_NULL(cfg);
+
+	if (cfgReductions.empty()) {
+		return BFSTraverse(cfg, inspectFunc);
+	}
+
+	auto inspectChanged = [this, &inspectFunc](const auto &node) {
+		return this->inspectChangedCFGNode(node, inspectFunc);
+	};
+
+	cfgReductions.back().skippedNodes = false;
+	if (BFSTraverse(cfg, inspectChanged)) {
+		return true;
+	}
+	if (!cfgReductions.back().skippedNodes) {
+		return false;
+	}
+
+	cfgReductions.back().unchangedNodes.clear();
+	return BFSTraverse(cfg, inspectChanged);
+}
+
+/**
+* @brief Inspects the given CFG node @a node by function @a inspectFunc unless
+*        it is known that the node cannot be reduced.
+*
+* When the node is reduced, its neighborhood before and after the reduction
+* is marked as changed in all the CFG reductions in progress.
+*
+* @returns Returns @c true if the node have been reduced.
+*
+* @par Preconditions
+*  - @a node is non-null
+*  - there is a CFG reduction in progress
+*/
+bool StructureConverter::inspectChangedCFGNode(const ShPtr<CFGNode> &node,
+		const std::function<bool (ShPtr<CFGNode>)> &inspectFunc) {
+	PRECONDITION_NON_NULL(node);
+	PRECONDITION(!cfgReductions.empty(), "no CFG reduction in progress");
+
+	if (hasItem(cfgReductions.back().unchangedNodes, node)) {
+		cfgReductions.back().skippedNodes = true;
+		return false;
+	}
+
+	auto neighborhood = getNeighborhood(node);
+	// The inspection may start nested reductions, so the state of this
+	// reduction must not be referenced across it.
+	if (!inspectFunc(node)) {
+		cfgReductions.back().unchangedNodes.insert(node);
+		return false;
+	}
+
+	markChanged(neighborhood);
+	markChanged(getNeighborhood(node));
+	return true;
+}
+
+/**
+* @brief Returns nodes whose reducibility may depend on the given node
+*        @a node.
+*
+* These are the node itself, its predecessors and their predecessors, its
+* successors and all their predecessors. The reduction rules look at most two
+* edges up from the reduced node and they check numbers of predecessors of its
+* successors.
+*
+* @par Preconditions
+*  - @a node is non-null
+*/
+CFGNode::CFGNodeSet StructureConverter::getNeighborhood(
+		const ShPtr<CFGNode> &node) const {
+	PRECONDITION_NON_NULL(node);
+
+	CFGNode::CFGNodeSet neighborhood{node};
+	for (const auto &pred: node->getPredecessors()) {
+		neighborhood.insert(pred);
+		for (const auto &predPred: pred->getPredecessors()) {
+			neighborhood.insert(predPred);
+		}
+	}
+
+	auto succs = node->getSuccessors();
+	if (node->hasStatementSuccessor()) {
+		succs.push_back(node->getStatementSuccessor());
+	}
+	for (const auto &succ: succs) {
+		neighborhood.insert(succ);
+		for (const auto &succPred: succ->getPredecessors()) {
+			neighborhood.insert(succPred);
+		}
+	}
+
+	return neighborhood;
+}
+
+/**
+* @brief Marks the given nodes @a nodes as changed in all the CFG reductions
+*        in progress, so they will be inspected again.
+*/
+void StructureConverter::markChanged(const CFGNode::CFGNodeSet &nodes) {
+	for (auto &reduction: cfgReductions) {
+		if (reduction.unchangedNodes.empty()) {
+			continue;
+		}
+
+		for (const auto &node: nodes) {
+			reduction.unchangedNodes.erase(node);
+		}
+	}
+}
+
 /**
 * @brief Traverses the given control-flow graph @a cfg of a loop using
 *        breadth-first search and inspect every node by function @a inspectFunc.
@@ -1641,12 +1792,11 @@ void StructureConverter::completelyReduceLoop(ShPtr<CFGNode> loopNode) {
 	PRECONDITION_NON_NULL(loopNode);
 
 	auto loop = getLoopFor(loopNode);
-	auto func = [this](const auto &node) {
-		return this->inspectCFGNode(node);
-	};
-
-	while (!hasItem(reducedLoops, loop) && BFSTraverse(loopNode, func)) {
-		// Keep looping until the loop is reduced.
+	{
+		CFGReductionScope reductionScope(this);
+		while (!hasItem(reducedLoops, loop) && reduceCFG(loopNode)) {
+			// Keep looping until the loop is reduced.
+		}
 	}
 
 	if (!hasItem(reducedLoops, loop)) {
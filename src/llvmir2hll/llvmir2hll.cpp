@@ -132,12 +132,15 @@ void LlvmIr2Hll::setConfig(retdec::config::Config* c)
 	globalConfig = c;
 }
 
-void LlvmIr2Hll::setOutputString(std::string* outString)
+/**
+* @brief Emits the generated code into @a out instead of the output file.
+*
+* The code is written into the stream as it is generated, so @a out is not
+* required to hold it all at once.
+*/
+void LlvmIr2Hll::setOutputStream(llvm::raw_ostream* out)
 {
-	if (outString)
-	{
-		outStringStream = std::make_unique<raw_string_ostream>(*outString);
-	}
+	outStream = out;
 }
 
 void LlvmIr2Hll::getAnalysisUsage(llvm::AnalysisUsage &au) const
@@ -272,10 +275,10 @@ bool LlvmIr2Hll::initialize(llvm::Module &m)
 	);
 
 	// Output stream into which the generated code will be emitted.
-	if (outStringStream)
+	if (outStream)
 	{
 		hllWriter = llvmir2hll::HLLWriterFactory::getInstance().createObject<
-		raw_string_ostream &>(TargetHLL, *outStringStream, globalConfig->parameters.getOutputFormat());
+		raw_ostream &>(TargetHLL, *outStream, globalConfig->parameters.getOutputFormat());
 	}
 	else
 	{
@@ -603,7 +606,8 @@ void LlvmIr2Hll::runOptimizations()
 					llvmir2hll::ValueAnalysis::create(aliasAnalysis, true),
 					cio,
 					arithmExprEvaluator,
-					Debug
+					Debug,
+					globalConfig->parameters.getThreads()
 			)
 	);
 	optManager->optimize(resModule);
@@ -687,6 +691,7 @@ void LlvmIr2Hll::finalize()
 {
 	saveConfig();
 	if (outFile) outFile->keep();
+	if (outStream) outStream->flush();
 }
 
 /**
@@ -25,15 +25,35 @@ FuncOptimizer::FuncOptimizer(ShPtr<Module> module):
 		PRECONDITION_NON_NULL(module);
 	}
 
+/**
+* @brief Returns @c true because optimizations of a single function should not
+*        affect optimizations of other functions.
+*
+* See Optimizer::canOptimizePartsSeparately() for more details.
+*/
+bool FuncOptimizer::canOptimizePartsSeparately() const {
+	return true;
+}
+
 /**
 * @brief Performs the optimization on all functions in the module.
 *
-* This function calls runOnFunction() for each function in the module.
+* This function calls runOnFunction() for each function in the module (or just
+* for the function passed to optimizeFunc()).
 *
 * Only redefine if you want to prescribe the order in which functions are
 * optimized; otherwise, just override runOnFunction().
 */
 void FuncOptimizer::doOptimization() {
+	if (onlyFunc) {
+		runOnFunction(onlyFunc);
+		return;
+	}
+
+	if (onlyGlobalVars) {
+		return;
+	}
+
 	// For each function in the module...
 	for (auto i = module->func_begin(), e = module->func_end(); i != e; ++i) {
 		runOnFunction(*i);
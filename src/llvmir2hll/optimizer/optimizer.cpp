@@ -4,9 +4,13 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include "retdec/llvmir2hll/ir/function.h"
 #include "retdec/llvmir2hll/ir/module.h"
 #include "retdec/llvmir2hll/optimizer/optimizer.h"
 #include "retdec/llvmir2hll/support/debug.h"
+#include "retdec/utils/container.h"
+
+using retdec::utils::hasItem;
 
 namespace retdec {
 namespace llvmir2hll {
@@ -20,7 +24,7 @@ namespace llvmir2hll {
 *  - @a module is non-null
 */
 Optimizer::Optimizer(ShPtr<Module> module):
-	OrderedAllVisitor(), module(module) {
+	OrderedAllVisitor(), module(module), onlyFunc(), onlyGlobalVars(false) {
 		PRECONDITION_NON_NULL(module);
 	}
 
@@ -43,6 +47,78 @@ ShPtr<Module> Optimizer::optimize() {
 	return module;
 }
 
+/**
+* @brief Performs all the optimizations of the specific optimizer, but only on
+*        the given function.
+*
+* @param[in,out] func Function to be optimized.
+*
+* Like optimize(), but the rest of the module (other functions and the
+* initializers of global variables) is neither modified nor traversed.
+*
+* @par Preconditions
+*  - @a func is non-null
+*  - canOptimizePartsSeparately() returns @c true
+*/
+void Optimizer::optimizeFunc(ShPtr<Function> func) {
+	PRECONDITION_NON_NULL(func);
+	PRECONDITION(canOptimizePartsSeparately(),
+		"the optimizer " << getId() << " cannot optimize a single function");
+
+	onlyFunc = func;
+	optimize();
+	onlyFunc.reset();
+}
+
+/**
+* @brief Performs all the optimizations of the specific optimizer, but only on
+*        the initializers of global variables.
+*
+* Like optimize(), but no function is modified or traversed.
+*
+* @par Preconditions
+*  - canOptimizePartsSeparately() returns @c true
+*/
+void Optimizer::optimizeGlobalVars() {
+	PRECONDITION(canOptimizePartsSeparately(),
+		"the optimizer " << getId() << " cannot optimize only global variables");
+
+	onlyGlobalVars = true;
+	optimize();
+	onlyGlobalVars = false;
+}
+
+/**
+* @brief Returns @c true if the optimizer can optimize every function and the
+*        initializers of global variables separately, @c false otherwise.
+*
+* If this function returns @c true, optimizing every function by optimizeFunc()
+* and the global variables by optimizeGlobalVars() has the same effect as
+* optimize(). Moreover, the optimizations of different parts do not affect each
+* other, so they can run in parallel (each of them with its own optimizer and
+* analyses).
+*
+* By default, this function returns @c false.
+*/
+bool Optimizer::canOptimizePartsSeparately() const {
+	return false;
+}
+
+/**
+* @brief Makes isDeclaration() answer from @a funcDeclarations instead of
+*        asking the functions.
+*
+* @param[in] funcDeclarations Functions declared in the module.
+*
+* When parts of the module are optimized in parallel, other threads may change
+* the bodies of other functions, so whether they are declarations has to be
+* found out before the optimization starts. If @a funcDeclarations is null,
+* the functions are asked again.
+*/
+void Optimizer::setFuncDeclarations(ShPtr<const FuncSet> funcDeclarations) {
+	this->funcDeclarations = funcDeclarations;
+}
+
 /**
 * @brief Performs pre-optimization matters.
 *
@@ -72,5 +148,67 @@ void Optimizer::doOptimization() {}
 */
 void Optimizer::doFinalization() {}
 
+/**
+* @brief Returns @c true if the whole module is optimized, @c false if only a
+*        part of it is optimized (see optimizeFunc() and optimizeGlobalVars()).
+*
+* Use it to skip computations over the whole module, like pre-computations of
+* analyses, when only a part of the module is optimized.
+*/
+bool Optimizer::optimizesWholeModule() const {
+	return !onlyFunc && !onlyGlobalVars;
+}
+
+/**
+* @brief Returns @c true if the initializers of global variables should be
+*        optimized, @c false otherwise.
+*
+* They should not be optimized when only a single function is optimized (see
+* optimizeFunc()).
+*/
+bool Optimizer::shouldOptimizeGlobalVars() const {
+	return !onlyFunc;
+}
+
+/**
+* @brief Returns the function definitions that should be optimized.
+*
+* If only a single function is optimized (see optimizeFunc()), it returns just
+* this function (provided that it is a definition). If only the global
+* variables are optimized (see optimizeGlobalVars()), it returns the empty
+* vector. Otherwise, it returns all the function definitions in the module.
+*/
+FuncVector Optimizer::getFuncDefinitionsToOptimize() const {
+	if (onlyFunc) {
+		return onlyFunc->isDefinition() ? FuncVector{onlyFunc} : FuncVector();
+	}
+
+	if (onlyGlobalVars) {
+		return FuncVector();
+	}
+
+	return FuncVector(module->func_definition_begin(),
+		module->func_definition_end());
+}
+
+/**
+* @brief Returns @c true if @a func is a declaration, @c false otherwise.
+*
+* Unlike @c func->isDeclaration(), it does not access the body of @a func when
+* the declarations have been set by setFuncDeclarations(), so it can be used
+* for other functions than the optimized one (see optimizeFunc()).
+*
+* @par Preconditions
+*  - @a func is non-null
+*/
+bool Optimizer::isDeclaration(ShPtr<Function> func) const {
+	PRECONDITION_NON_NULL(func);
+
+	if (funcDeclarations) {
+		return hasItem(*funcDeclarations, func);
+	}
+	return func->isDeclaration();
+}
+
 } // namespace llvmir2hll
 } // namespace retdec
@@ -4,13 +4,18 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
 #include "retdec/llvmir2hll/analysis/value_analysis.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluator_factory.h"
 #include "retdec/llvmir2hll/graphs/cg/cg_builder.h"
 #include "retdec/llvmir2hll/hll/hll_writer.h"
+#include "retdec/llvmir2hll/ir/module.h"
 #include "retdec/llvmir2hll/obtainer/call_info_obtainer.h"
+#include "retdec/llvmir2hll/obtainer/call_info_obtainer_factory.h"
 #include "retdec/llvmir2hll/optimizer/optimizer_manager.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/bit_op_to_log_op_optimizer.h"
 #include "retdec/llvmir2hll/optimizer/optimizers/bit_shift_optimizer.h"
@@ -63,6 +68,11 @@ namespace {
 /// Suffix of all optimizers.
 const std::string OPT_SUFFIX = "Optimizer";
 
+/// Number of groups of functions per thread when optimizing in parallel.
+/// Functions in a group are optimized one after another, so having more groups
+/// than threads prevents a single huge function from delaying many others.
+const std::size_t GROUPS_PER_THREAD = 4;
+
 /**
 * @brief Trims the optional suffix "Optimizer" from all optimization names in
 *        @a opts.
@@ -97,6 +107,9 @@ StringSet trimOptimizerSuffix(const StringSet &opts) {
 * @param[in] cio Call info obtainer.
 * @param[in] arithmExprEvaluator Used evaluator of arithmetical expressions.
 * @param[in] enableDebug Enables emission of debug messages.
+* @param[in] threads Number of threads optimizing functions in parallel. If it is
+*                    @c 1, everything is optimized in the calling thread. If it
+*                    is @c 0, all the hardware threads are used.
 *
 * To perform the actual optimizations, call optimize(). To get a list of
 * available optimizations and their names, see our wiki.
@@ -116,13 +129,15 @@ StringSet trimOptimizerSuffix(const StringSet &opts) {
 OptimizerManager::OptimizerManager(const StringSet &enabledOpts,
 	const StringSet &disabledOpts, ShPtr<HLLWriter> hllWriter,
 	ShPtr<ValueAnalysis> va, ShPtr<CallInfoObtainer> cio,
-	ShPtr<ArithmExprEvaluator> arithmExprEvaluator, bool enableDebug):
+	ShPtr<ArithmExprEvaluator> arithmExprEvaluator, bool enableDebug,
+	std::size_t threads):
 		enabledOpts(trimOptimizerSuffix(enabledOpts)),
 		disabledOpts(trimOptimizerSuffix(disabledOpts)),
 		hllWriter(hllWriter), va(va), cio(cio),
 		arithmExprEvaluator(arithmExprEvaluator),
 		enableDebug(enableDebug),
-		recoverFromOutOfMemory(true), backendRunOpts() {
+		recoverFromOutOfMemory(true), backendRunOpts(),
+		threadPool(threads), postponedOpts() {
 			PRECONDITION_NON_NULL(hllWriter);
 			PRECONDITION_NON_NULL(va);
 			PRECONDITION_NON_NULL(cio);
@@ -131,6 +146,8 @@ OptimizerManager::OptimizerManager(const StringSet &enabledOpts,
 
 /**
 * @brief Runs the optimizations over @a m.
+*
+* The result does not depend on the number of used threads.
 */
 void OptimizerManager::optimize(ShPtr<Module> m) {
 	// All optimizations should be run in order from the one that eliminates
@@ -248,6 +265,9 @@ void OptimizerManager::optimize(ShPtr<Module> m) {
 	//
 	run<CCastOptimizer>(m);
 	run<CArrayArgOptimizer>(m);
+
+	// Wait until the optimizations running in parallel (if any) finish.
+	runPostponedOptimizations(m);
 }
 
 /**
@@ -278,7 +298,101 @@ void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimi
 	}
 
 	printOptimization(OPT_ID);
+	runAndRecoverFromOutOfMemory([&]() { optimizer->optimize(); });
+	backendRunOpts.insert(OPT_ID);
+}
+
+/**
+* @brief Postpones the optimization with @a optId provided that it should be
+*        run.
+*
+* @param[in] optId ID of the optimization.
+* @param[in] createOptimizer Creates the optimizer for a group of functions.
+*
+* Postponed optimizations are run by runPostponedOptimizations().
+*/
+void OptimizerManager::postponeOptimizationProvidedItShouldBeRun(
+		const std::string &optId, LocalOptimizerCreator createOptimizer) {
+	if (!optShouldBeRun(optId)) {
+		return;
+	}
+
+	postponedOpts.emplace_back(optId, std::move(createOptimizer));
+	backendRunOpts.insert(optId);
+}
+
+/**
+* @brief Runs all the postponed optimizations over @a m.
+*
+* Every function forms a separate part of the module, and so do the
+* initializers of global variables. Each part is run through all the postponed
+* optimizations (in the order in which they have been postponed), and different
+* parts are optimized in parallel. Parts are split into groups, and every group
+* has its own optimizers and analyses, so no two threads share them.
+*
+* This function returns after all the parts are optimized, so it is a barrier
+* before the optimizations that need the whole module.
+*/
+void OptimizerManager::runPostponedOptimizations(ShPtr<Module> m) {
+	if (postponedOpts.empty()) {
+		return;
+	}
+
+	for (const auto &opt : postponedOpts) {
+		printOptimization(opt.first);
+	}
+
+	// The alias analysis is shared by all the groups, which cannot
+	// re-initialize it, so it has to be brought up to date now. During the
+	// optimizations, it may contain variables whose address is no longer
+	// taken, which is safe.
+	va->initAliasAnalysis(m);
+
+	// The last part are the initializers of global variables.
+	FuncVector funcs(m->func_begin(), m->func_end());
+	const std::size_t partCount = funcs.size() + 1;
+	const std::size_t groupCount = std::min(partCount,
+		threadPool.getThreadCount() * GROUPS_PER_THREAD);
+
+	// Bodies of functions change during the optimizations, so optimizers
+	// asking whether other functions are declarations get a snapshot.
+	auto funcDeclarations = std::make_shared<const FuncSet>(
+		m->func_declaration_begin(), m->func_declaration_end());
+
+	std::vector<std::vector<ShPtr<Optimizer>>> groupOptimizers(groupCount);
+	for (auto &optimizers : groupOptimizers) {
+		LocalAnalyses local(createLocalAnalyses());
+		for (const auto &opt : postponedOpts) {
+			optimizers.push_back(opt.second(local));
+			optimizers.back()->setFuncDeclarations(funcDeclarations);
+		}
+	}
+
+	threadPool.parallelFor(groupCount, [&](std::size_t group) {
+		for (std::size_t part = group; part < partCount; part += groupCount) {
+			for (const auto &optimizer : groupOptimizers[group]) {
+				runAndRecoverFromOutOfMemory([&]() {
+					if (part < funcs.size()) {
+						optimizer->optimizeFunc(funcs[part]);
+					} else {
+						optimizer->optimizeGlobalVars();
+					}
+				});
+			}
+		}
+	});
+	postponedOpts.clear();
+
+	// The shared value analysis has not seen the changes.
+	va->invalidateState();
+}
 
+/**
+* @brief Calls @a optimize, which runs an optimizer, and recovers from running
+*        out of memory (if requested).
+*/
+void OptimizerManager::runAndRecoverFromOutOfMemory(
+		const std::function<void ()> &optimize) {
 	if (recoverFromOutOfMemory) {
 		// Some optimizations, most notable CopyPropagation, may run out of
 		// memory on huge inputs. We try to recover from such situations by
@@ -287,17 +401,33 @@ void OptimizerManager::runOptimizerProvidedItShouldBeRun(ShPtr<Optimizer> optimi
 		// memory requirements of the optimizations, or to generate smaller
 		// code in the first place.
 		try {
-			optimizer->optimize();
+			optimize();
 		} catch (const std::bad_alloc &) {
 			Log::error() << Log::Warning << "out of memory; trying to recover" << std::endl;
 			std::this_thread::sleep_for(std::chrono::seconds(1));
 		}
 	} else {
 		// Just run the optimizer and let std::bad_alloc propagate.
-		optimizer->optimize();
+		optimize();
 	}
+}
 
-	backendRunOpts.insert(OPT_ID);
+/**
+* @brief Creates analyses for optimizers running in parallel with other
+*        optimizers.
+*
+* The created analyses are of the same kinds as the ones given in the
+* constructor, but they have their own state. Only the alias analysis is shared
+* (see ValueAnalysis::createWithSharedAliasAnalysis()).
+*/
+OptimizerManager::LocalAnalyses OptimizerManager::createLocalAnalyses() const {
+	LocalAnalyses local;
+	local.va = va->createWithSharedAliasAnalysis();
+	local.cio = CallInfoObtainerFactory::getInstance().createObject(
+		cio->getId());
+	local.arithmExprEvaluator = ArithmExprEvaluatorFactory::getInstance(
+		).createObject(arithmExprEvaluator->getId());
+	return local;
 }
 
 /**
@@ -351,10 +481,62 @@ bool OptimizerManager::shouldSecondCopyPropagationBeRun() const {
 */
 template<typename Optimization, typename... Args>
 void OptimizerManager::run(ShPtr<Module> m, Args &&... args) {
+	if (threadPool.isParallel()) {
+		auto optimizer = std::make_shared<Optimization>(m, args...);
+		if (optimizer->canOptimizePartsSeparately()) {
+			postponeOptimizationProvidedItShouldBeRun(optimizer->getId(),
+				[m, args...](const LocalAnalyses &local) -> ShPtr<Optimizer> {
+					return std::make_shared<Optimization>(m,
+						toLocal(args, local)...);
+				}
+			);
+			return;
+		}
+
+		// The optimization needs the whole module.
+		runPostponedOptimizations(m);
+		runOptimizerProvidedItShouldBeRun(optimizer);
+		return;
+	}
+
 	auto optimizer = std::make_shared<Optimization>(m,
 		std::forward<Args>(args)...);
 	runOptimizerProvidedItShouldBeRun(optimizer);
 }
 
+/**
+* @brief Returns @a arg, which can be shared by optimizers running in parallel.
+*/
+template<typename T>
+const T &OptimizerManager::toLocal(const T &arg, const LocalAnalyses &local) {
+	return arg;
+}
+
+/**
+* @brief Returns the local value analysis instead of the shared @a va.
+*/
+ShPtr<ValueAnalysis> OptimizerManager::toLocal(const ShPtr<ValueAnalysis> &va,
+		const LocalAnalyses &local) {
+	return local.va;
+}
+
+/**
+* @brief Returns the local call info obtainer instead of the shared @a cio.
+*/
+ShPtr<CallInfoObtainer> OptimizerManager::toLocal(
+		const ShPtr<CallInfoObtainer> &cio, const LocalAnalyses &local) {
+	return local.cio;
+}
+
+/**
+* @brief Returns the local evaluator instead of the shared @a
+*        arithmExprEvaluator.
+*/
+ShPtr<ArithmExprEvaluator> OptimizerManager::toLocal(
+		const ShPtr<ArithmExprEvaluator> &arithmExprEvaluator,
+		const LocalAnalyses &local) {
+	return local.arithmExprEvaluator;
+}
+
 } // namespace llvmir2hll
 } // namespace retdec
@@ -96,21 +96,22 @@ BitShiftOptimizer::BitShiftOptimizer(ShPtr<Module> module):
 
 void BitShiftOptimizer::doOptimization() {
 	// Visit the initializer of all global variables.
-	for (auto i = module->global_var_begin(), e = module->global_var_end();
-			i != e; ++i) {
-		if (ShPtr<Expression> init = (*i)->getInitializer()) {
-			init->accept(this);
+	if (shouldOptimizeGlobalVars()) {
+		for (auto i = module->global_var_begin(), e = module->global_var_end();
+				i != e; ++i) {
+			if (ShPtr<Expression> init = (*i)->getInitializer()) {
+				init->accept(this);
+			}
 		}
 	}
 
 	// Visit all functions.
-	for (auto i = module->func_definition_begin(),
-			e = module->func_definition_end(); i != e; ++i) {
-		(*i)->accept(this);
+	for (const auto &func : getFuncDefinitionsToOptimize()) {
+		func->accept(this);
 	}
 }
 
-void BitShiftOptimizer::visit(ShPtr<BitShlOpExpr> expr) {
+void BitShiftOptimizer::visit(const ShPtr<BitShlOpExpr> &expr) {
 	// First, visit (and possibly optimize) nested expression.
 	Optimizer::visit(expr);
 
@@ -129,7 +130,7 @@ void BitShiftOptimizer::visit(ShPtr<BitShlOpExpr> expr) {
 	Expression::replaceExpression(expr, mulOpExpr);
 }
 
-void BitShiftOptimizer::visit(ShPtr<BitShrOpExpr> expr) {
+void BitShiftOptimizer::visit(const ShPtr<BitShrOpExpr> &expr) {
 	// First, visit (and possibly optimize) nested expression.
 	Optimizer::visit(expr);
 
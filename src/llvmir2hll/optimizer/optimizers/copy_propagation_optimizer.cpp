@@ -210,7 +210,7 @@ CopyPropagationOptimizer::CopyPropagationOptimizer(ShPtr<Module> module,
 		va(va), cio(cio), vuv(), dua(), uda(),
 		ducs(), udcs(), globalVars(module->getGlobalVars()),
 		toEntirelyRemoveStmts(), toRemoveStmtsPreserveCalls(), modifiedStmts(),
-		codeChanged(false) {
+		codeChanged(false), cfgIsOutdated(false) {
 			PRECONDITION_NON_NULL(module);
 			PRECONDITION_NON_NULL(va);
 			PRECONDITION_NON_NULL(cio);
@@ -222,7 +222,10 @@ void CopyPropagationOptimizer::doOptimization() {
 	// surprisingly speeds up the optimization).
 	va->clearCache();
 	va->initAliasAnalysis(module);
-	vuv = VarUsesVisitor::create(va, true, module);
+	// When a single function is optimized, other functions must not be
+	// touched, so the uses are computed lazily.
+	vuv = VarUsesVisitor::create(va, true,
+		optimizesWholeModule() ? module : ShPtr<Module>());
 	dua = DefUseAnalysis::create(module, va, vuv);
 	uda = UseDefAnalysis::create(module);
 
@@ -231,9 +234,14 @@ void CopyPropagationOptimizer::doOptimization() {
 
 void CopyPropagationOptimizer::runOnFunction(ShPtr<Function> func) {
 	auto currCFG = cfgBuilder->getCFG(func);
+	cfgIsOutdated = false;
 
 	// Keep optimizing until there are no changes.
 	do {
+		if (cfgIsOutdated) {
+			currCFG = cfgBuilder->getCFG(func);
+			cfgIsOutdated = false;
+		}
 		ducs = dua->getDefUseChains(
 			func,
 			currCFG,
@@ -623,7 +631,7 @@ void CopyPropagationOptimizer::handleCaseSingleUse(ShPtr<Statement> stmt,
 				LOG << "\t" << "end 12.2" << std::endl;
 				return;
 			}
-			if (!fnc->isDeclaration()) {
+			if (!isDeclaration(fnc)) {
 				LOG << "\t" << "end 12.3" << std::endl;
 				return;
 			}
@@ -643,7 +651,7 @@ void CopyPropagationOptimizer::handleCaseSingleUse(ShPtr<Statement> stmt,
 			LOG << "\t" << "end 13.2" << std::endl;
 			return;
 		}
-		if (!fnc->isDeclaration()) {
+		if (!isDeclaration(fnc)) {
 			for (auto i = stmtSuccData->dir_read_begin(),
 					e = stmtSuccData->dir_read_end(); i != e ; ++i) {
 				if (hasItem(globalVars, *i)) {
@@ -1108,6 +1116,7 @@ void CopyPropagationOptimizer::handleCaseInductionVariable2(
 	// move (y = y + A) after breaking if statement
 	Statement::removeStatement(xStmt);
 	ifStmt->appendStatement(xStmt);
+	cfgIsOutdated = true;
 
 	modifiedStmts.insert(ifStmt);
 	va->removeFromCache(ifStmt);
@@ -43,7 +43,9 @@ void DeadLocalAssignOptimizer::doOptimization() {
 	if (!va->isInValidState()) {
 		va->clearCache();
 	}
-	vuv = VarUsesVisitor::create(va, true, module);
+	// Pre-compute the uses only when all functions are going to be optimized.
+	vuv = VarUsesVisitor::create(va, true,
+		optimizesWholeModule() ? module : ShPtr<Module>());
 
 	// Perform the optimization on all functions.
 	FuncOptimizer::doOptimization();
@@ -36,19 +36,20 @@ DerefToArrayIndexOptimizer::DerefToArrayIndexOptimizer(ShPtr<Module> module):
 
 void DerefToArrayIndexOptimizer::doOptimization() {
 	// Visit all global variables and their initializers.
-	for (auto i = module->global_var_begin(), e = module->global_var_end();
-			i != e; ++i) {
-		(*i)->accept(this);
+	if (shouldOptimizeGlobalVars()) {
+		for (auto i = module->global_var_begin(), e = module->global_var_end();
+				i != e; ++i) {
+			(*i)->accept(this);
+		}
 	}
 
 	// Visit all functions.
-	for (auto i = module->func_definition_begin(),
-			e = module->func_definition_end(); i != e; ++i) {
-		(*i)->accept(this);
+	for (const auto &func : getFuncDefinitionsToOptimize()) {
+		func->accept(this);
 	}
 }
 
-void DerefToArrayIndexOptimizer::visit(ShPtr<DerefOpExpr> expr) {
+void DerefToArrayIndexOptimizer::visit(const ShPtr<DerefOpExpr> &expr) {
 	// First, visit (and possibly optimize) nested expressions.
 	Optimizer::visit(expr);
 
@@ -28,6 +28,10 @@ EmptyArrayToStringOptimizer::EmptyArrayToStringOptimizer(ShPtr<Module> module):
 	}
 
 void EmptyArrayToStringOptimizer::doOptimization() {
+	if (!shouldOptimizeGlobalVars()) {
+		return;
+	}
+
 	// For each global variable in the module...
 	for (auto i = module->global_var_begin(), e = module->global_var_end();
 			i != e; ++i) {
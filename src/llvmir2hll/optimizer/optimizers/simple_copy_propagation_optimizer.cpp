@@ -62,7 +62,8 @@ void SimpleCopyPropagationOptimizer::doOptimization() {
 	// surprisingly speeds up the optimization).
 	va->clearCache();
 	va->initAliasAnalysis(module);
-	vuv = VarUsesVisitor::create(va, true, module);
+	vuv = VarUsesVisitor::create(va, true,
+		optimizesWholeModule() ? module : ShPtr<Module>());
 
 	FuncOptimizer::doOptimization();
 }
@@ -74,14 +75,14 @@ void SimpleCopyPropagationOptimizer::runOnFunction(ShPtr<Function> func) {
 	FuncOptimizer::runOnFunction(func);
 }
 
-void SimpleCopyPropagationOptimizer::visit(ShPtr<AssignStmt> stmt) {
+void SimpleCopyPropagationOptimizer::visit(const ShPtr<AssignStmt> &stmt) {
 	// First, visit nested statements.
 	FuncOptimizer::visit(stmt);
 
 	tryOptimization(stmt);
 }
 
-void SimpleCopyPropagationOptimizer::visit(ShPtr<VarDefStmt> stmt) {
+void SimpleCopyPropagationOptimizer::visit(const ShPtr<VarDefStmt> &stmt) {
 	// First, visit nested statements.
 	FuncOptimizer::visit(stmt);
 
@@ -226,7 +227,7 @@ void SimpleCopyPropagationOptimizer::tryOptimizationCase1(
 
 		// If declaration is called (function with no body), the subsequent
 		// checks are not needed.
-		if (fnc->isDeclaration()) {
+		if (isDeclaration(fnc)) {
 			firstUseStmt = firstUseStmt->getSuccessor();
 			continue;
 		}
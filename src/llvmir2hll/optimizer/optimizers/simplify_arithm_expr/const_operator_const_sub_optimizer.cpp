@@ -59,73 +59,73 @@ std::string ConstOperatorConstSubOptimizer::getId() const {
 	return CONST_OPERATOR_CONST_SUB_OPTIMIZER_ID;
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<AddOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<SubOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<MulOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<MulOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<DivOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<DivOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<BitAndOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<BitAndOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<BitOrOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<BitOrOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<BitXorOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<BitXorOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<LtOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<LtOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<LtEqOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<LtEqOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<GtOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<GtOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<GtEqOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<GtEqOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<EqOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	// This is resolved in EqualOperandsSubOptimizer.
@@ -137,7 +137,7 @@ void ConstOperatorConstSubOptimizer::visit(ShPtr<EqOpExpr> expr) {
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<NeqOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	// This is resolved in EqualOperandsSubOptimizer.
@@ -149,13 +149,13 @@ void ConstOperatorConstSubOptimizer::visit(ShPtr<NeqOpExpr> expr) {
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<AndOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<AndOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
 }
 
-void ConstOperatorConstSubOptimizer::visit(ShPtr<OrOpExpr> expr) {
+void ConstOperatorConstSubOptimizer::visit(const ShPtr<OrOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	tryOptimizeConstConstOperand(expr);
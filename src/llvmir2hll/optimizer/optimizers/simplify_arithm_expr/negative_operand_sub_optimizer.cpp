@@ -44,7 +44,7 @@ std::string NegativeOperandSubOptimizer::getId() const {
 	return NEGATIVE_OPERAND_SUB_OPTIMIZER_ID;
 }
 
-void NegativeOperandSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
+void NegativeOperandSubOptimizer::visit(const ShPtr<AddOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	// -------
@@ -128,7 +128,7 @@ void NegativeOperandSubOptimizer::visit(ShPtr<AddOpExpr> expr) {
 	// -------
 }
 
-void NegativeOperandSubOptimizer::visit(ShPtr<SubOpExpr> expr) {
+void NegativeOperandSubOptimizer::visit(const ShPtr<SubOpExpr> &expr) {
 	OrderedAllVisitor::visit(expr);
 
 	// -------
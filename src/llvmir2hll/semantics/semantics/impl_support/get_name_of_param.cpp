@@ -11,13 +11,12 @@ namespace llvmir2hll {
 namespace semantics {
 
 /**
-* @brief Returns the name of the given parameter from the given map.
+* @brief Returns the name of the given parameter from the given table.
 */
-std::optional<std::string> getNameOfParamFromMap(const std::string &funcName,
-		unsigned paramPos, const FuncParamNamesMap &map) {
-	auto funcParamIter = map.find(FuncParamPosPair(funcName, paramPos));
-	return funcParamIter != map.end() ?
-		std::optional<std::string>(funcParamIter->second) : std::nullopt;
+std::optional<std::string> getNameOfParamFromTable(const std::string &funcName,
+		unsigned paramPos, const FuncParamNamesTable &table) {
+	auto entry = table.find(FuncParamPosPair(funcName, paramPos));
+	return entry ? std::optional<std::string>(entry->paramName) : std::nullopt;
 }
 
 } // namespace semantics
@@ -5,6 +5,8 @@
 * @copyright (c) 2017 Avast Software, licensed under the MIT license
 */
 
+#include <iterator>
+
 #include "retdec/llvmir2hll/semantics/semantics/impl_support/get_name_of_param.h"
 #include "retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param.h"
 #include "retdec/llvmir2hll/semantics/semantics/win_api_semantics/get_name_of_param/a.h"
@@ -41,15 +43,13 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
-namespace {
-
 /**
-* @brief This function is used to initialize FUNC_PARAM_NAMES_MAP later in the
-*        file.
+* @brief Implements getNameOfParam() for WinAPISemantics.
+*
+* See its description for more details.
 */
-const FuncParamNamesMap &initFuncParamNamesMap() {
-	static FuncParamNamesMap funcParamNamesMap;
-
+std::optional<std::string> getNameOfParam(const std::string &funcName,
+		unsigned paramPos) {
 	//
 	// The base of the information for this type of semantics has been obtained
 	// by using the
@@ -59,55 +59,47 @@ const FuncParamNamesMap &initFuncParamNamesMap() {
 	// been commented out.
 	//
 
-	// Since having 10 000 lines in a single file was found impossible to
-	// compile by using gcc in a reasonable amount of time and memory (even
-	// using -fno-var-tracking), we had to split the initialization into
-	// several modules.
-	initFuncParamNamesMap_A(funcParamNamesMap);
-	initFuncParamNamesMap_B(funcParamNamesMap);
-	initFuncParamNamesMap_C1(funcParamNamesMap);
-	initFuncParamNamesMap_C2(funcParamNamesMap);
-	initFuncParamNamesMap_D(funcParamNamesMap);
-	initFuncParamNamesMap_E(funcParamNamesMap);
-	initFuncParamNamesMap_F(funcParamNamesMap);
-	initFuncParamNamesMap_G1(funcParamNamesMap);
-	initFuncParamNamesMap_G2(funcParamNamesMap);
-	initFuncParamNamesMap_H(funcParamNamesMap);
-	initFuncParamNamesMap_I(funcParamNamesMap);
-	initFuncParamNamesMap_J(funcParamNamesMap);
-	initFuncParamNamesMap_K(funcParamNamesMap);
-	initFuncParamNamesMap_L(funcParamNamesMap);
-	initFuncParamNamesMap_M(funcParamNamesMap);
-	initFuncParamNamesMap_N(funcParamNamesMap);
-	initFuncParamNamesMap_O(funcParamNamesMap);
-	initFuncParamNamesMap_P(funcParamNamesMap);
-	initFuncParamNamesMap_Q(funcParamNamesMap);
-	initFuncParamNamesMap_R(funcParamNamesMap);
-	initFuncParamNamesMap_S(funcParamNamesMap);
-	initFuncParamNamesMap_T(funcParamNamesMap);
-	initFuncParamNamesMap_U(funcParamNamesMap);
-	initFuncParamNamesMap_V(funcParamNamesMap);
-	initFuncParamNamesMap_W(funcParamNamesMap);
-	initFuncParamNamesMap_X(funcParamNamesMap);
-	initFuncParamNamesMap_Y(funcParamNamesMap);
-	initFuncParamNamesMap_Z(funcParamNamesMap);
-
-	return funcParamNamesMap;
-}
+	// The entries of the tables are sorted at compile time. Sorting 10 000
+	// entries in a single module would be too expensive, so the tables are
+	// split into several modules. Later tables take precedence.
+	static const FuncParamNamesTable *const FUNC_PARAM_NAMES_TABLES[] = {
+		&getFuncParamNamesTable_A(),
+		&getFuncParamNamesTable_B(),
+		&getFuncParamNamesTable_C1(),
+		&getFuncParamNamesTable_C2(),
+		&getFuncParamNamesTable_D(),
+		&getFuncParamNamesTable_E(),
+		&getFuncParamNamesTable_F(),
+		&getFuncParamNamesTable_G1(),
+		&getFuncParamNamesTable_G2(),
+		&getFuncParamNamesTable_H(),
+		&getFuncParamNamesTable_I(),
+		&getFuncParamNamesTable_J(),
+		&getFuncParamNamesTable_K(),
+		&getFuncParamNamesTable_L(),
+		&getFuncParamNamesTable_M(),
+		&getFuncParamNamesTable_N(),
+		&getFuncParamNamesTable_O(),
+		&getFuncParamNamesTable_P(),
+		&getFuncParamNamesTable_Q(),
+		&getFuncParamNamesTable_R(),
+		&getFuncParamNamesTable_S(),
+		&getFuncParamNamesTable_T(),
+		&getFuncParamNamesTable_U(),
+		&getFuncParamNamesTable_V(),
+		&getFuncParamNamesTable_W(),
+		&getFuncParamNamesTable_X(),
+		&getFuncParamNamesTable_Y(),
+		&getFuncParamNamesTable_Z(),
+	};
 
-/// Mapping of function parameter positions into the names of parameters.
-const FuncParamNamesMap &FUNC_PARAM_NAMES_MAP(initFuncParamNamesMap());
-
-} // anonymous namespace
-
-/**
-* @brief Implements getNameOfParam() for WinAPISemantics.
-*
-* See its description for more details.
-*/
-std::optional<std::string> getNameOfParam(const std::string &funcName,
-		unsigned paramPos) {
-	return getNameOfParamFromMap(funcName, paramPos, FUNC_PARAM_NAMES_MAP);
+	for (auto i = std::rbegin(FUNC_PARAM_NAMES_TABLES),
+			e = std::rend(FUNC_PARAM_NAMES_TABLES); i != e; ++i) {
+		if (auto paramName = getNameOfParamFromTable(funcName, paramPos, **i)) {
+			return paramName;
+		}
+	}
+	return std::nullopt;
 }
 
 } // namespace win_api
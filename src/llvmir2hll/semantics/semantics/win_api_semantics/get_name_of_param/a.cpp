@@ -11,489 +11,502 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
 /**
-* @brief Initializes the given map with info about functions starting with A or
-*        underscore.
+* @brief Names of parameters of functions starting with A or underscore.
 */
-void initFuncParamNamesMap_A(FuncParamNamesMap &funcParamNamesMap) {
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("_hread", 1, "hFile"); // HFILE
-	ADD_PARAM_NAME("_hread", 2, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("_hread", 3, "lBytes"); // __LONG32
-	ADD_PARAM_NAME("_hwrite", 1, "hFile"); // HFILE
-	ADD_PARAM_NAME("_hwrite", 2, "lpBuffer"); // LPCCH
-	ADD_PARAM_NAME("_hwrite", 3, "lBytes"); // __LONG32
-	ADD_PARAM_NAME("_lclose", 1, "hFile"); // HFILE
-	ADD_PARAM_NAME("_lcreat", 1, "lpPathName"); // LPCSTR
-	ADD_PARAM_NAME("_lcreat", 2, "iAttribute"); // int
-	ADD_PARAM_NAME("_llseek", 1, "hFile"); // HFILE
-	ADD_PARAM_NAME("_llseek", 2, "lOffset"); // LONG
-	ADD_PARAM_NAME("_llseek", 3, "iOrigin"); // int
-	ADD_PARAM_NAME("_lopen", 1, "lpPathName"); // LPCSTR
-	ADD_PARAM_NAME("_lopen", 2, "iReadWrite"); // int
-	ADD_PARAM_NAME("_lread", 1, "hFile"); // HFILE
-	ADD_PARAM_NAME("_lread", 2, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("_lread", 3, "uBytes"); // UINT
-	ADD_PARAM_NAME("_lwrite", 1, "hFile"); // HFILE
-	ADD_PARAM_NAME("_lwrite", 2, "lpBuffer"); // LPCCH
-	ADD_PARAM_NAME("_lwrite", 3, "uBytes"); // UINT
+	{"_hread", 1, "hFile"}, // HFILE
+	{"_hread", 2, "lpBuffer"}, // LPVOID
+	{"_hread", 3, "lBytes"}, // __LONG32
+	{"_hwrite", 1, "hFile"}, // HFILE
+	{"_hwrite", 2, "lpBuffer"}, // LPCCH
+	{"_hwrite", 3, "lBytes"}, // __LONG32
+	{"_lclose", 1, "hFile"}, // HFILE
+	{"_lcreat", 1, "lpPathName"}, // LPCSTR
+	{"_lcreat", 2, "iAttribute"}, // int
+	{"_llseek", 1, "hFile"}, // HFILE
+	{"_llseek", 2, "lOffset"}, // LONG
+	{"_llseek", 3, "iOrigin"}, // int
+	{"_lopen", 1, "lpPathName"}, // LPCSTR
+	{"_lopen", 2, "iReadWrite"}, // int
+	{"_lread", 1, "hFile"}, // HFILE
+	{"_lread", 2, "lpBuffer"}, // LPVOID
+	{"_lread", 3, "uBytes"}, // UINT
+	{"_lwrite", 1, "hFile"}, // HFILE
+	{"_lwrite", 2, "lpBuffer"}, // LPCCH
+	{"_lwrite", 3, "uBytes"}, // UINT
+
+	{"AbortDoc", 1, "hdc"}, // HDC
+	{"AbortPath", 1, "hdc"}, // HDC
+	{"AbortPrinter", 1, "hPrinter"}, // HANDLE
+	{"AbortSystemShutdownA", 1, "lpMachineName"}, // LPSTR
+	{"AbortSystemShutdownW", 1, "lpMachineName"}, // LPWSTR
+	{"AcceptEx", 1, "sListenSocket"}, // SOCKET
+	{"AcceptEx", 2, "sAcceptSocket"}, // SOCKET
+	{"AcceptEx", 3, "lpOutputBuffer"}, // PVOID
+	{"AcceptEx", 4, "dwReceiveDataLength"}, // DWORD
+	{"AcceptEx", 5, "dwLocalAddressLength"}, // DWORD
+	{"AcceptEx", 6, "dwRemoteAddressLength"}, // DWORD
+	{"AcceptEx", 7, "lpdwBytesReceived"}, // LPDWORD
+	{"AcceptEx", 8, "lpOverlapped"}, // LPOVERLAPPED
+	{"AccessCheck", 1, "pSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"AccessCheck", 2, "ClientToken"}, // HANDLE
+	{"AccessCheck", 3, "DesiredAccess"}, // DWORD
+	{"AccessCheck", 4, "GenericMapping"}, // PGENERIC_MAPPING
+	{"AccessCheck", 5, "PrivilegeSet"}, // PPRIVILEGE_SET
+	{"AccessCheck", 6, "PrivilegeSetLength"}, // LPDWORD
+	{"AccessCheck", 7, "GrantedAccess"}, // LPDWORD
+	{"AccessCheck", 8, "AccessStatus"}, // LPBOOL
+	{"AccessCheckAndAuditAlarmA", 1, "SubsystemName"}, // LPCSTR
+	{"AccessCheckAndAuditAlarmA", 2, "HandleId"}, // LPVOID
+	{"AccessCheckAndAuditAlarmA", 3, "ObjectTypeName"}, // LPSTR
+	{"AccessCheckAndAuditAlarmA", 4, "ObjectName"}, // LPSTR
+	{"AccessCheckAndAuditAlarmA", 5, "SecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"AccessCheckAndAuditAlarmA", 6, "DesiredAccess"}, // DWORD
+	{"AccessCheckAndAuditAlarmA", 7, "GenericMapping"}, // PGENERIC_MAPPING
+	{"AccessCheckAndAuditAlarmA", 8, "ObjectCreation"}, // WINBOOL
+	{"AccessCheckAndAuditAlarmA", 9, "GrantedAccess"}, // LPDWORD
+	{"AccessCheckAndAuditAlarmA", 10, "AccessStatus"}, // LPBOOL
+	{"AccessCheckAndAuditAlarmA", 11, "pfGenerateOnClose"}, // LPBOOL
+	{"AccessCheckAndAuditAlarmW", 1, "SubsystemName"}, // LPCWSTR
+	{"AccessCheckAndAuditAlarmW", 2, "HandleId"}, // LPVOID
+	{"AccessCheckAndAuditAlarmW", 3, "ObjectTypeName"}, // LPWSTR
+	{"AccessCheckAndAuditAlarmW", 4, "ObjectName"}, // LPWSTR
+	{"AccessCheckAndAuditAlarmW", 5, "SecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"AccessCheckAndAuditAlarmW", 6, "DesiredAccess"}, // DWORD
+	{"AccessCheckAndAuditAlarmW", 7, "GenericMapping"}, // PGENERIC_MAPPING
+	{"AccessCheckAndAuditAlarmW", 8, "ObjectCreation"}, // WINBOOL
+	{"AccessCheckAndAuditAlarmW", 9, "GrantedAccess"}, // LPDWORD
+	{"AccessCheckAndAuditAlarmW", 10, "AccessStatus"}, // LPBOOL
+	{"AccessCheckAndAuditAlarmW", 11, "pfGenerateOnClose"}, // LPBOOL
+	{"AccessCheckByType", 1, "pSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"AccessCheckByType", 2, "PrincipalSelfSid"}, // PSID
+	{"AccessCheckByType", 3, "ClientToken"}, // HANDLE
+	{"AccessCheckByType", 4, "DesiredAccess"}, // DWORD
+	{"AccessCheckByType", 5, "ObjectTypeList"}, // POBJECT_TYPE_LIST
+	{"AccessCheckByType", 6, "ObjectTypeListLength"}, // DWORD
+	{"AccessCheckByType", 7, "GenericMapping"}, // PGENERIC_MAPPING
+	{"AccessCheckByType", 8, "PrivilegeSet"}, // PPRIVILEGE_SET
+	{"AccessCheckByType", 9, "PrivilegeSetLength"}, // LPDWORD
+	{"AccessCheckByType", 10, "GrantedAccess"}, // LPDWORD
+	{"AccessCheckByType", 11, "AccessStatus"}, // LPBOOL
+	{"AccessCheckByTypeAndAuditAlarmA", 1, "SubsystemName"}, // LPCSTR
+	{"AccessCheckByTypeAndAuditAlarmA", 2, "HandleId"}, // LPVOID
+	{"AccessCheckByTypeAndAuditAlarmA", 3, "ObjectTypeName"}, // LPCSTR
+	{"AccessCheckByTypeAndAuditAlarmA", 4, "ObjectName"}, // LPCSTR
+	{"AccessCheckByTypeAndAuditAlarmA", 5, "SecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"AccessCheckByTypeAndAuditAlarmA", 6, "PrincipalSelfSid"}, // PSID
+	{"AccessCheckByTypeAndAuditAlarmA", 7, "DesiredAccess"}, // DWORD
+	{"AccessCheckByTypeAndAuditAlarmA", 8, "AuditType"}, // AUDIT_EVENT_TYPE
+	{"AccessCheckByTypeAndAuditAlarmA", 9, "Flags"}, // DWORD
+	{"AccessCheckByTypeAndAuditAlarmA", 10, "ObjectTypeList"}, // POBJECT_TYPE_LIST
+	{"AccessCheckByTypeAndAuditAlarmA", 11, "ObjectTypeListLength"}, // DWORD
+	{"AccessCheckByTypeAndAuditAlarmA", 12, "GenericMapping"}, // PGENERIC_MAPPING
+	{"AccessCheckByTypeAndAuditAlarmA", 13, "ObjectCreation"}, // WINBOOL
+	{"AccessCheckByTypeAndAuditAlarmA", 14, "GrantedAccess"}, // LPDWORD
+	{"AccessCheckByTypeAndAuditAlarmA", 15, "AccessStatus"}, // LPBOOL
+	{"AccessCheckByTypeAndAuditAlarmA", 16, "pfGenerateOnClose"}, // LPBOOL
+	{"AccessCheckByTypeAndAuditAlarmW", 1, "SubsystemName"}, // LPCWSTR
+	{"AccessCheckByTypeAndAuditAlarmW", 2, "HandleId"}, // LPVOID
+	{"AccessCheckByTypeAndAuditAlarmW", 3, "ObjectTypeName"}, // LPCWSTR
+	{"AccessCheckByTypeAndAuditAlarmW", 4, "ObjectName"}, // LPCWSTR
+	{"AccessCheckByTypeAndAuditAlarmW", 5, "SecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"AccessCheckByTypeAndAuditAlarmW", 6, "PrincipalSelfSid"}, // PSID
+	{"AccessCheckByTypeAndAuditAlarmW", 7, "DesiredAccess"}, // DWORD
+	{"AccessCheckByTypeAndAuditAlarmW", 8, "AuditType"}, // AUDIT_EVENT_TYPE
+	{"AccessCheckByTypeAndAuditAlarmW", 9, "Flags"}, // DWORD
+	{"AccessCheckByTypeAndAuditAlarmW", 10, "ObjectTypeList"}, // POBJECT_TYPE_LIST
+	{"AccessCheckByTypeAndAuditAlarmW", 11, "ObjectTypeListLength"}, // DWORD
+	{"AccessCheckByTypeAndAuditAlarmW", 12, "GenericMapping"}, // PGENERIC_MAPPING
+	{"AccessCheckByTypeAndAuditAlarmW", 13, "ObjectCreation"}, // WINBOOL
+	{"AccessCheckByTypeAndAuditAlarmW", 14, "GrantedAccess"}, // LPDWORD
+	{"AccessCheckByTypeAndAuditAlarmW", 15, "AccessStatus"}, // LPBOOL
+	{"AccessCheckByTypeAndAuditAlarmW", 16, "pfGenerateOnClose"}, // LPBOOL
+	{"AccessCheckByTypeResultList", 1, "pSecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"AccessCheckByTypeResultList", 2, "PrincipalSelfSid"}, // PSID
+	{"AccessCheckByTypeResultList", 3, "ClientToken"}, // HANDLE
+	{"AccessCheckByTypeResultList", 4, "DesiredAccess"}, // DWORD
+	{"AccessCheckByTypeResultList", 5, "ObjectTypeList"}, // POBJECT_TYPE_LIST
+	{"AccessCheckByTypeResultList", 6, "ObjectTypeListLength"}, // DWORD
+	{"AccessCheckByTypeResultList", 7, "GenericMapping"}, // PGENERIC_MAPPING
+	{"AccessCheckByTypeResultList", 8, "PrivilegeSet"}, // PPRIVILEGE_SET
+	{"AccessCheckByTypeResultList", 9, "PrivilegeSetLength"}, // LPDWORD
+	{"AccessCheckByTypeResultList", 10, "GrantedAccessList"}, // LPDWORD
+	{"AccessCheckByTypeResultList", 11, "AccessStatusList"}, // LPDWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 1, "SubsystemName"}, // LPCSTR
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 2, "HandleId"}, // LPVOID
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 3, "ObjectTypeName"}, // LPCSTR
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 4, "ObjectName"}, // LPCSTR
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 5, "SecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 6, "PrincipalSelfSid"}, // PSID
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 7, "DesiredAccess"}, // DWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 8, "AuditType"}, // AUDIT_EVENT_TYPE
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 9, "Flags"}, // DWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 10, "ObjectTypeList"}, // POBJECT_TYPE_LIST
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 11, "ObjectTypeListLength"}, // DWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 12, "GenericMapping"}, // PGENERIC_MAPPING
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 13, "ObjectCreation"}, // WINBOOL
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 14, "GrantedAccess"}, // LPDWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 15, "AccessStatusList"}, // LPDWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmA", 16, "pfGenerateOnClose"}, // LPBOOL
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 1, "SubsystemName"}, // LPCSTR
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 2, "HandleId"}, // LPVOID
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 3, "ClientToken"}, // HANDLE
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 4, "ObjectTypeName"}, // LPCSTR
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 5, "ObjectName"}, // LPCSTR
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 6, "SecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 7, "PrincipalSelfSid"}, // PSID
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 8, "DesiredAccess"}, // DWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 9, "AuditType"}, // AUDIT_EVENT_TYPE
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 10, "Flags"}, // DWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 11, "ObjectTypeList"}, // POBJECT_TYPE_LIST
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 12, "ObjectTypeListLength"}, // DWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 13, "GenericMapping"}, // PGENERIC_MAPPING
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 14, "ObjectCreation"}, // WINBOOL
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 15, "GrantedAccess"}, // LPDWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 16, "AccessStatusList"}, // LPDWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleA", 17, "pfGenerateOnClose"}, // LPBOOL
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 1, "SubsystemName"}, // LPCWSTR
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 2, "HandleId"}, // LPVOID
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 3, "ClientToken"}, // HANDLE
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 4, "ObjectTypeName"}, // LPCWSTR
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 5, "ObjectName"}, // LPCWSTR
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 6, "SecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 7, "PrincipalSelfSid"}, // PSID
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 8, "DesiredAccess"}, // DWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 9, "AuditType"}, // AUDIT_EVENT_TYPE
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 10, "Flags"}, // DWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 11, "ObjectTypeList"}, // POBJECT_TYPE_LIST
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 12, "ObjectTypeListLength"}, // DWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 13, "GenericMapping"}, // PGENERIC_MAPPING
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 14, "ObjectCreation"}, // WINBOOL
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 15, "GrantedAccess"}, // LPDWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 16, "AccessStatusList"}, // LPDWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmByHandleW", 17, "pfGenerateOnClose"}, // LPBOOL
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 1, "SubsystemName"}, // LPCWSTR
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 2, "HandleId"}, // LPVOID
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 3, "ObjectTypeName"}, // LPCWSTR
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 4, "ObjectName"}, // LPCWSTR
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 5, "SecurityDescriptor"}, // PSECURITY_DESCRIPTOR
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 6, "PrincipalSelfSid"}, // PSID
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 7, "DesiredAccess"}, // DWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 8, "AuditType"}, // AUDIT_EVENT_TYPE
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 9, "Flags"}, // DWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 10, "ObjectTypeList"}, // POBJECT_TYPE_LIST
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 11, "ObjectTypeListLength"}, // DWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 12, "GenericMapping"}, // PGENERIC_MAPPING
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 13, "ObjectCreation"}, // WINBOOL
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 14, "GrantedAccess"}, // LPDWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 15, "AccessStatusList"}, // LPDWORD
+	{"AccessCheckByTypeResultListAndAuditAlarmW", 16, "pfGenerateOnClose"}, // LPBOOL
+	{"AcquireSRWLockExclusive", 1, "SRWLock"}, // PSRWLOCK
+	{"AcquireSRWLockShared", 1, "SRWLock"}, // PSRWLOCK
+	{"ActivateActCtx", 1, "hActCtx"}, // HANDLE
+	{"ActivateActCtx", 2, "lpCookie"}, // ULONG_PTR *
+	{"ActivateKeyboardLayout", 1, "hkl"}, // HKL
+	{"ActivateKeyboardLayout", 2, "Flags"}, // UINT
+	{"AddAccessAllowedAce", 1, "pAcl"}, // PACL
+	{"AddAccessAllowedAce", 2, "dwAceRevision"}, // DWORD
+	{"AddAccessAllowedAce", 3, "AccessMask"}, // DWORD
+	{"AddAccessAllowedAce", 4, "pSid"}, // PSID
+	{"AddAccessAllowedAceEx", 1, "pAcl"}, // PACL
+	{"AddAccessAllowedAceEx", 2, "dwAceRevision"}, // DWORD
+	{"AddAccessAllowedAceEx", 3, "AceFlags"}, // DWORD
+	{"AddAccessAllowedAceEx", 4, "AccessMask"}, // DWORD
+	{"AddAccessAllowedAceEx", 5, "pSid"}, // PSID
+	{"AddAccessAllowedObjectAce", 1, "pAcl"}, // PACL
+	{"AddAccessAllowedObjectAce", 2, "dwAceRevision"}, // DWORD
+	{"AddAccessAllowedObjectAce", 3, "AceFlags"}, // DWORD
+	{"AddAccessAllowedObjectAce", 4, "AccessMask"}, // DWORD
+	{"AddAccessAllowedObjectAce", 5, "ObjectTypeGuid"}, // GUID *
+	{"AddAccessAllowedObjectAce", 6, "InheritedObjectTypeGuid"}, // GUID *
+	{"AddAccessAllowedObjectAce", 7, "pSid"}, // PSID
+	{"AddAccessDeniedAce", 1, "pAcl"}, // PACL
+	{"AddAccessDeniedAce", 2, "dwAceRevision"}, // DWORD
+	{"AddAccessDeniedAce", 3, "AccessMask"}, // DWORD
+	{"AddAccessDeniedAce", 4, "pSid"}, // PSID
+	{"AddAccessDeniedAceEx", 1, "pAcl"}, // PACL
+	{"AddAccessDeniedAceEx", 2, "dwAceRevision"}, // DWORD
+	{"AddAccessDeniedAceEx", 3, "AceFlags"}, // DWORD
+	{"AddAccessDeniedAceEx", 4, "AccessMask"}, // DWORD
+	{"AddAccessDeniedAceEx", 5, "pSid"}, // PSID
+	{"AddAccessDeniedObjectAce", 1, "pAcl"}, // PACL
+	{"AddAccessDeniedObjectAce", 2, "dwAceRevision"}, // DWORD
+	{"AddAccessDeniedObjectAce", 3, "AceFlags"}, // DWORD
+	{"AddAccessDeniedObjectAce", 4, "AccessMask"}, // DWORD
+	{"AddAccessDeniedObjectAce", 5, "ObjectTypeGuid"}, // GUID *
+	{"AddAccessDeniedObjectAce", 6, "InheritedObjectTypeGuid"}, // GUID *
+	{"AddAccessDeniedObjectAce", 7, "pSid"}, // PSID
+	{"AddAce", 1, "pAcl"}, // PACL
+	{"AddAce", 2, "dwAceRevision"}, // DWORD
+	{"AddAce", 3, "dwStartingAceIndex"}, // DWORD
+	{"AddAce", 4, "pAceList"}, // LPVOID
+	{"AddAce", 5, "nAceListLength"}, // DWORD
+	{"AddAtomA", 1, "lpString"}, // LPCSTR
+	{"AddAtomW", 1, "lpString"}, // LPCWSTR
+	{"AddAuditAccessAce", 1, "pAcl"}, // PACL
+	{"AddAuditAccessAce", 2, "dwAceRevision"}, // DWORD
+	{"AddAuditAccessAce", 3, "dwAccessMask"}, // DWORD
+	{"AddAuditAccessAce", 4, "pSid"}, // PSID
+	{"AddAuditAccessAce", 5, "bAuditSuccess"}, // WINBOOL
+	{"AddAuditAccessAce", 6, "bAuditFailure"}, // WINBOOL
+	{"AddAuditAccessAceEx", 1, "pAcl"}, // PACL
+	{"AddAuditAccessAceEx", 2, "dwAceRevision"}, // DWORD
+	{"AddAuditAccessAceEx", 3, "AceFlags"}, // DWORD
+	{"AddAuditAccessAceEx", 4, "dwAccessMask"}, // DWORD
+	{"AddAuditAccessAceEx", 5, "pSid"}, // PSID
+	{"AddAuditAccessAceEx", 6, "bAuditSuccess"}, // WINBOOL
+	{"AddAuditAccessAceEx", 7, "bAuditFailure"}, // WINBOOL
+	{"AddAuditAccessObjectAce", 1, "pAcl"}, // PACL
+	{"AddAuditAccessObjectAce", 2, "dwAceRevision"}, // DWORD
+	{"AddAuditAccessObjectAce", 3, "AceFlags"}, // DWORD
+	{"AddAuditAccessObjectAce", 4, "AccessMask"}, // DWORD
+	{"AddAuditAccessObjectAce", 5, "ObjectTypeGuid"}, // GUID *
+	{"AddAuditAccessObjectAce", 6, "InheritedObjectTypeGuid"}, // GUID *
+	{"AddAuditAccessObjectAce", 7, "pSid"}, // PSID
+	{"AddAuditAccessObjectAce", 8, "bAuditSuccess"}, // WINBOOL
+	{"AddAuditAccessObjectAce", 9, "bAuditFailure"}, // WINBOOL
+	{"AddConditionalAce", 1, "pAcl"}, // PACL
+	{"AddConditionalAce", 2, "dwAceRevision"}, // DWORD
+	{"AddConditionalAce", 3, "AceFlags"}, // DWORD
+	{"AddConditionalAce", 4, "AceType"}, // UCHAR
+	{"AddConditionalAce", 5, "AccessMask"}, // DWORD
+	{"AddConditionalAce", 6, "pSid"}, // PSID
+	{"AddConditionalAce", 7, "ConditionStr"}, // PWCHAR
+	{"AddConditionalAce", 8, "ReturnLength"}, // DWORD *
+	{"AddConsoleAliasA", 1, "Source"}, // LPSTR
+	{"AddConsoleAliasA", 2, "Target"}, // LPSTR
+	{"AddConsoleAliasA", 3, "ExeName"}, // LPSTR
+	{"AddConsoleAliasW", 1, "Source"}, // LPWSTR
+	{"AddConsoleAliasW", 2, "Target"}, // LPWSTR
+	{"AddConsoleAliasW", 3, "ExeName"}, // LPWSTR
+	{"AddFontMemResourceEx", 1, "pFileView"}, // PVOID
+	{"AddFontMemResourceEx", 2, "cjSize"}, // DWORD
+	{"AddFontMemResourceEx", 3, "pvResrved"}, // PVOID
+	{"AddFontMemResourceEx", 4, "pNumFonts"}, // DWORD *
+	{"AddFontResourceA", 1, "lpszFilename"}, // LPCSTR
+	{"AddFontResourceExA", 1, "name"}, // LPCSTR
+	{"AddFontResourceExA", 2, "fl"}, // DWORD
+	{"AddFontResourceExA", 3, "res"}, // PVOID
+	{"AddFontResourceExW", 1, "name"}, // LPCWSTR
+	{"AddFontResourceExW", 2, "fl"}, // DWORD
+	{"AddFontResourceExW", 3, "res"}, // PVOID
+	{"AddFontResourceW", 1, "lpszFilename"}, // LPCWSTR
+	{"AddFormA", 1, "hPrinter"}, // HANDLE
+	{"AddFormA", 2, "Level"}, // DWORD
+	{"AddFormA", 3, "pForm"}, // LPBYTE
+	{"AddFormW", 1, "hPrinter"}, // HANDLE
+	{"AddFormW", 2, "Level"}, // DWORD
+	{"AddFormW", 3, "pForm"}, // LPBYTE
+	{"AddJobA", 1, "hPrinter"}, // HANDLE
+	{"AddJobA", 2, "Level"}, // DWORD
+	{"AddJobA", 3, "pData"}, // LPBYTE
+	{"AddJobA", 4, "cbBuf"}, // DWORD
+	{"AddJobA", 5, "pcbNeeded"}, // LPDWORD
+	{"AddJobW", 1, "hPrinter"}, // HANDLE
+	{"AddJobW", 2, "Level"}, // DWORD
+	{"AddJobW", 3, "pData"}, // LPBYTE
+	{"AddJobW", 4, "cbBuf"}, // DWORD
+	{"AddJobW", 5, "pcbNeeded"}, // LPDWORD
+	{"AddLocalAlternateComputerNameA", 1, "lpDnsFQHostname"}, // LPCSTR
+	{"AddLocalAlternateComputerNameA", 2, "ulFlags"}, // ULONG
+	{"AddLocalAlternateComputerNameW", 1, "lpDnsFQHostname"}, // LPCWSTR
+	{"AddLocalAlternateComputerNameW", 2, "ulFlags"}, // ULONG
+	{"AddMandatoryAce", 1, "pAcl"}, // PACL
+	{"AddMandatoryAce", 2, "dwAceRevision"}, // DWORD
+	{"AddMandatoryAce", 3, "AceFlags"}, // DWORD
+	{"AddMandatoryAce", 4, "MandatoryPolicy"}, // DWORD
+	{"AddMandatoryAce", 5, "pLabelSid"}, // PSID
+	{"AddMonitorA", 1, "pName"}, // LPSTR
+	{"AddMonitorA", 2, "Level"}, // DWORD
+	{"AddMonitorA", 3, "pMonitorInfo"}, // LPBYTE
+	{"AddMonitorW", 1, "pName"}, // LPWSTR
+	{"AddMonitorW", 2, "Level"}, // DWORD
+	{"AddMonitorW", 3, "pMonitorInfo"}, // LPBYTE
+	{"AddPortA", 1, "pName"}, // LPSTR
+	{"AddPortA", 2, "hWnd"}, // HWND
+	{"AddPortA", 3, "pMonitorName"}, // LPSTR
+	{"AddPortW", 1, "pName"}, // LPWSTR
+	{"AddPortW", 2, "hWnd"}, // HWND
+	{"AddPortW", 3, "pMonitorName"}, // LPWSTR
+	{"AddPrintProcessorA", 1, "pName"}, // LPSTR
+	{"AddPrintProcessorA", 2, "pEnvironment"}, // LPSTR
+	{"AddPrintProcessorA", 3, "pPathName"}, // LPSTR
+	{"AddPrintProcessorA", 4, "pPrintProcessorName"}, // LPSTR
+	{"AddPrintProcessorW", 1, "pName"}, // LPWSTR
+	{"AddPrintProcessorW", 2, "pEnvironment"}, // LPWSTR
+	{"AddPrintProcessorW", 3, "pPathName"}, // LPWSTR
+	{"AddPrintProcessorW", 4, "pPrintProcessorName"}, // LPWSTR
+	{"AddPrintProvidorA", 1, "pName"}, // LPSTR
+	{"AddPrintProvidorA", 2, "level"}, // DWORD
+	{"AddPrintProvidorA", 3, "pProvidorInfo"}, // LPBYTE
+	{"AddPrintProvidorW", 1, "pName"}, // LPWSTR
+	{"AddPrintProvidorW", 2, "level"}, // DWORD
+	{"AddPrintProvidorW", 3, "pProvidorInfo"}, // LPBYTE
+	{"AddPrinterA", 1, "pName"}, // LPSTR
+	{"AddPrinterA", 2, "Level"}, // DWORD
+	{"AddPrinterA", 3, "pPrinter"}, // LPBYTE
+	{"AddPrinterConnectionA", 1, "pName"}, // LPSTR
+	{"AddPrinterConnectionW", 1, "pName"}, // LPWSTR
+	{"AddPrinterDriverA", 1, "pName"}, // LPSTR
+	{"AddPrinterDriverA", 2, "Level"}, // DWORD
+	{"AddPrinterDriverA", 3, "pDriverInfo"}, // LPBYTE
+	{"AddPrinterDriverExA", 1, "pName"}, // LPSTR
+	{"AddPrinterDriverExA", 2, "Level"}, // DWORD
+	{"AddPrinterDriverExA", 3, "pDriverInfo"}, // LPBYTE
+	{"AddPrinterDriverExA", 4, "dwFileCopyFlags"}, // DWORD
+	{"AddPrinterDriverExW", 1, "pName"}, // LPWSTR
+	{"AddPrinterDriverExW", 2, "Level"}, // DWORD
+	{"AddPrinterDriverExW", 3, "pDriverInfo"}, // LPBYTE
+	{"AddPrinterDriverExW", 4, "dwFileCopyFlags"}, // DWORD
+	{"AddPrinterDriverW", 1, "pName"}, // LPWSTR
+	{"AddPrinterDriverW", 2, "Level"}, // DWORD
+	{"AddPrinterDriverW", 3, "pDriverInfo"}, // LPBYTE
+	{"AddPrinterW", 1, "pName"}, // LPWSTR
+	{"AddPrinterW", 2, "Level"}, // DWORD
+	{"AddPrinterW", 3, "pPrinter"}, // LPBYTE
+	{"AddRefActCtx", 1, "hActCtx"}, // HANDLE
+	{"AddSIDToBoundaryDescriptor", 1, "BoundaryDescriptor"}, // HANDLE *
+	{"AddSIDToBoundaryDescriptor", 2, "RequiredSid"}, // PSID
+	{"AddSecureMemoryCacheCallback", 1, "pfnCallBack"}, // PSECURE_MEMORY_CACHE_CALLBACK
+	{"AddUsersToEncryptedFile", 1, "lpFileName"}, // LPCWSTR
+	{"AddUsersToEncryptedFile", 2, "pUsers"}, // PENCRYPTION_CERTIFICATE_LIST
+	{"AddVectoredContinueHandler", 1, "First"}, // ULONG
+	{"AddVectoredContinueHandler", 2, "Handler"}, // PVECTORED_EXCEPTION_HANDLER
+	{"AddVectoredExceptionHandler", 1, "First"}, // ULONG
+	{"AddVectoredExceptionHandler", 2, "Handler"}, // PVECTORED_EXCEPTION_HANDLER
+	{"AdjustTokenGroups", 1, "TokenHandle"}, // HANDLE
+	{"AdjustTokenGroups", 2, "ResetToDefault"}, // WINBOOL
+	{"AdjustTokenGroups", 3, "NewState"}, // PTOKEN_GROUPS
+	{"AdjustTokenGroups", 4, "BufferLength"}, // DWORD
+	{"AdjustTokenGroups", 5, "PreviousState"}, // PTOKEN_GROUPS
+	{"AdjustTokenGroups", 6, "ReturnLength"}, // PDWORD
+	{"AdjustTokenPrivileges", 1, "TokenHandle"}, // HANDLE
+	{"AdjustTokenPrivileges", 2, "DisableAllPrivileges"}, // WINBOOL
+	{"AdjustTokenPrivileges", 3, "NewState"}, // PTOKEN_PRIVILEGES
+	{"AdjustTokenPrivileges", 4, "BufferLength"}, // DWORD
+	{"AdjustTokenPrivileges", 5, "PreviousState"}, // PTOKEN_PRIVILEGES
+	{"AdjustTokenPrivileges", 6, "ReturnLength"}, // PDWORD
+	{"AdjustWindowRect", 1, "lpRect"}, // LPRECT
+	{"AdjustWindowRect", 2, "dwStyle"}, // DWORD
+	{"AdjustWindowRect", 3, "bMenu"}, // WINBOOL
+	{"AdjustWindowRectEx", 1, "lpRect"}, // LPRECT
+	{"AdjustWindowRectEx", 2, "dwStyle"}, // DWORD
+	{"AdjustWindowRectEx", 3, "bMenu"}, // WINBOOL
+	{"AdjustWindowRectEx", 4, "dwExStyle"}, // DWORD
+	{"AdvancedDocumentPropertiesA", 1, "hWnd"}, // HWND
+	{"AdvancedDocumentPropertiesA", 2, "hPrinter"}, // HANDLE
+	{"AdvancedDocumentPropertiesA", 3, "pDeviceName"}, // LPSTR
+	{"AdvancedDocumentPropertiesA", 4, "pDevModeOutput"}, // PDEVMODEA
+	{"AdvancedDocumentPropertiesA", 5, "pDevModeInput"}, // PDEVMODEA
+	{"AdvancedDocumentPropertiesW", 1, "hWnd"}, // HWND
+	{"AdvancedDocumentPropertiesW", 2, "hPrinter"}, // HANDLE
+	{"AdvancedDocumentPropertiesW", 3, "pDeviceName"}, // LPWSTR
+	{"AdvancedDocumentPropertiesW", 4, "pDevModeOutput"}, // PDEVMODEW
+	{"AdvancedDocumentPropertiesW", 5, "pDevModeInput"}, // PDEVMODEW
+	{"AllocateAndInitializeSid", 1, "pIdentifierAuthority"}, // PSID_IDENTIFIER_AUTHORITY
+	{"AllocateAndInitializeSid", 2, "nSubAuthorityCount"}, // BYTE
+	{"AllocateAndInitializeSid", 3, "nSubAuthority0"}, // DWORD
+	{"AllocateAndInitializeSid", 4, "nSubAuthority1"}, // DWORD
+	{"AllocateAndInitializeSid", 5, "nSubAuthority2"}, // DWORD
+	{"AllocateAndInitializeSid", 6, "nSubAuthority3"}, // DWORD
+	{"AllocateAndInitializeSid", 7, "nSubAuthority4"}, // DWORD
+	{"AllocateAndInitializeSid", 8, "nSubAuthority5"}, // DWORD
+	{"AllocateAndInitializeSid", 9, "nSubAuthority6"}, // DWORD
+	{"AllocateAndInitializeSid", 10, "nSubAuthority7"}, // DWORD
+	{"AllocateAndInitializeSid", 11, "pSid"}, // PSID *
+	{"AllocateLocallyUniqueId", 1, "Luid"}, // PLUID
+	{"AllocateUserPhysicalPages", 1, "hProcess"}, // HANDLE
+	{"AllocateUserPhysicalPages", 2, "NumberOfPages"}, // PULONG_PTR
+	{"AllocateUserPhysicalPages", 3, "PageArray"}, // PULONG_PTR
+	{"AllocateUserPhysicalPagesNuma", 1, "hProcess"}, // HANDLE
+	{"AllocateUserPhysicalPagesNuma", 2, "NumberOfPages"}, // PULONG_PTR
+	{"AllocateUserPhysicalPagesNuma", 3, "PageArray"}, // PULONG_PTR
+	{"AllocateUserPhysicalPagesNuma", 4, "nndPreferred"}, // DWORD
+	{"AllowSetForegroundWindow", 1, "dwProcessId"}, // DWORD
+	{"AlphaBlend", 1, "hdcDest"}, // HDC
+	{"AlphaBlend", 2, "xoriginDest"}, // int
+	{"AlphaBlend", 3, "yoriginDest"}, // int
+	{"AlphaBlend", 4, "wDest"}, // int
+	{"AlphaBlend", 5, "hDest"}, // int
+	{"AlphaBlend", 6, "hdcSrc"}, // HDC
+	{"AlphaBlend", 7, "xoriginSrc"}, // int
+	{"AlphaBlend", 8, "yoriginSrc"}, // int
+	{"AlphaBlend", 9, "wSrc"}, // int
+	{"AlphaBlend", 10, "hSrc"}, // int
+	{"AlphaBlend", 11, "ftn"}, // BLENDFUNCTION
+	{"AngleArc", 1, "hdc"}, // HDC
+	{"AngleArc", 2, "x"}, // int
+	{"AngleArc", 3, "y"}, // int
+	{"AngleArc", 4, "r"}, // DWORD
+	{"AngleArc", 5, "StartAngle"}, // FLOAT
+	{"AngleArc", 6, "SweepAngle"}, // FLOAT
+	{"AnimatePalette", 1, "hPal"}, // HPALETTE
+	{"AnimatePalette", 2, "iStartIndex"}, // UINT
+	{"AnimatePalette", 3, "cEntries"}, // UINT
+	{"AnimatePalette", 4, "ppe"}, // CONST PALETTEENTRY *
+	{"AnimateWindow", 1, "hWnd"}, // HWND
+	{"AnimateWindow", 2, "dwTime"}, // DWORD
+	{"AnimateWindow", 3, "dwFlags"}, // DWORD
+	{"AppendMenuA", 1, "hMenu"}, // HMENU
+	{"AppendMenuA", 2, "uFlags"}, // UINT
+	{"AppendMenuA", 3, "uIDNewItem"}, // UINT_PTR
+	{"AppendMenuA", 4, "lpNewItem"}, // LPCSTR
+	{"AppendMenuW", 1, "hMenu"}, // HMENU
+	{"AppendMenuW", 2, "uFlags"}, // UINT
+	{"AppendMenuW", 3, "uIDNewItem"}, // UINT_PTR
+	{"AppendMenuW", 4, "lpNewItem"}, // LPCWSTR
+	{"AppendPrinterNotifyInfoData", 1, "pInfoDest"}, // PPRINTER_NOTIFY_INFO
+	{"AppendPrinterNotifyInfoData", 2, "pInfoDataSrc"}, // PPRINTER_NOTIFY_INFO_DATA
+	{"AppendPrinterNotifyInfoData", 3, "fdwFlags"}, // DWORD
+	{"ApplicationRecoveryFinished", 1, "bSuccess"}, // WINBOOL
+	{"ApplicationRecoveryInProgress", 1, "pbCanceled"}, // PBOOL
+	{"Arc", 1, "hdc"}, // HDC
+	{"Arc", 2, "x1"}, // int
+	{"Arc", 3, "y1"}, // int
+	{"Arc", 4, "x2"}, // int
+	{"Arc", 5, "y2"}, // int
+	{"Arc", 6, "x3"}, // int
+	{"Arc", 7, "y3"}, // int
+	{"Arc", 8, "x4"}, // int
+	{"Arc", 9, "y4"}, // int
+	{"ArcTo", 1, "hdc"}, // HDC
+	{"ArcTo", 2, "left"}, // int
+	{"ArcTo", 3, "top"}, // int
+	{"ArcTo", 4, "right"}, // int
+	{"ArcTo", 5, "bottom"}, // int
+	{"ArcTo", 6, "xr1"}, // int
+	{"ArcTo", 7, "yr1"}, // int
+	{"ArcTo", 8, "xr2"}, // int
+	{"ArcTo", 9, "yr2"}, // int
+	{"AreAllAccessesGranted", 1, "GrantedAccess"}, // DWORD
+	{"AreAllAccessesGranted", 2, "DesiredAccess"}, // DWORD
+	{"AreAnyAccessesGranted", 1, "GrantedAccess"}, // DWORD
+	{"AreAnyAccessesGranted", 2, "DesiredAccess"}, // DWORD
+	{"ArrangeIconicWindows", 1, "hWnd"}, // HWND
+	{"AssignProcessToJobObject", 1, "hJob"}, // HANDLE
+	{"AssignProcessToJobObject", 2, "hProcess"}, // HANDLE
+	{"AttachConsole", 1, "dwProcessId"}, // DWORD
+	{"AttachThreadInput", 1, "idAttach"}, // DWORD
+	{"AttachThreadInput", 2, "idAttachTo"}, // DWORD
+	{"AttachThreadInput", 3, "fAttach"}, // WINBOOL
+};
+
+} // anonymous namespace
 
-	ADD_PARAM_NAME("AbortDoc", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("AbortPath", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("AbortPrinter", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("AbortSystemShutdownA", 1, "lpMachineName"); // LPSTR
-	ADD_PARAM_NAME("AbortSystemShutdownW", 1, "lpMachineName"); // LPWSTR
-	ADD_PARAM_NAME("AcceptEx", 1, "sListenSocket"); // SOCKET
-	ADD_PARAM_NAME("AcceptEx", 2, "sAcceptSocket"); // SOCKET
-	ADD_PARAM_NAME("AcceptEx", 3, "lpOutputBuffer"); // PVOID
-	ADD_PARAM_NAME("AcceptEx", 4, "dwReceiveDataLength"); // DWORD
-	ADD_PARAM_NAME("AcceptEx", 5, "dwLocalAddressLength"); // DWORD
-	ADD_PARAM_NAME("AcceptEx", 6, "dwRemoteAddressLength"); // DWORD
-	ADD_PARAM_NAME("AcceptEx", 7, "lpdwBytesReceived"); // LPDWORD
-	ADD_PARAM_NAME("AcceptEx", 8, "lpOverlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("AccessCheck", 1, "pSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("AccessCheck", 2, "ClientToken"); // HANDLE
-	ADD_PARAM_NAME("AccessCheck", 3, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("AccessCheck", 4, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("AccessCheck", 5, "PrivilegeSet"); // PPRIVILEGE_SET
-	ADD_PARAM_NAME("AccessCheck", 6, "PrivilegeSetLength"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheck", 7, "GrantedAccess"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheck", 8, "AccessStatus"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmA", 1, "SubsystemName"); // LPCSTR
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmA", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmA", 3, "ObjectTypeName"); // LPSTR
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmA", 4, "ObjectName"); // LPSTR
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmA", 5, "SecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmA", 6, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmA", 7, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmA", 8, "ObjectCreation"); // WINBOOL
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmA", 9, "GrantedAccess"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmA", 10, "AccessStatus"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmA", 11, "pfGenerateOnClose"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmW", 1, "SubsystemName"); // LPCWSTR
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmW", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmW", 3, "ObjectTypeName"); // LPWSTR
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmW", 4, "ObjectName"); // LPWSTR
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmW", 5, "SecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmW", 6, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmW", 7, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmW", 8, "ObjectCreation"); // WINBOOL
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmW", 9, "GrantedAccess"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmW", 10, "AccessStatus"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckAndAuditAlarmW", 11, "pfGenerateOnClose"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckByType", 1, "pSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("AccessCheckByType", 2, "PrincipalSelfSid"); // PSID
-	ADD_PARAM_NAME("AccessCheckByType", 3, "ClientToken"); // HANDLE
-	ADD_PARAM_NAME("AccessCheckByType", 4, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByType", 5, "ObjectTypeList"); // POBJECT_TYPE_LIST
-	ADD_PARAM_NAME("AccessCheckByType", 6, "ObjectTypeListLength"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByType", 7, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("AccessCheckByType", 8, "PrivilegeSet"); // PPRIVILEGE_SET
-	ADD_PARAM_NAME("AccessCheckByType", 9, "PrivilegeSetLength"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByType", 10, "GrantedAccess"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByType", 11, "AccessStatus"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 1, "SubsystemName"); // LPCSTR
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 3, "ObjectTypeName"); // LPCSTR
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 4, "ObjectName"); // LPCSTR
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 5, "SecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 6, "PrincipalSelfSid"); // PSID
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 7, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 8, "AuditType"); // AUDIT_EVENT_TYPE
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 9, "Flags"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 10, "ObjectTypeList"); // POBJECT_TYPE_LIST
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 11, "ObjectTypeListLength"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 12, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 13, "ObjectCreation"); // WINBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 14, "GrantedAccess"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 15, "AccessStatus"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmA", 16, "pfGenerateOnClose"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 1, "SubsystemName"); // LPCWSTR
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 3, "ObjectTypeName"); // LPCWSTR
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 4, "ObjectName"); // LPCWSTR
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 5, "SecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 6, "PrincipalSelfSid"); // PSID
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 7, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 8, "AuditType"); // AUDIT_EVENT_TYPE
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 9, "Flags"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 10, "ObjectTypeList"); // POBJECT_TYPE_LIST
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 11, "ObjectTypeListLength"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 12, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 13, "ObjectCreation"); // WINBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 14, "GrantedAccess"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 15, "AccessStatus"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeAndAuditAlarmW", 16, "pfGenerateOnClose"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeResultList", 1, "pSecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("AccessCheckByTypeResultList", 2, "PrincipalSelfSid"); // PSID
-	ADD_PARAM_NAME("AccessCheckByTypeResultList", 3, "ClientToken"); // HANDLE
-	ADD_PARAM_NAME("AccessCheckByTypeResultList", 4, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultList", 5, "ObjectTypeList"); // POBJECT_TYPE_LIST
-	ADD_PARAM_NAME("AccessCheckByTypeResultList", 6, "ObjectTypeListLength"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultList", 7, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("AccessCheckByTypeResultList", 8, "PrivilegeSet"); // PPRIVILEGE_SET
-	ADD_PARAM_NAME("AccessCheckByTypeResultList", 9, "PrivilegeSetLength"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultList", 10, "GrantedAccessList"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultList", 11, "AccessStatusList"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 1, "SubsystemName"); // LPCSTR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 3, "ObjectTypeName"); // LPCSTR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 4, "ObjectName"); // LPCSTR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 5, "SecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 6, "PrincipalSelfSid"); // PSID
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 7, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 8, "AuditType"); // AUDIT_EVENT_TYPE
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 9, "Flags"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 10, "ObjectTypeList"); // POBJECT_TYPE_LIST
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 11, "ObjectTypeListLength"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 12, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 13, "ObjectCreation"); // WINBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 14, "GrantedAccess"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 15, "AccessStatusList"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmA", 16, "pfGenerateOnClose"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 1, "SubsystemName"); // LPCSTR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 3, "ClientToken"); // HANDLE
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 4, "ObjectTypeName"); // LPCSTR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 5, "ObjectName"); // LPCSTR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 6, "SecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 7, "PrincipalSelfSid"); // PSID
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 8, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 9, "AuditType"); // AUDIT_EVENT_TYPE
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 10, "Flags"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 11, "ObjectTypeList"); // POBJECT_TYPE_LIST
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 12, "ObjectTypeListLength"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 13, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 14, "ObjectCreation"); // WINBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 15, "GrantedAccess"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 16, "AccessStatusList"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleA", 17, "pfGenerateOnClose"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 1, "SubsystemName"); // LPCWSTR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 3, "ClientToken"); // HANDLE
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 4, "ObjectTypeName"); // LPCWSTR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 5, "ObjectName"); // LPCWSTR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 6, "SecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 7, "PrincipalSelfSid"); // PSID
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 8, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 9, "AuditType"); // AUDIT_EVENT_TYPE
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 10, "Flags"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 11, "ObjectTypeList"); // POBJECT_TYPE_LIST
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 12, "ObjectTypeListLength"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 13, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 14, "ObjectCreation"); // WINBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 15, "GrantedAccess"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 16, "AccessStatusList"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmByHandleW", 17, "pfGenerateOnClose"); // LPBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 1, "SubsystemName"); // LPCWSTR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 2, "HandleId"); // LPVOID
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 3, "ObjectTypeName"); // LPCWSTR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 4, "ObjectName"); // LPCWSTR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 5, "SecurityDescriptor"); // PSECURITY_DESCRIPTOR
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 6, "PrincipalSelfSid"); // PSID
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 7, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 8, "AuditType"); // AUDIT_EVENT_TYPE
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 9, "Flags"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 10, "ObjectTypeList"); // POBJECT_TYPE_LIST
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 11, "ObjectTypeListLength"); // DWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 12, "GenericMapping"); // PGENERIC_MAPPING
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 13, "ObjectCreation"); // WINBOOL
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 14, "GrantedAccess"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 15, "AccessStatusList"); // LPDWORD
-	ADD_PARAM_NAME("AccessCheckByTypeResultListAndAuditAlarmW", 16, "pfGenerateOnClose"); // LPBOOL
-	ADD_PARAM_NAME("AcquireSRWLockExclusive", 1, "SRWLock"); // PSRWLOCK
-	ADD_PARAM_NAME("AcquireSRWLockShared", 1, "SRWLock"); // PSRWLOCK
-	ADD_PARAM_NAME("ActivateActCtx", 1, "hActCtx"); // HANDLE
-	ADD_PARAM_NAME("ActivateActCtx", 2, "lpCookie"); // ULONG_PTR *
-	ADD_PARAM_NAME("ActivateKeyboardLayout", 1, "hkl"); // HKL
-	ADD_PARAM_NAME("ActivateKeyboardLayout", 2, "Flags"); // UINT
-	ADD_PARAM_NAME("AddAccessAllowedAce", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("AddAccessAllowedAce", 2, "dwAceRevision"); // DWORD
-	ADD_PARAM_NAME("AddAccessAllowedAce", 3, "AccessMask"); // DWORD
-	ADD_PARAM_NAME("AddAccessAllowedAce", 4, "pSid"); // PSID
-	ADD_PARAM_NAME("AddAccessAllowedAceEx", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("AddAccessAllowedAceEx", 2, "dwAceRevision"); // DWORD
-	ADD_PARAM_NAME("AddAccessAllowedAceEx", 3, "AceFlags"); // DWORD
-	ADD_PARAM_NAME("AddAccessAllowedAceEx", 4, "AccessMask"); // DWORD
-	ADD_PARAM_NAME("AddAccessAllowedAceEx", 5, "pSid"); // PSID
-	ADD_PARAM_NAME("AddAccessAllowedObjectAce", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("AddAccessAllowedObjectAce", 2, "dwAceRevision"); // DWORD
-	ADD_PARAM_NAME("AddAccessAllowedObjectAce", 3, "AceFlags"); // DWORD
-	ADD_PARAM_NAME("AddAccessAllowedObjectAce", 4, "AccessMask"); // DWORD
-	ADD_PARAM_NAME("AddAccessAllowedObjectAce", 5, "ObjectTypeGuid"); // GUID *
-	ADD_PARAM_NAME("AddAccessAllowedObjectAce", 6, "InheritedObjectTypeGuid"); // GUID *
-	ADD_PARAM_NAME("AddAccessAllowedObjectAce", 7, "pSid"); // PSID
-	ADD_PARAM_NAME("AddAccessDeniedAce", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("AddAccessDeniedAce", 2, "dwAceRevision"); // DWORD
-	ADD_PARAM_NAME("AddAccessDeniedAce", 3, "AccessMask"); // DWORD
-	ADD_PARAM_NAME("AddAccessDeniedAce", 4, "pSid"); // PSID
-	ADD_PARAM_NAME("AddAccessDeniedAceEx", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("AddAccessDeniedAceEx", 2, "dwAceRevision"); // DWORD
-	ADD_PARAM_NAME("AddAccessDeniedAceEx", 3, "AceFlags"); // DWORD
-	ADD_PARAM_NAME("AddAccessDeniedAceEx", 4, "AccessMask"); // DWORD
-	ADD_PARAM_NAME("AddAccessDeniedAceEx", 5, "pSid"); // PSID
-	ADD_PARAM_NAME("AddAccessDeniedObjectAce", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("AddAccessDeniedObjectAce", 2, "dwAceRevision"); // DWORD
-	ADD_PARAM_NAME("AddAccessDeniedObjectAce", 3, "AceFlags"); // DWORD
-	ADD_PARAM_NAME("AddAccessDeniedObjectAce", 4, "AccessMask"); // DWORD
-	ADD_PARAM_NAME("AddAccessDeniedObjectAce", 5, "ObjectTypeGuid"); // GUID *
-	ADD_PARAM_NAME("AddAccessDeniedObjectAce", 6, "InheritedObjectTypeGuid"); // GUID *
-	ADD_PARAM_NAME("AddAccessDeniedObjectAce", 7, "pSid"); // PSID
-	ADD_PARAM_NAME("AddAce", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("AddAce", 2, "dwAceRevision"); // DWORD
-	ADD_PARAM_NAME("AddAce", 3, "dwStartingAceIndex"); // DWORD
-	ADD_PARAM_NAME("AddAce", 4, "pAceList"); // LPVOID
-	ADD_PARAM_NAME("AddAce", 5, "nAceListLength"); // DWORD
-	ADD_PARAM_NAME("AddAtomA", 1, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("AddAtomW", 1, "lpString"); // LPCWSTR
-	ADD_PARAM_NAME("AddAuditAccessAce", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("AddAuditAccessAce", 2, "dwAceRevision"); // DWORD
-	ADD_PARAM_NAME("AddAuditAccessAce", 3, "dwAccessMask"); // DWORD
-	ADD_PARAM_NAME("AddAuditAccessAce", 4, "pSid"); // PSID
-	ADD_PARAM_NAME("AddAuditAccessAce", 5, "bAuditSuccess"); // WINBOOL
-	ADD_PARAM_NAME("AddAuditAccessAce", 6, "bAuditFailure"); // WINBOOL
-	ADD_PARAM_NAME("AddAuditAccessAceEx", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("AddAuditAccessAceEx", 2, "dwAceRevision"); // DWORD
-	ADD_PARAM_NAME("AddAuditAccessAceEx", 3, "AceFlags"); // DWORD
-	ADD_PARAM_NAME("AddAuditAccessAceEx", 4, "dwAccessMask"); // DWORD
-	ADD_PARAM_NAME("AddAuditAccessAceEx", 5, "pSid"); // PSID
-	ADD_PARAM_NAME("AddAuditAccessAceEx", 6, "bAuditSuccess"); // WINBOOL
-	ADD_PARAM_NAME("AddAuditAccessAceEx", 7, "bAuditFailure"); // WINBOOL
-	ADD_PARAM_NAME("AddAuditAccessObjectAce", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("AddAuditAccessObjectAce", 2, "dwAceRevision"); // DWORD
-	ADD_PARAM_NAME("AddAuditAccessObjectAce", 3, "AceFlags"); // DWORD
-	ADD_PARAM_NAME("AddAuditAccessObjectAce", 4, "AccessMask"); // DWORD
-	ADD_PARAM_NAME("AddAuditAccessObjectAce", 5, "ObjectTypeGuid"); // GUID *
-	ADD_PARAM_NAME("AddAuditAccessObjectAce", 6, "InheritedObjectTypeGuid"); // GUID *
-	ADD_PARAM_NAME("AddAuditAccessObjectAce", 7, "pSid"); // PSID
-	ADD_PARAM_NAME("AddAuditAccessObjectAce", 8, "bAuditSuccess"); // WINBOOL
-	ADD_PARAM_NAME("AddAuditAccessObjectAce", 9, "bAuditFailure"); // WINBOOL
-	ADD_PARAM_NAME("AddConditionalAce", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("AddConditionalAce", 2, "dwAceRevision"); // DWORD
-	ADD_PARAM_NAME("AddConditionalAce", 3, "AceFlags"); // DWORD
-	ADD_PARAM_NAME("AddConditionalAce", 4, "AceType"); // UCHAR
-	ADD_PARAM_NAME("AddConditionalAce", 5, "AccessMask"); // DWORD
-	ADD_PARAM_NAME("AddConditionalAce", 6, "pSid"); // PSID
-	ADD_PARAM_NAME("AddConditionalAce", 7, "ConditionStr"); // PWCHAR
-	ADD_PARAM_NAME("AddConditionalAce", 8, "ReturnLength"); // DWORD *
-	ADD_PARAM_NAME("AddConsoleAliasA", 1, "Source"); // LPSTR
-	ADD_PARAM_NAME("AddConsoleAliasA", 2, "Target"); // LPSTR
-	ADD_PARAM_NAME("AddConsoleAliasA", 3, "ExeName"); // LPSTR
-	ADD_PARAM_NAME("AddConsoleAliasW", 1, "Source"); // LPWSTR
-	ADD_PARAM_NAME("AddConsoleAliasW", 2, "Target"); // LPWSTR
-	ADD_PARAM_NAME("AddConsoleAliasW", 3, "ExeName"); // LPWSTR
-	ADD_PARAM_NAME("AddFontMemResourceEx", 1, "pFileView"); // PVOID
-	ADD_PARAM_NAME("AddFontMemResourceEx", 2, "cjSize"); // DWORD
-	ADD_PARAM_NAME("AddFontMemResourceEx", 3, "pvResrved"); // PVOID
-	ADD_PARAM_NAME("AddFontMemResourceEx", 4, "pNumFonts"); // DWORD *
-	ADD_PARAM_NAME("AddFontResourceA", 1, "lpszFilename"); // LPCSTR
-	ADD_PARAM_NAME("AddFontResourceExA", 1, "name"); // LPCSTR
-	ADD_PARAM_NAME("AddFontResourceExA", 2, "fl"); // DWORD
-	ADD_PARAM_NAME("AddFontResourceExA", 3, "res"); // PVOID
-	ADD_PARAM_NAME("AddFontResourceExW", 1, "name"); // LPCWSTR
-	ADD_PARAM_NAME("AddFontResourceExW", 2, "fl"); // DWORD
-	ADD_PARAM_NAME("AddFontResourceExW", 3, "res"); // PVOID
-	ADD_PARAM_NAME("AddFontResourceW", 1, "lpszFilename"); // LPCWSTR
-	ADD_PARAM_NAME("AddFormA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("AddFormA", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("AddFormA", 3, "pForm"); // LPBYTE
-	ADD_PARAM_NAME("AddFormW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("AddFormW", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("AddFormW", 3, "pForm"); // LPBYTE
-	ADD_PARAM_NAME("AddJobA", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("AddJobA", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("AddJobA", 3, "pData"); // LPBYTE
-	ADD_PARAM_NAME("AddJobA", 4, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("AddJobA", 5, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("AddJobW", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("AddJobW", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("AddJobW", 3, "pData"); // LPBYTE
-	ADD_PARAM_NAME("AddJobW", 4, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("AddJobW", 5, "pcbNeeded"); // LPDWORD
-	ADD_PARAM_NAME("AddLocalAlternateComputerNameA", 1, "lpDnsFQHostname"); // LPCSTR
-	ADD_PARAM_NAME("AddLocalAlternateComputerNameA", 2, "ulFlags"); // ULONG
-	ADD_PARAM_NAME("AddLocalAlternateComputerNameW", 1, "lpDnsFQHostname"); // LPCWSTR
-	ADD_PARAM_NAME("AddLocalAlternateComputerNameW", 2, "ulFlags"); // ULONG
-	ADD_PARAM_NAME("AddMandatoryAce", 1, "pAcl"); // PACL
-	ADD_PARAM_NAME("AddMandatoryAce", 2, "dwAceRevision"); // DWORD
-	ADD_PARAM_NAME("AddMandatoryAce", 3, "AceFlags"); // DWORD
-	ADD_PARAM_NAME("AddMandatoryAce", 4, "MandatoryPolicy"); // DWORD
-	ADD_PARAM_NAME("AddMandatoryAce", 5, "pLabelSid"); // PSID
-	ADD_PARAM_NAME("AddMonitorA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("AddMonitorA", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("AddMonitorA", 3, "pMonitorInfo"); // LPBYTE
-	ADD_PARAM_NAME("AddMonitorW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("AddMonitorW", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("AddMonitorW", 3, "pMonitorInfo"); // LPBYTE
-	ADD_PARAM_NAME("AddPortA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("AddPortA", 2, "hWnd"); // HWND
-	ADD_PARAM_NAME("AddPortA", 3, "pMonitorName"); // LPSTR
-	ADD_PARAM_NAME("AddPortW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("AddPortW", 2, "hWnd"); // HWND
-	ADD_PARAM_NAME("AddPortW", 3, "pMonitorName"); // LPWSTR
-	ADD_PARAM_NAME("AddPrintProcessorA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("AddPrintProcessorA", 2, "pEnvironment"); // LPSTR
-	ADD_PARAM_NAME("AddPrintProcessorA", 3, "pPathName"); // LPSTR
-	ADD_PARAM_NAME("AddPrintProcessorA", 4, "pPrintProcessorName"); // LPSTR
-	ADD_PARAM_NAME("AddPrintProcessorW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("AddPrintProcessorW", 2, "pEnvironment"); // LPWSTR
-	ADD_PARAM_NAME("AddPrintProcessorW", 3, "pPathName"); // LPWSTR
-	ADD_PARAM_NAME("AddPrintProcessorW", 4, "pPrintProcessorName"); // LPWSTR
-	ADD_PARAM_NAME("AddPrintProvidorA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("AddPrintProvidorA", 2, "level"); // DWORD
-	ADD_PARAM_NAME("AddPrintProvidorA", 3, "pProvidorInfo"); // LPBYTE
-	ADD_PARAM_NAME("AddPrintProvidorW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("AddPrintProvidorW", 2, "level"); // DWORD
-	ADD_PARAM_NAME("AddPrintProvidorW", 3, "pProvidorInfo"); // LPBYTE
-	ADD_PARAM_NAME("AddPrinterA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("AddPrinterA", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("AddPrinterA", 3, "pPrinter"); // LPBYTE
-	ADD_PARAM_NAME("AddPrinterConnectionA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("AddPrinterConnectionW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("AddPrinterDriverA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("AddPrinterDriverA", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("AddPrinterDriverA", 3, "pDriverInfo"); // LPBYTE
-	ADD_PARAM_NAME("AddPrinterDriverExA", 1, "pName"); // LPSTR
-	ADD_PARAM_NAME("AddPrinterDriverExA", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("AddPrinterDriverExA", 3, "pDriverInfo"); // LPBYTE
-	ADD_PARAM_NAME("AddPrinterDriverExA", 4, "dwFileCopyFlags"); // DWORD
-	ADD_PARAM_NAME("AddPrinterDriverExW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("AddPrinterDriverExW", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("AddPrinterDriverExW", 3, "pDriverInfo"); // LPBYTE
-	ADD_PARAM_NAME("AddPrinterDriverExW", 4, "dwFileCopyFlags"); // DWORD
-	ADD_PARAM_NAME("AddPrinterDriverW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("AddPrinterDriverW", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("AddPrinterDriverW", 3, "pDriverInfo"); // LPBYTE
-	ADD_PARAM_NAME("AddPrinterW", 1, "pName"); // LPWSTR
-	ADD_PARAM_NAME("AddPrinterW", 2, "Level"); // DWORD
-	ADD_PARAM_NAME("AddPrinterW", 3, "pPrinter"); // LPBYTE
-	ADD_PARAM_NAME("AddRefActCtx", 1, "hActCtx"); // HANDLE
-	ADD_PARAM_NAME("AddSIDToBoundaryDescriptor", 1, "BoundaryDescriptor"); // HANDLE *
-	ADD_PARAM_NAME("AddSIDToBoundaryDescriptor", 2, "RequiredSid"); // PSID
-	ADD_PARAM_NAME("AddSecureMemoryCacheCallback", 1, "pfnCallBack"); // PSECURE_MEMORY_CACHE_CALLBACK
-	ADD_PARAM_NAME("AddUsersToEncryptedFile", 1, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("AddUsersToEncryptedFile", 2, "pUsers"); // PENCRYPTION_CERTIFICATE_LIST
-	ADD_PARAM_NAME("AddVectoredContinueHandler", 1, "First"); // ULONG
-	ADD_PARAM_NAME("AddVectoredContinueHandler", 2, "Handler"); // PVECTORED_EXCEPTION_HANDLER
-	ADD_PARAM_NAME("AddVectoredExceptionHandler", 1, "First"); // ULONG
-	ADD_PARAM_NAME("AddVectoredExceptionHandler", 2, "Handler"); // PVECTORED_EXCEPTION_HANDLER
-	ADD_PARAM_NAME("AdjustTokenGroups", 1, "TokenHandle"); // HANDLE
-	ADD_PARAM_NAME("AdjustTokenGroups", 2, "ResetToDefault"); // WINBOOL
-	ADD_PARAM_NAME("AdjustTokenGroups", 3, "NewState"); // PTOKEN_GROUPS
-	ADD_PARAM_NAME("AdjustTokenGroups", 4, "BufferLength"); // DWORD
-	ADD_PARAM_NAME("AdjustTokenGroups", 5, "PreviousState"); // PTOKEN_GROUPS
-	ADD_PARAM_NAME("AdjustTokenGroups", 6, "ReturnLength"); // PDWORD
-	ADD_PARAM_NAME("AdjustTokenPrivileges", 1, "TokenHandle"); // HANDLE
-	ADD_PARAM_NAME("AdjustTokenPrivileges", 2, "DisableAllPrivileges"); // WINBOOL
-	ADD_PARAM_NAME("AdjustTokenPrivileges", 3, "NewState"); // PTOKEN_PRIVILEGES
-	ADD_PARAM_NAME("AdjustTokenPrivileges", 4, "BufferLength"); // DWORD
-	ADD_PARAM_NAME("AdjustTokenPrivileges", 5, "PreviousState"); // PTOKEN_PRIVILEGES
-	ADD_PARAM_NAME("AdjustTokenPrivileges", 6, "ReturnLength"); // PDWORD
-	ADD_PARAM_NAME("AdjustWindowRect", 1, "lpRect"); // LPRECT
-	ADD_PARAM_NAME("AdjustWindowRect", 2, "dwStyle"); // DWORD
-	ADD_PARAM_NAME("AdjustWindowRect", 3, "bMenu"); // WINBOOL
-	ADD_PARAM_NAME("AdjustWindowRectEx", 1, "lpRect"); // LPRECT
-	ADD_PARAM_NAME("AdjustWindowRectEx", 2, "dwStyle"); // DWORD
-	ADD_PARAM_NAME("AdjustWindowRectEx", 3, "bMenu"); // WINBOOL
-	ADD_PARAM_NAME("AdjustWindowRectEx", 4, "dwExStyle"); // DWORD
-	ADD_PARAM_NAME("AdvancedDocumentPropertiesA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("AdvancedDocumentPropertiesA", 2, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("AdvancedDocumentPropertiesA", 3, "pDeviceName"); // LPSTR
-	ADD_PARAM_NAME("AdvancedDocumentPropertiesA", 4, "pDevModeOutput"); // PDEVMODEA
-	ADD_PARAM_NAME("AdvancedDocumentPropertiesA", 5, "pDevModeInput"); // PDEVMODEA
-	ADD_PARAM_NAME("AdvancedDocumentPropertiesW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("AdvancedDocumentPropertiesW", 2, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("AdvancedDocumentPropertiesW", 3, "pDeviceName"); // LPWSTR
-	ADD_PARAM_NAME("AdvancedDocumentPropertiesW", 4, "pDevModeOutput"); // PDEVMODEW
-	ADD_PARAM_NAME("AdvancedDocumentPropertiesW", 5, "pDevModeInput"); // PDEVMODEW
-	ADD_PARAM_NAME("AllocateAndInitializeSid", 1, "pIdentifierAuthority"); // PSID_IDENTIFIER_AUTHORITY
-	ADD_PARAM_NAME("AllocateAndInitializeSid", 2, "nSubAuthorityCount"); // BYTE
-	ADD_PARAM_NAME("AllocateAndInitializeSid", 3, "nSubAuthority0"); // DWORD
-	ADD_PARAM_NAME("AllocateAndInitializeSid", 4, "nSubAuthority1"); // DWORD
-	ADD_PARAM_NAME("AllocateAndInitializeSid", 5, "nSubAuthority2"); // DWORD
-	ADD_PARAM_NAME("AllocateAndInitializeSid", 6, "nSubAuthority3"); // DWORD
-	ADD_PARAM_NAME("AllocateAndInitializeSid", 7, "nSubAuthority4"); // DWORD
-	ADD_PARAM_NAME("AllocateAndInitializeSid", 8, "nSubAuthority5"); // DWORD
-	ADD_PARAM_NAME("AllocateAndInitializeSid", 9, "nSubAuthority6"); // DWORD
-	ADD_PARAM_NAME("AllocateAndInitializeSid", 10, "nSubAuthority7"); // DWORD
-	ADD_PARAM_NAME("AllocateAndInitializeSid", 11, "pSid"); // PSID *
-	ADD_PARAM_NAME("AllocateLocallyUniqueId", 1, "Luid"); // PLUID
-	ADD_PARAM_NAME("AllocateUserPhysicalPages", 1, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("AllocateUserPhysicalPages", 2, "NumberOfPages"); // PULONG_PTR
-	ADD_PARAM_NAME("AllocateUserPhysicalPages", 3, "PageArray"); // PULONG_PTR
-	ADD_PARAM_NAME("AllocateUserPhysicalPagesNuma", 1, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("AllocateUserPhysicalPagesNuma", 2, "NumberOfPages"); // PULONG_PTR
-	ADD_PARAM_NAME("AllocateUserPhysicalPagesNuma", 3, "PageArray"); // PULONG_PTR
-	ADD_PARAM_NAME("AllocateUserPhysicalPagesNuma", 4, "nndPreferred"); // DWORD
-	ADD_PARAM_NAME("AllowSetForegroundWindow", 1, "dwProcessId"); // DWORD
-	ADD_PARAM_NAME("AlphaBlend", 1, "hdcDest"); // HDC
-	ADD_PARAM_NAME("AlphaBlend", 2, "xoriginDest"); // int
-	ADD_PARAM_NAME("AlphaBlend", 3, "yoriginDest"); // int
-	ADD_PARAM_NAME("AlphaBlend", 4, "wDest"); // int
-	ADD_PARAM_NAME("AlphaBlend", 5, "hDest"); // int
-	ADD_PARAM_NAME("AlphaBlend", 6, "hdcSrc"); // HDC
-	ADD_PARAM_NAME("AlphaBlend", 7, "xoriginSrc"); // int
-	ADD_PARAM_NAME("AlphaBlend", 8, "yoriginSrc"); // int
-	ADD_PARAM_NAME("AlphaBlend", 9, "wSrc"); // int
-	ADD_PARAM_NAME("AlphaBlend", 10, "hSrc"); // int
-	ADD_PARAM_NAME("AlphaBlend", 11, "ftn"); // BLENDFUNCTION
-	ADD_PARAM_NAME("AngleArc", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("AngleArc", 2, "x"); // int
-	ADD_PARAM_NAME("AngleArc", 3, "y"); // int
-	ADD_PARAM_NAME("AngleArc", 4, "r"); // DWORD
-	ADD_PARAM_NAME("AngleArc", 5, "StartAngle"); // FLOAT
-	ADD_PARAM_NAME("AngleArc", 6, "SweepAngle"); // FLOAT
-	ADD_PARAM_NAME("AnimatePalette", 1, "hPal"); // HPALETTE
-	ADD_PARAM_NAME("AnimatePalette", 2, "iStartIndex"); // UINT
-	ADD_PARAM_NAME("AnimatePalette", 3, "cEntries"); // UINT
-	ADD_PARAM_NAME("AnimatePalette", 4, "ppe"); // CONST PALETTEENTRY *
-	ADD_PARAM_NAME("AnimateWindow", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("AnimateWindow", 2, "dwTime"); // DWORD
-	ADD_PARAM_NAME("AnimateWindow", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("AppendMenuA", 1, "hMenu"); // HMENU
-	ADD_PARAM_NAME("AppendMenuA", 2, "uFlags"); // UINT
-	ADD_PARAM_NAME("AppendMenuA", 3, "uIDNewItem"); // UINT_PTR
-	ADD_PARAM_NAME("AppendMenuA", 4, "lpNewItem"); // LPCSTR
-	ADD_PARAM_NAME("AppendMenuW", 1, "hMenu"); // HMENU
-	ADD_PARAM_NAME("AppendMenuW", 2, "uFlags"); // UINT
-	ADD_PARAM_NAME("AppendMenuW", 3, "uIDNewItem"); // UINT_PTR
-	ADD_PARAM_NAME("AppendMenuW", 4, "lpNewItem"); // LPCWSTR
-	ADD_PARAM_NAME("AppendPrinterNotifyInfoData", 1, "pInfoDest"); // PPRINTER_NOTIFY_INFO
-	ADD_PARAM_NAME("AppendPrinterNotifyInfoData", 2, "pInfoDataSrc"); // PPRINTER_NOTIFY_INFO_DATA
-	ADD_PARAM_NAME("AppendPrinterNotifyInfoData", 3, "fdwFlags"); // DWORD
-	ADD_PARAM_NAME("ApplicationRecoveryFinished", 1, "bSuccess"); // WINBOOL
-	ADD_PARAM_NAME("ApplicationRecoveryInProgress", 1, "pbCanceled"); // PBOOL
-	ADD_PARAM_NAME("Arc", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("Arc", 2, "x1"); // int
-	ADD_PARAM_NAME("Arc", 3, "y1"); // int
-	ADD_PARAM_NAME("Arc", 4, "x2"); // int
-	ADD_PARAM_NAME("Arc", 5, "y2"); // int
-	ADD_PARAM_NAME("Arc", 6, "x3"); // int
-	ADD_PARAM_NAME("Arc", 7, "y3"); // int
-	ADD_PARAM_NAME("Arc", 8, "x4"); // int
-	ADD_PARAM_NAME("Arc", 9, "y4"); // int
-	ADD_PARAM_NAME("ArcTo", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("ArcTo", 2, "left"); // int
-	ADD_PARAM_NAME("ArcTo", 3, "top"); // int
-	ADD_PARAM_NAME("ArcTo", 4, "right"); // int
-	ADD_PARAM_NAME("ArcTo", 5, "bottom"); // int
-	ADD_PARAM_NAME("ArcTo", 6, "xr1"); // int
-	ADD_PARAM_NAME("ArcTo", 7, "yr1"); // int
-	ADD_PARAM_NAME("ArcTo", 8, "xr2"); // int
-	ADD_PARAM_NAME("ArcTo", 9, "yr2"); // int
-	ADD_PARAM_NAME("AreAllAccessesGranted", 1, "GrantedAccess"); // DWORD
-	ADD_PARAM_NAME("AreAllAccessesGranted", 2, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("AreAnyAccessesGranted", 1, "GrantedAccess"); // DWORD
-	ADD_PARAM_NAME("AreAnyAccessesGranted", 2, "DesiredAccess"); // DWORD
-	ADD_PARAM_NAME("ArrangeIconicWindows", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("AssignProcessToJobObject", 1, "hJob"); // HANDLE
-	ADD_PARAM_NAME("AssignProcessToJobObject", 2, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("AttachConsole", 1, "dwProcessId"); // DWORD
-	ADD_PARAM_NAME("AttachThreadInput", 1, "idAttach"); // DWORD
-	ADD_PARAM_NAME("AttachThreadInput", 2, "idAttachTo"); // DWORD
-	ADD_PARAM_NAME("AttachThreadInput", 3, "fAttach"); // WINBOOL
+/**
+* @brief Returns a table with info about functions starting with A or
+*        underscore.
+*/
+const FuncParamNamesTable &getFuncParamNamesTable_A() {
+	static constexpr auto entries = sortEntries(FUNC_PARAM_NAMES);
+	static constexpr FuncParamNamesTable table(entries);
+	return table;
 }
 
 } // namespace win_api
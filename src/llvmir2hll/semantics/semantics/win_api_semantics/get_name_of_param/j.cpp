@@ -12,12 +12,11 @@ namespace semantics {
 namespace win_api {
 
 /**
-* @brief Initializes the given map with info about functions starting with J.
+* @brief Returns a table with info about functions starting with J.
 */
-void initFuncParamNamesMap_J(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
+const FuncParamNamesTable &getFuncParamNamesTable_J() {
+	static constexpr FuncParamNamesTable table;
+	return table;
 }
 
 } // namespace win_api
@@ -11,20 +11,33 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
 /**
-* @brief Initializes the given map with info about functions starting with K.
+* @brief Names of parameters of functions starting with K.
 */
-void initFuncParamNamesMap_K(FuncParamNamesMap &funcParamNamesMap) {
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("KillTimer", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("KillTimer", 2, "uIDEvent"); // UINT_PTR
+	{"KillTimer", 1, "hWnd"}, // HWND
+	{"KillTimer", 2, "uIDEvent"}, // UINT_PTR
+
+	{"keybd_event", 1, "bVk"}, // BYTE
+	{"keybd_event", 2, "bScan"}, // BYTE
+	{"keybd_event", 3, "dwFlags"}, // DWORD
+	{"keybd_event", 4, "dwExtraInfo"}, // ULONG_PTR
+};
+
+} // anonymous namespace
 
-	ADD_PARAM_NAME("keybd_event", 1, "bVk"); // BYTE
-	ADD_PARAM_NAME("keybd_event", 2, "bScan"); // BYTE
-	ADD_PARAM_NAME("keybd_event", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("keybd_event", 4, "dwExtraInfo"); // ULONG_PTR
+/**
+* @brief Returns a table with info about functions starting with K.
+*/
+const FuncParamNamesTable &getFuncParamNamesTable_K() {
+	static constexpr auto entries = sortEntries(FUNC_PARAM_NAMES);
+	static constexpr FuncParamNamesTable table(entries);
+	return table;
 }
 
 } // namespace win_api
@@ -11,33 +11,46 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
 /**
-* @brief Initializes the given map with info about functions starting with N.
+* @brief Names of parameters of functions starting with N.
 */
-void initFuncParamNamesMap_N(FuncParamNamesMap &funcParamNamesMap) {
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("NeedCurrentDirectoryForExePathA", 1, "ExeName"); // LPCSTR
-	ADD_PARAM_NAME("NeedCurrentDirectoryForExePathW", 1, "ExeName"); // LPCWSTR
-	ADD_PARAM_NAME("NormalizeString", 1, "NormForm"); // NORM_FORM
-	ADD_PARAM_NAME("NormalizeString", 2, "lpSrcString"); // LPCWSTR
-	ADD_PARAM_NAME("NormalizeString", 3, "cwSrcLength"); // int
-	ADD_PARAM_NAME("NormalizeString", 4, "lpDstString"); // LPWSTR
-	ADD_PARAM_NAME("NormalizeString", 5, "cwDstLength"); // int
-	ADD_PARAM_NAME("NotifyBootConfigStatus", 1, "BootAcceptable"); // WINBOOL
-	ADD_PARAM_NAME("NotifyChangeEventLog", 1, "hEventLog"); // HANDLE
-	ADD_PARAM_NAME("NotifyChangeEventLog", 2, "hEvent"); // HANDLE
-	ADD_PARAM_NAME("NotifyServiceStatusChangeA", 1, "hService"); // SC_HANDLE
-	ADD_PARAM_NAME("NotifyServiceStatusChangeA", 2, "dwNotifyMask"); // DWORD
-	ADD_PARAM_NAME("NotifyServiceStatusChangeA", 3, "pNotifyBuffer"); // PSERVICE_NOTIFYA
-	ADD_PARAM_NAME("NotifyServiceStatusChangeW", 1, "hService"); // SC_HANDLE
-	ADD_PARAM_NAME("NotifyServiceStatusChangeW", 2, "dwNotifyMask"); // DWORD
-	ADD_PARAM_NAME("NotifyServiceStatusChangeW", 3, "pNotifyBuffer"); // PSERVICE_NOTIFYW
-	ADD_PARAM_NAME("NotifyWinEvent", 1, "event"); // DWORD
-	ADD_PARAM_NAME("NotifyWinEvent", 2, "hWnd"); // HWND
-	ADD_PARAM_NAME("NotifyWinEvent", 3, "idObject"); // LONG
-	ADD_PARAM_NAME("NotifyWinEvent", 4, "idChild"); // LONG
+	{"NeedCurrentDirectoryForExePathA", 1, "ExeName"}, // LPCSTR
+	{"NeedCurrentDirectoryForExePathW", 1, "ExeName"}, // LPCWSTR
+	{"NormalizeString", 1, "NormForm"}, // NORM_FORM
+	{"NormalizeString", 2, "lpSrcString"}, // LPCWSTR
+	{"NormalizeString", 3, "cwSrcLength"}, // int
+	{"NormalizeString", 4, "lpDstString"}, // LPWSTR
+	{"NormalizeString", 5, "cwDstLength"}, // int
+	{"NotifyBootConfigStatus", 1, "BootAcceptable"}, // WINBOOL
+	{"NotifyChangeEventLog", 1, "hEventLog"}, // HANDLE
+	{"NotifyChangeEventLog", 2, "hEvent"}, // HANDLE
+	{"NotifyServiceStatusChangeA", 1, "hService"}, // SC_HANDLE
+	{"NotifyServiceStatusChangeA", 2, "dwNotifyMask"}, // DWORD
+	{"NotifyServiceStatusChangeA", 3, "pNotifyBuffer"}, // PSERVICE_NOTIFYA
+	{"NotifyServiceStatusChangeW", 1, "hService"}, // SC_HANDLE
+	{"NotifyServiceStatusChangeW", 2, "dwNotifyMask"}, // DWORD
+	{"NotifyServiceStatusChangeW", 3, "pNotifyBuffer"}, // PSERVICE_NOTIFYW
+	{"NotifyWinEvent", 1, "event"}, // DWORD
+	{"NotifyWinEvent", 2, "hWnd"}, // HWND
+	{"NotifyWinEvent", 3, "idObject"}, // LONG
+	{"NotifyWinEvent", 4, "idChild"}, // LONG
+};
+
+} // anonymous namespace
+
+/**
+* @brief Returns a table with info about functions starting with N.
+*/
+const FuncParamNamesTable &getFuncParamNamesTable_N() {
+	static constexpr auto entries = sortEntries(FUNC_PARAM_NAMES);
+	static constexpr FuncParamNamesTable table(entries);
+	return table;
 }
 
 } // namespace win_api
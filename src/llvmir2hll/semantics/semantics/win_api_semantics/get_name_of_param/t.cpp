@@ -11,138 +11,151 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
 /**
-* @brief Initializes the given map with info about functions starting with T.
+* @brief Names of parameters of functions starting with T.
 */
-void initFuncParamNamesMap_T(FuncParamNamesMap &funcParamNamesMap) {
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("TabbedTextOutA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("TabbedTextOutA", 2, "x"); // int
-	ADD_PARAM_NAME("TabbedTextOutA", 3, "y"); // int
-	ADD_PARAM_NAME("TabbedTextOutA", 4, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("TabbedTextOutA", 5, "chCount"); // int
-	ADD_PARAM_NAME("TabbedTextOutA", 6, "nTabPositions"); // int
-	ADD_PARAM_NAME("TabbedTextOutA", 7, "lpnTabStopPositions"); // CONST INT *
-	ADD_PARAM_NAME("TabbedTextOutA", 8, "nTabOrigin"); // int
-	ADD_PARAM_NAME("TabbedTextOutW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("TabbedTextOutW", 2, "x"); // int
-	ADD_PARAM_NAME("TabbedTextOutW", 3, "y"); // int
-	ADD_PARAM_NAME("TabbedTextOutW", 4, "lpString"); // LPCWSTR
-	ADD_PARAM_NAME("TabbedTextOutW", 5, "chCount"); // int
-	ADD_PARAM_NAME("TabbedTextOutW", 6, "nTabPositions"); // int
-	ADD_PARAM_NAME("TabbedTextOutW", 7, "lpnTabStopPositions"); // CONST INT *
-	ADD_PARAM_NAME("TabbedTextOutW", 8, "nTabOrigin"); // int
-	ADD_PARAM_NAME("TerminateJobObject", 1, "hJob"); // HANDLE
-	ADD_PARAM_NAME("TerminateJobObject", 2, "uExitCode"); // UINT
-	ADD_PARAM_NAME("TerminateProcess", 1, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("TerminateProcess", 2, "uExitCode"); // UINT
-	ADD_PARAM_NAME("TerminateThread", 1, "hThread"); // HANDLE
-	ADD_PARAM_NAME("TerminateThread", 2, "dwExitCode"); // DWORD
-	ADD_PARAM_NAME("TextOutA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("TextOutA", 2, "x"); // int
-	ADD_PARAM_NAME("TextOutA", 3, "y"); // int
-	ADD_PARAM_NAME("TextOutA", 4, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("TextOutA", 5, "c"); // int
-	ADD_PARAM_NAME("TextOutW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("TextOutW", 2, "x"); // int
-	ADD_PARAM_NAME("TextOutW", 3, "y"); // int
-	ADD_PARAM_NAME("TextOutW", 4, "lpString"); // LPCWSTR
-	ADD_PARAM_NAME("TextOutW", 5, "c"); // int
-	ADD_PARAM_NAME("TileWindows", 1, "hwndParent"); // HWND
-	ADD_PARAM_NAME("TileWindows", 2, "wHow"); // UINT
-	ADD_PARAM_NAME("TileWindows", 3, "lpRect"); // CONST RECT *
-	ADD_PARAM_NAME("TileWindows", 4, "cKids"); // UINT
-	ADD_PARAM_NAME("TileWindows", 5, "lpKids"); // const HWND *
-	ADD_PARAM_NAME("TlsFree", 1, "dwTlsIndex"); // DWORD
-	ADD_PARAM_NAME("TlsGetValue", 1, "dwTlsIndex"); // DWORD
-	ADD_PARAM_NAME("TlsSetValue", 1, "dwTlsIndex"); // DWORD
-	ADD_PARAM_NAME("TlsSetValue", 2, "lpTlsValue"); // LPVOID
-	ADD_PARAM_NAME("ToAscii", 1, "uVirtKey"); // UINT
-	ADD_PARAM_NAME("ToAscii", 2, "uScanCode"); // UINT
-	ADD_PARAM_NAME("ToAscii", 3, "lpKeyState"); // CONST BYTE *
-	ADD_PARAM_NAME("ToAscii", 4, "lpChar"); // LPWORD
-	ADD_PARAM_NAME("ToAscii", 5, "uFlags"); // UINT
-	ADD_PARAM_NAME("ToAsciiEx", 1, "uVirtKey"); // UINT
-	ADD_PARAM_NAME("ToAsciiEx", 2, "uScanCode"); // UINT
-	ADD_PARAM_NAME("ToAsciiEx", 3, "lpKeyState"); // CONST BYTE *
-	ADD_PARAM_NAME("ToAsciiEx", 4, "lpChar"); // LPWORD
-	ADD_PARAM_NAME("ToAsciiEx", 5, "uFlags"); // UINT
-	ADD_PARAM_NAME("ToAsciiEx", 6, "dwhkl"); // HKL
-	ADD_PARAM_NAME("ToUnicode", 1, "wVirtKey"); // UINT
-	ADD_PARAM_NAME("ToUnicode", 2, "wScanCode"); // UINT
-	ADD_PARAM_NAME("ToUnicode", 3, "lpKeyState"); // CONST BYTE *
-	ADD_PARAM_NAME("ToUnicode", 4, "pwszBuff"); // LPWSTR
-	ADD_PARAM_NAME("ToUnicode", 5, "cchBuff"); // int
-	ADD_PARAM_NAME("ToUnicode", 6, "wFlags"); // UINT
-	ADD_PARAM_NAME("ToUnicodeEx", 1, "wVirtKey"); // UINT
-	ADD_PARAM_NAME("ToUnicodeEx", 2, "wScanCode"); // UINT
-	ADD_PARAM_NAME("ToUnicodeEx", 3, "lpKeyState"); // CONST BYTE *
-	ADD_PARAM_NAME("ToUnicodeEx", 4, "pwszBuff"); // LPWSTR
-	ADD_PARAM_NAME("ToUnicodeEx", 5, "cchBuff"); // int
-	ADD_PARAM_NAME("ToUnicodeEx", 6, "wFlags"); // UINT
-	ADD_PARAM_NAME("ToUnicodeEx", 7, "dwhkl"); // HKL
-	ADD_PARAM_NAME("TrackMouseEvent", 1, "lpEventTrack"); // LPTRACKMOUSEEVENT
-	ADD_PARAM_NAME("TrackPopupMenu", 1, "hMenu"); // HMENU
-	ADD_PARAM_NAME("TrackPopupMenu", 2, "uFlags"); // UINT
-	ADD_PARAM_NAME("TrackPopupMenu", 3, "x"); // int
-	ADD_PARAM_NAME("TrackPopupMenu", 4, "y"); // int
-	ADD_PARAM_NAME("TrackPopupMenu", 5, "nReserved"); // int
-	ADD_PARAM_NAME("TrackPopupMenu", 6, "hWnd"); // HWND
-	ADD_PARAM_NAME("TrackPopupMenu", 7, "prcRect"); // CONST RECT *
-	ADD_PARAM_NAME("TrackPopupMenuEx", 1, "hmenu"); // HMENU
-	ADD_PARAM_NAME("TrackPopupMenuEx", 2, "fuFlags"); // UINT
-	ADD_PARAM_NAME("TrackPopupMenuEx", 3, "x"); // int
-	ADD_PARAM_NAME("TrackPopupMenuEx", 4, "y"); // int
-	ADD_PARAM_NAME("TrackPopupMenuEx", 5, "hWnd"); // HWND
-	ADD_PARAM_NAME("TrackPopupMenuEx", 6, "lptpm"); // LPTPMPARAMS
-	ADD_PARAM_NAME("TransactNamedPipe", 1, "hNamedPipe"); // HANDLE
-	ADD_PARAM_NAME("TransactNamedPipe", 2, "lpInBuffer"); // LPVOID
-	ADD_PARAM_NAME("TransactNamedPipe", 3, "nInBufferSize"); // DWORD
-	ADD_PARAM_NAME("TransactNamedPipe", 4, "lpOutBuffer"); // LPVOID
-	ADD_PARAM_NAME("TransactNamedPipe", 5, "nOutBufferSize"); // DWORD
-	ADD_PARAM_NAME("TransactNamedPipe", 6, "lpBytesRead"); // LPDWORD
-	ADD_PARAM_NAME("TransactNamedPipe", 7, "lpOverlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("TranslateAcceleratorA", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("TranslateAcceleratorA", 2, "hAccTable"); // HACCEL
-	ADD_PARAM_NAME("TranslateAcceleratorA", 3, "lpMsg"); // LPMSG
-	ADD_PARAM_NAME("TranslateAcceleratorW", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("TranslateAcceleratorW", 2, "hAccTable"); // HACCEL
-	ADD_PARAM_NAME("TranslateAcceleratorW", 3, "lpMsg"); // LPMSG
-	ADD_PARAM_NAME("TranslateCharsetInfo", 1, "lpSrc"); // DWORD *
-	ADD_PARAM_NAME("TranslateCharsetInfo", 2, "lpCs"); // LPCHARSETINFO
-	ADD_PARAM_NAME("TranslateCharsetInfo", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("TranslateMDISysAccel", 1, "hWndClient"); // HWND
-	ADD_PARAM_NAME("TranslateMDISysAccel", 2, "lpMsg"); // LPMSG
-	ADD_PARAM_NAME("TranslateMessage", 1, "lpMsg"); // CONST MSG *
-	ADD_PARAM_NAME("TransmitCommChar", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("TransmitCommChar", 2, "cChar"); // char
-	ADD_PARAM_NAME("TransmitFile", 1, "hSocket"); // SOCKET
-	ADD_PARAM_NAME("TransmitFile", 2, "hFile"); // HANDLE
-	ADD_PARAM_NAME("TransmitFile", 3, "nNumberOfBytesToWrite"); // DWORD
-	ADD_PARAM_NAME("TransmitFile", 4, "nNumberOfBytesPerSend"); // DWORD
-	ADD_PARAM_NAME("TransmitFile", 5, "lpOverlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("TransmitFile", 6, "lpTransmitBuffers"); // LPTRANSMIT_FILE_BUFFERS
-	ADD_PARAM_NAME("TransmitFile", 7, "dwReserved"); // DWORD
-	ADD_PARAM_NAME("TransparentBlt", 1, "hdcDest"); // HDC
-	ADD_PARAM_NAME("TransparentBlt", 2, "xoriginDest"); // int
-	ADD_PARAM_NAME("TransparentBlt", 3, "yoriginDest"); // int
-	ADD_PARAM_NAME("TransparentBlt", 4, "wDest"); // int
-	ADD_PARAM_NAME("TransparentBlt", 5, "hDest"); // int
-	ADD_PARAM_NAME("TransparentBlt", 6, "hdcSrc"); // HDC
-	ADD_PARAM_NAME("TransparentBlt", 7, "xoriginSrc"); // int
-	ADD_PARAM_NAME("TransparentBlt", 8, "yoriginSrc"); // int
-	ADD_PARAM_NAME("TransparentBlt", 9, "wSrc"); // int
-	ADD_PARAM_NAME("TransparentBlt", 10, "hSrc"); // int
-	ADD_PARAM_NAME("TransparentBlt", 11, "crTransparent"); // UINT
-	ADD_PARAM_NAME("TryEnterCriticalSection", 1, "lpCriticalSection"); // LPCRITICAL_SECTION
-	ADD_PARAM_NAME("TrySubmitThreadpoolCallback", 1, "pfns"); // PTP_SIMPLE_CALLBACK
-	ADD_PARAM_NAME("TrySubmitThreadpoolCallback", 2, "pv"); // PVOID
-	ADD_PARAM_NAME("TrySubmitThreadpoolCallback", 3, "pcbe"); // PTP_CALLBACK_ENVIRON
-	ADD_PARAM_NAME("TzSpecificLocalTimeToSystemTime", 1, "lpTimeZoneInformation"); // LPTIME_ZONE_INFORMATION
-	ADD_PARAM_NAME("TzSpecificLocalTimeToSystemTime", 2, "lpLocalTime"); // LPSYSTEMTIME
-	ADD_PARAM_NAME("TzSpecificLocalTimeToSystemTime", 3, "lpUniversalTime"); // LPSYSTEMTIME
+	{"TabbedTextOutA", 1, "hdc"}, // HDC
+	{"TabbedTextOutA", 2, "x"}, // int
+	{"TabbedTextOutA", 3, "y"}, // int
+	{"TabbedTextOutA", 4, "lpString"}, // LPCSTR
+	{"TabbedTextOutA", 5, "chCount"}, // int
+	{"TabbedTextOutA", 6, "nTabPositions"}, // int
+	{"TabbedTextOutA", 7, "lpnTabStopPositions"}, // CONST INT *
+	{"TabbedTextOutA", 8, "nTabOrigin"}, // int
+	{"TabbedTextOutW", 1, "hdc"}, // HDC
+	{"TabbedTextOutW", 2, "x"}, // int
+	{"TabbedTextOutW", 3, "y"}, // int
+	{"TabbedTextOutW", 4, "lpString"}, // LPCWSTR
+	{"TabbedTextOutW", 5, "chCount"}, // int
+	{"TabbedTextOutW", 6, "nTabPositions"}, // int
+	{"TabbedTextOutW", 7, "lpnTabStopPositions"}, // CONST INT *
+	{"TabbedTextOutW", 8, "nTabOrigin"}, // int
+	{"TerminateJobObject", 1, "hJob"}, // HANDLE
+	{"TerminateJobObject", 2, "uExitCode"}, // UINT
+	{"TerminateProcess", 1, "hProcess"}, // HANDLE
+	{"TerminateProcess", 2, "uExitCode"}, // UINT
+	{"TerminateThread", 1, "hThread"}, // HANDLE
+	{"TerminateThread", 2, "dwExitCode"}, // DWORD
+	{"TextOutA", 1, "hdc"}, // HDC
+	{"TextOutA", 2, "x"}, // int
+	{"TextOutA", 3, "y"}, // int
+	{"TextOutA", 4, "lpString"}, // LPCSTR
+	{"TextOutA", 5, "c"}, // int
+	{"TextOutW", 1, "hdc"}, // HDC
+	{"TextOutW", 2, "x"}, // int
+	{"TextOutW", 3, "y"}, // int
+	{"TextOutW", 4, "lpString"}, // LPCWSTR
+	{"TextOutW", 5, "c"}, // int
+	{"TileWindows", 1, "hwndParent"}, // HWND
+	{"TileWindows", 2, "wHow"}, // UINT
+	{"TileWindows", 3, "lpRect"}, // CONST RECT *
+	{"TileWindows", 4, "cKids"}, // UINT
+	{"TileWindows", 5, "lpKids"}, // const HWND *
+	{"TlsFree", 1, "dwTlsIndex"}, // DWORD
+	{"TlsGetValue", 1, "dwTlsIndex"}, // DWORD
+	{"TlsSetValue", 1, "dwTlsIndex"}, // DWORD
+	{"TlsSetValue", 2, "lpTlsValue"}, // LPVOID
+	{"ToAscii", 1, "uVirtKey"}, // UINT
+	{"ToAscii", 2, "uScanCode"}, // UINT
+	{"ToAscii", 3, "lpKeyState"}, // CONST BYTE *
+	{"ToAscii", 4, "lpChar"}, // LPWORD
+	{"ToAscii", 5, "uFlags"}, // UINT
+	{"ToAsciiEx", 1, "uVirtKey"}, // UINT
+	{"ToAsciiEx", 2, "uScanCode"}, // UINT
+	{"ToAsciiEx", 3, "lpKeyState"}, // CONST BYTE *
+	{"ToAsciiEx", 4, "lpChar"}, // LPWORD
+	{"ToAsciiEx", 5, "uFlags"}, // UINT
+	{"ToAsciiEx", 6, "dwhkl"}, // HKL
+	{"ToUnicode", 1, "wVirtKey"}, // UINT
+	{"ToUnicode", 2, "wScanCode"}, // UINT
+	{"ToUnicode", 3, "lpKeyState"}, // CONST BYTE *
+	{"ToUnicode", 4, "pwszBuff"}, // LPWSTR
+	{"ToUnicode", 5, "cchBuff"}, // int
+	{"ToUnicode", 6, "wFlags"}, // UINT
+	{"ToUnicodeEx", 1, "wVirtKey"}, // UINT
+	{"ToUnicodeEx", 2, "wScanCode"}, // UINT
+	{"ToUnicodeEx", 3, "lpKeyState"}, // CONST BYTE *
+	{"ToUnicodeEx", 4, "pwszBuff"}, // LPWSTR
+	{"ToUnicodeEx", 5, "cchBuff"}, // int
+	{"ToUnicodeEx", 6, "wFlags"}, // UINT
+	{"ToUnicodeEx", 7, "dwhkl"}, // HKL
+	{"TrackMouseEvent", 1, "lpEventTrack"}, // LPTRACKMOUSEEVENT
+	{"TrackPopupMenu", 1, "hMenu"}, // HMENU
+	{"TrackPopupMenu", 2, "uFlags"}, // UINT
+	{"TrackPopupMenu", 3, "x"}, // int
+	{"TrackPopupMenu", 4, "y"}, // int
+	{"TrackPopupMenu", 5, "nReserved"}, // int
+	{"TrackPopupMenu", 6, "hWnd"}, // HWND
+	{"TrackPopupMenu", 7, "prcRect"}, // CONST RECT *
+	{"TrackPopupMenuEx", 1, "hmenu"}, // HMENU
+	{"TrackPopupMenuEx", 2, "fuFlags"}, // UINT
+	{"TrackPopupMenuEx", 3, "x"}, // int
+	{"TrackPopupMenuEx", 4, "y"}, // int
+	{"TrackPopupMenuEx", 5, "hWnd"}, // HWND
+	{"TrackPopupMenuEx", 6, "lptpm"}, // LPTPMPARAMS
+	{"TransactNamedPipe", 1, "hNamedPipe"}, // HANDLE
+	{"TransactNamedPipe", 2, "lpInBuffer"}, // LPVOID
+	{"TransactNamedPipe", 3, "nInBufferSize"}, // DWORD
+	{"TransactNamedPipe", 4, "lpOutBuffer"}, // LPVOID
+	{"TransactNamedPipe", 5, "nOutBufferSize"}, // DWORD
+	{"TransactNamedPipe", 6, "lpBytesRead"}, // LPDWORD
+	{"TransactNamedPipe", 7, "lpOverlapped"}, // LPOVERLAPPED
+	{"TranslateAcceleratorA", 1, "hWnd"}, // HWND
+	{"TranslateAcceleratorA", 2, "hAccTable"}, // HACCEL
+	{"TranslateAcceleratorA", 3, "lpMsg"}, // LPMSG
+	{"TranslateAcceleratorW", 1, "hWnd"}, // HWND
+	{"TranslateAcceleratorW", 2, "hAccTable"}, // HACCEL
+	{"TranslateAcceleratorW", 3, "lpMsg"}, // LPMSG
+	{"TranslateCharsetInfo", 1, "lpSrc"}, // DWORD *
+	{"TranslateCharsetInfo", 2, "lpCs"}, // LPCHARSETINFO
+	{"TranslateCharsetInfo", 3, "dwFlags"}, // DWORD
+	{"TranslateMDISysAccel", 1, "hWndClient"}, // HWND
+	{"TranslateMDISysAccel", 2, "lpMsg"}, // LPMSG
+	{"TranslateMessage", 1, "lpMsg"}, // CONST MSG *
+	{"TransmitCommChar", 1, "hFile"}, // HANDLE
+	{"TransmitCommChar", 2, "cChar"}, // char
+	{"TransmitFile", 1, "hSocket"}, // SOCKET
+	{"TransmitFile", 2, "hFile"}, // HANDLE
+	{"TransmitFile", 3, "nNumberOfBytesToWrite"}, // DWORD
+	{"TransmitFile", 4, "nNumberOfBytesPerSend"}, // DWORD
+	{"TransmitFile", 5, "lpOverlapped"}, // LPOVERLAPPED
+	{"TransmitFile", 6, "lpTransmitBuffers"}, // LPTRANSMIT_FILE_BUFFERS
+	{"TransmitFile", 7, "dwReserved"}, // DWORD
+	{"TransparentBlt", 1, "hdcDest"}, // HDC
+	{"TransparentBlt", 2, "xoriginDest"}, // int
+	{"TransparentBlt", 3, "yoriginDest"}, // int
+	{"TransparentBlt", 4, "wDest"}, // int
+	{"TransparentBlt", 5, "hDest"}, // int
+	{"TransparentBlt", 6, "hdcSrc"}, // HDC
+	{"TransparentBlt", 7, "xoriginSrc"}, // int
+	{"TransparentBlt", 8, "yoriginSrc"}, // int
+	{"TransparentBlt", 9, "wSrc"}, // int
+	{"TransparentBlt", 10, "hSrc"}, // int
+	{"TransparentBlt", 11, "crTransparent"}, // UINT
+	{"TryEnterCriticalSection", 1, "lpCriticalSection"}, // LPCRITICAL_SECTION
+	{"TrySubmitThreadpoolCallback", 1, "pfns"}, // PTP_SIMPLE_CALLBACK
+	{"TrySubmitThreadpoolCallback", 2, "pv"}, // PVOID
+	{"TrySubmitThreadpoolCallback", 3, "pcbe"}, // PTP_CALLBACK_ENVIRON
+	{"TzSpecificLocalTimeToSystemTime", 1, "lpTimeZoneInformation"}, // LPTIME_ZONE_INFORMATION
+	{"TzSpecificLocalTimeToSystemTime", 2, "lpLocalTime"}, // LPSYSTEMTIME
+	{"TzSpecificLocalTimeToSystemTime", 3, "lpUniversalTime"}, // LPSYSTEMTIME
+};
+
+} // anonymous namespace
+
+/**
+* @brief Returns a table with info about functions starting with T.
+*/
+const FuncParamNamesTable &getFuncParamNamesTable_T() {
+	static constexpr auto entries = sortEntries(FUNC_PARAM_NAMES);
+	static constexpr FuncParamNamesTable table(entries);
+	return table;
 }
 
 } // namespace win_api
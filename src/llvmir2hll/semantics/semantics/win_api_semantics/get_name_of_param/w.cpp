@@ -11,663 +11,676 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
 /**
-* @brief Initializes the given map with info about functions starting with W.
+* @brief Names of parameters of functions starting with W.
 */
-void initFuncParamNamesMap_W(FuncParamNamesMap &funcParamNamesMap) {
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("WICConvertBitmapSource", 1, "dstFormat"); // REFWICPixelFormatGUID
-	ADD_PARAM_NAME("WICConvertBitmapSource", 2, "pISrc"); // IWICBitmapSource *
-	ADD_PARAM_NAME("WICConvertBitmapSource", 3, "ppIDst"); // IWICBitmapSource * *
-	ADD_PARAM_NAME("WINNLSEnableIME", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("WINNLSEnableIME", 2, "bFlag"); // WINBOOL
-	ADD_PARAM_NAME("WINNLSGetEnableStatus", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("WINNLSGetIMEHotkey", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("WNetAddConnection2A", 1, "lpNetResource"); // LPNETRESOURCEA
-	ADD_PARAM_NAME("WNetAddConnection2A", 2, "lpPassword"); // LPCSTR
-	ADD_PARAM_NAME("WNetAddConnection2A", 3, "lpUserName"); // LPCSTR
-	ADD_PARAM_NAME("WNetAddConnection2A", 4, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("WNetAddConnection2W", 1, "lpNetResource"); // LPNETRESOURCEW
-	ADD_PARAM_NAME("WNetAddConnection2W", 2, "lpPassword"); // LPCWSTR
-	ADD_PARAM_NAME("WNetAddConnection2W", 3, "lpUserName"); // LPCWSTR
-	ADD_PARAM_NAME("WNetAddConnection2W", 4, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("WNetAddConnection3A", 1, "hwndOwner"); // HWND
-	ADD_PARAM_NAME("WNetAddConnection3A", 2, "lpNetResource"); // LPNETRESOURCEA
-	ADD_PARAM_NAME("WNetAddConnection3A", 3, "lpPassword"); // LPCSTR
-	ADD_PARAM_NAME("WNetAddConnection3A", 4, "lpUserName"); // LPCSTR
-	ADD_PARAM_NAME("WNetAddConnection3A", 5, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("WNetAddConnection3W", 1, "hwndOwner"); // HWND
-	ADD_PARAM_NAME("WNetAddConnection3W", 2, "lpNetResource"); // LPNETRESOURCEW
-	ADD_PARAM_NAME("WNetAddConnection3W", 3, "lpPassword"); // LPCWSTR
-	ADD_PARAM_NAME("WNetAddConnection3W", 4, "lpUserName"); // LPCWSTR
-	ADD_PARAM_NAME("WNetAddConnection3W", 5, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("WNetAddConnectionA", 1, "lpRemoteName"); // LPCSTR
-	ADD_PARAM_NAME("WNetAddConnectionA", 2, "lpPassword"); // LPCSTR
-	ADD_PARAM_NAME("WNetAddConnectionA", 3, "lpLocalName"); // LPCSTR
-	ADD_PARAM_NAME("WNetAddConnectionW", 1, "lpRemoteName"); // LPCWSTR
-	ADD_PARAM_NAME("WNetAddConnectionW", 2, "lpPassword"); // LPCWSTR
-	ADD_PARAM_NAME("WNetAddConnectionW", 3, "lpLocalName"); // LPCWSTR
-	ADD_PARAM_NAME("WNetCancelConnection2A", 1, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("WNetCancelConnection2A", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("WNetCancelConnection2A", 3, "fForce"); // WINBOOL
-	ADD_PARAM_NAME("WNetCancelConnection2W", 1, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("WNetCancelConnection2W", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("WNetCancelConnection2W", 3, "fForce"); // WINBOOL
-	ADD_PARAM_NAME("WNetCancelConnectionA", 1, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("WNetCancelConnectionA", 2, "fForce"); // WINBOOL
-	ADD_PARAM_NAME("WNetCancelConnectionW", 1, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("WNetCancelConnectionW", 2, "fForce"); // WINBOOL
-	ADD_PARAM_NAME("WNetCloseEnum", 1, "hEnum"); // HANDLE
-	ADD_PARAM_NAME("WNetConnectionDialog", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("WNetConnectionDialog", 2, "dwType"); // DWORD
-	ADD_PARAM_NAME("WNetConnectionDialog1A", 1, "lpConnDlgStruct"); // LPCONNECTDLGSTRUCTA
-	ADD_PARAM_NAME("WNetConnectionDialog1W", 1, "lpConnDlgStruct"); // LPCONNECTDLGSTRUCTW
-	ADD_PARAM_NAME("WNetDisconnectDialog", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("WNetDisconnectDialog", 2, "dwType"); // DWORD
-	ADD_PARAM_NAME("WNetDisconnectDialog1A", 1, "lpConnDlgStruct"); // LPDISCDLGSTRUCTA
-	ADD_PARAM_NAME("WNetDisconnectDialog1W", 1, "lpConnDlgStruct"); // LPDISCDLGSTRUCTW
-	ADD_PARAM_NAME("WNetEnumResourceA", 1, "hEnum"); // HANDLE
-	ADD_PARAM_NAME("WNetEnumResourceA", 2, "lpcCount"); // LPDWORD
-	ADD_PARAM_NAME("WNetEnumResourceA", 3, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("WNetEnumResourceA", 4, "lpBufferSize"); // LPDWORD
-	ADD_PARAM_NAME("WNetEnumResourceW", 1, "hEnum"); // HANDLE
-	ADD_PARAM_NAME("WNetEnumResourceW", 2, "lpcCount"); // LPDWORD
-	ADD_PARAM_NAME("WNetEnumResourceW", 3, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("WNetEnumResourceW", 4, "lpBufferSize"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetConnectionA", 1, "lpLocalName"); // LPCSTR
-	ADD_PARAM_NAME("WNetGetConnectionA", 2, "lpRemoteName"); // LPSTR
-	ADD_PARAM_NAME("WNetGetConnectionA", 3, "lpnLength"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetConnectionW", 1, "lpLocalName"); // LPCWSTR
-	ADD_PARAM_NAME("WNetGetConnectionW", 2, "lpRemoteName"); // LPWSTR
-	ADD_PARAM_NAME("WNetGetConnectionW", 3, "lpnLength"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetLastErrorA", 1, "lpError"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetLastErrorA", 2, "lpErrorBuf"); // LPSTR
-	ADD_PARAM_NAME("WNetGetLastErrorA", 3, "nErrorBufSize"); // DWORD
-	ADD_PARAM_NAME("WNetGetLastErrorA", 4, "lpNameBuf"); // LPSTR
-	ADD_PARAM_NAME("WNetGetLastErrorA", 5, "nNameBufSize"); // DWORD
-	ADD_PARAM_NAME("WNetGetLastErrorW", 1, "lpError"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetLastErrorW", 2, "lpErrorBuf"); // LPWSTR
-	ADD_PARAM_NAME("WNetGetLastErrorW", 3, "nErrorBufSize"); // DWORD
-	ADD_PARAM_NAME("WNetGetLastErrorW", 4, "lpNameBuf"); // LPWSTR
-	ADD_PARAM_NAME("WNetGetLastErrorW", 5, "nNameBufSize"); // DWORD
-	ADD_PARAM_NAME("WNetGetNetworkInformationA", 1, "lpProvider"); // LPCSTR
-	ADD_PARAM_NAME("WNetGetNetworkInformationA", 2, "lpNetInfoStruct"); // LPNETINFOSTRUCT
-	ADD_PARAM_NAME("WNetGetNetworkInformationW", 1, "lpProvider"); // LPCWSTR
-	ADD_PARAM_NAME("WNetGetNetworkInformationW", 2, "lpNetInfoStruct"); // LPNETINFOSTRUCT
-	ADD_PARAM_NAME("WNetGetProviderNameA", 1, "dwNetType"); // DWORD
-	ADD_PARAM_NAME("WNetGetProviderNameA", 2, "lpProviderName"); // LPSTR
-	ADD_PARAM_NAME("WNetGetProviderNameA", 3, "lpBufferSize"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetProviderNameW", 1, "dwNetType"); // DWORD
-	ADD_PARAM_NAME("WNetGetProviderNameW", 2, "lpProviderName"); // LPWSTR
-	ADD_PARAM_NAME("WNetGetProviderNameW", 3, "lpBufferSize"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetResourceInformationA", 1, "lpNetResource"); // LPNETRESOURCEA
-	ADD_PARAM_NAME("WNetGetResourceInformationA", 2, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("WNetGetResourceInformationA", 3, "lpcbBuffer"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetResourceInformationA", 4, "lplpSystem"); // LPSTR *
-	ADD_PARAM_NAME("WNetGetResourceInformationW", 1, "lpNetResource"); // LPNETRESOURCEW
-	ADD_PARAM_NAME("WNetGetResourceInformationW", 2, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("WNetGetResourceInformationW", 3, "lpcbBuffer"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetResourceInformationW", 4, "lplpSystem"); // LPWSTR *
-	ADD_PARAM_NAME("WNetGetResourceParentA", 1, "lpNetResource"); // LPNETRESOURCEA
-	ADD_PARAM_NAME("WNetGetResourceParentA", 2, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("WNetGetResourceParentA", 3, "lpcbBuffer"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetResourceParentW", 1, "lpNetResource"); // LPNETRESOURCEW
-	ADD_PARAM_NAME("WNetGetResourceParentW", 2, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("WNetGetResourceParentW", 3, "lpcbBuffer"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetUniversalNameA", 1, "lpLocalPath"); // LPCSTR
-	ADD_PARAM_NAME("WNetGetUniversalNameA", 2, "dwInfoLevel"); // DWORD
-	ADD_PARAM_NAME("WNetGetUniversalNameA", 3, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("WNetGetUniversalNameA", 4, "lpBufferSize"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetUniversalNameW", 1, "lpLocalPath"); // LPCWSTR
-	ADD_PARAM_NAME("WNetGetUniversalNameW", 2, "dwInfoLevel"); // DWORD
-	ADD_PARAM_NAME("WNetGetUniversalNameW", 3, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("WNetGetUniversalNameW", 4, "lpBufferSize"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetUserA", 1, "lpName"); // LPCSTR
-	ADD_PARAM_NAME("WNetGetUserA", 2, "lpUserName"); // LPSTR
-	ADD_PARAM_NAME("WNetGetUserA", 3, "lpnLength"); // LPDWORD
-	ADD_PARAM_NAME("WNetGetUserW", 1, "lpName"); // LPCWSTR
-	ADD_PARAM_NAME("WNetGetUserW", 2, "lpUserName"); // LPWSTR
-	ADD_PARAM_NAME("WNetGetUserW", 3, "lpnLength"); // LPDWORD
-	ADD_PARAM_NAME("WNetOpenEnumA", 1, "dwScope"); // DWORD
-	ADD_PARAM_NAME("WNetOpenEnumA", 2, "dwType"); // DWORD
-	ADD_PARAM_NAME("WNetOpenEnumA", 3, "dwUsage"); // DWORD
-	ADD_PARAM_NAME("WNetOpenEnumA", 4, "lpNetResource"); // LPNETRESOURCEA
-	ADD_PARAM_NAME("WNetOpenEnumA", 5, "lphEnum"); // LPHANDLE
-	ADD_PARAM_NAME("WNetOpenEnumW", 1, "dwScope"); // DWORD
-	ADD_PARAM_NAME("WNetOpenEnumW", 2, "dwType"); // DWORD
-	ADD_PARAM_NAME("WNetOpenEnumW", 3, "dwUsage"); // DWORD
-	ADD_PARAM_NAME("WNetOpenEnumW", 4, "lpNetResource"); // LPNETRESOURCEW
-	ADD_PARAM_NAME("WNetOpenEnumW", 5, "lphEnum"); // LPHANDLE
-	ADD_PARAM_NAME("WNetRestoreConnectionA", 1, "hwndParent"); // HWND
-	ADD_PARAM_NAME("WNetRestoreConnectionA", 2, "lpDevice"); // LPCSTR
-	ADD_PARAM_NAME("WNetRestoreConnectionW", 1, "hwndParent"); // HWND
-	ADD_PARAM_NAME("WNetRestoreConnectionW", 2, "lpDevice"); // LPCWSTR
-	ADD_PARAM_NAME("WNetUseConnectionA", 1, "hwndOwner"); // HWND
-	ADD_PARAM_NAME("WNetUseConnectionA", 2, "lpNetResource"); // LPNETRESOURCEA
-	ADD_PARAM_NAME("WNetUseConnectionA", 3, "lpPassword"); // LPCSTR
-	ADD_PARAM_NAME("WNetUseConnectionA", 4, "lpUserID"); // LPCSTR
-	ADD_PARAM_NAME("WNetUseConnectionA", 5, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("WNetUseConnectionA", 6, "lpAccessName"); // LPSTR
-	ADD_PARAM_NAME("WNetUseConnectionA", 7, "lpBufferSize"); // LPDWORD
-	ADD_PARAM_NAME("WNetUseConnectionA", 8, "lpResult"); // LPDWORD
-	ADD_PARAM_NAME("WNetUseConnectionW", 1, "hwndOwner"); // HWND
-	ADD_PARAM_NAME("WNetUseConnectionW", 2, "lpNetResource"); // LPNETRESOURCEW
-	ADD_PARAM_NAME("WNetUseConnectionW", 3, "lpPassword"); // LPCWSTR
-	ADD_PARAM_NAME("WNetUseConnectionW", 4, "lpUserID"); // LPCWSTR
-	ADD_PARAM_NAME("WNetUseConnectionW", 5, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("WNetUseConnectionW", 6, "lpAccessName"); // LPWSTR
-	ADD_PARAM_NAME("WNetUseConnectionW", 7, "lpBufferSize"); // LPDWORD
-	ADD_PARAM_NAME("WNetUseConnectionW", 8, "lpResult"); // LPDWORD
-	ADD_PARAM_NAME("WSARecvEx", 1, "s"); // SOCKET
-	ADD_PARAM_NAME("WSARecvEx", 2, "buf"); // char *
-	ADD_PARAM_NAME("WSARecvEx", 3, "len"); // int
-	ADD_PARAM_NAME("WSARecvEx", 4, "flags"); // int *
-	ADD_PARAM_NAME("WTHelperCertCheckValidSignature", 1, "pProvData"); // CRYPT_PROVIDER_DATA *
-	ADD_PARAM_NAME("WTHelperCertIsSelfSigned", 1, "dwEncoding"); // DWORD
-	ADD_PARAM_NAME("WTHelperCertIsSelfSigned", 2, "pCert"); // CERT_INFO *
-	ADD_PARAM_NAME("WTHelperGetProvCertFromChain", 1, "pSgnr"); // CRYPT_PROVIDER_SGNR *
-	ADD_PARAM_NAME("WTHelperGetProvCertFromChain", 2, "idxCert"); // DWORD
-	ADD_PARAM_NAME("WTHelperGetProvPrivateDataFromChain", 1, "pProvData"); // CRYPT_PROVIDER_DATA *
-	ADD_PARAM_NAME("WTHelperGetProvPrivateDataFromChain", 2, "pgProviderID"); // GUID *
-	ADD_PARAM_NAME("WTHelperGetProvSignerFromChain", 1, "pProvData"); // CRYPT_PROVIDER_DATA *
-	ADD_PARAM_NAME("WTHelperGetProvSignerFromChain", 2, "idxSigner"); // DWORD
-	ADD_PARAM_NAME("WTHelperGetProvSignerFromChain", 3, "fCounterSigner"); // WINBOOL
-	ADD_PARAM_NAME("WTHelperGetProvSignerFromChain", 4, "idxCounterSigner"); // DWORD
-	ADD_PARAM_NAME("WTHelperProvDataFromStateData", 1, "hStateData"); // HANDLE
-	ADD_PARAM_NAME("WaitCommEvent", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("WaitCommEvent", 2, "lpEvtMask"); // LPDWORD
-	ADD_PARAM_NAME("WaitCommEvent", 3, "lpOverlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("WaitForDebugEvent", 1, "lpDebugEvent"); // LPDEBUG_EVENT
-	ADD_PARAM_NAME("WaitForDebugEvent", 2, "dwMilliseconds"); // DWORD
-	ADD_PARAM_NAME("WaitForInputIdle", 1, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("WaitForInputIdle", 2, "dwMilliseconds"); // DWORD
-	ADD_PARAM_NAME("WaitForMultipleObjects", 1, "nCount"); // DWORD
-	ADD_PARAM_NAME("WaitForMultipleObjects", 2, "lpHandles"); // CONST HANDLE *
-	ADD_PARAM_NAME("WaitForMultipleObjects", 3, "bWaitAll"); // WINBOOL
-	ADD_PARAM_NAME("WaitForMultipleObjects", 4, "dwMilliseconds"); // DWORD
-	ADD_PARAM_NAME("WaitForMultipleObjectsEx", 1, "nCount"); // DWORD
-	ADD_PARAM_NAME("WaitForMultipleObjectsEx", 2, "lpHandles"); // CONST HANDLE *
-	ADD_PARAM_NAME("WaitForMultipleObjectsEx", 3, "bWaitAll"); // WINBOOL
-	ADD_PARAM_NAME("WaitForMultipleObjectsEx", 4, "dwMilliseconds"); // DWORD
-	ADD_PARAM_NAME("WaitForMultipleObjectsEx", 5, "bAlertable"); // WINBOOL
-	ADD_PARAM_NAME("WaitForPrinterChange", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("WaitForPrinterChange", 2, "Flags"); // DWORD
-	ADD_PARAM_NAME("WaitForSingleObject", 1, "hHandle"); // HANDLE
-	ADD_PARAM_NAME("WaitForSingleObject", 2, "dwMilliseconds"); // DWORD
-	ADD_PARAM_NAME("WaitForSingleObjectEx", 1, "hHandle"); // HANDLE
-	ADD_PARAM_NAME("WaitForSingleObjectEx", 2, "dwMilliseconds"); // DWORD
-	ADD_PARAM_NAME("WaitForSingleObjectEx", 3, "bAlertable"); // WINBOOL
-	ADD_PARAM_NAME("WaitForThreadpoolIoCallbacks", 1, "pio"); // PTP_IO
-	ADD_PARAM_NAME("WaitForThreadpoolIoCallbacks", 2, "fCancelPendingCallbacks"); // WINBOOL
-	ADD_PARAM_NAME("WaitForThreadpoolTimerCallbacks", 1, "pti"); // PTP_TIMER
-	ADD_PARAM_NAME("WaitForThreadpoolTimerCallbacks", 2, "fCancelPendingCallbacks"); // WINBOOL
-	ADD_PARAM_NAME("WaitForThreadpoolWaitCallbacks", 1, "pwa"); // PTP_WAIT
-	ADD_PARAM_NAME("WaitForThreadpoolWaitCallbacks", 2, "fCancelPendingCallbacks"); // WINBOOL
-	ADD_PARAM_NAME("WaitForThreadpoolWorkCallbacks", 1, "pwk"); // PTP_WORK
-	ADD_PARAM_NAME("WaitForThreadpoolWorkCallbacks", 2, "fCancelPendingCallbacks"); // WINBOOL
-	ADD_PARAM_NAME("WaitNamedPipeA", 1, "lpNamedPipeName"); // LPCSTR
-	ADD_PARAM_NAME("WaitNamedPipeA", 2, "nTimeOut"); // DWORD
-	ADD_PARAM_NAME("WaitNamedPipeW", 1, "lpNamedPipeName"); // LPCWSTR
-	ADD_PARAM_NAME("WaitNamedPipeW", 2, "nTimeOut"); // DWORD
-	ADD_PARAM_NAME("WakeAllConditionVariable", 1, "ConditionVariable"); // PCONDITION_VARIABLE
-	ADD_PARAM_NAME("WakeConditionVariable", 1, "ConditionVariable"); // PCONDITION_VARIABLE
-	ADD_PARAM_NAME("WideCharToMultiByte", 1, "CodePage"); // UINT
-	ADD_PARAM_NAME("WideCharToMultiByte", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("WideCharToMultiByte", 3, "lpWideCharStr"); // LPCWSTR
-	ADD_PARAM_NAME("WideCharToMultiByte", 4, "cchWideChar"); // int
-	ADD_PARAM_NAME("WideCharToMultiByte", 5, "lpMultiByteStr"); // LPSTR
-	ADD_PARAM_NAME("WideCharToMultiByte", 6, "cbMultiByte"); // int
-	ADD_PARAM_NAME("WideCharToMultiByte", 7, "lpDefaultChar"); // LPCSTR
-	ADD_PARAM_NAME("WideCharToMultiByte", 8, "lpUsedDefaultChar"); // LPBOOL
-	ADD_PARAM_NAME("WidenPath", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("WinExec", 1, "lpCmdLine"); // LPCSTR
-	ADD_PARAM_NAME("WinExec", 2, "uCmdShow"); // UINT
-	ADD_PARAM_NAME("WinHelpA", 1, "hWndMain"); // HWND
-	ADD_PARAM_NAME("WinHelpA", 2, "lpszHelp"); // LPCSTR
-	ADD_PARAM_NAME("WinHelpA", 3, "uCommand"); // UINT
-	ADD_PARAM_NAME("WinHelpA", 4, "dwData"); // ULONG_PTR
-	ADD_PARAM_NAME("WinHelpW", 1, "hWndMain"); // HWND
-	ADD_PARAM_NAME("WinHelpW", 2, "lpszHelp"); // LPCWSTR
-	ADD_PARAM_NAME("WinHelpW", 3, "uCommand"); // UINT
-	ADD_PARAM_NAME("WinHelpW", 4, "dwData"); // ULONG_PTR
-	ADD_PARAM_NAME("WinHttpAddRequestHeaders", 1, "hRequest"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpAddRequestHeaders", 2, "pwszHeaders"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpAddRequestHeaders", 3, "dwHeadersLength"); // DWORD
-	ADD_PARAM_NAME("WinHttpAddRequestHeaders", 4, "dwModifiers"); // DWORD
-	ADD_PARAM_NAME("WinHttpCloseHandle", 1, "hInternet"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpConnect", 1, "hSession"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpConnect", 2, "pswzServerName"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpConnect", 3, "nServerPort"); // INTERNET_PORT
-	ADD_PARAM_NAME("WinHttpConnect", 4, "dwReserved"); // DWORD
-	ADD_PARAM_NAME("WinHttpCrackUrl", 1, "pwszUrl"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpCrackUrl", 2, "dwUrlLength"); // DWORD
-	ADD_PARAM_NAME("WinHttpCrackUrl", 3, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("WinHttpCrackUrl", 4, "lpUrlComponents"); // LPURL_COMPONENTS
-	ADD_PARAM_NAME("WinHttpCreateUrl", 1, "lpUrlComponents"); // LPURL_COMPONENTS
-	ADD_PARAM_NAME("WinHttpCreateUrl", 2, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("WinHttpCreateUrl", 3, "pwszUrl"); // LPWSTR
-	ADD_PARAM_NAME("WinHttpCreateUrl", 4, "lpdwUrlLength"); // LPDWORD
-	ADD_PARAM_NAME("WinHttpDetectAutoProxyConfigUrl", 1, "dwAutoDetectFlags"); // DWORD
-	ADD_PARAM_NAME("WinHttpGetDefaultProxyConfiguration", 1, "pProxyInfo"); // WINHTTP_PROXY_INFO *
-	ADD_PARAM_NAME("WinHttpGetIEProxyConfigForCurrentUser", 1, "pProxyConfig"); // WINHTTP_CURRENT_USER_IE_PROXY_CONFIG *
-	ADD_PARAM_NAME("WinHttpGetProxyForUrl", 1, "hSession"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpGetProxyForUrl", 2, "lpcwszUrl"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpGetProxyForUrl", 3, "pAutoProxyOptions"); // WINHTTP_AUTOPROXY_OPTIONS *
-	ADD_PARAM_NAME("WinHttpGetProxyForUrl", 4, "pProxyInfo"); // WINHTTP_PROXY_INFO *
-	ADD_PARAM_NAME("WinHttpOpen", 1, "pwszUserAgent"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpOpen", 2, "dwAccessType"); // DWORD
-	ADD_PARAM_NAME("WinHttpOpen", 3, "pwszProxyName"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpOpen", 4, "pwszProxyBypass"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpOpen", 5, "dwFlags"); // DWORD
-	ADD_PARAM_NAME("WinHttpOpenRequest", 1, "hConnect"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpOpenRequest", 2, "pwszVerb"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpOpenRequest", 3, "pwszObjectName"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpOpenRequest", 4, "pwszVersion"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpOpenRequest", 5, "pwszReferrer"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpOpenRequest", 6, "ppwszAcceptTypes"); // LPCWSTR *
-	ADD_PARAM_NAME("WinHttpOpenRequest", 7, "dwFlags"); // DWORD
-	// ADD_PARAM_NAME("WinHttpQueryAuthParams", 1, "?"); // ?
-	ADD_PARAM_NAME("WinHttpQueryAuthSchemes", 1, "hRequest"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpQueryAuthSchemes", 2, "lpdwSupportedSchemes"); // LPDWORD
-	ADD_PARAM_NAME("WinHttpQueryAuthSchemes", 3, "lpdwFirstScheme"); // LPDWORD
-	ADD_PARAM_NAME("WinHttpQueryAuthSchemes", 4, "pdwAuthTarget"); // LPDWORD
-	ADD_PARAM_NAME("WinHttpQueryDataAvailable", 1, "hRequest"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpQueryDataAvailable", 2, "lpdwNumberOfBytesAvailable"); // LPDWORD
-	ADD_PARAM_NAME("WinHttpQueryHeaders", 1, "hRequest"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpQueryHeaders", 2, "dwInfoLevel"); // DWORD
-	ADD_PARAM_NAME("WinHttpQueryHeaders", 3, "pwszName"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpQueryHeaders", 4, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("WinHttpQueryHeaders", 5, "lpdwBufferLength"); // LPDWORD
-	ADD_PARAM_NAME("WinHttpQueryHeaders", 6, "lpdwIndex"); // LPDWORD
-	ADD_PARAM_NAME("WinHttpQueryOption", 1, "hInternet"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpQueryOption", 2, "dwOption"); // DWORD
-	ADD_PARAM_NAME("WinHttpQueryOption", 3, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("WinHttpQueryOption", 4, "lpdwBufferLength"); // LPDWORD
-	ADD_PARAM_NAME("WinHttpReadData", 1, "hRequest"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpReadData", 2, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("WinHttpReadData", 3, "dwNumberOfBytesToRead"); // DWORD
-	ADD_PARAM_NAME("WinHttpReadData", 4, "lpdwNumberOfBytesRead"); // LPDWORD
-	ADD_PARAM_NAME("WinHttpReceiveResponse", 1, "hRequest"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpReceiveResponse", 2, "lpReserved"); // LPVOID
-	ADD_PARAM_NAME("WinHttpSendRequest", 1, "hRequest"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpSendRequest", 2, "pwszHeaders"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpSendRequest", 3, "dwHeadersLength"); // DWORD
-	ADD_PARAM_NAME("WinHttpSendRequest", 4, "lpOptional"); // LPVOID
-	ADD_PARAM_NAME("WinHttpSendRequest", 5, "dwOptionalLength"); // DWORD
-	ADD_PARAM_NAME("WinHttpSendRequest", 6, "dwTotalLength"); // DWORD
-	ADD_PARAM_NAME("WinHttpSendRequest", 7, "dwContext"); // DWORD_PTR
-	ADD_PARAM_NAME("WinHttpSetCredentials", 1, "hRequest"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpSetCredentials", 2, "AuthTargets"); // DWORD
-	ADD_PARAM_NAME("WinHttpSetCredentials", 3, "AuthScheme"); // DWORD
-	ADD_PARAM_NAME("WinHttpSetCredentials", 4, "pwszUserName"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpSetCredentials", 5, "pwszPassword"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpSetCredentials", 6, "pAuthParams"); // LPVOID
-	ADD_PARAM_NAME("WinHttpSetDefaultProxyConfiguration", 1, "pProxyInfo"); // WINHTTP_PROXY_INFO *
-	ADD_PARAM_NAME("WinHttpSetOption", 1, "hInternet"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpSetOption", 2, "dwOption"); // DWORD
-	ADD_PARAM_NAME("WinHttpSetOption", 3, "lpBuffer"); // LPVOID
-	ADD_PARAM_NAME("WinHttpSetOption", 4, "dwBufferLength"); // DWORD
-	ADD_PARAM_NAME("WinHttpSetStatusCallback", 1, "hInternet"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpSetStatusCallback", 2, "lpfnInternetCallback"); // WINHTTP_STATUS_CALLBACK
-	ADD_PARAM_NAME("WinHttpSetStatusCallback", 3, "dwNotificationFlags"); // DWORD
-	ADD_PARAM_NAME("WinHttpSetStatusCallback", 4, "dwReserved"); // DWORD_PTR
-	ADD_PARAM_NAME("WinHttpSetTimeouts", 1, "hInternet"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpSetTimeouts", 2, "dwResolveTimeout"); // int
-	ADD_PARAM_NAME("WinHttpSetTimeouts", 3, "dwConnectTimeout"); // int
-	ADD_PARAM_NAME("WinHttpSetTimeouts", 4, "dwSendTimeout"); // int
-	ADD_PARAM_NAME("WinHttpSetTimeouts", 5, "dwReceiveTimeout"); // int
-	ADD_PARAM_NAME("WinHttpTimeFromSystemTime", 1, "LPWSTR"); // CONST SYSTEMTIME *
-	ADD_PARAM_NAME("WinHttpTimeToSystemTime", 1, "pwszTime"); // LPCWSTR
-	ADD_PARAM_NAME("WinHttpTimeToSystemTime", 2, "pst"); // SYSTEMTIME *
-	ADD_PARAM_NAME("WinHttpWriteData", 1, "hRequest"); // HINTERNET
-	ADD_PARAM_NAME("WinHttpWriteData", 2, "lpBuffer"); // LPCVOID
-	ADD_PARAM_NAME("WinHttpWriteData", 3, "dwNumberOfBytesToWrite"); // DWORD
-	ADD_PARAM_NAME("WinHttpWriteData", 4, "lpdwNumberOfBytesWritten"); // LPDWORD
-	ADD_PARAM_NAME("WinMain", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("WinMain", 2, "hPrevInstance"); // HINSTANCE
-	ADD_PARAM_NAME("WinMain", 3, "lpCmdLine"); // LPSTR
-	ADD_PARAM_NAME("WinMain", 4, "nShowCmd"); // int
-	ADD_PARAM_NAME("WinUsb_AbortPipe", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_AbortPipe", 2, "PipeID"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_ControlTransfer", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_ControlTransfer", 2, "SetupPacket"); // WINUSB_SETUP_PACKET
-	ADD_PARAM_NAME("WinUsb_ControlTransfer", 3, "Buffer"); // PUCHAR
-	ADD_PARAM_NAME("WinUsb_ControlTransfer", 4, "BufferLength"); // ULONG
-	ADD_PARAM_NAME("WinUsb_ControlTransfer", 5, "LengthTransferred"); // PULONG
-	ADD_PARAM_NAME("WinUsb_ControlTransfer", 6, "Overlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("WinUsb_FlushPipe", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_FlushPipe", 2, "PipeID"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_Free", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_GetAssociatedInterface", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_GetAssociatedInterface", 2, "AssociatedInterfaceIndex"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_GetAssociatedInterface", 3, "AssociatedInterfaceHandle"); // PWINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_GetCurrentAlternateSetting", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_GetCurrentAlternateSetting", 2, "AlternateSetting"); // PUCHAR
-	ADD_PARAM_NAME("WinUsb_GetDescriptor", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_GetDescriptor", 2, "DescriptorType"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_GetDescriptor", 3, "Index"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_GetDescriptor", 4, "LanguageID"); // USHORT
-	ADD_PARAM_NAME("WinUsb_GetDescriptor", 5, "Buffer"); // PUCHAR
-	ADD_PARAM_NAME("WinUsb_GetDescriptor", 6, "BufferLength"); // ULONG
-	ADD_PARAM_NAME("WinUsb_GetDescriptor", 7, "LengthTransferred"); // PULONG
-	ADD_PARAM_NAME("WinUsb_GetOverlappedResult", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_GetOverlappedResult", 2, "lpOverlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("WinUsb_GetOverlappedResult", 3, "lpNumberOfBytesTransferred"); // LPDWORD
-	ADD_PARAM_NAME("WinUsb_GetOverlappedResult", 4, "bWait"); // WINBOOL
-	ADD_PARAM_NAME("WinUsb_GetPipePolicy", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_GetPipePolicy", 2, "PipeID"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_GetPipePolicy", 3, "PolicyType"); // ULONG
-	ADD_PARAM_NAME("WinUsb_GetPipePolicy", 4, "ValueLength"); // PULONG
-	ADD_PARAM_NAME("WinUsb_GetPipePolicy", 5, "Value"); // PVOID
-	ADD_PARAM_NAME("WinUsb_GetPowerPolicy", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_GetPowerPolicy", 2, "PolicyType"); // ULONG
-	ADD_PARAM_NAME("WinUsb_GetPowerPolicy", 3, "ValueLength"); // PULONG
-	ADD_PARAM_NAME("WinUsb_GetPowerPolicy", 4, "Value"); // PVOID
-	ADD_PARAM_NAME("WinUsb_Initialize", 1, "DeviceHandle"); // HANDLE
-	ADD_PARAM_NAME("WinUsb_Initialize", 2, "InterfaceHandle"); // PWINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_QueryDeviceInformation", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_QueryDeviceInformation", 2, "InformationType"); // ULONG
-	ADD_PARAM_NAME("WinUsb_QueryDeviceInformation", 3, "BufferLength"); // PULONG
-	ADD_PARAM_NAME("WinUsb_QueryDeviceInformation", 4, "Buffer"); // PVOID
-	ADD_PARAM_NAME("WinUsb_QueryInterfaceSettings", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_QueryInterfaceSettings", 2, "AlternateSettingNumber"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_QueryInterfaceSettings", 3, "UsbAltInterfaceDescriptor"); // PUSB_INTERFACE_DESCRIPTOR
-	ADD_PARAM_NAME("WinUsb_QueryPipe", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_QueryPipe", 2, "AlternateInterfaceNumber"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_QueryPipe", 3, "PipeIndex"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_QueryPipe", 4, "PipeInformation"); // PWINUSB_PIPE_INFORMATION
-	ADD_PARAM_NAME("WinUsb_ReadPipe", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_ReadPipe", 2, "PipeID"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_ReadPipe", 3, "Buffer"); // PUCHAR
-	ADD_PARAM_NAME("WinUsb_ReadPipe", 4, "BufferLength"); // ULONG
-	ADD_PARAM_NAME("WinUsb_ReadPipe", 5, "LengthTransferred"); // PULONG
-	ADD_PARAM_NAME("WinUsb_ReadPipe", 6, "Overlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("WinUsb_ResetPipe", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_ResetPipe", 2, "PipeID"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_SetCurrentAlternateInterface", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_SetCurrentAlternateInterface", 2, "AlternateSetting"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_SetPipePolicy", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_SetPipePolicy", 2, "PipeID"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_SetPipePolicy", 3, "PolicyType"); // ULONG
-	ADD_PARAM_NAME("WinUsb_SetPipePolicy", 4, "ValueLength"); // ULONG
-	ADD_PARAM_NAME("WinUsb_SetPipePolicy", 5, "Value"); // PVOID
-	ADD_PARAM_NAME("WinUsb_SetPowerPolicy", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_SetPowerPolicy", 2, "PolicyType"); // ULONG
-	ADD_PARAM_NAME("WinUsb_SetPowerPolicy", 3, "ValueLength"); // ULONG
-	ADD_PARAM_NAME("WinUsb_SetPowerPolicy", 4, "Value"); // PVOID
-	ADD_PARAM_NAME("WinUsb_WritePipe", 1, "InterfaceHandle"); // WINUSB_INTERFACE_HANDLE
-	ADD_PARAM_NAME("WinUsb_WritePipe", 2, "PipeID"); // UCHAR
-	ADD_PARAM_NAME("WinUsb_WritePipe", 3, "Buffer"); // PUCHAR
-	ADD_PARAM_NAME("WinUsb_WritePipe", 4, "BufferLength"); // ULONG
-	ADD_PARAM_NAME("WinUsb_WritePipe", 5, "LengthTransferred"); // PULONG
-	ADD_PARAM_NAME("WinUsb_WritePipe", 6, "Overlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("WinVerifyTrust", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("WinVerifyTrust", 2, "pgActionID"); // GUID *
-	ADD_PARAM_NAME("WinVerifyTrust", 3, "pWVTData"); // LPVOID
-	ADD_PARAM_NAME("WinVerifyTrustEx", 1, "hWnd"); // HWND
-	ADD_PARAM_NAME("WinVerifyTrustEx", 2, "pgActionID"); // GUID *
-	ADD_PARAM_NAME("WinVerifyTrustEx", 3, "pWinTrustData"); // WINTRUST_DATA *
-	ADD_PARAM_NAME("WindowFromDC", 1, "hDC"); // HDC
-	ADD_PARAM_NAME("WindowFromPoint", 1, "Point"); // POINT
-	ADD_PARAM_NAME("WintrustAddActionID", 1, "pgActionID"); // GUID *
-	ADD_PARAM_NAME("WintrustAddActionID", 2, "fdwFlags"); // DWORD
-	ADD_PARAM_NAME("WintrustAddActionID", 3, "psProvInfo"); // CRYPT_REGISTER_ACTIONID *
-	ADD_PARAM_NAME("WintrustAddDefaultForUsage", 1, "pszUsageOID"); // const char *
-	ADD_PARAM_NAME("WintrustAddDefaultForUsage", 2, "psDefUsage"); // CRYPT_PROVIDER_REGDEFUSAGE *
-	ADD_PARAM_NAME("WintrustGetDefaultForUsage", 1, "dwAction"); // DWORD
-	ADD_PARAM_NAME("WintrustGetDefaultForUsage", 2, "pszUsageOID"); // const char *
-	ADD_PARAM_NAME("WintrustGetDefaultForUsage", 3, "psUsage"); // CRYPT_PROVIDER_DEFUSAGE *
-	ADD_PARAM_NAME("WintrustGetRegPolicyFlags", 1, "pdwPolicyFlags"); // DWORD *
-	ADD_PARAM_NAME("WintrustLoadFunctionPointers", 1, "pgActionID"); // GUID *
-	ADD_PARAM_NAME("WintrustLoadFunctionPointers", 2, "pPfns"); // CRYPT_PROVIDER_FUNCTIONS *
-	ADD_PARAM_NAME("WintrustRemoveActionID", 1, "pgActionID"); // GUID *
-	ADD_PARAM_NAME("WintrustSetDefaultIncludePEPageHashes", 1, "fIncludePEPageHashes"); // WINBOOL
-	ADD_PARAM_NAME("WintrustSetRegPolicyFlags", 1, "dwPolicyFlags"); // DWORD
-	ADD_PARAM_NAME("WlxActivateUserShell", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxActivateUserShell", 2, "pszDesktopName"); // PWSTR
-	ADD_PARAM_NAME("WlxActivateUserShell", 3, "pszMprLogonScript"); // PWSTR
-	ADD_PARAM_NAME("WlxActivateUserShell", 4, "pEnvironment"); // PVOID
-	ADD_PARAM_NAME("WlxDisconnectNotify", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxDisplayLockedNotice", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxDisplaySASNotice", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxDisplayStatusMessage", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxDisplayStatusMessage", 2, "hDesktop"); // HDESK
-	ADD_PARAM_NAME("WlxDisplayStatusMessage", 3, "dwOptions"); // DWORD
-	ADD_PARAM_NAME("WlxDisplayStatusMessage", 4, "pTitle"); // PWSTR
-	ADD_PARAM_NAME("WlxDisplayStatusMessage", 5, "pMessage"); // PWSTR
-	ADD_PARAM_NAME("WlxGetConsoleSwitchCredentials", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxGetConsoleSwitchCredentials", 2, "pCredInfo"); // PVOID
-	ADD_PARAM_NAME("WlxGetStatusMessage", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxGetStatusMessage", 2, "pdwOptions"); // DWORD *
-	ADD_PARAM_NAME("WlxGetStatusMessage", 3, "pMessage"); // PWSTR
-	ADD_PARAM_NAME("WlxGetStatusMessage", 4, "dwBufferSize"); // DWORD
-	ADD_PARAM_NAME("WlxInitialize", 1, "lpWinsta"); // LPWSTR
-	ADD_PARAM_NAME("WlxInitialize", 2, "hWlx"); // HANDLE
-	ADD_PARAM_NAME("WlxInitialize", 3, "pvReserved"); // PVOID
-	ADD_PARAM_NAME("WlxInitialize", 4, "pWinlogonFunctions"); // PVOID
-	ADD_PARAM_NAME("WlxInitialize", 5, "pWlxContext"); // PVOID *
-	ADD_PARAM_NAME("WlxIsLockOk", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxIsLogoffOk", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxLoggedOnSAS", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxLoggedOnSAS", 2, "dwSasType"); // DWORD
-	ADD_PARAM_NAME("WlxLoggedOnSAS", 3, "pReserved"); // PVOID
-	ADD_PARAM_NAME("WlxLoggedOutSAS", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxLoggedOutSAS", 2, "dwSasType"); // DWORD
-	ADD_PARAM_NAME("WlxLoggedOutSAS", 3, "pAuthenticationId"); // PLUID
-	ADD_PARAM_NAME("WlxLoggedOutSAS", 4, "pLogonSid"); // PSID
-	ADD_PARAM_NAME("WlxLoggedOutSAS", 5, "pdwOptions"); // PDWORD
-	ADD_PARAM_NAME("WlxLoggedOutSAS", 6, "phToken"); // PHANDLE
-	ADD_PARAM_NAME("WlxLoggedOutSAS", 7, "pNprNotifyInfo"); // PWLX_MPR_NOTIFY_INFO
-	ADD_PARAM_NAME("WlxLoggedOutSAS", 8, "pProfile"); // PVOID *
-	ADD_PARAM_NAME("WlxLogoff", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxNegotiate", 1, "dwWinlogonVersion"); // DWORD
-	ADD_PARAM_NAME("WlxNegotiate", 2, "pdwDllVersion"); // PDWORD
-	ADD_PARAM_NAME("WlxNetworkProviderLoad", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxNetworkProviderLoad", 2, "pNprNotifyInfo"); // PWLX_MPR_NOTIFY_INFO
-	ADD_PARAM_NAME("WlxReconnectNotify", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxRemoveStatusMessage", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxScreenSaverNotify", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxScreenSaverNotify", 2, "pSecure"); // WINBOOL *
-	ADD_PARAM_NAME("WlxShutdown", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxShutdown", 2, "ShutdownType"); // DWORD
-	ADD_PARAM_NAME("WlxStartApplication", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxStartApplication", 2, "pszDesktopName"); // PWSTR
-	ADD_PARAM_NAME("WlxStartApplication", 3, "pEnvironment"); // PVOID
-	ADD_PARAM_NAME("WlxStartApplication", 4, "pszCmdLine"); // PWSTR
-	ADD_PARAM_NAME("WlxWkstaLockedSAS", 1, "pWlxContext"); // PVOID
-	ADD_PARAM_NAME("WlxWkstaLockedSAS", 2, "dwSasType"); // DWORD
-	ADD_PARAM_NAME("Wow64DisableWow64FsRedirection", 1, "OldValue"); // PVOID *
-	ADD_PARAM_NAME("Wow64EnableWow64FsRedirection", 1, "Wow64FsEnableRedirection"); // BOOLEAN
-	ADD_PARAM_NAME("Wow64GetThreadContext", 1, "hThread"); // HANDLE
-	ADD_PARAM_NAME("Wow64GetThreadContext", 2, "lpContext"); // PWOW64_CONTEXT
-	ADD_PARAM_NAME("Wow64RevertWow64FsRedirection", 1, "OlValue"); // PVOID
-	ADD_PARAM_NAME("Wow64SetThreadContext", 1, "hThread"); // HANDLE
-	ADD_PARAM_NAME("Wow64SetThreadContext", 2, "lpContext"); // const WOW64_CONTEXT *
-	ADD_PARAM_NAME("Wow64SuspendThread", 1, "hThread"); // HANDLE
-	ADD_PARAM_NAME("Wow64Win32ApiEntry", 1, "dwFuncNumber"); // DWORD
-	ADD_PARAM_NAME("Wow64Win32ApiEntry", 2, "dwFlag"); // DWORD
-	ADD_PARAM_NAME("Wow64Win32ApiEntry", 3, "dwRes"); // DWORD
-	ADD_PARAM_NAME("WriteConsoleA", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("WriteConsoleA", 2, "lpBuffer"); // CONST VOID *
-	ADD_PARAM_NAME("WriteConsoleA", 3, "nNumberOfCharsToWrite"); // DWORD
-	ADD_PARAM_NAME("WriteConsoleA", 4, "lpNumberOfCharsWritten"); // LPDWORD
-	ADD_PARAM_NAME("WriteConsoleA", 5, "lpReserved"); // LPVOID
-	ADD_PARAM_NAME("WriteConsoleInputA", 1, "hConsoleInput"); // HANDLE
-	ADD_PARAM_NAME("WriteConsoleInputA", 2, "lpBuffer"); // CONST INPUT_RECORD *
-	ADD_PARAM_NAME("WriteConsoleInputA", 3, "nLength"); // DWORD
-	ADD_PARAM_NAME("WriteConsoleInputA", 4, "lpNumberOfEventsWritten"); // LPDWORD
-	ADD_PARAM_NAME("WriteConsoleInputW", 1, "hConsoleInput"); // HANDLE
-	ADD_PARAM_NAME("WriteConsoleInputW", 2, "lpBuffer"); // CONST INPUT_RECORD *
-	ADD_PARAM_NAME("WriteConsoleInputW", 3, "nLength"); // DWORD
-	ADD_PARAM_NAME("WriteConsoleInputW", 4, "lpNumberOfEventsWritten"); // LPDWORD
-	ADD_PARAM_NAME("WriteConsoleOutputA", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("WriteConsoleOutputA", 2, "lpBuffer"); // CONST CHAR_INFO *
-	ADD_PARAM_NAME("WriteConsoleOutputA", 3, "dwBufferSize"); // COORD
-	ADD_PARAM_NAME("WriteConsoleOutputA", 4, "dwBufferCoord"); // COORD
-	ADD_PARAM_NAME("WriteConsoleOutputA", 5, "lpWriteRegion"); // PSMALL_RECT
-	ADD_PARAM_NAME("WriteConsoleOutputAttribute", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("WriteConsoleOutputAttribute", 2, "lpAttribute"); // CONST WORD *
-	ADD_PARAM_NAME("WriteConsoleOutputAttribute", 3, "nLength"); // DWORD
-	ADD_PARAM_NAME("WriteConsoleOutputAttribute", 4, "dwWriteCoord"); // COORD
-	ADD_PARAM_NAME("WriteConsoleOutputAttribute", 5, "lpNumberOfAttrsWritten"); // LPDWORD
-	ADD_PARAM_NAME("WriteConsoleOutputCharacterA", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("WriteConsoleOutputCharacterA", 2, "lpCharacter"); // LPCSTR
-	ADD_PARAM_NAME("WriteConsoleOutputCharacterA", 3, "nLength"); // DWORD
-	ADD_PARAM_NAME("WriteConsoleOutputCharacterA", 4, "dwWriteCoord"); // COORD
-	ADD_PARAM_NAME("WriteConsoleOutputCharacterA", 5, "lpNumberOfCharsWritten"); // LPDWORD
-	ADD_PARAM_NAME("WriteConsoleOutputCharacterW", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("WriteConsoleOutputCharacterW", 2, "lpCharacter"); // LPCWSTR
-	ADD_PARAM_NAME("WriteConsoleOutputCharacterW", 3, "nLength"); // DWORD
-	ADD_PARAM_NAME("WriteConsoleOutputCharacterW", 4, "dwWriteCoord"); // COORD
-	ADD_PARAM_NAME("WriteConsoleOutputCharacterW", 5, "lpNumberOfCharsWritten"); // LPDWORD
-	ADD_PARAM_NAME("WriteConsoleOutputW", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("WriteConsoleOutputW", 2, "lpBuffer"); // CONST CHAR_INFO *
-	ADD_PARAM_NAME("WriteConsoleOutputW", 3, "dwBufferSize"); // COORD
-	ADD_PARAM_NAME("WriteConsoleOutputW", 4, "dwBufferCoord"); // COORD
-	ADD_PARAM_NAME("WriteConsoleOutputW", 5, "lpWriteRegion"); // PSMALL_RECT
-	ADD_PARAM_NAME("WriteConsoleW", 1, "hConsoleOutput"); // HANDLE
-	ADD_PARAM_NAME("WriteConsoleW", 2, "lpBuffer"); // CONST VOID *
-	ADD_PARAM_NAME("WriteConsoleW", 3, "nNumberOfCharsToWrite"); // DWORD
-	ADD_PARAM_NAME("WriteConsoleW", 4, "lpNumberOfCharsWritten"); // LPDWORD
-	ADD_PARAM_NAME("WriteConsoleW", 5, "lpReserved"); // LPVOID
-	ADD_PARAM_NAME("WriteEncryptedFileRaw", 1, "pfImportCallback"); // PFE_IMPORT_FUNC
-	ADD_PARAM_NAME("WriteEncryptedFileRaw", 2, "pvCallbackContext"); // PVOID
-	ADD_PARAM_NAME("WriteEncryptedFileRaw", 3, "pvContext"); // PVOID
-	ADD_PARAM_NAME("WriteFile", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("WriteFile", 2, "lpBuffer"); // LPCVOID
-	ADD_PARAM_NAME("WriteFile", 3, "nNumberOfBytesToWrite"); // DWORD
-	ADD_PARAM_NAME("WriteFile", 4, "lpNumberOfBytesWritten"); // LPDWORD
-	ADD_PARAM_NAME("WriteFile", 5, "lpOverlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("WriteFileEx", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("WriteFileEx", 2, "lpBuffer"); // LPCVOID
-	ADD_PARAM_NAME("WriteFileEx", 3, "nNumberOfBytesToWrite"); // DWORD
-	ADD_PARAM_NAME("WriteFileEx", 4, "lpOverlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("WriteFileEx", 5, "lpCompletionRoutine"); // LPOVERLAPPED_COMPLETION_ROUTINE
-	ADD_PARAM_NAME("WriteFileGather", 1, "hFile"); // HANDLE
-	ADD_PARAM_NAME("WriteFileGather", 2, "aSegmentArray"); // FILE_SEGMENT_ELEMENT []
-	ADD_PARAM_NAME("WriteFileGather", 3, "nNumberOfBytesToWrite"); // DWORD
-	ADD_PARAM_NAME("WriteFileGather", 4, "lpReserved"); // LPDWORD
-	ADD_PARAM_NAME("WriteFileGather", 5, "lpOverlapped"); // LPOVERLAPPED
-	ADD_PARAM_NAME("WritePrinter", 1, "hPrinter"); // HANDLE
-	ADD_PARAM_NAME("WritePrinter", 2, "pBuf"); // LPVOID
-	ADD_PARAM_NAME("WritePrinter", 3, "cbBuf"); // DWORD
-	ADD_PARAM_NAME("WritePrinter", 4, "pcWritten"); // LPDWORD
-	ADD_PARAM_NAME("WritePrivateProfileSectionA", 1, "lpAppName"); // LPCSTR
-	ADD_PARAM_NAME("WritePrivateProfileSectionA", 2, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("WritePrivateProfileSectionA", 3, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("WritePrivateProfileSectionW", 1, "lpAppName"); // LPCWSTR
-	ADD_PARAM_NAME("WritePrivateProfileSectionW", 2, "lpString"); // LPCWSTR
-	ADD_PARAM_NAME("WritePrivateProfileSectionW", 3, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("WritePrivateProfileStringA", 1, "lpAppName"); // LPCSTR
-	ADD_PARAM_NAME("WritePrivateProfileStringA", 2, "lpKeyName"); // LPCSTR
-	ADD_PARAM_NAME("WritePrivateProfileStringA", 3, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("WritePrivateProfileStringA", 4, "lpFileName"); // LPCSTR
-	ADD_PARAM_NAME("WritePrivateProfileStringW", 1, "lpAppName"); // LPCWSTR
-	ADD_PARAM_NAME("WritePrivateProfileStringW", 2, "lpKeyName"); // LPCWSTR
-	ADD_PARAM_NAME("WritePrivateProfileStringW", 3, "lpString"); // LPCWSTR
-	ADD_PARAM_NAME("WritePrivateProfileStringW", 4, "lpFileName"); // LPCWSTR
-	ADD_PARAM_NAME("WritePrivateProfileStructA", 1, "lpszSection"); // LPCSTR
-	ADD_PARAM_NAME("WritePrivateProfileStructA", 2, "lpszKey"); // LPCSTR
-	ADD_PARAM_NAME("WritePrivateProfileStructA", 3, "lpStruct"); // LPVOID
-	ADD_PARAM_NAME("WritePrivateProfileStructA", 4, "uSizeStruct"); // UINT
-	ADD_PARAM_NAME("WritePrivateProfileStructA", 5, "szFile"); // LPCSTR
-	ADD_PARAM_NAME("WritePrivateProfileStructW", 1, "lpszSection"); // LPCWSTR
-	ADD_PARAM_NAME("WritePrivateProfileStructW", 2, "lpszKey"); // LPCWSTR
-	ADD_PARAM_NAME("WritePrivateProfileStructW", 3, "lpStruct"); // LPVOID
-	ADD_PARAM_NAME("WritePrivateProfileStructW", 4, "uSizeStruct"); // UINT
-	ADD_PARAM_NAME("WritePrivateProfileStructW", 5, "szFile"); // LPCWSTR
-	ADD_PARAM_NAME("WriteProcessMemory", 1, "hProcess"); // HANDLE
-	ADD_PARAM_NAME("WriteProcessMemory", 2, "lpBaseAddress"); // LPVOID
-	ADD_PARAM_NAME("WriteProcessMemory", 3, "lpBuffer"); // LPCVOID
-	ADD_PARAM_NAME("WriteProcessMemory", 4, "nSize"); // SIZE_T
-	ADD_PARAM_NAME("WriteProcessMemory", 5, "lpNumberOfBytesWritten"); // SIZE_T *
-	ADD_PARAM_NAME("WriteProfileSectionA", 1, "lpAppName"); // LPCSTR
-	ADD_PARAM_NAME("WriteProfileSectionA", 2, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("WriteProfileSectionW", 1, "lpAppName"); // LPCWSTR
-	ADD_PARAM_NAME("WriteProfileSectionW", 2, "lpString"); // LPCWSTR
-	ADD_PARAM_NAME("WriteProfileStringA", 1, "lpAppName"); // LPCSTR
-	ADD_PARAM_NAME("WriteProfileStringA", 2, "lpKeyName"); // LPCSTR
-	ADD_PARAM_NAME("WriteProfileStringA", 3, "lpString"); // LPCSTR
-	ADD_PARAM_NAME("WriteProfileStringW", 1, "lpAppName"); // LPCWSTR
-	ADD_PARAM_NAME("WriteProfileStringW", 2, "lpKeyName"); // LPCWSTR
-	ADD_PARAM_NAME("WriteProfileStringW", 3, "lpString"); // LPCWSTR
-	ADD_PARAM_NAME("WriteTapemark", 1, "hDevice"); // HANDLE
-	ADD_PARAM_NAME("WriteTapemark", 2, "dwTapemarkType"); // DWORD
-	ADD_PARAM_NAME("WriteTapemark", 3, "dwTapemarkCount"); // DWORD
-	ADD_PARAM_NAME("WriteTapemark", 4, "bImmediate"); // WINBOOL
+	{"WICConvertBitmapSource", 1, "dstFormat"}, // REFWICPixelFormatGUID
+	{"WICConvertBitmapSource", 2, "pISrc"}, // IWICBitmapSource *
+	{"WICConvertBitmapSource", 3, "ppIDst"}, // IWICBitmapSource * *
+	{"WINNLSEnableIME", 1, "hWnd"}, // HWND
+	{"WINNLSEnableIME", 2, "bFlag"}, // WINBOOL
+	{"WINNLSGetEnableStatus", 1, "hWnd"}, // HWND
+	{"WINNLSGetIMEHotkey", 1, "hWnd"}, // HWND
+	{"WNetAddConnection2A", 1, "lpNetResource"}, // LPNETRESOURCEA
+	{"WNetAddConnection2A", 2, "lpPassword"}, // LPCSTR
+	{"WNetAddConnection2A", 3, "lpUserName"}, // LPCSTR
+	{"WNetAddConnection2A", 4, "dwFlags"}, // DWORD
+	{"WNetAddConnection2W", 1, "lpNetResource"}, // LPNETRESOURCEW
+	{"WNetAddConnection2W", 2, "lpPassword"}, // LPCWSTR
+	{"WNetAddConnection2W", 3, "lpUserName"}, // LPCWSTR
+	{"WNetAddConnection2W", 4, "dwFlags"}, // DWORD
+	{"WNetAddConnection3A", 1, "hwndOwner"}, // HWND
+	{"WNetAddConnection3A", 2, "lpNetResource"}, // LPNETRESOURCEA
+	{"WNetAddConnection3A", 3, "lpPassword"}, // LPCSTR
+	{"WNetAddConnection3A", 4, "lpUserName"}, // LPCSTR
+	{"WNetAddConnection3A", 5, "dwFlags"}, // DWORD
+	{"WNetAddConnection3W", 1, "hwndOwner"}, // HWND
+	{"WNetAddConnection3W", 2, "lpNetResource"}, // LPNETRESOURCEW
+	{"WNetAddConnection3W", 3, "lpPassword"}, // LPCWSTR
+	{"WNetAddConnection3W", 4, "lpUserName"}, // LPCWSTR
+	{"WNetAddConnection3W", 5, "dwFlags"}, // DWORD
+	{"WNetAddConnectionA", 1, "lpRemoteName"}, // LPCSTR
+	{"WNetAddConnectionA", 2, "lpPassword"}, // LPCSTR
+	{"WNetAddConnectionA", 3, "lpLocalName"}, // LPCSTR
+	{"WNetAddConnectionW", 1, "lpRemoteName"}, // LPCWSTR
+	{"WNetAddConnectionW", 2, "lpPassword"}, // LPCWSTR
+	{"WNetAddConnectionW", 3, "lpLocalName"}, // LPCWSTR
+	{"WNetCancelConnection2A", 1, "lpName"}, // LPCSTR
+	{"WNetCancelConnection2A", 2, "dwFlags"}, // DWORD
+	{"WNetCancelConnection2A", 3, "fForce"}, // WINBOOL
+	{"WNetCancelConnection2W", 1, "lpName"}, // LPCWSTR
+	{"WNetCancelConnection2W", 2, "dwFlags"}, // DWORD
+	{"WNetCancelConnection2W", 3, "fForce"}, // WINBOOL
+	{"WNetCancelConnectionA", 1, "lpName"}, // LPCSTR
+	{"WNetCancelConnectionA", 2, "fForce"}, // WINBOOL
+	{"WNetCancelConnectionW", 1, "lpName"}, // LPCWSTR
+	{"WNetCancelConnectionW", 2, "fForce"}, // WINBOOL
+	{"WNetCloseEnum", 1, "hEnum"}, // HANDLE
+	{"WNetConnectionDialog", 1, "hWnd"}, // HWND
+	{"WNetConnectionDialog", 2, "dwType"}, // DWORD
+	{"WNetConnectionDialog1A", 1, "lpConnDlgStruct"}, // LPCONNECTDLGSTRUCTA
+	{"WNetConnectionDialog1W", 1, "lpConnDlgStruct"}, // LPCONNECTDLGSTRUCTW
+	{"WNetDisconnectDialog", 1, "hWnd"}, // HWND
+	{"WNetDisconnectDialog", 2, "dwType"}, // DWORD
+	{"WNetDisconnectDialog1A", 1, "lpConnDlgStruct"}, // LPDISCDLGSTRUCTA
+	{"WNetDisconnectDialog1W", 1, "lpConnDlgStruct"}, // LPDISCDLGSTRUCTW
+	{"WNetEnumResourceA", 1, "hEnum"}, // HANDLE
+	{"WNetEnumResourceA", 2, "lpcCount"}, // LPDWORD
+	{"WNetEnumResourceA", 3, "lpBuffer"}, // LPVOID
+	{"WNetEnumResourceA", 4, "lpBufferSize"}, // LPDWORD
+	{"WNetEnumResourceW", 1, "hEnum"}, // HANDLE
+	{"WNetEnumResourceW", 2, "lpcCount"}, // LPDWORD
+	{"WNetEnumResourceW", 3, "lpBuffer"}, // LPVOID
+	{"WNetEnumResourceW", 4, "lpBufferSize"}, // LPDWORD
+	{"WNetGetConnectionA", 1, "lpLocalName"}, // LPCSTR
+	{"WNetGetConnectionA", 2, "lpRemoteName"}, // LPSTR
+	{"WNetGetConnectionA", 3, "lpnLength"}, // LPDWORD
+	{"WNetGetConnectionW", 1, "lpLocalName"}, // LPCWSTR
+	{"WNetGetConnectionW", 2, "lpRemoteName"}, // LPWSTR
+	{"WNetGetConnectionW", 3, "lpnLength"}, // LPDWORD
+	{"WNetGetLastErrorA", 1, "lpError"}, // LPDWORD
+	{"WNetGetLastErrorA", 2, "lpErrorBuf"}, // LPSTR
+	{"WNetGetLastErrorA", 3, "nErrorBufSize"}, // DWORD
+	{"WNetGetLastErrorA", 4, "lpNameBuf"}, // LPSTR
+	{"WNetGetLastErrorA", 5, "nNameBufSize"}, // DWORD
+	{"WNetGetLastErrorW", 1, "lpError"}, // LPDWORD
+	{"WNetGetLastErrorW", 2, "lpErrorBuf"}, // LPWSTR
+	{"WNetGetLastErrorW", 3, "nErrorBufSize"}, // DWORD
+	{"WNetGetLastErrorW", 4, "lpNameBuf"}, // LPWSTR
+	{"WNetGetLastErrorW", 5, "nNameBufSize"}, // DWORD
+	{"WNetGetNetworkInformationA", 1, "lpProvider"}, // LPCSTR
+	{"WNetGetNetworkInformationA", 2, "lpNetInfoStruct"}, // LPNETINFOSTRUCT
+	{"WNetGetNetworkInformationW", 1, "lpProvider"}, // LPCWSTR
+	{"WNetGetNetworkInformationW", 2, "lpNetInfoStruct"}, // LPNETINFOSTRUCT
+	{"WNetGetProviderNameA", 1, "dwNetType"}, // DWORD
+	{"WNetGetProviderNameA", 2, "lpProviderName"}, // LPSTR
+	{"WNetGetProviderNameA", 3, "lpBufferSize"}, // LPDWORD
+	{"WNetGetProviderNameW", 1, "dwNetType"}, // DWORD
+	{"WNetGetProviderNameW", 2, "lpProviderName"}, // LPWSTR
+	{"WNetGetProviderNameW", 3, "lpBufferSize"}, // LPDWORD
+	{"WNetGetResourceInformationA", 1, "lpNetResource"}, // LPNETRESOURCEA
+	{"WNetGetResourceInformationA", 2, "lpBuffer"}, // LPVOID
+	{"WNetGetResourceInformationA", 3, "lpcbBuffer"}, // LPDWORD
+	{"WNetGetResourceInformationA", 4, "lplpSystem"}, // LPSTR *
+	{"WNetGetResourceInformationW", 1, "lpNetResource"}, // LPNETRESOURCEW
+	{"WNetGetResourceInformationW", 2, "lpBuffer"}, // LPVOID
+	{"WNetGetResourceInformationW", 3, "lpcbBuffer"}, // LPDWORD
+	{"WNetGetResourceInformationW", 4, "lplpSystem"}, // LPWSTR *
+	{"WNetGetResourceParentA", 1, "lpNetResource"}, // LPNETRESOURCEA
+	{"WNetGetResourceParentA", 2, "lpBuffer"}, // LPVOID
+	{"WNetGetResourceParentA", 3, "lpcbBuffer"}, // LPDWORD
+	{"WNetGetResourceParentW", 1, "lpNetResource"}, // LPNETRESOURCEW
+	{"WNetGetResourceParentW", 2, "lpBuffer"}, // LPVOID
+	{"WNetGetResourceParentW", 3, "lpcbBuffer"}, // LPDWORD
+	{"WNetGetUniversalNameA", 1, "lpLocalPath"}, // LPCSTR
+	{"WNetGetUniversalNameA", 2, "dwInfoLevel"}, // DWORD
+	{"WNetGetUniversalNameA", 3, "lpBuffer"}, // LPVOID
+	{"WNetGetUniversalNameA", 4, "lpBufferSize"}, // LPDWORD
+	{"WNetGetUniversalNameW", 1, "lpLocalPath"}, // LPCWSTR
+	{"WNetGetUniversalNameW", 2, "dwInfoLevel"}, // DWORD
+	{"WNetGetUniversalNameW", 3, "lpBuffer"}, // LPVOID
+	{"WNetGetUniversalNameW", 4, "lpBufferSize"}, // LPDWORD
+	{"WNetGetUserA", 1, "lpName"}, // LPCSTR
+	{"WNetGetUserA", 2, "lpUserName"}, // LPSTR
+	{"WNetGetUserA", 3, "lpnLength"}, // LPDWORD
+	{"WNetGetUserW", 1, "lpName"}, // LPCWSTR
+	{"WNetGetUserW", 2, "lpUserName"}, // LPWSTR
+	{"WNetGetUserW", 3, "lpnLength"}, // LPDWORD
+	{"WNetOpenEnumA", 1, "dwScope"}, // DWORD
+	{"WNetOpenEnumA", 2, "dwType"}, // DWORD
+	{"WNetOpenEnumA", 3, "dwUsage"}, // DWORD
+	{"WNetOpenEnumA", 4, "lpNetResource"}, // LPNETRESOURCEA
+	{"WNetOpenEnumA", 5, "lphEnum"}, // LPHANDLE
+	{"WNetOpenEnumW", 1, "dwScope"}, // DWORD
+	{"WNetOpenEnumW", 2, "dwType"}, // DWORD
+	{"WNetOpenEnumW", 3, "dwUsage"}, // DWORD
+	{"WNetOpenEnumW", 4, "lpNetResource"}, // LPNETRESOURCEW
+	{"WNetOpenEnumW", 5, "lphEnum"}, // LPHANDLE
+	{"WNetRestoreConnectionA", 1, "hwndParent"}, // HWND
+	{"WNetRestoreConnectionA", 2, "lpDevice"}, // LPCSTR
+	{"WNetRestoreConnectionW", 1, "hwndParent"}, // HWND
+	{"WNetRestoreConnectionW", 2, "lpDevice"}, // LPCWSTR
+	{"WNetUseConnectionA", 1, "hwndOwner"}, // HWND
+	{"WNetUseConnectionA", 2, "lpNetResource"}, // LPNETRESOURCEA
+	{"WNetUseConnectionA", 3, "lpPassword"}, // LPCSTR
+	{"WNetUseConnectionA", 4, "lpUserID"}, // LPCSTR
+	{"WNetUseConnectionA", 5, "dwFlags"}, // DWORD
+	{"WNetUseConnectionA", 6, "lpAccessName"}, // LPSTR
+	{"WNetUseConnectionA", 7, "lpBufferSize"}, // LPDWORD
+	{"WNetUseConnectionA", 8, "lpResult"}, // LPDWORD
+	{"WNetUseConnectionW", 1, "hwndOwner"}, // HWND
+	{"WNetUseConnectionW", 2, "lpNetResource"}, // LPNETRESOURCEW
+	{"WNetUseConnectionW", 3, "lpPassword"}, // LPCWSTR
+	{"WNetUseConnectionW", 4, "lpUserID"}, // LPCWSTR
+	{"WNetUseConnectionW", 5, "dwFlags"}, // DWORD
+	{"WNetUseConnectionW", 6, "lpAccessName"}, // LPWSTR
+	{"WNetUseConnectionW", 7, "lpBufferSize"}, // LPDWORD
+	{"WNetUseConnectionW", 8, "lpResult"}, // LPDWORD
+	{"WSARecvEx", 1, "s"}, // SOCKET
+	{"WSARecvEx", 2, "buf"}, // char *
+	{"WSARecvEx", 3, "len"}, // int
+	{"WSARecvEx", 4, "flags"}, // int *
+	{"WTHelperCertCheckValidSignature", 1, "pProvData"}, // CRYPT_PROVIDER_DATA *
+	{"WTHelperCertIsSelfSigned", 1, "dwEncoding"}, // DWORD
+	{"WTHelperCertIsSelfSigned", 2, "pCert"}, // CERT_INFO *
+	{"WTHelperGetProvCertFromChain", 1, "pSgnr"}, // CRYPT_PROVIDER_SGNR *
+	{"WTHelperGetProvCertFromChain", 2, "idxCert"}, // DWORD
+	{"WTHelperGetProvPrivateDataFromChain", 1, "pProvData"}, // CRYPT_PROVIDER_DATA *
+	{"WTHelperGetProvPrivateDataFromChain", 2, "pgProviderID"}, // GUID *
+	{"WTHelperGetProvSignerFromChain", 1, "pProvData"}, // CRYPT_PROVIDER_DATA *
+	{"WTHelperGetProvSignerFromChain", 2, "idxSigner"}, // DWORD
+	{"WTHelperGetProvSignerFromChain", 3, "fCounterSigner"}, // WINBOOL
+	{"WTHelperGetProvSignerFromChain", 4, "idxCounterSigner"}, // DWORD
+	{"WTHelperProvDataFromStateData", 1, "hStateData"}, // HANDLE
+	{"WaitCommEvent", 1, "hFile"}, // HANDLE
+	{"WaitCommEvent", 2, "lpEvtMask"}, // LPDWORD
+	{"WaitCommEvent", 3, "lpOverlapped"}, // LPOVERLAPPED
+	{"WaitForDebugEvent", 1, "lpDebugEvent"}, // LPDEBUG_EVENT
+	{"WaitForDebugEvent", 2, "dwMilliseconds"}, // DWORD
+	{"WaitForInputIdle", 1, "hProcess"}, // HANDLE
+	{"WaitForInputIdle", 2, "dwMilliseconds"}, // DWORD
+	{"WaitForMultipleObjects", 1, "nCount"}, // DWORD
+	{"WaitForMultipleObjects", 2, "lpHandles"}, // CONST HANDLE *
+	{"WaitForMultipleObjects", 3, "bWaitAll"}, // WINBOOL
+	{"WaitForMultipleObjects", 4, "dwMilliseconds"}, // DWORD
+	{"WaitForMultipleObjectsEx", 1, "nCount"}, // DWORD
+	{"WaitForMultipleObjectsEx", 2, "lpHandles"}, // CONST HANDLE *
+	{"WaitForMultipleObjectsEx", 3, "bWaitAll"}, // WINBOOL
+	{"WaitForMultipleObjectsEx", 4, "dwMilliseconds"}, // DWORD
+	{"WaitForMultipleObjectsEx", 5, "bAlertable"}, // WINBOOL
+	{"WaitForPrinterChange", 1, "hPrinter"}, // HANDLE
+	{"WaitForPrinterChange", 2, "Flags"}, // DWORD
+	{"WaitForSingleObject", 1, "hHandle"}, // HANDLE
+	{"WaitForSingleObject", 2, "dwMilliseconds"}, // DWORD
+	{"WaitForSingleObjectEx", 1, "hHandle"}, // HANDLE
+	{"WaitForSingleObjectEx", 2, "dwMilliseconds"}, // DWORD
+	{"WaitForSingleObjectEx", 3, "bAlertable"}, // WINBOOL
+	{"WaitForThreadpoolIoCallbacks", 1, "pio"}, // PTP_IO
+	{"WaitForThreadpoolIoCallbacks", 2, "fCancelPendingCallbacks"}, // WINBOOL
+	{"WaitForThreadpoolTimerCallbacks", 1, "pti"}, // PTP_TIMER
+	{"WaitForThreadpoolTimerCallbacks", 2, "fCancelPendingCallbacks"}, // WINBOOL
+	{"WaitForThreadpoolWaitCallbacks", 1, "pwa"}, // PTP_WAIT
+	{"WaitForThreadpoolWaitCallbacks", 2, "fCancelPendingCallbacks"}, // WINBOOL
+	{"WaitForThreadpoolWorkCallbacks", 1, "pwk"}, // PTP_WORK
+	{"WaitForThreadpoolWorkCallbacks", 2, "fCancelPendingCallbacks"}, // WINBOOL
+	{"WaitNamedPipeA", 1, "lpNamedPipeName"}, // LPCSTR
+	{"WaitNamedPipeA", 2, "nTimeOut"}, // DWORD
+	{"WaitNamedPipeW", 1, "lpNamedPipeName"}, // LPCWSTR
+	{"WaitNamedPipeW", 2, "nTimeOut"}, // DWORD
+	{"WakeAllConditionVariable", 1, "ConditionVariable"}, // PCONDITION_VARIABLE
+	{"WakeConditionVariable", 1, "ConditionVariable"}, // PCONDITION_VARIABLE
+	{"WideCharToMultiByte", 1, "CodePage"}, // UINT
+	{"WideCharToMultiByte", 2, "dwFlags"}, // DWORD
+	{"WideCharToMultiByte", 3, "lpWideCharStr"}, // LPCWSTR
+	{"WideCharToMultiByte", 4, "cchWideChar"}, // int
+	{"WideCharToMultiByte", 5, "lpMultiByteStr"}, // LPSTR
+	{"WideCharToMultiByte", 6, "cbMultiByte"}, // int
+	{"WideCharToMultiByte", 7, "lpDefaultChar"}, // LPCSTR
+	{"WideCharToMultiByte", 8, "lpUsedDefaultChar"}, // LPBOOL
+	{"WidenPath", 1, "hdc"}, // HDC
+	{"WinExec", 1, "lpCmdLine"}, // LPCSTR
+	{"WinExec", 2, "uCmdShow"}, // UINT
+	{"WinHelpA", 1, "hWndMain"}, // HWND
+	{"WinHelpA", 2, "lpszHelp"}, // LPCSTR
+	{"WinHelpA", 3, "uCommand"}, // UINT
+	{"WinHelpA", 4, "dwData"}, // ULONG_PTR
+	{"WinHelpW", 1, "hWndMain"}, // HWND
+	{"WinHelpW", 2, "lpszHelp"}, // LPCWSTR
+	{"WinHelpW", 3, "uCommand"}, // UINT
+	{"WinHelpW", 4, "dwData"}, // ULONG_PTR
+	{"WinHttpAddRequestHeaders", 1, "hRequest"}, // HINTERNET
+	{"WinHttpAddRequestHeaders", 2, "pwszHeaders"}, // LPCWSTR
+	{"WinHttpAddRequestHeaders", 3, "dwHeadersLength"}, // DWORD
+	{"WinHttpAddRequestHeaders", 4, "dwModifiers"}, // DWORD
+	{"WinHttpCloseHandle", 1, "hInternet"}, // HINTERNET
+	{"WinHttpConnect", 1, "hSession"}, // HINTERNET
+	{"WinHttpConnect", 2, "pswzServerName"}, // LPCWSTR
+	{"WinHttpConnect", 3, "nServerPort"}, // INTERNET_PORT
+	{"WinHttpConnect", 4, "dwReserved"}, // DWORD
+	{"WinHttpCrackUrl", 1, "pwszUrl"}, // LPCWSTR
+	{"WinHttpCrackUrl", 2, "dwUrlLength"}, // DWORD
+	{"WinHttpCrackUrl", 3, "dwFlags"}, // DWORD
+	{"WinHttpCrackUrl", 4, "lpUrlComponents"}, // LPURL_COMPONENTS
+	{"WinHttpCreateUrl", 1, "lpUrlComponents"}, // LPURL_COMPONENTS
+	{"WinHttpCreateUrl", 2, "dwFlags"}, // DWORD
+	{"WinHttpCreateUrl", 3, "pwszUrl"}, // LPWSTR
+	{"WinHttpCreateUrl", 4, "lpdwUrlLength"}, // LPDWORD
+	{"WinHttpDetectAutoProxyConfigUrl", 1, "dwAutoDetectFlags"}, // DWORD
+	{"WinHttpGetDefaultProxyConfiguration", 1, "pProxyInfo"}, // WINHTTP_PROXY_INFO *
+	{"WinHttpGetIEProxyConfigForCurrentUser", 1, "pProxyConfig"}, // WINHTTP_CURRENT_USER_IE_PROXY_CONFIG *
+	{"WinHttpGetProxyForUrl", 1, "hSession"}, // HINTERNET
+	{"WinHttpGetProxyForUrl", 2, "lpcwszUrl"}, // LPCWSTR
+	{"WinHttpGetProxyForUrl", 3, "pAutoProxyOptions"}, // WINHTTP_AUTOPROXY_OPTIONS *
+	{"WinHttpGetProxyForUrl", 4, "pProxyInfo"}, // WINHTTP_PROXY_INFO *
+	{"WinHttpOpen", 1, "pwszUserAgent"}, // LPCWSTR
+	{"WinHttpOpen", 2, "dwAccessType"}, // DWORD
+	{"WinHttpOpen", 3, "pwszProxyName"}, // LPCWSTR
+	{"WinHttpOpen", 4, "pwszProxyBypass"}, // LPCWSTR
+	{"WinHttpOpen", 5, "dwFlags"}, // DWORD
+	{"WinHttpOpenRequest", 1, "hConnect"}, // HINTERNET
+	{"WinHttpOpenRequest", 2, "pwszVerb"}, // LPCWSTR
+	{"WinHttpOpenRequest", 3, "pwszObjectName"}, // LPCWSTR
+	{"WinHttpOpenRequest", 4, "pwszVersion"}, // LPCWSTR
+	{"WinHttpOpenRequest", 5, "pwszReferrer"}, // LPCWSTR
+	{"WinHttpOpenRequest", 6, "ppwszAcceptTypes"}, // LPCWSTR *
+	{"WinHttpOpenRequest", 7, "dwFlags"}, // DWORD
+	// {"WinHttpQueryAuthParams", 1, "?"}, // ?
+	{"WinHttpQueryAuthSchemes", 1, "hRequest"}, // HINTERNET
+	{"WinHttpQueryAuthSchemes", 2, "lpdwSupportedSchemes"}, // LPDWORD
+	{"WinHttpQueryAuthSchemes", 3, "lpdwFirstScheme"}, // LPDWORD
+	{"WinHttpQueryAuthSchemes", 4, "pdwAuthTarget"}, // LPDWORD
+	{"WinHttpQueryDataAvailable", 1, "hRequest"}, // HINTERNET
+	{"WinHttpQueryDataAvailable", 2, "lpdwNumberOfBytesAvailable"}, // LPDWORD
+	{"WinHttpQueryHeaders", 1, "hRequest"}, // HINTERNET
+	{"WinHttpQueryHeaders", 2, "dwInfoLevel"}, // DWORD
+	{"WinHttpQueryHeaders", 3, "pwszName"}, // LPCWSTR
+	{"WinHttpQueryHeaders", 4, "lpBuffer"}, // LPVOID
+	{"WinHttpQueryHeaders", 5, "lpdwBufferLength"}, // LPDWORD
+	{"WinHttpQueryHeaders", 6, "lpdwIndex"}, // LPDWORD
+	{"WinHttpQueryOption", 1, "hInternet"}, // HINTERNET
+	{"WinHttpQueryOption", 2, "dwOption"}, // DWORD
+	{"WinHttpQueryOption", 3, "lpBuffer"}, // LPVOID
+	{"WinHttpQueryOption", 4, "lpdwBufferLength"}, // LPDWORD
+	{"WinHttpReadData", 1, "hRequest"}, // HINTERNET
+	{"WinHttpReadData", 2, "lpBuffer"}, // LPVOID
+	{"WinHttpReadData", 3, "dwNumberOfBytesToRead"}, // DWORD
+	{"WinHttpReadData", 4, "lpdwNumberOfBytesRead"}, // LPDWORD
+	{"WinHttpReceiveResponse", 1, "hRequest"}, // HINTERNET
+	{"WinHttpReceiveResponse", 2, "lpReserved"}, // LPVOID
+	{"WinHttpSendRequest", 1, "hRequest"}, // HINTERNET
+	{"WinHttpSendRequest", 2, "pwszHeaders"}, // LPCWSTR
+	{"WinHttpSendRequest", 3, "dwHeadersLength"}, // DWORD
+	{"WinHttpSendRequest", 4, "lpOptional"}, // LPVOID
+	{"WinHttpSendRequest", 5, "dwOptionalLength"}, // DWORD
+	{"WinHttpSendRequest", 6, "dwTotalLength"}, // DWORD
+	{"WinHttpSendRequest", 7, "dwContext"}, // DWORD_PTR
+	{"WinHttpSetCredentials", 1, "hRequest"}, // HINTERNET
+	{"WinHttpSetCredentials", 2, "AuthTargets"}, // DWORD
+	{"WinHttpSetCredentials", 3, "AuthScheme"}, // DWORD
+	{"WinHttpSetCredentials", 4, "pwszUserName"}, // LPCWSTR
+	{"WinHttpSetCredentials", 5, "pwszPassword"}, // LPCWSTR
+	{"WinHttpSetCredentials", 6, "pAuthParams"}, // LPVOID
+	{"WinHttpSetDefaultProxyConfiguration", 1, "pProxyInfo"}, // WINHTTP_PROXY_INFO *
+	{"WinHttpSetOption", 1, "hInternet"}, // HINTERNET
+	{"WinHttpSetOption", 2, "dwOption"}, // DWORD
+	{"WinHttpSetOption", 3, "lpBuffer"}, // LPVOID
+	{"WinHttpSetOption", 4, "dwBufferLength"}, // DWORD
+	{"WinHttpSetStatusCallback", 1, "hInternet"}, // HINTERNET
+	{"WinHttpSetStatusCallback", 2, "lpfnInternetCallback"}, // WINHTTP_STATUS_CALLBACK
+	{"WinHttpSetStatusCallback", 3, "dwNotificationFlags"}, // DWORD
+	{"WinHttpSetStatusCallback", 4, "dwReserved"}, // DWORD_PTR
+	{"WinHttpSetTimeouts", 1, "hInternet"}, // HINTERNET
+	{"WinHttpSetTimeouts", 2, "dwResolveTimeout"}, // int
+	{"WinHttpSetTimeouts", 3, "dwConnectTimeout"}, // int
+	{"WinHttpSetTimeouts", 4, "dwSendTimeout"}, // int
+	{"WinHttpSetTimeouts", 5, "dwReceiveTimeout"}, // int
+	{"WinHttpTimeFromSystemTime", 1, "LPWSTR"}, // CONST SYSTEMTIME *
+	{"WinHttpTimeToSystemTime", 1, "pwszTime"}, // LPCWSTR
+	{"WinHttpTimeToSystemTime", 2, "pst"}, // SYSTEMTIME *
+	{"WinHttpWriteData", 1, "hRequest"}, // HINTERNET
+	{"WinHttpWriteData", 2, "lpBuffer"}, // LPCVOID
+	{"WinHttpWriteData", 3, "dwNumberOfBytesToWrite"}, // DWORD
+	{"WinHttpWriteData", 4, "lpdwNumberOfBytesWritten"}, // LPDWORD
+	{"WinMain", 1, "hInstance"}, // HINSTANCE
+	{"WinMain", 2, "hPrevInstance"}, // HINSTANCE
+	{"WinMain", 3, "lpCmdLine"}, // LPSTR
+	{"WinMain", 4, "nShowCmd"}, // int
+	{"WinUsb_AbortPipe", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_AbortPipe", 2, "PipeID"}, // UCHAR
+	{"WinUsb_ControlTransfer", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_ControlTransfer", 2, "SetupPacket"}, // WINUSB_SETUP_PACKET
+	{"WinUsb_ControlTransfer", 3, "Buffer"}, // PUCHAR
+	{"WinUsb_ControlTransfer", 4, "BufferLength"}, // ULONG
+	{"WinUsb_ControlTransfer", 5, "LengthTransferred"}, // PULONG
+	{"WinUsb_ControlTransfer", 6, "Overlapped"}, // LPOVERLAPPED
+	{"WinUsb_FlushPipe", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_FlushPipe", 2, "PipeID"}, // UCHAR
+	{"WinUsb_Free", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_GetAssociatedInterface", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_GetAssociatedInterface", 2, "AssociatedInterfaceIndex"}, // UCHAR
+	{"WinUsb_GetAssociatedInterface", 3, "AssociatedInterfaceHandle"}, // PWINUSB_INTERFACE_HANDLE
+	{"WinUsb_GetCurrentAlternateSetting", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_GetCurrentAlternateSetting", 2, "AlternateSetting"}, // PUCHAR
+	{"WinUsb_GetDescriptor", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_GetDescriptor", 2, "DescriptorType"}, // UCHAR
+	{"WinUsb_GetDescriptor", 3, "Index"}, // UCHAR
+	{"WinUsb_GetDescriptor", 4, "LanguageID"}, // USHORT
+	{"WinUsb_GetDescriptor", 5, "Buffer"}, // PUCHAR
+	{"WinUsb_GetDescriptor", 6, "BufferLength"}, // ULONG
+	{"WinUsb_GetDescriptor", 7, "LengthTransferred"}, // PULONG
+	{"WinUsb_GetOverlappedResult", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_GetOverlappedResult", 2, "lpOverlapped"}, // LPOVERLAPPED
+	{"WinUsb_GetOverlappedResult", 3, "lpNumberOfBytesTransferred"}, // LPDWORD
+	{"WinUsb_GetOverlappedResult", 4, "bWait"}, // WINBOOL
+	{"WinUsb_GetPipePolicy", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_GetPipePolicy", 2, "PipeID"}, // UCHAR
+	{"WinUsb_GetPipePolicy", 3, "PolicyType"}, // ULONG
+	{"WinUsb_GetPipePolicy", 4, "ValueLength"}, // PULONG
+	{"WinUsb_GetPipePolicy", 5, "Value"}, // PVOID
+	{"WinUsb_GetPowerPolicy", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_GetPowerPolicy", 2, "PolicyType"}, // ULONG
+	{"WinUsb_GetPowerPolicy", 3, "ValueLength"}, // PULONG
+	{"WinUsb_GetPowerPolicy", 4, "Value"}, // PVOID
+	{"WinUsb_Initialize", 1, "DeviceHandle"}, // HANDLE
+	{"WinUsb_Initialize", 2, "InterfaceHandle"}, // PWINUSB_INTERFACE_HANDLE
+	{"WinUsb_QueryDeviceInformation", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_QueryDeviceInformation", 2, "InformationType"}, // ULONG
+	{"WinUsb_QueryDeviceInformation", 3, "BufferLength"}, // PULONG
+	{"WinUsb_QueryDeviceInformation", 4, "Buffer"}, // PVOID
+	{"WinUsb_QueryInterfaceSettings", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_QueryInterfaceSettings", 2, "AlternateSettingNumber"}, // UCHAR
+	{"WinUsb_QueryInterfaceSettings", 3, "UsbAltInterfaceDescriptor"}, // PUSB_INTERFACE_DESCRIPTOR
+	{"WinUsb_QueryPipe", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_QueryPipe", 2, "AlternateInterfaceNumber"}, // UCHAR
+	{"WinUsb_QueryPipe", 3, "PipeIndex"}, // UCHAR
+	{"WinUsb_QueryPipe", 4, "PipeInformation"}, // PWINUSB_PIPE_INFORMATION
+	{"WinUsb_ReadPipe", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_ReadPipe", 2, "PipeID"}, // UCHAR
+	{"WinUsb_ReadPipe", 3, "Buffer"}, // PUCHAR
+	{"WinUsb_ReadPipe", 4, "BufferLength"}, // ULONG
+	{"WinUsb_ReadPipe", 5, "LengthTransferred"}, // PULONG
+	{"WinUsb_ReadPipe", 6, "Overlapped"}, // LPOVERLAPPED
+	{"WinUsb_ResetPipe", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_ResetPipe", 2, "PipeID"}, // UCHAR
+	{"WinUsb_SetCurrentAlternateInterface", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_SetCurrentAlternateInterface", 2, "AlternateSetting"}, // UCHAR
+	{"WinUsb_SetPipePolicy", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_SetPipePolicy", 2, "PipeID"}, // UCHAR
+	{"WinUsb_SetPipePolicy", 3, "PolicyType"}, // ULONG
+	{"WinUsb_SetPipePolicy", 4, "ValueLength"}, // ULONG
+	{"WinUsb_SetPipePolicy", 5, "Value"}, // PVOID
+	{"WinUsb_SetPowerPolicy", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_SetPowerPolicy", 2, "PolicyType"}, // ULONG
+	{"WinUsb_SetPowerPolicy", 3, "ValueLength"}, // ULONG
+	{"WinUsb_SetPowerPolicy", 4, "Value"}, // PVOID
+	{"WinUsb_WritePipe", 1, "InterfaceHandle"}, // WINUSB_INTERFACE_HANDLE
+	{"WinUsb_WritePipe", 2, "PipeID"}, // UCHAR
+	{"WinUsb_WritePipe", 3, "Buffer"}, // PUCHAR
+	{"WinUsb_WritePipe", 4, "BufferLength"}, // ULONG
+	{"WinUsb_WritePipe", 5, "LengthTransferred"}, // PULONG
+	{"WinUsb_WritePipe", 6, "Overlapped"}, // LPOVERLAPPED
+	{"WinVerifyTrust", 1, "hWnd"}, // HWND
+	{"WinVerifyTrust", 2, "pgActionID"}, // GUID *
+	{"WinVerifyTrust", 3, "pWVTData"}, // LPVOID
+	{"WinVerifyTrustEx", 1, "hWnd"}, // HWND
+	{"WinVerifyTrustEx", 2, "pgActionID"}, // GUID *
+	{"WinVerifyTrustEx", 3, "pWinTrustData"}, // WINTRUST_DATA *
+	{"WindowFromDC", 1, "hDC"}, // HDC
+	{"WindowFromPoint", 1, "Point"}, // POINT
+	{"WintrustAddActionID", 1, "pgActionID"}, // GUID *
+	{"WintrustAddActionID", 2, "fdwFlags"}, // DWORD
+	{"WintrustAddActionID", 3, "psProvInfo"}, // CRYPT_REGISTER_ACTIONID *
+	{"WintrustAddDefaultForUsage", 1, "pszUsageOID"}, // const char *
+	{"WintrustAddDefaultForUsage", 2, "psDefUsage"}, // CRYPT_PROVIDER_REGDEFUSAGE *
+	{"WintrustGetDefaultForUsage", 1, "dwAction"}, // DWORD
+	{"WintrustGetDefaultForUsage", 2, "pszUsageOID"}, // const char *
+	{"WintrustGetDefaultForUsage", 3, "psUsage"}, // CRYPT_PROVIDER_DEFUSAGE *
+	{"WintrustGetRegPolicyFlags", 1, "pdwPolicyFlags"}, // DWORD *
+	{"WintrustLoadFunctionPointers", 1, "pgActionID"}, // GUID *
+	{"WintrustLoadFunctionPointers", 2, "pPfns"}, // CRYPT_PROVIDER_FUNCTIONS *
+	{"WintrustRemoveActionID", 1, "pgActionID"}, // GUID *
+	{"WintrustSetDefaultIncludePEPageHashes", 1, "fIncludePEPageHashes"}, // WINBOOL
+	{"WintrustSetRegPolicyFlags", 1, "dwPolicyFlags"}, // DWORD
+	{"WlxActivateUserShell", 1, "pWlxContext"}, // PVOID
+	{"WlxActivateUserShell", 2, "pszDesktopName"}, // PWSTR
+	{"WlxActivateUserShell", 3, "pszMprLogonScript"}, // PWSTR
+	{"WlxActivateUserShell", 4, "pEnvironment"}, // PVOID
+	{"WlxDisconnectNotify", 1, "pWlxContext"}, // PVOID
+	{"WlxDisplayLockedNotice", 1, "pWlxContext"}, // PVOID
+	{"WlxDisplaySASNotice", 1, "pWlxContext"}, // PVOID
+	{"WlxDisplayStatusMessage", 1, "pWlxContext"}, // PVOID
+	{"WlxDisplayStatusMessage", 2, "hDesktop"}, // HDESK
+	{"WlxDisplayStatusMessage", 3, "dwOptions"}, // DWORD
+	{"WlxDisplayStatusMessage", 4, "pTitle"}, // PWSTR
+	{"WlxDisplayStatusMessage", 5, "pMessage"}, // PWSTR
+	{"WlxGetConsoleSwitchCredentials", 1, "pWlxContext"}, // PVOID
+	{"WlxGetConsoleSwitchCredentials", 2, "pCredInfo"}, // PVOID
+	{"WlxGetStatusMessage", 1, "pWlxContext"}, // PVOID
+	{"WlxGetStatusMessage", 2, "pdwOptions"}, // DWORD *
+	{"WlxGetStatusMessage", 3, "pMessage"}, // PWSTR
+	{"WlxGetStatusMessage", 4, "dwBufferSize"}, // DWORD
+	{"WlxInitialize", 1, "lpWinsta"}, // LPWSTR
+	{"WlxInitialize", 2, "hWlx"}, // HANDLE
+	{"WlxInitialize", 3, "pvReserved"}, // PVOID
+	{"WlxInitialize", 4, "pWinlogonFunctions"}, // PVOID
+	{"WlxInitialize", 5, "pWlxContext"}, // PVOID *
+	{"WlxIsLockOk", 1, "pWlxContext"}, // PVOID
+	{"WlxIsLogoffOk", 1, "pWlxContext"}, // PVOID
+	{"WlxLoggedOnSAS", 1, "pWlxContext"}, // PVOID
+	{"WlxLoggedOnSAS", 2, "dwSasType"}, // DWORD
+	{"WlxLoggedOnSAS", 3, "pReserved"}, // PVOID
+	{"WlxLoggedOutSAS", 1, "pWlxContext"}, // PVOID
+	{"WlxLoggedOutSAS", 2, "dwSasType"}, // DWORD
+	{"WlxLoggedOutSAS", 3, "pAuthenticationId"}, // PLUID
+	{"WlxLoggedOutSAS", 4, "pLogonSid"}, // PSID
+	{"WlxLoggedOutSAS", 5, "pdwOptions"}, // PDWORD
+	{"WlxLoggedOutSAS", 6, "phToken"}, // PHANDLE
+	{"WlxLoggedOutSAS", 7, "pNprNotifyInfo"}, // PWLX_MPR_NOTIFY_INFO
+	{"WlxLoggedOutSAS", 8, "pProfile"}, // PVOID *
+	{"WlxLogoff", 1, "pWlxContext"}, // PVOID
+	{"WlxNegotiate", 1, "dwWinlogonVersion"}, // DWORD
+	{"WlxNegotiate", 2, "pdwDllVersion"}, // PDWORD
+	{"WlxNetworkProviderLoad", 1, "pWlxContext"}, // PVOID
+	{"WlxNetworkProviderLoad", 2, "pNprNotifyInfo"}, // PWLX_MPR_NOTIFY_INFO
+	{"WlxReconnectNotify", 1, "pWlxContext"}, // PVOID
+	{"WlxRemoveStatusMessage", 1, "pWlxContext"}, // PVOID
+	{"WlxScreenSaverNotify", 1, "pWlxContext"}, // PVOID
+	{"WlxScreenSaverNotify", 2, "pSecure"}, // WINBOOL *
+	{"WlxShutdown", 1, "pWlxContext"}, // PVOID
+	{"WlxShutdown", 2, "ShutdownType"}, // DWORD
+	{"WlxStartApplication", 1, "pWlxContext"}, // PVOID
+	{"WlxStartApplication", 2, "pszDesktopName"}, // PWSTR
+	{"WlxStartApplication", 3, "pEnvironment"}, // PVOID
+	{"WlxStartApplication", 4, "pszCmdLine"}, // PWSTR
+	{"WlxWkstaLockedSAS", 1, "pWlxContext"}, // PVOID
+	{"WlxWkstaLockedSAS", 2, "dwSasType"}, // DWORD
+	{"Wow64DisableWow64FsRedirection", 1, "OldValue"}, // PVOID *
+	{"Wow64EnableWow64FsRedirection", 1, "Wow64FsEnableRedirection"}, // BOOLEAN
+	{"Wow64GetThreadContext", 1, "hThread"}, // HANDLE
+	{"Wow64GetThreadContext", 2, "lpContext"}, // PWOW64_CONTEXT
+	{"Wow64RevertWow64FsRedirection", 1, "OlValue"}, // PVOID
+	{"Wow64SetThreadContext", 1, "hThread"}, // HANDLE
+	{"Wow64SetThreadContext", 2, "lpContext"}, // const WOW64_CONTEXT *
+	{"Wow64SuspendThread", 1, "hThread"}, // HANDLE
+	{"Wow64Win32ApiEntry", 1, "dwFuncNumber"}, // DWORD
+	{"Wow64Win32ApiEntry", 2, "dwFlag"}, // DWORD
+	{"Wow64Win32ApiEntry", 3, "dwRes"}, // DWORD
+	{"WriteConsoleA", 1, "hConsoleOutput"}, // HANDLE
+	{"WriteConsoleA", 2, "lpBuffer"}, // CONST VOID *
+	{"WriteConsoleA", 3, "nNumberOfCharsToWrite"}, // DWORD
+	{"WriteConsoleA", 4, "lpNumberOfCharsWritten"}, // LPDWORD
+	{"WriteConsoleA", 5, "lpReserved"}, // LPVOID
+	{"WriteConsoleInputA", 1, "hConsoleInput"}, // HANDLE
+	{"WriteConsoleInputA", 2, "lpBuffer"}, // CONST INPUT_RECORD *
+	{"WriteConsoleInputA", 3, "nLength"}, // DWORD
+	{"WriteConsoleInputA", 4, "lpNumberOfEventsWritten"}, // LPDWORD
+	{"WriteConsoleInputW", 1, "hConsoleInput"}, // HANDLE
+	{"WriteConsoleInputW", 2, "lpBuffer"}, // CONST INPUT_RECORD *
+	{"WriteConsoleInputW", 3, "nLength"}, // DWORD
+	{"WriteConsoleInputW", 4, "lpNumberOfEventsWritten"}, // LPDWORD
+	{"WriteConsoleOutputA", 1, "hConsoleOutput"}, // HANDLE
+	{"WriteConsoleOutputA", 2, "lpBuffer"}, // CONST CHAR_INFO *
+	{"WriteConsoleOutputA", 3, "dwBufferSize"}, // COORD
+	{"WriteConsoleOutputA", 4, "dwBufferCoord"}, // COORD
+	{"WriteConsoleOutputA", 5, "lpWriteRegion"}, // PSMALL_RECT
+	{"WriteConsoleOutputAttribute", 1, "hConsoleOutput"}, // HANDLE
+	{"WriteConsoleOutputAttribute", 2, "lpAttribute"}, // CONST WORD *
+	{"WriteConsoleOutputAttribute", 3, "nLength"}, // DWORD
+	{"WriteConsoleOutputAttribute", 4, "dwWriteCoord"}, // COORD
+	{"WriteConsoleOutputAttribute", 5, "lpNumberOfAttrsWritten"}, // LPDWORD
+	{"WriteConsoleOutputCharacterA", 1, "hConsoleOutput"}, // HANDLE
+	{"WriteConsoleOutputCharacterA", 2, "lpCharacter"}, // LPCSTR
+	{"WriteConsoleOutputCharacterA", 3, "nLength"}, // DWORD
+	{"WriteConsoleOutputCharacterA", 4, "dwWriteCoord"}, // COORD
+	{"WriteConsoleOutputCharacterA", 5, "lpNumberOfCharsWritten"}, // LPDWORD
+	{"WriteConsoleOutputCharacterW", 1, "hConsoleOutput"}, // HANDLE
+	{"WriteConsoleOutputCharacterW", 2, "lpCharacter"}, // LPCWSTR
+	{"WriteConsoleOutputCharacterW", 3, "nLength"}, // DWORD
+	{"WriteConsoleOutputCharacterW", 4, "dwWriteCoord"}, // COORD
+	{"WriteConsoleOutputCharacterW", 5, "lpNumberOfCharsWritten"}, // LPDWORD
+	{"WriteConsoleOutputW", 1, "hConsoleOutput"}, // HANDLE
+	{"WriteConsoleOutputW", 2, "lpBuffer"}, // CONST CHAR_INFO *
+	{"WriteConsoleOutputW", 3, "dwBufferSize"}, // COORD
+	{"WriteConsoleOutputW", 4, "dwBufferCoord"}, // COORD
+	{"WriteConsoleOutputW", 5, "lpWriteRegion"}, // PSMALL_RECT
+	{"WriteConsoleW", 1, "hConsoleOutput"}, // HANDLE
+	{"WriteConsoleW", 2, "lpBuffer"}, // CONST VOID *
+	{"WriteConsoleW", 3, "nNumberOfCharsToWrite"}, // DWORD
+	{"WriteConsoleW", 4, "lpNumberOfCharsWritten"}, // LPDWORD
+	{"WriteConsoleW", 5, "lpReserved"}, // LPVOID
+	{"WriteEncryptedFileRaw", 1, "pfImportCallback"}, // PFE_IMPORT_FUNC
+	{"WriteEncryptedFileRaw", 2, "pvCallbackContext"}, // PVOID
+	{"WriteEncryptedFileRaw", 3, "pvContext"}, // PVOID
+	{"WriteFile", 1, "hFile"}, // HANDLE
+	{"WriteFile", 2, "lpBuffer"}, // LPCVOID
+	{"WriteFile", 3, "nNumberOfBytesToWrite"}, // DWORD
+	{"WriteFile", 4, "lpNumberOfBytesWritten"}, // LPDWORD
+	{"WriteFile", 5, "lpOverlapped"}, // LPOVERLAPPED
+	{"WriteFileEx", 1, "hFile"}, // HANDLE
+	{"WriteFileEx", 2, "lpBuffer"}, // LPCVOID
+	{"WriteFileEx", 3, "nNumberOfBytesToWrite"}, // DWORD
+	{"WriteFileEx", 4, "lpOverlapped"}, // LPOVERLAPPED
+	{"WriteFileEx", 5, "lpCompletionRoutine"}, // LPOVERLAPPED_COMPLETION_ROUTINE
+	{"WriteFileGather", 1, "hFile"}, // HANDLE
+	{"WriteFileGather", 2, "aSegmentArray"}, // FILE_SEGMENT_ELEMENT []
+	{"WriteFileGather", 3, "nNumberOfBytesToWrite"}, // DWORD
+	{"WriteFileGather", 4, "lpReserved"}, // LPDWORD
+	{"WriteFileGather", 5, "lpOverlapped"}, // LPOVERLAPPED
+	{"WritePrinter", 1, "hPrinter"}, // HANDLE
+	{"WritePrinter", 2, "pBuf"}, // LPVOID
+	{"WritePrinter", 3, "cbBuf"}, // DWORD
+	{"WritePrinter", 4, "pcWritten"}, // LPDWORD
+	{"WritePrivateProfileSectionA", 1, "lpAppName"}, // LPCSTR
+	{"WritePrivateProfileSectionA", 2, "lpString"}, // LPCSTR
+	{"WritePrivateProfileSectionA", 3, "lpFileName"}, // LPCSTR
+	{"WritePrivateProfileSectionW", 1, "lpAppName"}, // LPCWSTR
+	{"WritePrivateProfileSectionW", 2, "lpString"}, // LPCWSTR
+	{"WritePrivateProfileSectionW", 3, "lpFileName"}, // LPCWSTR
+	{"WritePrivateProfileStringA", 1, "lpAppName"}, // LPCSTR
+	{"WritePrivateProfileStringA", 2, "lpKeyName"}, // LPCSTR
+	{"WritePrivateProfileStringA", 3, "lpString"}, // LPCSTR
+	{"WritePrivateProfileStringA", 4, "lpFileName"}, // LPCSTR
+	{"WritePrivateProfileStringW", 1, "lpAppName"}, // LPCWSTR
+	{"WritePrivateProfileStringW", 2, "lpKeyName"}, // LPCWSTR
+	{"WritePrivateProfileStringW", 3, "lpString"}, // LPCWSTR
+	{"WritePrivateProfileStringW", 4, "lpFileName"}, // LPCWSTR
+	{"WritePrivateProfileStructA", 1, "lpszSection"}, // LPCSTR
+	{"WritePrivateProfileStructA", 2, "lpszKey"}, // LPCSTR
+	{"WritePrivateProfileStructA", 3, "lpStruct"}, // LPVOID
+	{"WritePrivateProfileStructA", 4, "uSizeStruct"}, // UINT
+	{"WritePrivateProfileStructA", 5, "szFile"}, // LPCSTR
+	{"WritePrivateProfileStructW", 1, "lpszSection"}, // LPCWSTR
+	{"WritePrivateProfileStructW", 2, "lpszKey"}, // LPCWSTR
+	{"WritePrivateProfileStructW", 3, "lpStruct"}, // LPVOID
+	{"WritePrivateProfileStructW", 4, "uSizeStruct"}, // UINT
+	{"WritePrivateProfileStructW", 5, "szFile"}, // LPCWSTR
+	{"WriteProcessMemory", 1, "hProcess"}, // HANDLE
+	{"WriteProcessMemory", 2, "lpBaseAddress"}, // LPVOID
+	{"WriteProcessMemory", 3, "lpBuffer"}, // LPCVOID
+	{"WriteProcessMemory", 4, "nSize"}, // SIZE_T
+	{"WriteProcessMemory", 5, "lpNumberOfBytesWritten"}, // SIZE_T *
+	{"WriteProfileSectionA", 1, "lpAppName"}, // LPCSTR
+	{"WriteProfileSectionA", 2, "lpString"}, // LPCSTR
+	{"WriteProfileSectionW", 1, "lpAppName"}, // LPCWSTR
+	{"WriteProfileSectionW", 2, "lpString"}, // LPCWSTR
+	{"WriteProfileStringA", 1, "lpAppName"}, // LPCSTR
+	{"WriteProfileStringA", 2, "lpKeyName"}, // LPCSTR
+	{"WriteProfileStringA", 3, "lpString"}, // LPCSTR
+	{"WriteProfileStringW", 1, "lpAppName"}, // LPCWSTR
+	{"WriteProfileStringW", 2, "lpKeyName"}, // LPCWSTR
+	{"WriteProfileStringW", 3, "lpString"}, // LPCWSTR
+	{"WriteTapemark", 1, "hDevice"}, // HANDLE
+	{"WriteTapemark", 2, "dwTapemarkType"}, // DWORD
+	{"WriteTapemark", 3, "dwTapemarkCount"}, // DWORD
+	{"WriteTapemark", 4, "bImmediate"}, // WINBOOL
+
+	{"wWinMain", 1, "hInstance"}, // HINSTANCE
+	{"wWinMain", 2, "hPrevInstance"}, // HINSTANCE
+	{"wWinMain", 3, "lpCmdLine"}, // LPWSTR
+	{"wWinMain", 4, "nShowCmd"}, // int
+	{"wglCopyContext", 1, "hglrc"}, // HGLRC
+	{"wglCopyContext", 2, "hglrc"}, // HGLRC
+	{"wglCopyContext", 3, "mask"}, // UINT
+	{"wglCreateContext", 1, "hdc"}, // HDC
+	{"wglCreateLayerContext", 1, "hdc"}, // HDC
+	{"wglCreateLayerContext", 2, "iLayerPlane"}, // int
+	{"wglDeleteContext", 1, "hglrc"}, // HGLRC
+	{"wglDescribeLayerPlane", 1, "hdc"}, // HDC
+	{"wglDescribeLayerPlane", 2, "iPixelFormat"}, // int
+	{"wglDescribeLayerPlane", 3, "iLayerPlane"}, // int
+	{"wglDescribeLayerPlane", 4, "nBytes"}, // UINT
+	{"wglDescribeLayerPlane", 5, "plpd"}, // LPLAYERPLANEDESCRIPTOR
+	{"wglGetLayerPaletteEntries", 1, "hdc"}, // HDC
+	{"wglGetLayerPaletteEntries", 2, "iLayerPlane"}, // int
+	{"wglGetLayerPaletteEntries", 3, "iStart"}, // int
+	{"wglGetLayerPaletteEntries", 4, "cEntries"}, // int
+	{"wglGetLayerPaletteEntries", 5, "pcr"}, // COLORREF *
+	{"wglGetProcAddress", 1, "lpszProc"}, // LPCSTR
+	{"wglMakeCurrent", 1, "hdc"}, // HDC
+	{"wglMakeCurrent", 2, "hglrc"}, // HGLRC
+	{"wglRealizeLayerPalette", 1, "hdc"}, // HDC
+	{"wglRealizeLayerPalette", 2, "iLayerPlane"}, // int
+	{"wglRealizeLayerPalette", 3, "bRealize"}, // WINBOOL
+	{"wglSetLayerPaletteEntries", 1, "hdc"}, // HDC
+	{"wglSetLayerPaletteEntries", 2, "iLayerPlane"}, // int
+	{"wglSetLayerPaletteEntries", 3, "iStart"}, // int
+	{"wglSetLayerPaletteEntries", 4, "cEntries"}, // int
+	{"wglSetLayerPaletteEntries", 5, "pcr"}, // const COLORREF *
+	{"wglShareLists", 1, "hglrc"}, // HGLRC
+	{"wglShareLists", 2, "hglrc"}, // HGLRC
+	{"wglSwapLayerBuffers", 1, "hdc"}, // HDC
+	{"wglSwapLayerBuffers", 2, "fuPlanes"}, // UINT
+	// {"wglSwapMultipleBuffers", 1, "?"}, // ?
+	{"wglUseFontBitmapsA", 1, "hdc"}, // HDC
+	{"wglUseFontBitmapsA", 2, "first"}, // DWORD
+	{"wglUseFontBitmapsA", 3, "count"}, // DWORD
+	{"wglUseFontBitmapsA", 4, "listBase"}, // DWORD
+	{"wglUseFontBitmapsW", 1, "hdc"}, // HDC
+	{"wglUseFontBitmapsW", 2, "first"}, // DWORD
+	{"wglUseFontBitmapsW", 3, "count"}, // DWORD
+	{"wglUseFontBitmapsW", 4, "listBase"}, // DWORD
+	{"wglUseFontOutlinesA", 1, "hdc"}, // HDC
+	{"wglUseFontOutlinesA", 2, "first"}, // DWORD
+	{"wglUseFontOutlinesA", 3, "count"}, // DWORD
+	{"wglUseFontOutlinesA", 4, "listBase"}, // DWORD
+	{"wglUseFontOutlinesA", 5, "deviation"}, // FLOAT
+	{"wglUseFontOutlinesA", 6, "extrusion"}, // FLOAT
+	{"wglUseFontOutlinesA", 7, "format"}, // int
+	{"wglUseFontOutlinesA", 8, "lpgmf"}, // LPGLYPHMETRICSFLOAT
+	{"wglUseFontOutlinesW", 1, "hdc"}, // HDC
+	{"wglUseFontOutlinesW", 2, "first"}, // DWORD
+	{"wglUseFontOutlinesW", 3, "count"}, // DWORD
+	{"wglUseFontOutlinesW", 4, "listBase"}, // DWORD
+	{"wglUseFontOutlinesW", 5, "deviation"}, // FLOAT
+	{"wglUseFontOutlinesW", 6, "extrusion"}, // FLOAT
+	{"wglUseFontOutlinesW", 7, "format"}, // int
+	{"wglUseFontOutlinesW", 8, "lpgmf"}, // LPGLYPHMETRICSFLOAT
+
+	{"wsprintfA", 1, "lpOut"}, // LPSTR
+	{"wsprintfA", 2, "lpFmt"}, // LPCSTR
+	{"wsprintfW", 1, "lpOut"}, // LPWSTR
+	{"wsprintfW", 2, "lpFmt"}, // LPCWSTR
+	{"wvsprintfA", 1, "lpOut"}, // LPSTR
+	{"wvsprintfA", 2, "lpFmt"}, // LPCTSTR
+	{"wvsprintfW", 1, "lpOut"}, // LPWSTR
+	{"wvsprintfW", 2, "lpFmt"}, // LPCWSTR
+};
 
-	ADD_PARAM_NAME("wWinMain", 1, "hInstance"); // HINSTANCE
-	ADD_PARAM_NAME("wWinMain", 2, "hPrevInstance"); // HINSTANCE
-	ADD_PARAM_NAME("wWinMain", 3, "lpCmdLine"); // LPWSTR
-	ADD_PARAM_NAME("wWinMain", 4, "nShowCmd"); // int
-	ADD_PARAM_NAME("wglCopyContext", 1, "hglrc"); // HGLRC
-	ADD_PARAM_NAME("wglCopyContext", 2, "hglrc"); // HGLRC
-	ADD_PARAM_NAME("wglCopyContext", 3, "mask"); // UINT
-	ADD_PARAM_NAME("wglCreateContext", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("wglCreateLayerContext", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("wglCreateLayerContext", 2, "iLayerPlane"); // int
-	ADD_PARAM_NAME("wglDeleteContext", 1, "hglrc"); // HGLRC
-	ADD_PARAM_NAME("wglDescribeLayerPlane", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("wglDescribeLayerPlane", 2, "iPixelFormat"); // int
-	ADD_PARAM_NAME("wglDescribeLayerPlane", 3, "iLayerPlane"); // int
-	ADD_PARAM_NAME("wglDescribeLayerPlane", 4, "nBytes"); // UINT
-	ADD_PARAM_NAME("wglDescribeLayerPlane", 5, "plpd"); // LPLAYERPLANEDESCRIPTOR
-	ADD_PARAM_NAME("wglGetLayerPaletteEntries", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("wglGetLayerPaletteEntries", 2, "iLayerPlane"); // int
-	ADD_PARAM_NAME("wglGetLayerPaletteEntries", 3, "iStart"); // int
-	ADD_PARAM_NAME("wglGetLayerPaletteEntries", 4, "cEntries"); // int
-	ADD_PARAM_NAME("wglGetLayerPaletteEntries", 5, "pcr"); // COLORREF *
-	ADD_PARAM_NAME("wglGetProcAddress", 1, "lpszProc"); // LPCSTR
-	ADD_PARAM_NAME("wglMakeCurrent", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("wglMakeCurrent", 2, "hglrc"); // HGLRC
-	ADD_PARAM_NAME("wglRealizeLayerPalette", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("wglRealizeLayerPalette", 2, "iLayerPlane"); // int
-	ADD_PARAM_NAME("wglRealizeLayerPalette", 3, "bRealize"); // WINBOOL
-	ADD_PARAM_NAME("wglSetLayerPaletteEntries", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("wglSetLayerPaletteEntries", 2, "iLayerPlane"); // int
-	ADD_PARAM_NAME("wglSetLayerPaletteEntries", 3, "iStart"); // int
-	ADD_PARAM_NAME("wglSetLayerPaletteEntries", 4, "cEntries"); // int
-	ADD_PARAM_NAME("wglSetLayerPaletteEntries", 5, "pcr"); // const COLORREF *
-	ADD_PARAM_NAME("wglShareLists", 1, "hglrc"); // HGLRC
-	ADD_PARAM_NAME("wglShareLists", 2, "hglrc"); // HGLRC
-	ADD_PARAM_NAME("wglSwapLayerBuffers", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("wglSwapLayerBuffers", 2, "fuPlanes"); // UINT
-	// ADD_PARAM_NAME("wglSwapMultipleBuffers", 1, "?"); // ?
-	ADD_PARAM_NAME("wglUseFontBitmapsA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("wglUseFontBitmapsA", 2, "first"); // DWORD
-	ADD_PARAM_NAME("wglUseFontBitmapsA", 3, "count"); // DWORD
-	ADD_PARAM_NAME("wglUseFontBitmapsA", 4, "listBase"); // DWORD
-	ADD_PARAM_NAME("wglUseFontBitmapsW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("wglUseFontBitmapsW", 2, "first"); // DWORD
-	ADD_PARAM_NAME("wglUseFontBitmapsW", 3, "count"); // DWORD
-	ADD_PARAM_NAME("wglUseFontBitmapsW", 4, "listBase"); // DWORD
-	ADD_PARAM_NAME("wglUseFontOutlinesA", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("wglUseFontOutlinesA", 2, "first"); // DWORD
-	ADD_PARAM_NAME("wglUseFontOutlinesA", 3, "count"); // DWORD
-	ADD_PARAM_NAME("wglUseFontOutlinesA", 4, "listBase"); // DWORD
-	ADD_PARAM_NAME("wglUseFontOutlinesA", 5, "deviation"); // FLOAT
-	ADD_PARAM_NAME("wglUseFontOutlinesA", 6, "extrusion"); // FLOAT
-	ADD_PARAM_NAME("wglUseFontOutlinesA", 7, "format"); // int
-	ADD_PARAM_NAME("wglUseFontOutlinesA", 8, "lpgmf"); // LPGLYPHMETRICSFLOAT
-	ADD_PARAM_NAME("wglUseFontOutlinesW", 1, "hdc"); // HDC
-	ADD_PARAM_NAME("wglUseFontOutlinesW", 2, "first"); // DWORD
-	ADD_PARAM_NAME("wglUseFontOutlinesW", 3, "count"); // DWORD
-	ADD_PARAM_NAME("wglUseFontOutlinesW", 4, "listBase"); // DWORD
-	ADD_PARAM_NAME("wglUseFontOutlinesW", 5, "deviation"); // FLOAT
-	ADD_PARAM_NAME("wglUseFontOutlinesW", 6, "extrusion"); // FLOAT
-	ADD_PARAM_NAME("wglUseFontOutlinesW", 7, "format"); // int
-	ADD_PARAM_NAME("wglUseFontOutlinesW", 8, "lpgmf"); // LPGLYPHMETRICSFLOAT
+} // anonymous namespace
 
-	ADD_PARAM_NAME("wsprintfA", 1, "lpOut"); // LPSTR
-	ADD_PARAM_NAME("wsprintfA", 2, "lpFmt"); // LPCSTR
-	ADD_PARAM_NAME("wsprintfW", 1, "lpOut"); // LPWSTR
-	ADD_PARAM_NAME("wsprintfW", 2, "lpFmt"); // LPCWSTR
-	ADD_PARAM_NAME("wvsprintfA", 1, "lpOut"); // LPSTR
-	ADD_PARAM_NAME("wvsprintfA", 2, "lpFmt"); // LPCTSTR
-	ADD_PARAM_NAME("wvsprintfW", 1, "lpOut"); // LPWSTR
-	ADD_PARAM_NAME("wvsprintfW", 2, "lpFmt"); // LPCWSTR
+/**
+* @brief Returns a table with info about functions starting with W.
+*/
+const FuncParamNamesTable &getFuncParamNamesTable_W() {
+	static constexpr auto entries = sortEntries(FUNC_PARAM_NAMES);
+	static constexpr FuncParamNamesTable table(entries);
+	return table;
 }
 
 } // namespace win_api
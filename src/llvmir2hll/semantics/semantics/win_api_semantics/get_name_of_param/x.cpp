@@ -11,21 +11,34 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
 /**
-* @brief Initializes the given map with info about functions starting with X.
+* @brief Names of parameters of functions starting with X.
 */
-void initFuncParamNamesMap_X(FuncParamNamesMap &funcParamNamesMap) {
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("XcvDataW", 1, "hXcv"); // HANDLE
-	ADD_PARAM_NAME("XcvDataW", 2, "pszDataName"); // PCWSTR
-	ADD_PARAM_NAME("XcvDataW", 3, "pInputData"); // PBYTE
-	ADD_PARAM_NAME("XcvDataW", 4, "cbInputData"); // DWORD
-	ADD_PARAM_NAME("XcvDataW", 5, "pOutputData"); // PBYTE
-	ADD_PARAM_NAME("XcvDataW", 6, "cbOutputData"); // DWORD
-	ADD_PARAM_NAME("XcvDataW", 7, "pcbOutputNeeded"); // PDWORD
-	ADD_PARAM_NAME("XcvDataW", 8, "pdwStatus"); // PDWORD
+	{"XcvDataW", 1, "hXcv"}, // HANDLE
+	{"XcvDataW", 2, "pszDataName"}, // PCWSTR
+	{"XcvDataW", 3, "pInputData"}, // PBYTE
+	{"XcvDataW", 4, "cbInputData"}, // DWORD
+	{"XcvDataW", 5, "pOutputData"}, // PBYTE
+	{"XcvDataW", 6, "cbOutputData"}, // DWORD
+	{"XcvDataW", 7, "pcbOutputNeeded"}, // PDWORD
+	{"XcvDataW", 8, "pdwStatus"}, // PDWORD
+};
+
+} // anonymous namespace
+
+/**
+* @brief Returns a table with info about functions starting with X.
+*/
+const FuncParamNamesTable &getFuncParamNamesTable_X() {
+	static constexpr auto entries = sortEntries(FUNC_PARAM_NAMES);
+	static constexpr FuncParamNamesTable table(entries);
+	return table;
 }
 
 } // namespace win_api
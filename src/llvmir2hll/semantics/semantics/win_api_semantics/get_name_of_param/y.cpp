@@ -12,12 +12,11 @@ namespace semantics {
 namespace win_api {
 
 /**
-* @brief Initializes the given map with info about functions starting with Y.
+* @brief Returns a table with info about functions starting with Y.
 */
-void initFuncParamNamesMap_Y(FuncParamNamesMap &funcParamNamesMap) {
-	//
-	// windows.h
-	//
+const FuncParamNamesTable &getFuncParamNamesTable_Y() {
+	static constexpr FuncParamNamesTable table;
+	return table;
 }
 
 } // namespace win_api
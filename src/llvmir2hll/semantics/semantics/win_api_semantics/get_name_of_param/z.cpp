@@ -11,14 +11,27 @@ namespace llvmir2hll {
 namespace semantics {
 namespace win_api {
 
+namespace {
+
 /**
-* @brief Initializes the given map with info about functions starting with Z.
+* @brief Names of parameters of functions starting with Z.
 */
-void initFuncParamNamesMap_Z(FuncParamNamesMap &funcParamNamesMap) {
+constexpr FuncParamName FUNC_PARAM_NAMES[] = {
 	//
 	// windows.h
 	//
-	ADD_PARAM_NAME("ZombifyActCtx", 1, "hActCtx"); // HANDLE
+	{"ZombifyActCtx", 1, "hActCtx"}, // HANDLE
+};
+
+} // anonymous namespace
+
+/**
+* @brief Returns a table with info about functions starting with Z.
+*/
+const FuncParamNamesTable &getFuncParamNamesTable_Z() {
+	static constexpr auto entries = sortEntries(FUNC_PARAM_NAMES);
+	static constexpr FuncParamNamesTable table(entries);
+	return table;
 }
 
 } // namespace win_api
@@ -138,7 +138,7 @@ private:
 	/// @name Visitor Interface
 	/// @{
 	using OrderedAllVisitor::visit;
-	virtual void visit(ShPtr<Variable> var) override {
+	virtual void visit(const ShPtr<Variable> &var) override {
 		usedVarsInLastInit.insert(var);
 	}
 	/// @}
@@ -65,6 +65,7 @@ bool ElfImage::load()
 
 	// Fix sizes of BSS segments after we have loaded and sorted everything
 	fixBssSegments();
+	invalidateSegmentIndex();
 
 	return true;
 }
@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <climits>
 #include <cstring>
 
@@ -18,7 +19,7 @@ namespace retdec {
 namespace loader {
 
 Image::Image(const std::shared_ptr<retdec::fileformat::FileFormat>& fileFormat) : _fileFormat(fileFormat), _segments(),
-	_baseAddress(0), _namelessSegNameGen("seg", '0', 4), _statusMessage()
+	_segmentIndex(), _segmentIndexValid(false), _segmentIndexMutex(), _lastSegment(nullptr), _baseAddress(0), _namelessSegNameGen("seg", '0', 4), _statusMessage()
 {
 }
 
@@ -331,18 +332,39 @@ std::pair<const std::uint8_t*, std::uint64_t> Image::getRawSegmentData(std::uint
 bool Image::getXByte(std::uint64_t address, std::uint64_t x, std::uint64_t& res, Endianness e/* = UNKNOWN*/) const
 {
 	const auto *seg = getSegmentFromAddress(address);
-	if (!seg || x * getByteLength() > sizeof(res) * CHAR_BIT)
+	if (!seg || x == 0 || x * getByteLength() > sizeof(res) * CHAR_BIT)
 	{
 		return false;
 	}
 
-	std::vector<std::uint8_t> data;
-	if (!seg->getBytes(data, address - seg->getAddress(), x) || data.size() != x)
+	const auto offset = address - seg->getAddress();
+	if (offset >= seg->getSize() || x > seg->getSize() - offset)
 	{
 		return false;
 	}
 
-	return createValueFromBytes(data, res, e);
+	if (e == Endianness::UNKNOWN)
+	{
+		e = getEndianness();
+		if (e == Endianness::UNKNOWN)
+		{
+			return false;
+		}
+	}
+
+	// Read the value straight from the segment data. Bytes beyond the physical
+	// data of the segment are zeroes, just like in Segment::getBytes().
+	const auto rawData = seg->getRawData();
+	const auto byteLength = getByteLength();
+	res = 0;
+	for (std::uint64_t i = 0; i < x; ++i)
+	{
+		const auto pos = offset + i;
+		const std::uint64_t byte = pos < rawData.second ? rawData.first[pos] : 0;
+		res += byte << (byteLength * (e == Endianness::LITTLE ? i : x - i - 1));
+	}
+
+	return true;
 }
 
 /**
@@ -396,7 +418,15 @@ bool Image::setXBytes(std::uint64_t address, const std::vector<std::uint8_t>& va
 		return false;
 	}
 
-	return seg->setBytes(val, address - seg->getAddress());
+	// Hashes of the file are computed lazily from the original content.
+	const auto offset = address - seg->getAddress();
+	const auto rawData = seg->getRawData();
+	if (_fileFormat && rawData.first && offset < rawData.second)
+	{
+		_fileFormat->keepOriginalBytes(rawData.first + offset, std::min<std::uint64_t>(val.size(), rawData.second - offset));
+	}
+
+	return seg->setBytes(val, offset);
 }
 
 /**
@@ -437,6 +467,7 @@ const retdec::fileformat::LoaderErrorInfo & Image::getLoaderErrorInfo() const
 
 Segment* Image::insertSegment(std::unique_ptr<Segment> segment)
 {
+	invalidateSegmentIndex();
 	_segments.push_back(std::move(segment));
 
 	// We have used move constructor, segment is no longer valid pointer
@@ -448,6 +479,7 @@ Segment* Image::insertSegment(std::unique_ptr<Segment> segment)
 
 void Image::removeSegment(Segment* segment)
 {
+	invalidateSegmentIndex();
 	for (auto itr = _segments.begin(); itr != _segments.end(); ++itr)
 	{
 		if (itr->get() == segment)
@@ -468,12 +500,76 @@ void Image::nameSegment(Segment* segment)
 
 void Image::sortSegments()
 {
+	invalidateSegmentIndex();
 	std::stable_sort(_segments.begin(), _segments.end(), [](const std::unique_ptr<Segment>& seg1, const std::unique_ptr<Segment>& seg2)
 			{
 				return seg1->getAddress() < seg2->getAddress();
 			});
 }
 
+/**
+ * Invalidates the address index of segments. It must be called whenever
+ * an address or a size of some segment changes. Insertion, removal and
+ * sorting of segments invalidate the index on their own.
+ */
+void Image::invalidateSegmentIndex()
+{
+	_lastSegment.store(nullptr, std::memory_order_relaxed);
+	_segmentIndexValid.store(false, std::memory_order_release);
+}
+
+/**
+ * Builds the address index of segments if it is not valid.
+ *
+ * The index contains segments sorted by their addresses together with
+ * the maximal end address of all the preceding segments. Therefore, all
+ * the segments containing an address can be found by binary search and
+ * a short backward walk, which stops right away if segments do not overlap.
+ */
+void Image::_buildSegmentIndex() const
+{
+	if (_segmentIndexValid.load(std::memory_order_acquire))
+		return;
+
+	std::lock_guard<std::mutex> lock(_segmentIndexMutex);
+	if (_segmentIndexValid.load(std::memory_order_relaxed))
+		return;
+
+	_segmentIndex.clear();
+	_segmentIndex.reserve(_segments.size());
+	for (std::size_t i = 0, e = _segments.size(); i < e; ++i)
+	{
+		const auto* seg = _segments[i].get();
+		_segmentIndex.push_back({seg->getAddress(), seg->getEndAddress(), 0, i, seg, false});
+	}
+
+	std::sort(_segmentIndex.begin(), _segmentIndex.end(), [](const SegmentIndexEntry& e1, const SegmentIndexEntry& e2)
+			{
+				return e1.start < e2.start || (e1.start == e2.start && e1.order < e2.order);
+			});
+
+	std::uint64_t maxEnd = 0;
+	for (std::size_t i = 0, e = _segmentIndex.size(); i < e; ++i)
+	{
+		auto& entry = _segmentIndex[i];
+		if (i > 0 && maxEnd > entry.start)
+		{
+			entry.overlapped = true;
+			// Mark all the preceding segments reaching into this one.
+			for (std::size_t j = i; j > 0 && _segmentIndex[j - 1].maxEnd > entry.start; --j)
+			{
+				if (_segmentIndex[j - 1].end > entry.start)
+					_segmentIndex[j - 1].overlapped = true;
+			}
+		}
+
+		maxEnd = std::max(maxEnd, entry.end);
+		entry.maxEnd = maxEnd;
+	}
+
+	_segmentIndexValid.store(true, std::memory_order_release);
+}
+
 const Segment* Image::_getSegment(std::size_t index) const
 {
 	if (index >= getNumberOfSegments())
@@ -506,13 +602,39 @@ const Segment* Image::_getSegmentWithIndex(std::size_t index) const
 
 const Segment* Image::_getSegmentFromAddress(std::uint64_t address) const
 {
-	for (const auto& segment : getSegments())
+	// Consecutive reads mostly go to the same segment.
+	const auto* lastSegment = _lastSegment.load(std::memory_order_relaxed);
+	if (lastSegment && lastSegment->containsAddress(address))
+		return lastSegment;
+
+	_buildSegmentIndex();
+
+	auto itr = std::upper_bound(_segmentIndex.begin(), _segmentIndex.end(), address, [](std::uint64_t addr, const SegmentIndexEntry& entry)
+			{
+				return addr < entry.start;
+			});
+
+	// If segments overlap, return the first one in the list of segments,
+	// just like the plain search through the list would.
+	const SegmentIndexEntry* found = nullptr;
+	while (itr != _segmentIndex.begin())
 	{
-		if (segment->containsAddress(address))
-			return segment.get();
+		--itr;
+		if (itr->maxEnd <= address)
+			break;
+
+		if (address < itr->end && (found == nullptr || itr->order < found->order))
+			found = &*itr;
 	}
 
-	return nullptr;
+	if (found == nullptr)
+		return nullptr;
+
+	// Only segments that are not overlapped can be returned without the search.
+	if (!found->overlapped)
+		_lastSegment.store(found->segment, std::memory_order_relaxed);
+
+	return found->segment;
 }
 
 } // namespace loader
@@ -196,6 +196,94 @@ bool BreakMachOUniversal::extract(
 	return false;
 }
 
+/**
+ * Extract object by iterator into memory
+ * @param it object iterator
+ * @param data extracted object
+ * @return @c true if object was extracted successfully, @c false otherwise
+ */
+bool BreakMachOUniversal::extract(
+		llvm::object::MachOUniversalBinary::object_iterator &it,
+		std::vector<std::uint8_t> &data)
+{
+	auto* start = reinterpret_cast<const std::uint8_t*>(
+			getFileBufferStart() + it->getOffset());
+	data.assign(start, start + it->getSize());
+	return true;
+}
+
+/**
+ * Get archive with best architecture for decompilation
+ * @param res reference for storing result
+ * @return @c true if there is some archive, @c false otherwise
+ */
+bool BreakMachOUniversal::getBestArchive(
+		llvm::object::MachOUniversalBinary::object_iterator &res)
+{
+	if(!file->getNumberOfObjects())
+	{
+		return false;
+	}
+
+	if(getByArchFamily(CPU_TYPE_X86, res)
+			|| getByArchFamily(CPU_TYPE_ARM, res)
+			|| getByArchFamily(CPU_TYPE_POWERPC, res))
+	{
+		return true;
+	}
+
+	// If none of above, just pick first.
+	res = file->begin_objects();
+	return true;
+}
+
+/**
+ * Get archive by architecture family
+ * @param familyName family name
+ * @param res reference for storing result
+ * @return @c true if archive was found, @c false otherwise
+ */
+bool BreakMachOUniversal::getArchiveForFamily(
+		const std::string &familyName,
+		llvm::object::MachOUniversalBinary::object_iterator &res)
+{
+	if(familyName == "x86")
+	{
+		return getByArchFamily(CPU_TYPE_X86, res);
+	}
+	else if(familyName == "arm" || familyName == "thumb")
+	{
+		// Same family
+		return getByArchFamily(CPU_TYPE_ARM, res);
+	}
+	else if(familyName == "powerpc")
+	{
+		return getByArchFamily(CPU_TYPE_POWERPC, res);
+	}
+	else if(familyName == "x86-64")
+	{
+		return getByArchFamily(CPU_TYPE_X86_64, res);
+	}
+	else if(familyName == "arm64")
+	{
+		return getByArchFamily(CPU_TYPE_ARM64, res);
+	}
+	else if(familyName == "powerpc64")
+	{
+		return getByArchFamily(CPU_TYPE_POWERPC64, res);
+	}
+	else if(familyName == "sparc")
+	{
+		return getByArchFamily(CPU_TYPE_SPARC, res);
+	}
+	else if(familyName == "mc98000")
+	{
+		return getByArchFamily(CPU_TYPE_MC98000, res);
+	}
+
+	return false;
+}
+
 /**
  * Get file names of objects stored in archive
  * @param archOffset start of archive in Mach-O Universal Binary
@@ -468,15 +556,24 @@ bool BreakMachOUniversal::extractBestArchive(
 	}
 
 	auto obj = file->begin_objects();
-	if(getByArchFamily(CPU_TYPE_X86, obj)
-			|| getByArchFamily(CPU_TYPE_ARM, obj)
-			|| getByArchFamily(CPU_TYPE_POWERPC, obj))
+	return getBestArchive(obj) && extract(obj, outPath);
+}
+
+/**
+ * Extract archive with best architecture for decompilation into memory
+ * @param data extracted archive
+ * @return @c true if extraction was successful, @c false otherwise
+ */
+bool BreakMachOUniversal::extractBestArchive(
+		std::vector<std::uint8_t> &data)
+{
+	if(!file)
 	{
-		return extract(obj, outPath);
+		return false;
 	}
 
-	// If none of above, just pick first.
-	return extract(obj, outPath);
+	auto obj = file->begin_objects();
+	return getBestArchive(obj) && extract(obj, data);
 }
 
 /**
@@ -522,65 +619,26 @@ bool BreakMachOUniversal::extractArchiveForFamily(
 	}
 
 	auto obj = file->begin_objects();
-	if(familyName == "x86")
-	{
-		if(getByArchFamily(CPU_TYPE_X86, obj))
-		{
-			return extract(obj, outPath);
-		}
-	}
-	else if(familyName == "arm" || familyName == "thumb")
-	{
-		// Same family
-		if(getByArchFamily(CPU_TYPE_ARM, obj))
-		{
-			return extract(obj, outPath);
-		}
-	}
-	else if(familyName == "powerpc")
-	{
-		if(getByArchFamily(CPU_TYPE_POWERPC, obj))
-		{
-			return extract(obj, outPath);
-		}
-	}
-	else if(familyName == "x86-64")
-	{
-		if(getByArchFamily(CPU_TYPE_X86_64, obj))
-		{
-			return extract(obj, outPath);
-		}
-	}
-	else if(familyName == "arm64")
-	{
-		if(getByArchFamily(CPU_TYPE_ARM64, obj))
-		{
-			return extract(obj, outPath);
-		}
-	}
-	else if(familyName == "powerpc64")
-	{
-		if(getByArchFamily(CPU_TYPE_POWERPC64, obj))
-		{
-			return extract(obj, outPath);
-		}
-	}
-	else if(familyName == "sparc")
-	{
-		if(getByArchFamily(CPU_TYPE_SPARC, obj))
-		{
-			return extract(obj, outPath);
-		}
-	}
-	else if(familyName == "mc98000")
+	return getArchiveForFamily(familyName, obj) && extract(obj, outPath);
+}
+
+/**
+ * Extract archive by architecture family into memory
+ * @param familyName family name
+ * @param data extracted archive
+ * @return @c true if extraction was successful, @c false otherwise
+ */
+bool BreakMachOUniversal::extractArchiveForFamily(
+		const std::string &familyName,
+		std::vector<std::uint8_t> &data)
+{
+	if(!file)
 	{
-		if(getByArchFamily(CPU_TYPE_MC98000, obj))
-		{
-			return extract(obj, outPath);
-		}
+		return false;
 	}
 
-	return false;
+	auto obj = file->begin_objects();
+	return getArchiveForFamily(familyName, obj) && extract(obj, data);
 }
 
 /**
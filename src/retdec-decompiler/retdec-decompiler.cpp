@@ -7,7 +7,11 @@
 #include <fstream>
 #include <future>
 #include <chrono>
+#include <iostream>
+#include <mutex>
+#include <optional>
 #include <thread>
+#include <tuple>
 
 #include <llvm/ADT/Triple.h>
 #include <llvm/Analysis/LoopInfo.h>
@@ -35,10 +39,15 @@
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/ToolOutputFile.h>
 #include <llvm/Target/TargetMachine.h>
+#include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 
 #include "retdec/ar-extractor/archive_wrapper.h"
 #include "retdec/ar-extractor/detection.h"
 #include "retdec/config/config.h"
+#include "retdec/cpdetect/cptypes.h"
 #include "retdec/retdec/retdec.h"
 #include "retdec/macho-extractor/break_fat.h"
 #include "retdec/unpackertool/unpackertool.h"
@@ -47,7 +56,9 @@
 #include "retdec/utils/io/log.h"
 #include "retdec/utils/memory.h"
 #include "retdec/utils/string.h"
+#include "retdec/utils/thread_pool.h"
 #include "retdec/utils/version.h"
+#include "retdec/yaracpp/yara_detector.h"
 
 using namespace retdec::utils::io;
 
@@ -77,12 +88,22 @@ class ProgramOptions
 		bool cleanup = false;
 		std::set<std::string> toClean;
 
+		bool server = false;
+		uint64_t serverJobs = 1;
+		/// Options of a single server request: errors must not end the server.
+		bool serverRequest = false;
+
 	public:
 		ProgramOptions(
 				int argc,
 				char *argv[],
 				retdec::config::Config& c,
 				retdec::config::Parameters& p);
+		ProgramOptions(
+				const std::string& name,
+				const std::list<std::string>& args,
+				retdec::config::Config& c,
+				retdec::config::Parameters& p);
 
 		void load();
 
@@ -119,6 +140,23 @@ ProgramOptions::ProgramOptions(
 	}
 }
 
+/**
+ * Options of a single request in the server mode.
+ */
+ProgramOptions::ProgramOptions(
+		const std::string& name,
+		const std::list<std::string>& args,
+		retdec::config::Config& c,
+		retdec::config::Parameters& p)
+		: programName(name)
+		, config(c)
+		, params(p)
+		, _argv(args)
+		, serverRequest(true)
+{
+
+}
+
 void ProgramOptions::load()
 {
 	for (auto i = _argv.begin(); i != _argv.end();)
@@ -161,7 +199,11 @@ void ProgramOptions::load()
 		}
 	}
 
-	afterLoad();
+	// Inputs come with the requests in the server mode.
+	if (!server)
+	{
+		afterLoad();
+	}
 }
 
 void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
@@ -174,6 +216,12 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 	}
 	else if (isParam(i, "", "--version"))
 	{
+		if (serverRequest)
+		{
+			throw std::runtime_error(
+				"[--version] cannot be used in a server request"
+			);
+		}
 		Log::info() << retdec::utils::version::getVersionStringLong() << "\n";
 		exit(EXIT_SUCCESS);
 	}
@@ -275,6 +323,13 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 	}
 	else if (isParam(i, "", "--max-memory"))
 	{
+		// The memory limit is set once for the whole server process.
+		if (serverRequest)
+		{
+			throw std::runtime_error(
+				"[--max-memory] cannot be used in a server request"
+			);
+		}
 		auto val = getParamOrDie(i);
 		try
 		{
@@ -290,6 +345,12 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 	}
 	else if (isParam(i, "", "--no-memory-limit"))
 	{
+		if (serverRequest)
+		{
+			throw std::runtime_error(
+				"[--no-memory-limit] cannot be used in a server request"
+			);
+		}
 		params.setMaxMemoryLimit(0);
 		params.setIsMaxMemoryLimitHalfRam(false);
 	}
@@ -501,6 +562,24 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 		auto file = checkFile(getParamOrDie(i), "[--static-code-sigfile]");
 		params.userStaticSignaturePaths.insert(file);
 	}
+	else if (isParam(i, "", "--yara-cache"))
+	{
+		if (serverRequest)
+		{
+			throw std::runtime_error(
+				"[--yara-cache] cannot be used in a server request"
+			);
+		}
+		auto dir = getParamOrDie(i);
+		if (!fs::is_directory(dir))
+		{
+			throw std::runtime_error(
+				"[--yara-cache] bad directory: " + dir
+			);
+		}
+		retdec::yaracpp::YaraDetector::setCacheDirectory(
+				fs::absolute(dir).string());
+	}
 	else if (isParam(i, "", "--timeout"))
 	{
 		auto t = getParamOrDie(i);
@@ -515,10 +594,55 @@ void ProgramOptions::loadOption(std::list<std::string>::iterator& i)
 			);
 		}
 	}
+	else if (isParam(i, "-j", "--threads"))
+	{
+		auto t = getParamOrDie(i);
+		try
+		{
+			params.setThreads(std::stoull(t));
+		}
+		catch (...)
+		{
+			throw std::runtime_error(
+				"[-j|--threads] invalid number of threads: " + t
+			);
+		}
+	}
 	else if (isParam(i, "-s", "--silent"))
 	{
 		params.setIsVerboseOutput(false);
 	}
+	// Must be before --server, isParam() checks only the prefix.
+	else if (isParam(i, "", "--server-jobs"))
+	{
+		if (serverRequest)
+		{
+			throw std::runtime_error(
+				"[--server-jobs] cannot be used in a server request"
+			);
+		}
+		auto j = getParamOrDie(i);
+		try
+		{
+			serverJobs = std::stoull(j);
+		}
+		catch (...)
+		{
+			throw std::runtime_error(
+				"[--server-jobs] invalid number of jobs: " + j
+			);
+		}
+	}
+	else if (isParam(i, "", "--server"))
+	{
+		if (serverRequest)
+		{
+			throw std::runtime_error(
+				"[--server] cannot be used in a server request"
+			);
+		}
+		server = true;
+	}
 	// Input file is the only argument that does not have -x or --xyz
 	// before it. But only one input is expected.
 	else if (params.getInputFile().empty())
@@ -612,6 +736,11 @@ std::string ProgramOptions::checkFile(
 
 void ProgramOptions::printHelpAndDie()
 {
+	if (serverRequest)
+	{
+		throw std::runtime_error("invalid request arguments, see --help");
+	}
+
 	Log::info() << programName << R"(:
 Mandatory arguments:
 	INPUT_FILE File to decompile.
@@ -642,6 +771,7 @@ Archive decompilation arguments:
 	[--ar-index INDEX] Pick file from archive for decompilation by its zero-based index.
 	[--ar-name NAME] Pick file from archive for decompilation by its name.
 	[--static-code-sigfile FILE] Adds additional signature file for static code detection.
+	[--yara-cache DIR] Stores compiled YARA rules into the given existing directory and reuses them in later runs.
 Backend arguments:
 	[--backend-disabled-opts LIST] Prevents the optimizations from the given comma-separated list of optimizations to be run.
 	[--backend-enabled-opts LIST] Runs only the optimizations from the given comma-separated list of optimizations.
@@ -658,8 +788,27 @@ Backend arguments:
 	[--backend-no-symbolic-names] Disables the conversion of constant arguments to their symbolic names.
 Decompilation process arguments:
 	[--timeout SECONDS]
+	[-j|--threads N] Number of threads used by the analyses that run in parallel (0 = all hardware threads, default: 1):
+	                 reaching definitions, reference solving of static code detection, and backend optimizations
+	                 of single functions. The LLVM passes and the code generation always run on a single thread.
 	[--max-memory MAX_MEMORY] Limits the maximal memory used by the given number of bytes.
 	[--no-memory-limit] Disables the default memory limit (half of system RAM).
+Server arguments:
+	[--server] Do not decompile INPUT_FILE, handle requests read from stdin instead.
+	           Each request is a single line with a JSON object:
+	               {"id": ID, "command": "decompile|disassemble|shutdown", "args": [ARGS], "inline": BOOL}
+	           where ARGS are the arguments described here (including INPUT_FILE) and "inline" returns
+	           the decompiled code in the response instead of writing it to the output file.
+	           Each response is a single line with a JSON object written to stdout:
+	               {"id": ID, "status": "ok|error|timeout|bad_alloc", "exitCode": N, "message": MSG,
+	                "output": CODE, "functions": [...], "phases": [{"name": NAME, "seconds": N}, ...], "seconds": N}
+	           Logs are written to stderr. Other arguments given together with --server are defaults of all
+	           the requests. The memory limit (--max-memory, --no-memory-limit) can be given only together
+	           with --server, it is a limit of the whole server shared by all the requests. A request that
+	           runs out of it is answered with status "bad_alloc". A request with --timeout is stopped after
+	           the pass that runs when the timeout expires. It is answered with status "timeout" only once
+	           it has stopped, until then it keeps its job.
+	[--server-jobs N] Number of requests handled at the same time (0 = all hardware threads, default: 1).
 LLVM IR debug arguments:
 	[--print-after-all] Dump LLVM IR to stderr after every LLVM pass.
 	[--print-before-all] Dump LLVM IR to stderr before every LLVM pass.
@@ -758,41 +907,74 @@ void limitMaximalMemoryIfRequested(const retdec::config::Parameters& params)
 //==============================================================================
 //
 
+using Clock = std::chrono::steady_clock;
+
 /**
- * TODO: this function is exact copy of the function located in retdec/retdec.cpp.
- * The reason for this is that right now creation of correct interface that
- * would hold this function is much more time expensive than hard copy.
- *
- * This function should be located in utils/io/log.{cpp,h}. For that it should
- * now retdec::config::Parameters object. Inclusion of this object would be,
- * however, only possible after linking rapidjson library to the retdec::utils.
- * This is not wanted. Best solution would be making Parameters unaware of
- * rapidjson.
+ * Append the duration of phase @a name started at @a start to @a phaseTimes
+ * (if set).
  */
-void setLogsFrom(const retdec::config::Parameters& params)
+void addPhaseTime(
+		retdec::PhaseTimes* phaseTimes,
+		const std::string& name,
+		Clock::time_point start)
 {
-	auto logFile = params.getLogFile();
-	auto errFile = params.getErrFile();
-	auto verbose = params.isVerboseOutput();
-
-	Logger::Ptr outLog = nullptr;
-
-	outLog.reset(
-		logFile.empty()
-			? new Logger(std::cout, verbose)
-			: new FileLogger(logFile, verbose)
-	);
-
-	Log::set(Log::Type::Info, std::move(outLog));
+	if (phaseTimes)
+	{
+		phaseTimes->emplace_back(
+				name,
+				std::chrono::duration<double>(Clock::now() - start).count()
+		);
+	}
+}
 
-	if (!errFile.empty()) {
-		Log::set(Log::Type::Error, Logger::Ptr(new FileLogger(errFile)));
+/**
+ * Create archive wrapper of the decompiled input -- @a bytes if they are set,
+ * the input file from @a config otherwise.
+ */
+std::unique_ptr<retdec::ar_extractor::ArchiveWrapper> createArchiveWrapper(
+		const retdec::config::Config& config,
+		const std::vector<std::uint8_t>& bytes,
+		bool& ok,
+		std::string& errMsg)
+{
+	if (!bytes.empty())
+	{
+		return std::make_unique<retdec::ar_extractor::ArchiveWrapper>(
+				bytes.data(),
+				bytes.size(),
+				ok,
+				errMsg
+		);
 	}
+	return std::make_unique<retdec::ar_extractor::ArchiveWrapper>(
+			config.parameters.getInputFile(),
+			ok,
+			errMsg
+	);
 }
 
-int decompile(retdec::config::Config& config, ProgramOptions& po)
+/**
+ * Decompile the input given in @a config.
+ * If @a outString is set, the decompiled code is returned in it instead of
+ * being written to the output file. If @a phaseTimes is set, durations of
+ * the decompilation phases are appended to it. If @a cancel is set, the
+ * decompilation is stopped between two passes once it becomes true.
+ *
+ * Files extracted from Mach-O universal binaries and archives are kept in
+ * memory and handed over to the decompilation as they are. The same holds
+ * for the unpacked file and for the input parsed by the unpacker. The input
+ * file in @a config is left unchanged, it always names the original input.
+ */
+int decompile(
+		retdec::config::Config& config,
+		ProgramOptions& po,
+		retdec::PhaseTimes* phaseTimes = nullptr,
+		std::string* outString = nullptr,
+		const retdec::CancelFlag* cancel = nullptr)
 {
-	setLogsFrom(config.parameters);
+	retdec::setLogsFrom(config.parameters);
+
+	retdec::DecompilationInput input;
 
 	// Macho-O extraction.
 	//
@@ -802,14 +984,13 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 	if (fat.isValid())
 	{
 		Log::phase("Mach-O extraction");
-
-		auto extractedFile = po.arExtractPath + "_m";
+		auto start = Clock::now();
 
 		if (config.architecture.isKnown())
 		{
 			if (!fat.extractArchiveForFamily(
 					config.architecture.getName(),
-					extractedFile))
+					input.bytes))
 			{
 				std::stringstream ss;
 				ss << "Invalid --arch option '"
@@ -822,7 +1003,7 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 		}
 		else
 		{
-			if (!fat.extractBestArchive(extractedFile))
+			if (!fat.extractBestArchive(input.bytes))
 			{
 				throw std::runtime_error(
 						"Mach-O extraction: extractBestArchive() failed."
@@ -831,8 +1012,7 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 			}
 		}
 
-		config.parameters.setInputFile(extractedFile);
-		po.toClean.insert(extractedFile);
+		addPhaseTime(phaseTimes, "Mach-O extraction", start);
 	}
 
 	// Archive extraction.
@@ -840,14 +1020,11 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 	if (po.arIdx || !po.arName.empty())
 	{
 		Log::phase("Archive extraction");
+		auto start = Clock::now();
 
 		bool ok = true;
 		std::string errMsg;
-		retdec::ar_extractor::ArchiveWrapper arw(
-				config.parameters.getInputFile(),
-				ok,
-				errMsg
-		);
+		auto arw = createArchiveWrapper(config, input.bytes, ok, errMsg);
 
 		if (!ok)
 		{
@@ -856,9 +1033,10 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 			);
 		}
 
+		std::vector<std::uint8_t> extracted;
 		if (po.arIdx)
 		{
-			if (!arw.extractByIndex(po.arIdx.value(), errMsg, po.arExtractPath))
+			if (!arw->extractByIndex(po.arIdx.value(), errMsg, extracted))
 			{
 				throw std::runtime_error(
 						"failed to extract archive: " + errMsg + "\n"
@@ -866,14 +1044,14 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 						+ std::to_string(po.arIdx.value())
 						+ "' was not found in the input archive."
 						  " Valid indexes are 0-"
-						+ std::to_string(arw.getNumberOfObjects()-1)
+						+ std::to_string(arw->getNumberOfObjects()-1)
 						+ ".\n"
 				);
 			}
 		}
 		else if (!po.arName.empty())
 		{
-			if (!arw.extractByName(po.arName, errMsg, po.arExtractPath))
+			if (!arw->extractByName(po.arName, errMsg, extracted))
 			{
 				throw std::runtime_error(
 						"failed to extract archive: " + errMsg + "\n"
@@ -883,25 +1061,24 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 			}
 		}
 
-		config.parameters.setInputFile(po.arExtractPath);
-		po.toClean.insert(po.arExtractPath);
+		// The wrapper may refer to the bytes, it must not outlive them.
+		arw.reset();
+		input.bytes = std::move(extracted);
+
+		addPhaseTime(phaseTimes, "Archive extraction", start);
 	}
 	else
 	{
 		bool ok = true;
 		std::string errMsg;
-		retdec::ar_extractor::ArchiveWrapper arw(
-				config.parameters.getInputFile(),
-				ok,
-				errMsg
-		);
-		if (ok && arw.isThinArchive())
+		auto arw = createArchiveWrapper(config, input.bytes, ok, errMsg);
+		if (ok && arw->isThinArchive())
 		{
 			Log::error() << "This file is an archive!" << std::endl;
 			Log::error() << "Error: File is a thin archive and cannot be decompiled." << std::endl;
 			return EXIT_FAILURE;
 		}
-		else if (ok && arw.isEmptyArchive())
+		else if (ok && arw->isEmptyArchive())
 		{
 			Log::error() << "This file is an archive!" << std::endl;
 			Log::error() << "Error: The input archive is empty." << std::endl;
@@ -912,14 +1089,20 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 			Log::error() << "This file is an archive!" << std::endl;
 
 			std::string result;
-			if (arw.getPlainTextList(result, errMsg, false, true))
+			if (arw->getPlainTextList(result, errMsg, false, true))
 			{
 				Log::error() << result << std::endl;
 			}
 			return EXIT_FAILURE;
 		}
 
-		if (!ok && retdec::ar_extractor::isArchive(config.parameters.getInputFile()))
+		bool isArchive = input.bytes.empty()
+				? retdec::ar_extractor::isArchive(
+						config.parameters.getInputFile())
+				: retdec::ar_extractor::isArchive(
+						input.bytes.data(),
+						input.bytes.size());
+		if (!ok && isArchive)
 		{
 			Log::error() << "This file is an archive!" << std::endl;
 			Log::error() << "Error: The input archive has invalid format." << std::endl;
@@ -931,29 +1114,53 @@ int decompile(retdec::config::Config& config, ProgramOptions& po)
 	//
 
 	Log::phase("Unpacking");
-	std::vector<std::string> unpackArgs;
-	unpackArgs.push_back("whatever_program_name");
-	unpackArgs.push_back(config.parameters.getInputFile());
-	unpackArgs.push_back("--output");
-	unpackArgs.push_back(config.parameters.getOutputUnpackedFile());
-	char* uargv[4] = {
-			unpackArgs[0].data(),
-			unpackArgs[1].data(),
-			unpackArgs[2].data(),
-			unpackArgs[3].data()
-	};
-	auto unpackCode = retdec::unpackertool::_main(4, uargv);
-	if (unpackCode == 0) // EXIT_CODE_OK
-	{
-		config.parameters.setInputFile(
+	auto unpackStart = Clock::now();
+	retdec::unpackertool::UnpackResult unpacked;
+	{
+		// The unpacker keeps global state, requests of the server must not
+		// run it at the same time.
+		static std::mutex unpackMutex;
+		std::lock_guard<std::mutex> lock(unpackMutex);
+		// The extracted input is written only if some plugin needs it, never
+		// over the original input file.
+		unpacked = retdec::unpackertool::unpack(
+				input.bytes.empty()
+						? config.parameters.getInputFile()
+						: po.arExtractPath,
+				input.bytes.empty() ? nullptr : &input.bytes,
 				config.parameters.getOutputUnpackedFile()
 		);
+	}
+	if (unpacked.code == retdec::unpackertool::EXIT_CODE_OK)
+	{
 		po.toClean.insert(config.parameters.getOutputUnpackedFile());
+		input.bytes = std::move(unpacked.unpacked);
+	}
+	else if (unpacked.input && !config.fileFormat.isRaw())
+	{
+		// The input was parsed by the unpacker, it may refer to input.bytes.
+		// Raw inputs are not parsed in the same way by the decompilation.
+		input.fileFormat = std::move(unpacked.input);
+		if (unpacked.inputToolsStatus == retdec::cpdetect::ReturnCode::OK)
+		{
+			input.tools = std::move(unpacked.inputTools);
+		}
+		else
+		{
+			input.tools = std::make_shared<retdec::cpdetect::ToolInformation>();
+		}
 	}
+	addPhaseTime(phaseTimes, "Unpacking", unpackStart);
 
 	// Decompilation.
 	//
-	return retdec::decompile(config);
+	return retdec::decompile(
+			config,
+			outString,
+			phaseTimes,
+			input.bytes.empty() && !input.fileFormat ? nullptr : &input,
+			cancel
+	);
 }
 
 //
@@ -975,6 +1182,435 @@ void cleanup(ProgramOptions& po)
 	}
 }
 
+//
+//==============================================================================
+// Server.
+//==============================================================================
+//
+
+/**
+ * A single request of the decompilation server.
+ * It is shared with the thread running the request.
+ */
+struct ServerRequest
+{
+	explicit ServerRequest(const retdec::config::Config& base)
+			: config(base)
+	{
+
+	}
+
+	std::string command;
+	bool inlineOutput = false;
+	retdec::config::Config config;
+	std::unique_ptr<ProgramOptions> po;
+
+	retdec::PhaseTimes phaseTimes;
+	std::string output;
+	retdec::common::FunctionSet functions;
+
+	/// Set when the timeout of the request expires, the request stops
+	/// between two passes.
+	retdec::CancelFlag cancel{false};
+};
+
+/**
+ * Run the given request.
+ */
+int runServerRequest(ServerRequest& r)
+{
+	int ret = EXIT_SUCCESS;
+	try
+	{
+		if (r.command == "decompile")
+		{
+			ret = decompile(
+					r.config,
+					*r.po,
+					&r.phaseTimes,
+					r.inlineOutput ? &r.output : nullptr,
+					&r.cancel
+			);
+		}
+		else
+		{
+			retdec::setLogsFrom(r.config.parameters);
+			auto start = Clock::now();
+			retdec::disassemble(
+					r.config.parameters.getInputFile(),
+					&r.functions,
+					&r.cancel
+			);
+			addPhaseTime(&r.phaseTimes, "Disassembling", start);
+		}
+	}
+	catch (...)
+	{
+		cleanup(*r.po);
+		throw;
+	}
+
+	cleanup(*r.po);
+	return ret;
+}
+
+/**
+ * @return ID of the given @a request, @c null if it has none.
+ */
+const rapidjson::Value& getRequestId(const rapidjson::Value& request)
+{
+	static const rapidjson::Value noId;
+	return request.IsObject() && request.HasMember("id")
+			? request["id"]
+			: noId;
+}
+
+/**
+ * Decompilation server.
+ *
+ * Requests are read line by line from an input stream, each line holds one
+ * JSON request. All the requests share everything that is loaded only once
+ * per process (registered passes, the base config, ...). Each request is
+ * answered by a single line with a JSON response. Responses of requests
+ * handled at the same time may be written in any order, the request ID is
+ * copied to the response.
+ */
+class Server
+{
+	public:
+		Server(
+				const retdec::config::Config& base,
+				const ProgramOptions& po,
+				std::ostream& out);
+
+		int run(std::istream& in);
+
+	private:
+		void handle(const rapidjson::Value& request);
+		void respond(
+				const rapidjson::Value& id,
+				const std::string& status,
+				int exitCode,
+				const std::string& message,
+				Clock::time_point start,
+				const ServerRequest* r = nullptr);
+
+	private:
+		const retdec::config::Config& _base;
+		std::string _programName;
+		uint64_t _jobs = 1;
+
+		std::ostream& _out;
+		std::mutex _outMutex;
+};
+
+Server::Server(
+		const retdec::config::Config& base,
+		const ProgramOptions& po,
+		std::ostream& out)
+		: _base(base)
+		, _programName(po.programName)
+		, _jobs(po.serverJobs)
+		, _out(out)
+{
+
+}
+
+/**
+ * Handle requests from @a in until its end or until a shutdown request.
+ */
+int Server::run(std::istream& in)
+{
+	std::shared_ptr<rapidjson::Document> shutdown;
+
+	{
+		retdec::utils::ThreadPool pool(_jobs);
+
+		std::string line;
+		while (std::getline(in, line))
+		{
+			if (line.find_first_not_of(" \t\r") == std::string::npos)
+			{
+				continue;
+			}
+
+			auto request = std::make_shared<rapidjson::Document>();
+			request->Parse(line.c_str());
+			if (request->HasParseError())
+			{
+				respond(
+						rapidjson::Value(),
+						"error",
+						EXIT_FAILURE,
+						std::string("invalid request: ")
+								+ rapidjson::GetParseError_En(
+										request->GetParseError()),
+						Clock::now()
+				);
+				continue;
+			}
+
+			if (request->IsObject()
+					&& request->HasMember("command")
+					&& (*request)["command"] == "shutdown")
+			{
+				shutdown = request;
+				break;
+			}
+
+			pool.submit([this, request]() { handle(*request); });
+		}
+
+		// Requests in progress are finished before the pool is destroyed.
+		pool.wait();
+	}
+
+	if (shutdown)
+	{
+		respond(
+				getRequestId(*shutdown),
+				"ok",
+				EXIT_SUCCESS,
+				std::string(),
+				Clock::now()
+		);
+	}
+
+	return EXIT_SUCCESS;
+}
+
+/**
+ * Handle a single (decompile or disassemble) @a request.
+ * All errors are reported in the response, none of them ends the server.
+ */
+void Server::handle(const rapidjson::Value& request)
+{
+	auto start = Clock::now();
+
+	auto& id = getRequestId(request);
+
+	auto r = std::make_shared<ServerRequest>(_base);
+	std::list<std::string> args;
+
+	// Check the request.
+	//
+	std::string error;
+	if (!request.IsObject())
+	{
+		error = "request is not an object";
+	}
+	else if (!request.HasMember("command") || !request["command"].IsString())
+	{
+		error = "missing command";
+	}
+	else if ((r->command = request["command"].GetString()) != "decompile"
+			&& r->command != "disassemble")
+	{
+		error = "unknown command: " + r->command;
+	}
+	else if (request.HasMember("inline") && !request["inline"].IsBool())
+	{
+		error = "inline is not a bool";
+	}
+	else if (!request.HasMember("args") || !request["args"].IsArray())
+	{
+		error = "missing args";
+	}
+	else
+	{
+		r->inlineOutput = request.HasMember("inline")
+				&& request["inline"].GetBool();
+
+		for (auto& a : request["args"].GetArray())
+		{
+			if (!a.IsString())
+			{
+				error = "args must be strings";
+				break;
+			}
+			args.push_back(a.GetString());
+		}
+	}
+	if (!error.empty())
+	{
+		respond(id, "error", EXIT_FAILURE, "invalid request: " + error, start);
+		return;
+	}
+
+	// Parse the request arguments on top of the base config.
+	//
+	r->po = std::make_unique<ProgramOptions>(
+			_programName,
+			args,
+			r->config,
+			r->config.parameters
+	);
+	try
+	{
+		r->po->load();
+	}
+	catch (const std::runtime_error& e)
+	{
+		respond(id, "error", EXIT_FAILURE, e.what(), start);
+		return;
+	}
+
+	// Run the request.
+	// A request with a timeout runs in its own thread watched by this one.
+	// When the timeout expires, the request is cancelled, and it is answered
+	// only after its thread stops. Until then, it keeps its job.
+	//
+	int ret = EXIT_SUCCESS;
+	try
+	{
+		auto& params = r->config.parameters;
+		if (params.isTimeout())
+		{
+			std::packaged_task<int()> task([r]() {
+				return runServerRequest(*r);
+			});
+			auto future = task.get_future();
+			std::thread thr(std::move(task));
+
+			auto timeout = std::chrono::seconds(params.getTimeout());
+			if (future.wait_until(start + timeout)
+					== std::future_status::timeout)
+			{
+				r->cancel = true;
+				thr.join();
+				respond(
+						id,
+						"timeout",
+						EXIT_TIMEOUT,
+						"timeout after: "
+								+ std::to_string(params.getTimeout())
+								+ " seconds",
+						start
+				);
+				return;
+			}
+
+			thr.join();
+			ret = future.get(); // this will propagate exception
+		}
+		else
+		{
+			ret = runServerRequest(*r);
+		}
+	}
+	catch (const std::bad_alloc& e)
+	{
+		respond(id, "bad_alloc", EXIT_BAD_ALLOC, "catched std::bad_alloc", start);
+		return;
+	}
+	catch (const std::exception& e)
+	{
+		respond(id, "error", EXIT_FAILURE, e.what(), start);
+		return;
+	}
+
+	respond(
+			id,
+			ret == EXIT_SUCCESS ? "ok" : "error",
+			ret,
+			std::string(),
+			start,
+			r.get()
+	);
+}
+
+/**
+ * Write a response to the request with the given @a id.
+ * Results are included only if the finished request @a r is given.
+ */
+void Server::respond(
+		const rapidjson::Value& id,
+		const std::string& status,
+		int exitCode,
+		const std::string& message,
+		Clock::time_point start,
+		const ServerRequest* r)
+{
+	rapidjson::StringBuffer buffer;
+	rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+	writer.StartObject();
+	writer.Key("id");
+	id.Accept(writer);
+	writer.Key("status");
+	writer.String(status.c_str(), status.size());
+	writer.Key("exitCode");
+	writer.Int(exitCode);
+	if (!message.empty())
+	{
+		writer.Key("message");
+		writer.String(message.c_str(), message.size());
+	}
+	if (r)
+	{
+		if (r->inlineOutput && r->command == "decompile")
+		{
+			writer.Key("output");
+			writer.String(r->output.c_str(), r->output.size());
+		}
+		if (r->command == "disassemble")
+		{
+			writer.Key("functions");
+			writer.StartArray();
+			for (auto& f : r->functions)
+			{
+				auto s = f.getStart().toHexPrefixString();
+				auto e = f.getEnd().toHexPrefixString();
+				writer.StartObject();
+				writer.Key("name");
+				writer.String(f.getName().c_str(), f.getName().size());
+				writer.Key("start");
+				writer.String(s.c_str(), s.size());
+				writer.Key("end");
+				writer.String(e.c_str(), e.size());
+				writer.EndObject();
+			}
+			writer.EndArray();
+		}
+		writer.Key("phases");
+		writer.StartArray();
+		for (auto& p : r->phaseTimes)
+		{
+			writer.StartObject();
+			writer.Key("name");
+			writer.String(p.first.c_str(), p.first.size());
+			writer.Key("seconds");
+			writer.Double(p.second);
+			writer.EndObject();
+		}
+		writer.EndArray();
+	}
+	writer.Key("seconds");
+	writer.Double(std::chrono::duration<double>(Clock::now() - start).count());
+	writer.EndObject();
+
+	std::lock_guard<std::mutex> lock(_outMutex);
+	_out << buffer.GetString() << std::endl;
+}
+
+/**
+ * Run the decompilation server with the given @a base config on stdin and
+ * stdout.
+ */
+int runServer(const retdec::config::Config& base, const ProgramOptions& po)
+{
+	// Only responses are written to stdout. Everything else that would be
+	// written there (logs) is redirected to stderr.
+	std::ostream out(std::cout.rdbuf());
+	auto* coutBuffer = std::cout.rdbuf(std::cerr.rdbuf());
+
+	Server server(base, po, out);
+	auto ret = server.run(std::cin);
+
+	std::cout.rdbuf(coutBuffer);
+	return ret;
+}
+
 //
 //==============================================================================
 // Main.
@@ -1021,6 +1657,12 @@ int main(int argc, char **argv)
 	//
 	limitMaximalMemoryIfRequested(config.parameters);
 
+	// Handle requests instead of a single decompilation.
+	//
+	if (po.server)
+	{
+		return runServer(config, po);
+	}
 
 	// Decompile.
 	//
@@ -1030,11 +1672,11 @@ int main(int argc, char **argv)
 		std::stringstream buffer;
 		if (config.parameters.isTimeout())
 		{
-			std::packaged_task<
-					int(retdec::config::Config&,
-					ProgramOptions&)> task(decompile);
+			std::packaged_task<int()> task([&config, &po]() {
+				return decompile(config, po);
+			});
 			auto future = task.get_future();
-			std::thread thr(std::move(task), std::ref(config), std::ref(po));
+			std::thread thr(std::move(task));
 			auto timeout = std::chrono::seconds(config.parameters.getTimeout());
 			if (future.wait_for(timeout) != std::future_status::timeout)
 			{
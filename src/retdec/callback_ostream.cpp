@@ -0,0 +1,43 @@
+/**
+ * \file src/retdec/callback_ostream.cpp
+ * \brief Output stream that hands the written data to a callback.
+ * \copyright (c) 2019 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+
+#include "retdec/retdec/callback_ostream.h"
+
+namespace retdec {
+
+CallbackOstream::CallbackOstream(const OutputCallback& callback)
+		: _callback(callback)
+{
+	SetBufferSize(BufferSize);
+}
+
+CallbackOstream::~CallbackOstream()
+{
+	flush();
+}
+
+void CallbackOstream::write_impl(const char* ptr, std::size_t size)
+{
+	// raw_ostream passes writes larger than the buffer straight through, so
+	// they have to be split here.
+	while (size > 0)
+	{
+		auto chunk = std::min(size, BufferSize);
+		_callback(ptr, chunk);
+		_pos += chunk;
+		ptr += chunk;
+		size -= chunk;
+	}
+}
+
+uint64_t CallbackOstream::current_pos() const
+{
+	return _pos;
+}
+
+} // namespace retdec
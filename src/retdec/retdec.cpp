@@ -4,6 +4,11 @@
  * @copyright (c) 2019 Avast Software, licensed under the MIT license
  */
 
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <tuple>
+
 #include <llvm/ADT/Triple.h>
 #include <llvm/Analysis/CallGraph.h>
 #include <llvm/Analysis/CallGraphSCCPass.h>
@@ -44,10 +49,14 @@
 #include "retdec/bin2llvmir/optimizations/provider_init/provider_init.h"
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
 #include "retdec/bin2llvmir/providers/config.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 
 #include "retdec/llvmir2hll/llvmir2hll.h"
 
 #include "retdec/config/config.h"
+#include "retdec/cpdetect/cptypes.h"
+#include "retdec/fileformat/format_factory.h"
+#include "retdec/retdec/callback_ostream.h"
 #include "retdec/retdec/retdec.h"
 #include "retdec/utils/memory.h"
 #include "retdec/utils/io/log.h"
@@ -92,6 +101,15 @@ std::unique_ptr<llvm::Module> createLlvmModule(llvm::LLVMContext& Context)
 
 namespace retdec {
 
+LlvmModuleContextPair::~LlvmModuleContextPair()
+{
+	// Order matters: provider data refer to module, module destructor uses
+	// context.
+	bin2llvmir::ProviderContext::release(module.get());
+	module.reset();
+	context.reset();
+}
+
 common::BasicBlock fillBasicBlock(
 		bin2llvmir::Config* config,
 		llvm::BasicBlock& bb,
@@ -300,7 +318,8 @@ void fillFunctions(
 
 LlvmModuleContextPair disassemble(
 		const std::string& inputPath,
-		retdec::common::FunctionSet* fs)
+		retdec::common::FunctionSet* fs,
+		const CancelFlag* cancel)
 {
 	auto context = std::make_unique<llvm::LLVMContext>();
 	auto module = createLlvmModule(*context);
@@ -308,16 +327,34 @@ LlvmModuleContextPair disassemble(
 	config::Config c;
 	c.parameters.setInputFile(inputPath);
 
-	// Create a PassManager to hold and optimize the collection of passes we
-	// are about to build.
-	llvm::legacy::PassManager pm;
-
-	pm.add(new bin2llvmir::ProviderInitialization(&c));
-	pm.add(new bin2llvmir::Decoder());
+	auto checkCancel = [cancel]()
+	{
+		if (cancel && *cancel)
+		{
+			throw std::runtime_error("disassembly cancelled");
+		}
+	};
 
-	// Now that we have all of the passes ready, run them.
-	pm.run(*module);
+	// Each pass gets its own PassManager, so that the disassembly can be
+	// stopped between them.
+	checkCancel();
+	{
+		llvm::legacy::PassManager pm;
+		pm.add(new bin2llvmir::ProviderInitialization(&c));
+		pm.run(*module);
+	}
+	checkCancel();
+	{
+		llvm::legacy::PassManager pm;
+		pm.add(new bin2llvmir::Decoder());
+		pm.run(*module);
+	}
+	checkCancel();
 
+	// Basic blocks of the returned functions point to Capstone instructions
+	// of the module, so none of them may be dropped from the store's cache.
+	bin2llvmir::AsmInstruction::getCapstoneInsnStore(module.get())
+			.setCacheSize(0);
 	fillFunctions(*module, fs);
 
 	return LlvmModuleContextPair{std::move(module), std::move(context)};
@@ -334,16 +371,98 @@ llvm::PassRegistry& initializeLlvmPasses()
 {
 	// Initialize passes
 	llvm::PassRegistry& Registry = *llvm::PassRegistry::getPassRegistry();
-	initializeCore(Registry);
-	initializeScalarOpts(Registry);
-	initializeIPO(Registry);
-	initializeAnalysis(Registry);
-	initializeTransformUtils(Registry);
-	initializeInstCombine(Registry);
-	initializeTarget(Registry);
+
+	// The registry is process-wide, it is enough to initialize it once.
+	static std::once_flag initialized;
+	std::call_once(initialized, [&Registry]()
+	{
+		initializeCore(Registry);
+		initializeScalarOpts(Registry);
+		initializeIPO(Registry);
+		initializeAnalysis(Registry);
+		initializeTransformUtils(Registry);
+		initializeInstCombine(Registry);
+		initializeTarget(Registry);
+	});
 	return Registry;
 }
 
+/**
+ * Measures durations of decompilation phases and tells when the decompilation
+ * must stop because its timeout expired or because it was cancelled.
+ */
+class PhaseMonitor
+{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+	public:
+		PhaseMonitor(
+				const retdec::config::Parameters& params,
+				PhaseTimes* phaseTimes,
+				const CancelFlag* cancel)
+				: Times(phaseTimes)
+				, Cancel(cancel)
+				, Timeout(params.getTimeout())
+				, Start(Clock::now())
+				, PhaseStart(Start)
+		{
+
+		}
+
+		/**
+		 * Throw if the decompilation must stop. It is called between passes,
+		 * never from inside of a pass manager.
+		 */
+		void check() const
+		{
+			if (Cancel && *Cancel)
+			{
+				throw std::runtime_error("decompilation cancelled");
+			}
+			if (Timeout > 0 && Clock::now() - Start > std::chrono::seconds(Timeout))
+			{
+				throw std::runtime_error(
+						"timeout after: " + std::to_string(Timeout) + " seconds"
+				);
+			}
+		}
+
+		/**
+		 * Finish the current phase (if any) and start a new one.
+		 */
+		void startPhase(const std::string& name)
+		{
+			finish();
+			Phase = name;
+		}
+
+		/**
+		 * Finish the current phase (if any).
+		 */
+		void finish()
+		{
+			auto now = Clock::now();
+			if (Times && !Phase.empty())
+			{
+				Times->emplace_back(
+						Phase,
+						std::chrono::duration<double>(now - PhaseStart).count()
+				);
+			}
+			Phase.clear();
+			PhaseStart = now;
+		}
+
+	private:
+		PhaseTimes* Times = nullptr;
+		const CancelFlag* Cancel = nullptr;
+		uint64_t Timeout = 0;
+		Clock::time_point Start;
+		std::string Phase;
+		Clock::time_point PhaseStart;
+};
+
 /**
  * This pass just prints phase information about other, subsequent passes.
  * In pass manager, tt should be placed right before the pass which phase info
@@ -356,18 +475,22 @@ class ModulePassPrinter : public ModulePass
 		std::string PhaseName;
 		std::string PhaseArg;
 		std::string PassName;
+		PhaseMonitor* Monitor = nullptr;
 
-		static std::string LastPhase;
+		// Each decompilation runs its passes in a single thread.
+		static thread_local std::string LastPhase;
 		inline static const std::string LlvmAggregatePhaseName = "LLVM";
 
 	public:
 		ModulePassPrinter(
 				const std::string& phaseName,
-				const std::string& phaseArg)
+				const std::string& phaseArg,
+				PhaseMonitor* monitor = nullptr)
 				: ModulePass(ID)
 				, PhaseName(phaseName)
 				, PhaseArg(phaseArg)
 				, PassName("ModulePass Printer: " + PhaseName)
+				, Monitor(monitor)
 		{
 
 		}
@@ -378,6 +501,10 @@ class ModulePassPrinter : public ModulePass
 			{
 				Log::phase(PhaseName);
 				LastPhase = PhaseArg;
+				if (Monitor)
+				{
+					Monitor->startPhase(PhaseName);
+				}
 			}
 			else
 			{
@@ -386,6 +513,10 @@ class ModulePassPrinter : public ModulePass
 				{
 					Log::phase(LlvmAggregatePhaseName);
 					LastPhase = LlvmAggregatePhaseName;
+					if (Monitor)
+					{
+						Monitor->startPhase(LlvmAggregatePhaseName);
+					}
 				}
 
 				// print all
@@ -406,7 +537,7 @@ class ModulePassPrinter : public ModulePass
 		}
 };
 char ModulePassPrinter::ID = 0;
-std::string ModulePassPrinter::LastPhase;
+thread_local std::string ModulePassPrinter::LastPhase;
 
 /**
  * Add the pass to the pass manager - no verification.
@@ -414,11 +545,13 @@ std::string ModulePassPrinter::LastPhase;
 static inline void addPass(
 		legacy::PassManagerBase& PM,
 		Pass* P,
-		const PassInfo* PI)
+		const PassInfo* PI,
+		PhaseMonitor* monitor = nullptr)
 {
 	PM.add(new ModulePassPrinter(
 			PI->getPassName().str(),
-			PI->getPassArgument().str()
+			PI->getPassArgument().str(),
+			monitor
 	));
 	PM.add(P);
 
@@ -431,20 +564,22 @@ static inline void addPass(
 }
 
 
-/**
- * TODO: this function has exact copy located in retdec-decompiler.cpp.
- * The reason for this is that right now creation of correct interface that
- * would hold this function is much more time expensive than hard copy.
- *
- * Before merging these two methods (providing them suitable interface)
- * each change in one of them must be reflected to both.
- */
 void setLogsFrom(const retdec::config::Parameters& params)
 {
 	auto logFile = params.getLogFile();
 	auto errFile = params.getErrFile();
 	auto verbose = params.isVerboseOutput();
 
+	static std::mutex logsMutex;
+	static std::optional<std::tuple<std::string, std::string, bool>> lastLogs;
+	std::lock_guard<std::mutex> lock(logsMutex);
+	auto logs = std::make_tuple(logFile, errFile, verbose);
+	if (lastLogs == logs)
+	{
+		return;
+	}
+	lastLogs = logs;
+
 	Logger::Ptr outLog = nullptr;
 
 	outLog.reset(
@@ -460,22 +595,54 @@ void setLogsFrom(const retdec::config::Parameters& params)
 	}
 }
 
-bool decompile(retdec::config::Config& config, std::string* outString)
+/**
+ * Run a decompilation according to \p config. If \p out is set, the output is
+ * written into it instead of the output file from \p config. If \p input is
+ * set, it is decompiled instead of the input file from \p config.
+ */
+static bool runDecompilation(
+		retdec::config::Config& config,
+		llvm::raw_ostream* out,
+		PhaseTimes* phaseTimes,
+		const DecompilationInput* input,
+		const CancelFlag* cancel)
 {
 	setLogsFrom(config.parameters);
 
+	PhaseMonitor monitor(config.parameters, phaseTimes, cancel);
+
 	Log::phase("Initialization");
+	monitor.startPhase("Initialization");
 	auto& passRegistry = initializeLlvmPasses();
 
+	std::shared_ptr<fileformat::FileFormat> inputFormat;
+	std::shared_ptr<const cpdetect::ToolInformation> inputTools;
+	if (input && input->fileFormat)
+	{
+		inputFormat = input->fileFormat;
+		inputTools = input->tools;
+	}
+	else if (input && !input->bytes.empty())
+	{
+		inputFormat = fileformat::createFileFormat(
+				input->bytes.data(),
+				input->bytes.size(),
+				config.fileFormat.isRaw());
+		if (inputFormat == nullptr)
+		{
+			throw std::runtime_error("Failed to load input file");
+		}
+	}
+
 	// limitMaximalMemoryIfRequested(params);
 	// PrintAfterAll = true;
 
 	auto context = std::make_unique<llvm::LLVMContext>();
 	auto module = createLlvmModule(*context);
 
-	// Create a PassManager to hold and optimize the collection of passes we
-	// are about to build.
-	llvm::legacy::PassManager pm;
+	// All the data the providers hold for the module are dropped at the end
+	// of the decompilation.
+	bin2llvmir::ProviderContextGuard providersGuard(module.get());
 
 	// Without this LLVM does more opts than we would like it to.
 	// e.g. printf() call -> puts() call
@@ -485,37 +652,94 @@ bool decompile(retdec::config::Config& config, std::string* outString)
 	TargetLibraryInfoImpl TLII(ModuleTriple);
 	// The -disable-simplify-libcalls flag actually disables all builtin optzns.
 	TLII.disableAllFunctions();
-	pm.add(new TargetLibraryInfoWrapperPass(TLII));
 
+	std::vector<const llvm::PassInfo*> passInfos;
 	for (auto& p : config.parameters.llvmPasses)
 	{
 		if (auto* info = passRegistry.getPassInfo(p))
+		{
+			passInfos.push_back(info);
+		}
+		else
+		{
+			throw std::runtime_error("cannot create pass: " + p);
+		}
+	}
+
+	// All the passes work in a single LLVM context, which must not be modified
+	// from several threads at once. Therefore, they always run serially and
+	// the number of threads from the parameters is used only by the parts
+	// that do not modify the LLVM module.
+	//
+	// Each pass gets its own PassManager, so that the decompilation can be
+	// stopped between any two passes without unwinding through LLVM. This does
+	// not change the order in which the passes run on functions: each pass is
+	// preceded by a ModulePassPrinter, which is a module pass, so function
+	// passes are never run together on a single function anyway.
+	for (auto* info : passInfos)
+	{
+		monitor.check();
+
+		llvm::legacy::PassManager pm;
+		pm.add(new TargetLibraryInfoWrapperPass(TLII));
+
 		{
 			auto* pass = info->createPass();
-			addPass(pm, pass, info);
+			addPass(pm, pass, info, &monitor);
 
 			if (info->getTypeInfo() == &bin2llvmir::ProviderInitialization::ID)
 			{
 				auto* p = static_cast<bin2llvmir::ProviderInitialization*>(pass);
 				p->setConfig(&config);
+				if (inputFormat)
+				{
+					p->setInput(inputFormat, inputTools);
+				}
 			}
 			if (info->getTypeInfo() == &llvmir2hll::LlvmIr2Hll::ID)
 			{
 				auto* p = static_cast<llvmir2hll::LlvmIr2Hll*>(pass);
 				p->setConfig(&config);
-				p->setOutputString(outString);
+				p->setOutputStream(out);
 			}
 		}
-		else
-		{
-			throw std::runtime_error("cannot create pass: " + p);
-		}
-	}
 
-	// Now that we have all of the passes ready, run them.
-	pm.run(*module);
+		pm.run(*module);
+	}
+	monitor.finish();
 
 	return EXIT_SUCCESS;
 }
 
+bool decompile(
+		retdec::config::Config& config,
+		std::string* outString,
+		PhaseTimes* phaseTimes,
+		const DecompilationInput* input,
+		const CancelFlag* cancel)
+{
+	if (outString == nullptr)
+	{
+		return runDecompilation(config, nullptr, phaseTimes, input, cancel);
+	}
+
+	llvm::raw_string_ostream out(*outString);
+	auto ret = runDecompilation(config, &out, phaseTimes, input, cancel);
+	out.flush();
+	return ret;
+}
+
+bool decompile(
+		retdec::config::Config& config,
+		const OutputCallback& output,
+		PhaseTimes* phaseTimes,
+		const DecompilationInput* input,
+		const CancelFlag* cancel)
+{
+	CallbackOstream out(output);
+	auto ret = runDecompilation(config, &out, phaseTimes, input, cancel);
+	out.flush();
+	return ret;
+}
+
 } // namespace retdec
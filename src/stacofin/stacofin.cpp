@@ -4,6 +4,7 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 
@@ -12,6 +13,7 @@
 #include "retdec/stacofin/stacofin.h"
 #include "retdec/utils/string.h"
 #include "retdec/utils/filesystem.h"
+#include "retdec/utils/thread_pool.h"
 #include "retdec/yaracpp/yara_detector.h"
 
 /**
@@ -40,6 +42,12 @@ namespace {
 
 using namespace retdec;
 
+/**
+ * Number of detections whose references are solved by one task.
+ * Each task opens its own Capstone engine.
+ */
+const std::size_t REFERENCE_SOLVING_CHUNK = 1024;
+
 void selectSignaturesWithNames(
 		const std::set<std::string>& src,
 		std::set<std::string>& dst,
@@ -696,93 +704,172 @@ void Finder::search(
 	const Image& image,
 	const std::string& yaraFile)
 {
-	// Get FileFormat instance.
-	const auto* fileFormat = image.getFileFormat();
-	if (!fileFormat)
+	search(image, std::set<std::string>{yaraFile});
+}
+
+/**
+ * Search for static code in input file.
+ *
+ * All text signature files are compiled into a single set of rules, so the
+ * code is scanned only once for all of them. Precompiled signature files
+ * cannot be merged and are scanned one by one.
+ *
+ * @param image input file image
+ * @param yaraFiles static code signature files
+ */
+void Finder::search(
+	const retdec::loader::Image& image,
+	const std::set<std::string>& yaraFiles)
+{
+	std::vector<std::string> textFiles;
+	for (const auto& f : yaraFiles)
+	{
+		if (YaraDetector::isPrecompiledRuleFile(f))
+		{
+			YaraDetector detector;
+			if (detector.addRuleFile(f))
+			{
+				searchCode(image, detector, f);
+			}
+		}
+		else
+		{
+			textFiles.push_back(f);
+		}
+	}
+
+	if (textFiles.empty())
 	{
 		return;
 	}
 
-	// Start Yara detector.
+	// Rules of each file are in a namespace named by the file path.
 	YaraDetector detector;
-	detector.addRuleFile(yaraFile);
-	auto inputBytes = fileFormat->getLoadedBytes();
-	detector.analyze(inputBytes);
-	if (!detector.isInValidState())
+	if (detector.addRuleFiles(textFiles))
 	{
+		searchCode(image, detector);
 		return;
 	}
 
-	// Iterate over detected rules.
-	for (const YaraRule &detectedRule : detector.getDetectedRules())
+	// Some of the files are broken, do not let them hide the others.
+	for (const auto& f : textFiles)
 	{
-		DetectedFunction detectedFunction;
-		detectedFunction.signaturePath = yaraFile;
-
-		for (const YaraMeta &ruleMeta : detectedRule.getMetas())
+		YaraDetector fileDetector;
+		if (fileDetector.addRuleFile(f, f))
 		{
-			if (ruleMeta.getId() == "name")
-			{
-				detectedFunction.names.push_back(ruleMeta.getStringValue());
-			}
-			if (ruleMeta.getId() == "size")
-			{
-				detectedFunction.size = ruleMeta.getIntValue();
-			}
-			if (ruleMeta.getId() == "refs")
-			{
-				const auto &refs = ruleMeta.getStringValue();
-				detectedFunction.setReferences(refs);
-			}
-			if (ruleMeta.getId() == "altNames")
-			{
-				std::string name;
-				const auto &altNames = ruleMeta.getStringValue();
-				std::istringstream ss(altNames, std::istringstream::in);
-				while(ss >> name)
-				{
-					detectedFunction.names.push_back(name);
-				}
-			}
-		}
-
-		// Iterate over all matches.
-		for (const YaraMatch &ruleMatch : detectedRule.getMatches())
-		{
-			// This is different for every match.
-			detectedFunction.offset = ruleMatch.getOffset();
-			std::uint64_t address = 0;
-			if (!fileFormat->getAddressFromOffset(
-						address, detectedFunction.offset))
-			{
-				// Cannot get address. Maybe report error?
-				continue;
-			}
-
-			// Store data.
-			detectedFunction.setAddress(address);
-			coveredCode.insert(AddressRange(
-					address,
-					address + detectedFunction.size));
-
-			_allDetections.emplace(detectedFunction.getAddress(), detectedFunction);
+			searchCode(image, fileDetector);
 		}
 	}
 }
 
 /**
- * Search for static code in input file.
+ * Scan code segments of input file with the given detector and store the
+ * detected functions.
+ *
+ * Segments are scanned right in the loaded image. A match offset is thus an
+ * offset into a segment, and the address of the match is the segment address
+ * plus this offset.
  *
  * @param image input file image
- * @param yaraFiles static code signature files
+ * @param detector detector with static code signatures
+ * @param yaraFile static code signature file of all the detector's rules,
+ *                 or an empty string if the rules are in namespaces named by
+ *                 their files
  */
-void Finder::search(
+void Finder::searchCode(
 	const retdec::loader::Image& image,
-	const std::set<std::string>& yaraFiles)
+	YaraDetector& detector,
+	const std::string& yaraFile)
 {
-	for (const auto& f : yaraFiles)
+	if (!detector.isInValidState())
 	{
-		search(image, f);
+		return;
+	}
+
+	for (auto& seg : image.getSegments())
+	{
+		// Segments without sections/segments in the file format may contain
+		// anything, scan them as well.
+		auto* sec = seg->getSecSeg();
+		if (sec && !sec->isSomeCode())
+		{
+			continue;
+		}
+
+		auto data = seg->getRawData();
+		if (data.first == nullptr || data.second == 0)
+		{
+			continue;
+		}
+
+		// Detected rules accumulate over scans, process only the new ones.
+		std::size_t first = detector.getDetectedRules().size();
+		if (!detector.analyze(data.first, data.second))
+		{
+			// Rules detected by the failed scan may miss some matches, so
+			// none of them is used. They are left behind by the next scan.
+			LOG << "failed to scan segment " << seg->getName() << " at "
+					<< std::hex << seg->getAddress() << std::dec << " ("
+					<< detector.getDetectedRules().size() - first
+					<< " detected rules dropped)" << std::endl;
+			continue;
+		}
+
+		const auto& rules = detector.getDetectedRules();
+		for (std::size_t i = first; i < rules.size(); ++i)
+		{
+			const YaraRule& detectedRule = rules[i];
+
+			DetectedFunction detectedFunction;
+			detectedFunction.signaturePath = yaraFile.empty()
+					? detectedRule.getNamespace()
+					: yaraFile;
+
+			for (const YaraMeta &ruleMeta : detectedRule.getMetas())
+			{
+				if (ruleMeta.getId() == "name")
+				{
+					detectedFunction.names.push_back(ruleMeta.getStringValue());
+				}
+				if (ruleMeta.getId() == "size")
+				{
+					detectedFunction.size = ruleMeta.getIntValue();
+				}
+				if (ruleMeta.getId() == "refs")
+				{
+					const auto &refs = ruleMeta.getStringValue();
+					detectedFunction.setReferences(refs);
+				}
+				if (ruleMeta.getId() == "altNames")
+				{
+					std::string name;
+					const auto &altNames = ruleMeta.getStringValue();
+					std::istringstream ss(altNames, std::istringstream::in);
+					while(ss >> name)
+					{
+						detectedFunction.names.push_back(name);
+					}
+				}
+			}
+
+			// Iterate over all matches.
+			for (const YaraMatch &ruleMatch : detectedRule.getMatches())
+			{
+				// This is different for every match.
+				Address address = seg->getAddress() + ruleMatch.getOffset();
+				detectedFunction.offset = sec
+						? sec->getOffset() + ruleMatch.getOffset()
+						: ruleMatch.getOffset();
+
+				// Store data.
+				detectedFunction.setAddress(address);
+				coveredCode.insert(AddressRange(
+						address,
+						address + detectedFunction.size));
+
+				_allDetections.emplace(detectedFunction.getAddress(), detectedFunction);
+			}
+		}
 	}
 }
 
@@ -809,7 +896,7 @@ void Finder::searchAndConfirm(
 	_config = &config;
 	_image = &image;
 
-	if (initDisassembler() || _ceInsn == nullptr)
+	if (initDisassembler())
 	{
 		return;
 	}
@@ -827,14 +914,13 @@ void Finder::searchAndConfirm(
 		}
 	}
 
+	initDetections();
+
 	LOG << dumpDetectedFunctions(_allDetections) << std::endl;
 	solveReferences();
 	LOG << dumpDetectedFunctions(_allDetections) << std::endl;
 
-	for (auto& p : _allDetections)
-	{
-		_worklistDetections.insert(&p.second);
-	}
+	initReferenceIndex();
 
 	confirmWithoutRefs();
 	confirmAllRefsOk();
@@ -848,49 +934,95 @@ void Finder::searchAndConfirm(
 				<< std::endl;
 	}
 	LOG << "\t Rejected detections:" << std::endl;
-	for (auto& p : _rejectedDetections)
+	for (std::size_t i = 0; i < _detections.size(); ++i)
 	{
-		LOG << "        " << "assert not self.out_config.is_statically_linked('"
-				<< p.second->getName() << "', " << p.first << ")"
-				<< std::endl;
+		if (_states[i] == DetectionState::REJECTED)
+		{
+			LOG << "        " << "assert not self.out_config.is_statically_linked('"
+					<< _detections[i]->getName() << "', "
+					<< _detections[i]->getAddress() << ")" << std::endl;
+		}
 	}
 	LOG << "\t Worklist detections:" << std::endl;
-	for (auto* f : _worklistDetections)
+	for (std::size_t i = 0; i < _detections.size(); ++i)
 	{
-		LOG << "        " << "assert not self.out_config.is_statically_linked('"
-				<< f->getName() << "', " << f->getAddress() << ")"
-				<< std::endl;
+		if (_states[i] == DetectionState::WORKLIST)
+		{
+			LOG << "        " << "assert not self.out_config.is_statically_linked('"
+					<< _detections[i]->getName() << "', "
+					<< _detections[i]->getAddress() << ")" << std::endl;
+		}
 	}
-
-	cs_free(_ceInsn, 1);
-	cs_close(&_ce);
 }
 
+struct Finder::Disassembler
+{
+	Disassembler(cs_arch arch, cs_mode mode)
+	{
+		if (cs_open(arch, mode, &handle) != CS_ERR_OK)
+		{
+			return;
+		}
+		opened = true;
+		if (cs_option(handle, CS_OPT_DETAIL, CS_OPT_ON) != CS_ERR_OK)
+		{
+			return;
+		}
+		insn = cs_malloc(handle);
+	}
+
+	~Disassembler()
+	{
+		if (insn)
+		{
+			cs_free(insn, 1);
+		}
+		if (opened)
+		{
+			cs_close(&handle);
+		}
+	}
+
+	Disassembler(const Disassembler&) = delete;
+	Disassembler& operator=(const Disassembler&) = delete;
+
+	bool isOk() const
+	{
+		return insn != nullptr;
+	}
+
+	csh handle = 0;
+	cs_insn* insn = nullptr;
+	bool opened = false;
+};
+
 /**
+ * Select Capstone architecture and mode for solving references and check
+ * that an engine can be opened with them.
+ *
  * @return @c False of everything ok, @c true otherwise.
  */
 bool Finder::initDisassembler()
 {
-	cs_arch arch;
 	_ceMode = CS_MODE_LITTLE_ENDIAN;
 	if (_config->architecture.isX86())
 	{
-		arch = CS_ARCH_X86;
+		_ceArch = CS_ARCH_X86;
 		_ceMode = CS_MODE_32;
 	}
 	else if (_config->architecture.isMipsOrPic32())
 	{
-		arch = CS_ARCH_MIPS;
+		_ceArch = CS_ARCH_MIPS;
 		_ceMode = CS_MODE_MIPS32;
 	}
 	else if (_config->architecture.isArm32OrThumb())
 	{
-		arch = CS_ARCH_ARM;
+		_ceArch = CS_ARCH_ARM;
 		_ceMode = CS_MODE_ARM;
 	}
 	else if (_config->architecture.isPpc())
 	{
-		arch = CS_ARCH_PPC;
+		_ceArch = CS_ARCH_PPC;
 		_ceMode = CS_MODE_LITTLE_ENDIAN;
 	}
 	else
@@ -898,54 +1030,129 @@ bool Finder::initDisassembler()
 		return true;
 	}
 
-	if (cs_open(arch, _ceMode, &_ce) != CS_ERR_OK)
+	Disassembler d(_ceArch, _ceMode);
+	return !d.isOk();
+}
+
+/**
+ * Create the flat worklist of all the detections. All of them start in the
+ * worklist.
+ */
+void Finder::initDetections()
+{
+	_detections.clear();
+	_states.clear();
+	_indexes.clear();
+	_maxDetectionSize = 0;
+
+	std::vector<DetectedFunction*> all;
+	all.reserve(_allDetections.size());
+	for (auto& p : _allDetections)
 	{
-		return true;
+		all.push_back(&p.second);
+		_maxDetectionSize = std::max(_maxDetectionSize, p.second.size);
 	}
-	if (cs_option(_ce, CS_OPT_DETAIL, CS_OPT_ON) != CS_ERR_OK)
+
+	// Stable sort keeps the first of the same detections from different
+	// signature files in front of the others.
+	auto byAddressName = [](const DetectedFunction* a, const DetectedFunction* b)
 	{
-		return true;
+		return a->getAddress() == b->getAddress()
+				? a->getName() < b->getName()
+				: a->getAddress() < b->getAddress();
+	};
+	std::stable_sort(all.begin(), all.end(), byAddressName);
+
+	_detections.reserve(all.size());
+	_indexes.reserve(all.size());
+	for (auto* f : all)
+	{
+		if (_detections.empty() || byAddressName(_detections.back(), f))
+		{
+			_detections.push_back(f);
+		}
+		_indexes.emplace(f, _detections.size() - 1);
 	}
-	_ceInsn = cs_malloc(_ce);
+	_states.assign(_detections.size(), DetectionState::WORKLIST);
+}
 
-	return false;
+/**
+ * Index references of all the detections by their targets and names.
+ * It must be called after the references are solved.
+ */
+void Finder::initReferenceIndex()
+{
+	_refIndex.clear();
+	for (auto& p : _allDetections)
+	for (auto& r : p.second.references)
+	{
+		_refIndex.push_back({r.target, &r.name, &r});
+	}
+
+	std::sort(_refIndex.begin(), _refIndex.end());
 }
 
+/**
+ * Solve references of all the detections.
+ *
+ * Each detection is solved on its own -- only its references are modified,
+ * everything else is just read. Detections are therefore solved in parallel,
+ * in chunks with their own Capstone engines, on a pool created for this call
+ * with the number of threads from the configuration. Conflicts between
+ * detections are resolved later by the serial confirmation.
+ */
 void Finder::solveReferences()
 {
+	std::vector<DetectedFunction*> all;
+	all.reserve(_allDetections.size());
 	for (auto& p : _allDetections)
 	{
-		bool modeSwitch = false;
-		std::string& sigPath = p.second.signaturePath;
-		if (_config->architecture.isArm32OrThumb()
-				&& utils::containsCaseInsensitive(sigPath, "thumb"))
+		all.push_back(&p.second);
+	}
+
+	std::size_t chunks = (all.size() + REFERENCE_SOLVING_CHUNK - 1)
+			/ REFERENCE_SOLVING_CHUNK;
+
+	ThreadPool pool(_config->parameters.getThreads());
+	pool.parallelFor(chunks, [this, &all](std::size_t c)
+	{
+		Disassembler d(_ceArch, _ceMode);
+		if (!d.isOk())
 		{
-			if (cs_option(_ce, CS_OPT_MODE, CS_MODE_THUMB) != CS_ERR_OK)
-			{
-				assert(false);
-				return;
-			}
-			modeSwitch = true;
+			return;
 		}
 
-		for (auto& r : p.second.references)
+		std::size_t b = c * REFERENCE_SOLVING_CHUNK;
+		std::size_t e = std::min(all.size(), b + REFERENCE_SOLVING_CHUNK);
+		for (std::size_t i = b; i < e; ++i)
 		{
-			r.target = getAddressFromRef(r.address);
-			checkRef(r);
+			solveReferences(d, *all[i]);
 		}
+	});
+}
 
-		if (modeSwitch)
+void Finder::solveReferences(Disassembler& d, DetectedFunction& f)
+{
+	if (_config->architecture.isArm32OrThumb())
+	{
+		cs_mode mode = f.isThumb() ? CS_MODE_THUMB : _ceMode;
+		if (cs_option(d.handle, CS_OPT_MODE, mode) != CS_ERR_OK)
 		{
-			if (cs_option(_ce, CS_OPT_MODE, _ceMode) != CS_ERR_OK)
-			{
-				assert(false);
-				return;
-			}
+			assert(false);
+			return;
 		}
 	}
+
+	for (auto& r : f.references)
+	{
+		r.target = getAddressFromRef(d, r.address);
+		checkRef(d, r);
+	}
 }
 
-common::Address Finder::getAddressFromRef(common::Address ref)
+common::Address Finder::getAddressFromRef(
+		Disassembler& d,
+		common::Address ref)
 {
 	if (_config->architecture.isX86())
 	{
@@ -953,15 +1160,15 @@ common::Address Finder::getAddressFromRef(common::Address ref)
 	}
 	else if (_config->architecture.isMipsOrPic32())
 	{
-		return getAddressFromRef_mips(ref);
+		return getAddressFromRef_mips(d, ref);
 	}
 	else if (_config->architecture.isArm())
 	{
-		return getAddressFromRef_arm(ref);
+		return getAddressFromRef_arm(d, ref);
 	}
 	else if (_config->architecture.isPpc())
 	{
-		return getAddressFromRef_ppc(ref);
+		return getAddressFromRef_ppc(d, ref);
 	}
 	else
 	{
@@ -1085,20 +1292,22 @@ bool isAddInsn_mips(csh ce, cs_insn* i)
  * On MIPS, reference is an instruction that needs to be disassembled and
  * inspected for reference target.
  */
-common::Address Finder::getAddressFromRef_mips(common::Address ref)
+common::Address Finder::getAddressFromRef_mips(
+		Disassembler& d,
+		common::Address ref)
 {
 	uint64_t addr = ref;
 	ByteData data = _image->getRawSegmentData(ref);
-	if (!cs_disasm_iter(_ce, &data.first, &data.second, &addr, _ceInsn))
+	if (!cs_disasm_iter(d.handle, &data.first, &data.second, &addr, d.insn))
 	{
 		return Address();
 	}
-	auto& mips = _ceInsn->detail->mips;
+	auto& mips = d.insn->detail->mips;
 
 	// j target_function
 	// jal target_function
 	//
-	if (isJumpInsn_mips(_ce, _ceInsn)
+	if (isJumpInsn_mips(d.handle, d.insn)
 			&& mips.op_count == 1
 			&& mips.operands[0].type == MIPS_OP_IMM)
 	{
@@ -1107,7 +1316,7 @@ common::Address Finder::getAddressFromRef_mips(common::Address ref)
 	// lui reg, upper
 	// ...
 	//
-	else if (_ceInsn->id == MIPS_INS_LUI
+	else if (d.insn->id == MIPS_INS_LUI
 			&& mips.op_count == 2
 			&& mips.operands[0].type == MIPS_OP_REG
 			&& mips.operands[1].type == MIPS_OP_IMM)
@@ -1116,7 +1325,7 @@ common::Address Finder::getAddressFromRef_mips(common::Address ref)
 		unsigned s = _config->architecture.getBitSize() / 2;
 		uint64_t upper = uint64_t(mips.operands[1].imm) << s;
 
-		if (!cs_disasm_iter(_ce, &data.first, &data.second, &addr, _ceInsn))
+		if (!cs_disasm_iter(d.handle, &data.first, &data.second, &addr, d.insn))
 		{
 			return Address();
 		}
@@ -1126,10 +1335,10 @@ common::Address Finder::getAddressFromRef_mips(common::Address ref)
 		// Maybe, we should check that skipped instruction does not use reg.
 		// Maybe, more than one instruction needs to be skipped.
 		//
-		if (!isLoadStoreInsn_mips(_ce, _ceInsn)
-				&& !isAddInsn_mips(_ce, _ceInsn))
+		if (!isLoadStoreInsn_mips(d.handle, d.insn)
+				&& !isAddInsn_mips(d.handle, d.insn))
 		{
-			if (!cs_disasm_iter(_ce, &data.first, &data.second, &addr, _ceInsn))
+			if (!cs_disasm_iter(d.handle, &data.first, &data.second, &addr, d.insn))
 			{
 				return Address();
 			}
@@ -1143,7 +1352,7 @@ common::Address Finder::getAddressFromRef_mips(common::Address ref)
 		// sw $zero, -0x1f14($at)
 		// ==> 0x891 E0EC
 		//
-		if (isLoadStoreInsn_mips(_ce, _ceInsn)
+		if (isLoadStoreInsn_mips(d.handle, d.insn)
 				&& mips.op_count == 2
 				&& mips.operands[1].type == MIPS_OP_MEM
 				&& mips.operands[1].mem.base == reg)
@@ -1155,7 +1364,7 @@ common::Address Finder::getAddressFromRef_mips(common::Address ref)
 		// addiu $a2, $a2, 0x5ff4
 		// ==> 0x891 5FF4
 		//
-		else if (isAddInsn_mips(_ce, _ceInsn)
+		else if (isAddInsn_mips(d.handle, d.insn)
 				&& mips.op_count == 3
 				&& mips.operands[1].type == MIPS_OP_REG
 				&& mips.operands[1].reg == reg
@@ -1176,7 +1385,9 @@ common::Address Finder::getAddressFromRef_mips(common::Address ref)
  * a word after the function that just needs to be read (it should point
  * somewhere to the loaded image, but that is checked later).
  */
-common::Address Finder::getAddressFromRef_arm(common::Address ref)
+common::Address Finder::getAddressFromRef_arm(
+		Disassembler& d,
+		common::Address ref)
 {
 	std::uint64_t ci = 0;
 	if (_image->getWord(ref, ci))
@@ -1206,13 +1417,13 @@ common::Address Finder::getAddressFromRef_arm(common::Address ref)
 	//
 	uint64_t addr = ref;
 	ByteData data = _image->getRawSegmentData(ref);
-	if (cs_disasm_iter(_ce, &data.first, &data.second, &addr, _ceInsn))
+	if (cs_disasm_iter(d.handle, &data.first, &data.second, &addr, d.insn))
 	{
-		auto& arm = _ceInsn->detail->arm;
+		auto& arm = d.insn->detail->arm;
 
-		bool isBr = cs_insn_group(_ce, _ceInsn, ARM_GRP_JUMP)
-				|| cs_insn_group(_ce, _ceInsn, ARM_GRP_CALL)
-				|| cs_insn_group(_ce, _ceInsn, ARM_GRP_BRANCH_RELATIVE);
+		bool isBr = cs_insn_group(d.handle, d.insn, ARM_GRP_JUMP)
+				|| cs_insn_group(d.handle, d.insn, ARM_GRP_CALL)
+				|| cs_insn_group(d.handle, d.insn, ARM_GRP_BRANCH_RELATIVE);
 
 		if (isBr
 				&& arm.op_count == 1
@@ -1233,7 +1444,7 @@ common::Address Finder::getAddressFromRef_arm(common::Address ref)
 		}
 		// mov pc, lr (return)
 		//
-		else if (_ceInsn->id == ARM_INS_MOV
+		else if (d.insn->id == ARM_INS_MOV
 				&& arm.op_count == 2
 				&& arm.operands[0].type == ARM_OP_REG
 				&& arm.operands[0].reg == ARM_REG_PC
@@ -1254,7 +1465,9 @@ common::Address Finder::getAddressFromRef_arm(common::Address ref)
 	return Address();
 }
 
-common::Address Finder::getAddressFromRef_ppc(common::Address ref)
+common::Address Finder::getAddressFromRef_ppc(
+		Disassembler& d,
+		common::Address ref)
 {
 	std::uint64_t ci = 0;
 	if (_image->getWord(ref, ci))
@@ -1279,11 +1492,11 @@ common::Address Finder::getAddressFromRef_ppc(common::Address ref)
 	//
 	uint64_t addr = ref;
 	ByteData data = _image->getRawSegmentData(ref);
-	if (cs_disasm_iter(_ce, &data.first, &data.second, &addr, _ceInsn))
+	if (cs_disasm_iter(d.handle, &data.first, &data.second, &addr, d.insn))
 	{
-		auto& ppc = _ceInsn->detail->ppc;
+		auto& ppc = d.insn->detail->ppc;
 
-		if (_ceInsn->id == PPC_INS_BL
+		if (d.insn->id == PPC_INS_BL
 				&& ppc.op_count == 1
 				&& ppc.operands[0].type == PPC_OP_IMM)
 		{
@@ -1300,7 +1513,7 @@ common::Address Finder::getAddressFromRef_ppc(common::Address ref)
 	return Address();
 }
 
-void Finder::checkRef(Reference& ref)
+void Finder::checkRef(Disassembler& d, Reference& ref)
 {
 	if (ref.target.isUndefined())
 	{
@@ -1369,7 +1582,7 @@ void Finder::checkRef(Reference& ref)
 	//
 	if (_config->architecture.isX86())
 	{
-		checkRef_x86(ref);
+		checkRef_x86(d, ref);
 	}
 	if (ref.ok)
 	{
@@ -1428,7 +1641,7 @@ void Finder::checkRef(Reference& ref)
 	}
 }
 
-void Finder::checkRef_x86(Reference& ref)
+void Finder::checkRef_x86(Disassembler& d, Reference& ref)
 {
 	if (ref.target.isUndefined())
 	{
@@ -1437,16 +1650,16 @@ void Finder::checkRef_x86(Reference& ref)
 
 	uint64_t addr = ref.target;
 	ByteData bytes = _image->getRawSegmentData(ref.target);
-	if (cs_disasm_iter(_ce, &bytes.first, &bytes.second, &addr, _ceInsn))
+	if (cs_disasm_iter(d.handle, &bytes.first, &bytes.second, &addr, d.insn))
 	{
-		auto& x86 = _ceInsn->detail->x86;
+		auto& x86 = d.insn->detail->x86;
 
 		// Pattern: reference to stub function jumping to import:
 		//     _localeconv     proc near
 		//     FF 25 E0 B1 40 00        jmp ds:__imp__localeconv
 		//     _localeconv     endp
 		//
-		if (_ceInsn->id == X86_INS_JMP
+		if (d.insn->id == X86_INS_JMP
 				&& x86.op_count == 1
 				&& x86.operands[0].type == X86_OP_MEM
 				&& x86.operands[0].mem.segment == X86_REG_INVALID
@@ -1470,6 +1683,13 @@ void Finder::checkRef_x86(Reference& ref)
 	}
 }
 
+bool Finder::isInWorklist(const DetectedFunction* f) const
+{
+	auto it = _indexes.find(f);
+	return it != _indexes.end()
+			&& _states[it->second] == DetectionState::WORKLIST;
+}
+
 /**
  * Sometimes, we don't need references to solve detections.
  * e.g. on PIC32 detected function '_scanf_cdnopuxX' is in section
@@ -1483,21 +1703,21 @@ void Finder::confirmWithoutRefs()
 {
 	LOG << "\t" << "confirmWithoutRefs()" << std::endl;
 
-	auto worklistCopy = _worklistDetections;
-	for (auto* f : worklistCopy)
+	for (std::size_t i = 0; i < _detections.size(); ++i)
 	{
-		if (_worklistDetections.count(f) == 0)
+		if (_states[i] != DetectionState::WORKLIST)
 		{
 			continue;
 		}
 
+		auto* f = _detections[i];
 		if (auto* s = _image->getSegmentFromAddress(f->getAddress()))
 		{
 			for (auto& n : f->names)
 			{
 				if (s->getName() == (".text." + n))
 				{
-					confirmFunction(f);
+					confirmFunction(i);
 					break;
 				}
 			}
@@ -1533,63 +1753,78 @@ void Finder::confirmAllRefsOk(std::size_t minFncSzWithoutRefs)
 {
 	LOG << "\t" << "confirmAllRefsOk()" << std::endl;
 
-	// Sort all functions with all references OK by number of references
-	// (and other stuff).
+	// All functions with all references OK, sorted by address.
 	//
-	std::multiset<DetectedFunction*, comByRefSizeAddress> byRefNum;
-
-	DetectedFunctionsPtrMultimap byAddress;
-	for (auto* f : _worklistDetections)
+	std::vector<std::size_t> byAddress;
+	for (std::size_t i = 0; i < _detections.size(); ++i)
 	{
-		if (f->allRefsOk())
+		if (_states[i] == DetectionState::WORKLIST
+				&& _detections[i]->allRefsOk())
 		{
-			byRefNum.insert(f);
-			byAddress.emplace(f->getAddress(), f);
+			byAddress.push_back(i);
 		}
 	}
+
+	// Sort them by number of references (and other stuff).
+	//
+	std::vector<std::size_t> byRefNum = byAddress;
+	std::stable_sort(
+			byRefNum.begin(),
+			byRefNum.end(),
+			[this](std::size_t a, std::size_t b)
+	{
+		return comByRefSizeAddress()(_detections[a], _detections[b]);
+	});
+
 	LOG << "\t\t" << "byRefNum (sz = " << byRefNum.size() << "):" << std::endl;
-	for (auto& f : byRefNum)
+	for (auto i : byRefNum)
 	{
+		auto* f = _detections[i];
 		LOG << "\t\t\t" << f->references.size() << " @ " << f->getAddress()
 				<< " " << f->getName() << ", sz = " << f->size << std::endl;
 	}
 
+	auto addressLess = [this](std::size_t i, Address a)
+	{
+		return _detections[i]->getAddress() < a;
+	};
+
 	// From functions with the most references to those with at least one
 	// reference, confirm function if:
 	//   - No conflicting function at the same address.
 	//   - Conflicting function is shorter or has less references.
 	//   - Function has at least some reference or is not too short.
 	//
-	for (auto* f : byRefNum)
+	for (auto i : byRefNum)
 	{
 		// Function was solved in the meantime.
 		//
-		if (_worklistDetections.count(f) == 0)
+		if (_states[i] != DetectionState::WORKLIST)
 		{
 			continue;
 		}
 
 		// Skip functions without references that are to short.
 		//
+		auto* f = _detections[i];
 		if (f->references.empty() && f->size < minFncSzWithoutRefs)
 		{
 			continue;
 		}
 
-		// Only one function at this address.
-		//
-		if (byAddress.count(f->getAddress()) == 1)
-		{
-			confirmFunction(f);
-		}
-
-		//
+		// Only one function at this address, or the best one of conflicting
+		// functions.
 		//
 		bool bestConflicting = true;
-		auto eqr = byAddress.equal_range(f->getAddress());
-		for (auto it = eqr.first; it != eqr.second; ++it)
+		auto it = std::lower_bound(
+				byAddress.begin(),
+				byAddress.end(),
+				f->getAddress(),
+				addressLess);
+		for (; it != byAddress.end()
+				&& _detections[*it]->getAddress() == f->getAddress(); ++it)
 		{
-			auto* of = it->second;
+			auto* of = _detections[*it];
 			if (f != of)
 			{
 				if (!(f->size > of->size
@@ -1602,7 +1837,7 @@ void Finder::confirmAllRefsOk(std::size_t minFncSzWithoutRefs)
 		}
 		if (bestConflicting)
 		{
-			confirmFunction(f);
+			confirmFunction(i);
 		}
 	}
 }
@@ -1617,9 +1852,12 @@ void Finder::confirmPartialRefsOk(float okShare)
 		//
 		float maxShare = 0.0;
 		DetectedFunction* f = nullptr;
-		for (auto* of : _worklistDetections)
+		std::size_t fi = 0;
+		for (std::size_t i = 0; i < _detections.size(); ++i)
 		{
-			if (of->references.empty())
+			auto* of = _detections[i];
+			if (_states[i] != DetectionState::WORKLIST
+					|| of->references.empty())
 			{
 				continue;
 			}
@@ -1630,6 +1868,7 @@ void Finder::confirmPartialRefsOk(float okShare)
 			{
 				maxShare = ms;
 				f = of;
+				fi = i;
 			}
 		}
 
@@ -1645,55 +1884,66 @@ void Finder::confirmPartialRefsOk(float okShare)
 		// This can increase ok share in other function by confirming all
 		// (even unsolved) references in this function -> repeat loop.
 		//
-		confirmFunction(f);
+		confirmFunction(fi);
 	}
 }
 
-void Finder::confirmFunction(DetectedFunction* f)
+/**
+ * Confirm detection @a i in @c _detections and reject all the detections
+ * conflicting with it.
+ */
+void Finder::confirmFunction(std::size_t i)
 {
+	auto* f = _detections[i];
+
 	LOG << "\t\t" << "confirming " << f->getName() << " @ " << f->getAddress()
 			<< std::endl;
 
 	// Confirm the function.
 	//
 	_confirmedDetections.emplace(f->getAddress(), f);
-	_worklistDetections.erase(f);
+	_states[i] = DetectionState::CONFIRMED;
 
-	// Reject all other function at the same address.
+	// Reject all functions that overlap with the function, including all
+	// other functions at the same address. Detections are sorted by address,
+	// so only those starting at most the biggest detection size before the
+	// function need to be checked.
 	//
-	auto eqr = _allDetections.equal_range(f->getAddress());
-	for (auto it = eqr.first; it != eqr.second; ++it)
+	AddressRange range(f->getAddress(), f->getAddress() + f->size);
+	Address from = f->getAddress() > _maxDetectionSize
+			? Address(f->getAddress() - _maxDetectionSize)
+			: Address(0);
+	auto it = std::lower_bound(
+			_detections.begin(),
+			_detections.end(),
+			from,
+			[](const DetectedFunction* of, Address a)
+	{
+		return of->getAddress() < a;
+	});
+	for (; it != _detections.end()
+			&& (*it)->getAddress() <= range.getEnd(); ++it)
 	{
-		auto* of = &it->second;
-		if (of != f)
+		auto* of = *it;
+		auto oi = it - _detections.begin();
+		if (of == f || _states[oi] != DetectionState::WORKLIST)
+		{
+			continue;
+		}
+
+		AddressRange oRange(of->getAddress(), of->getAddress() + of->size);
+		if (of->getAddress() == f->getAddress())
 		{
-			_rejectedDetections.emplace(of->getAddress(), of);
-			_worklistDetections.erase(of);
+			_states[oi] = DetectionState::REJECTED;
 			LOG << "\t\t\t" << "rejecting #1 " << of->getName() << " @ "
 					<< of->getAddress() << std::endl;
 		}
-	}
-
-	// Reject all functions that overlap with the function.
-	//
-	AddressRange range(f->getAddress(), f->getAddress() + f->size);
-	auto it = _worklistDetections.begin(), e = _worklistDetections.end();
-	while (it != e)
-	{
-		auto* of = *it;
-		if (of != f)
+		else if (range.overlaps(oRange))
 		{
-			AddressRange oRange(of->getAddress(), of->getAddress() + of->size);
-			if (range.overlaps(oRange))
-			{
-				_rejectedDetections.emplace(of->getAddress(), of);
-				it = _worklistDetections.erase(it);
-				LOG << "\t\t\t" << "rejecting #2 " << of->getName() << " @ "
-						<< of->getAddress() << std::endl;
-				continue;
-			}
+			_states[oi] = DetectionState::REJECTED;
+			LOG << "\t\t\t" << "rejecting #2 " << of->getName() << " @ "
+					<< of->getAddress() << std::endl;
 		}
-		++it;
 	}
 
 	// Confirm and make use of all references.
@@ -1702,22 +1952,22 @@ void Finder::confirmFunction(DetectedFunction* f)
 	{
 		// Confirm all functions referenced from the function.
 		//
-		if (r.targetFnc && _worklistDetections.count(r.targetFnc))
+		if (r.targetFnc && isInWorklist(r.targetFnc))
 		{
-			confirmFunction(r.targetFnc);
+			confirmFunction(_indexes[r.targetFnc]);
 		}
 
 		// Confirm this reference in all detected functions.
 		//
 		if (!r.ok)
 		{
-			for (auto& p : _allDetections)
-			for (auto& oref : p.second.references)
+			auto eqr = std::equal_range(
+					_refIndex.begin(),
+					_refIndex.end(),
+					RefEntry{r.target, &r.name, nullptr});
+			for (auto oIt = eqr.first; oIt != eqr.second; ++oIt)
 			{
-				if (r.target == oref.target && r.name == oref.name)
-				{
-					oref.ok = true;
-				}
+				oIt->ref->ok = true;
 			}
 		}
 	}
@@ -5,9 +5,11 @@
  */
 
 #include <cstddef>
+#include <cstdio>
 #include <memory>
 
 #include "retdec/utils/conversion.h"
+#include "retdec/utils/file_io.h"
 #include "retdec/utils/filesystem.h"
 #include "retdec/utils/io/log.h"
 #include "retdec/utils/memory.h"
@@ -28,26 +30,21 @@ namespace retdec {
 namespace unpackertool {
 
 /**
- * Possible exit codes of the unpacker as program.
+ * Detect tools in the input file. If @a inputBytes are set, the input is
+ * parsed from them instead of the file.
  */
-enum ExitCode
-{
-	EXIT_CODE_OK = 0, ///< Unpacker ended successfully.
-	EXIT_CODE_NOTHING_TO_DO, ///< There was not found matching plugin.
-	EXIT_CODE_UNPACKING_FAILED, ///< At least one plugin failed at the unpacking of the file.
-	EXIT_CODE_PREPROCESSING_ERROR, ///< Error with preprocessing of input file before unpacking.
-	EXIT_CODE_MEMORY_LIMIT_ERROR ///< There was an error when setting the memory limit.
-};
-
-bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
+bool detectTools(const std::string& inputFile, const std::vector<std::uint8_t>* inputBytes, UnpackResult& result)
 {
 	using namespace retdec::cpdetect;
 	using namespace retdec::fileformat;
 
 	DetectParams detectionParams(SearchType::MOST_SIMILAR, true, false);
 
-	ToolInformation toolInfo;
-	switch (detectFileFormat(inputFile))
+	auto toolInfo = std::make_shared<ToolInformation>();
+	auto format = inputBytes
+			? detectFileFormat(inputBytes->data(), inputBytes->size())
+			: detectFileFormat(inputFile);
+	switch (format)
 	{
 		case Format::UNDETECTABLE:
 			Log::error() << "Input file '" << inputFile << "' doesn't exist!" << std::endl;
@@ -57,7 +54,9 @@ bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::D
 			return false;
 		default:
 		{
-			auto fileParser = createFileFormat(inputFile);
+			std::shared_ptr<FileFormat> fileParser = inputBytes
+					? createFileFormat(inputBytes->data(), inputBytes->size())
+					: createFileFormat(inputFile);
 			if (!fileParser)
 			{
 				Log::error() << "Error while detecting format of file '" << inputFile << "'! Please, report this." << std::endl;
@@ -67,7 +66,7 @@ bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::D
 			auto compilerDetector = std::make_unique<CompilerDetector>(
 					*(fileParser.get()),
 					detectionParams,
-					toolInfo
+					*toolInfo
 			);
 			if (!compilerDetector)
 			{
@@ -75,15 +74,37 @@ bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::D
 				return false;
 			}
 
-			compilerDetector->getAllInformation();
+			result.inputToolsStatus = compilerDetector->getAllInformation();
+			result.input = std::move(fileParser);
 			break;
 		}
 	}
 
-	detectedPackers = toolInfo.detectedTools;
+	result.inputTools = toolInfo;
+	return true;
+}
+
+bool detectPackers(const std::string& inputFile, std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
+{
+	UnpackResult result;
+	if (!detectTools(inputFile, nullptr, result))
+		return false;
+
+	detectedPackers = result.inputTools->detectedTools;
 	return true;
 }
 
+bool hasMatchingPlugins(const std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
+{
+	for (const auto& detectedPacker : detectedPackers)
+	{
+		if (!PluginMgr::matchingPlugins(detectedPacker.name, detectedPacker.versionInfo).empty())
+			return true;
+	}
+
+	return false;
+}
+
 ExitCode unpackFile(const std::string& inputFile, const std::string& outputFile, bool brute, const std::vector<retdec::cpdetect::DetectResult>& detectedPackers)
 {
 	Plugin::Arguments pluginArgs = { inputFile, outputFile, brute };
@@ -118,6 +139,56 @@ ExitCode unpackFile(const std::string& inputFile, const std::string& outputFile,
 	return ret;
 }
 
+/**
+ * Detect packers of the input file and unpack it. This is the library
+ * interface of the unpacker, it keeps both the input and the output in memory.
+ * Files are used only if there is a plugin for some of the detected packers,
+ * because the plugins work with files.
+ *
+ * @param inputFile Path to the input file. If @a inputBytes are set, the input
+ *                  is written there only for the plugins and removed afterwards.
+ * @param inputBytes Content of the input file, or @c nullptr to read the input
+ *                  from @a inputFile.
+ * @param workFile  Path where plugins write the unpacked file. It is kept,
+ *                  its content is read into the result as well.
+ * @param brute     Run plugins in the brute mode.
+ */
+UnpackResult unpack(
+		const std::string& inputFile,
+		const std::vector<std::uint8_t>* inputBytes,
+		const std::string& workFile,
+		bool brute)
+{
+	UnpackResult result;
+	if (!detectTools(inputFile, inputBytes, result))
+	{
+		result.code = EXIT_CODE_PREPROCESSING_ERROR;
+		return result;
+	}
+
+	const auto& detectedPackers = result.inputTools->detectedTools;
+	bool writeInput = inputBytes && hasMatchingPlugins(detectedPackers);
+	if (writeInput && !writeFile(inputFile, *inputBytes))
+	{
+		Log::error() << "Could not write input file '" << inputFile << "'!" << std::endl;
+		result.code = EXIT_CODE_PREPROCESSING_ERROR;
+		return result;
+	}
+
+	result.code = unpackFile(inputFile, workFile, brute, detectedPackers);
+	if (result.code == EXIT_CODE_OK
+			&& (!readFile(workFile, result.unpacked) || result.unpacked.empty()))
+	{
+		result.code = EXIT_CODE_UNPACKING_FAILED;
+		result.unpacked.clear();
+	}
+
+	if (writeInput)
+		std::remove(inputFile.c_str());
+
+	return result;
+}
+
 ExitCode processArgs(ArgHandler& handler, char argc, char** argv)
 {
 	// In case of failed parsing just print the help
@@ -1,4 +1,6 @@
 
 if(NOT TARGET retdec::utils)
+    find_package(Threads REQUIRED)
+
     include(${CMAKE_CURRENT_LIST_DIR}/retdec-utils-targets.cmake)
 endif()
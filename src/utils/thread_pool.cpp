@@ -0,0 +1,122 @@
+/**
+* @file src/utils/thread_pool.cpp
+* @brief Implementation of a simple pool of worker threads.
+* @copyright (c) 2021 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/utils/thread_pool.h"
+
+namespace retdec {
+namespace utils {
+
+/**
+* @brief Creates a pool with the given number of threads.
+*
+* @param[in] threads Number of threads. If it is @c 0, the number of hardware
+*                    threads is used. If it is @c 1, no worker thread is
+*                    created and tasks are run synchronously.
+*/
+ThreadPool::ThreadPool(std::size_t threads):
+	threadCount(threads == 0 ? getHardwareThreadCount() : threads) {
+	if (threadCount < 2) {
+		threadCount = 1;
+		return;
+	}
+
+	workers.reserve(threadCount);
+	for (std::size_t i = 0; i < threadCount; ++i) {
+		workers.emplace_back(&ThreadPool::workerLoop, this);
+	}
+}
+
+/**
+* @brief Waits for all the submitted tasks and destroys the pool.
+*/
+ThreadPool::~ThreadPool() {
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	taskAvailable.notify_all();
+	for (auto &worker : workers) {
+		worker.join();
+	}
+}
+
+/**
+* @brief Returns the number of threads that execute tasks.
+*/
+std::size_t ThreadPool::getThreadCount() const {
+	return threadCount;
+}
+
+/**
+* @brief Returns @c true if tasks are executed by worker threads, @c false if
+*        they are executed synchronously.
+*/
+bool ThreadPool::isParallel() const {
+	return !workers.empty();
+}
+
+/**
+* @brief Waits until all the submitted tasks finish.
+*/
+void ThreadPool::wait() {
+	std::unique_lock<std::mutex> lock(mutex);
+	allFinished.wait(lock, [this]() { return unfinished == 0; });
+}
+
+/**
+* @brief Returns the number of concurrent threads supported by the hardware
+*        (at least @c 1).
+*/
+std::size_t ThreadPool::getHardwareThreadCount() {
+	auto n = std::thread::hardware_concurrency();
+	return n == 0 ? 1 : n;
+}
+
+void ThreadPool::enqueue(std::function<void()> task) {
+	if (!isParallel()) {
+		task();
+		return;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		tasks.push(std::move(task));
+		++unfinished;
+	}
+	taskAvailable.notify_one();
+}
+
+void ThreadPool::workerLoop() {
+	while (true) {
+		std::function<void()> task;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			taskAvailable.wait(lock, [this]() {
+				return stopping || !tasks.empty();
+			});
+			if (tasks.empty()) {
+				// stopping
+				return;
+			}
+			task = std::move(tasks.front());
+			tasks.pop();
+		}
+
+		// Exceptions are stored in the futures of the tasks.
+		task();
+
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			--unfinished;
+			if (unfinished == 0) {
+				allFinished.notify_all();
+			}
+		}
+	}
+}
+
+} // namespace utils
+} // namespace retdec
@@ -3,6 +3,7 @@ if(NOT TARGET retdec::yaracpp)
     find_package(retdec @PROJECT_VERSION@
         REQUIRED
         COMPONENTS
+            utils
             libyara
     )
 
@@ -4,10 +4,19 @@
  * @copyright (c) 2017 Avast Software, licensed under the MIT license
  */
 
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <list>
+#include <mutex>
+#include <random>
+#include <sstream>
+
 #include <yara.h>
 #include <yara/compiler.h>
 #include <yara/types.h>
 
+#include "retdec/utils/filesystem.h"
 #include "retdec/yaracpp/yara_detector.h"
 
 namespace retdec {
@@ -15,6 +24,394 @@ namespace yaracpp {
 
 namespace {
 
+/**
+ * Memory buffer to scan.
+ */
+struct MemoryBuffer
+{
+	const std::uint8_t* data;
+	std::size_t size;
+};
+
+/**
+ * Size, time of the last modification and hash of the content of a rule file.
+ */
+struct RuleFileInfo
+{
+	std::uintmax_t size = 0;
+	fs::file_time_type time;
+	std::string hash;
+	bool precompiled = false;
+};
+
+/**
+ * Rules compiled from files, shared by all the detectors in the process.
+ *
+ * Rules stay in the cache as long as some detector uses them. Besides that,
+ * the most recently used rules are kept even if no detector uses them, so
+ * that detectors created one after another do not compile them again.
+ */
+class RulesCache
+{
+	public:
+		RulesCache()
+		{
+			initialized = yr_initialize() == ERROR_SUCCESS;
+		}
+
+		~RulesCache()
+		{
+			recentRules.clear();
+			if (initialized)
+				yr_finalize();
+		}
+
+		/**
+		 * Find rules with the given hash.
+		 * @return Rules or @c nullptr if they are not in the cache.
+		 */
+		std::shared_ptr<YR_RULES> find(const std::string& hash)
+		{
+			auto f = rules.find(hash);
+			if (f == rules.end())
+				return nullptr;
+
+			auto result = f->second.lock();
+			if (result)
+				use(result);
+			return result;
+		}
+
+		/**
+		 * Add rules with the given hash.
+		 */
+		void insert(const std::string& hash, const std::shared_ptr<YR_RULES>& r)
+		{
+			for (auto it = rules.begin(); it != rules.end();)
+			{
+				it = it->second.expired() ? rules.erase(it) : std::next(it);
+			}
+
+			rules[hash] = r;
+			use(r);
+		}
+
+		/**
+		 * Get number of rules which are still compiled.
+		 */
+		std::size_t size() const
+		{
+			std::size_t result = 0;
+			for (const auto& r : rules)
+			{
+				result += !r.second.expired();
+			}
+			return result;
+		}
+
+		/**
+		 * Set number of the most recently used rules which are kept even
+		 * if no detector uses them.
+		 */
+		void setCapacity(std::size_t c)
+		{
+			capacity = c;
+			trim();
+		}
+
+	private:
+		void use(const std::shared_ptr<YR_RULES>& r)
+		{
+			recentRules.remove(r);
+			recentRules.push_front(r);
+			trim();
+		}
+
+		void trim()
+		{
+			while (recentRules.size() > capacity)
+				recentRules.pop_back();
+		}
+
+	public:
+		std::mutex mutex;
+		/// rule files indexed by their paths
+		std::unordered_map<std::string, RuleFileInfo> files;
+		/// directory with compiled rules (no on-disk cache if empty)
+		std::string directory;
+		bool initialized = false;
+
+	private:
+		/// compiled rules indexed by hashes of the rule files
+		std::unordered_map<std::string, std::weak_ptr<YR_RULES>> rules;
+		/// the most recently used rules, the most recent one first
+		std::list<std::shared_ptr<YR_RULES>> recentRules;
+		/// maximal size of @c recentRules
+		std::size_t capacity = 4;
+};
+
+RulesCache& getRulesCache()
+{
+	static RulesCache cache;
+	return cache;
+}
+
+/**
+ * Compute hash identifying rules compiled from the given content
+ * of a rule file in the given namespace.
+ */
+std::string getRulesHash(
+		const std::string& content,
+		const std::string& nameSpace)
+{
+	// 64-bit FNV-1a.
+	std::uint64_t hash = 0xcbf29ce484222325ULL;
+	auto add = [&hash](const std::string& str)
+	{
+		for (unsigned char c : str)
+		{
+			hash ^= c;
+			hash *= 0x100000001b3ULL;
+		}
+		hash ^= 0xff;
+		hash *= 0x100000001b3ULL;
+	};
+	add(content);
+	add(nameSpace);
+
+	std::ostringstream result;
+	result << std::hex << std::setfill('0') << std::setw(16) << hash
+			<< "-" << std::dec << content.size();
+	return result.str();
+}
+
+/**
+ * <path to text rule file, namespace of its rules>
+ */
+using RuleFileNamespaces = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * Compile text rules from the given files into a single set of rules.
+ * @return Compiled rules or @c nullptr on error.
+ */
+YR_RULES* compileRuleFiles(const RuleFileNamespaces& files)
+{
+	YR_COMPILER* compiler = nullptr;
+	if (yr_compiler_create(&compiler) != ERROR_SUCCESS)
+		return nullptr;
+
+	bool ok = true;
+	for (const auto& f : files)
+	{
+		auto* file = fopen(f.first.c_str(), "r");
+		if (!file)
+		{
+			ok = false;
+			break;
+		}
+
+		const char* ns = f.second.empty() ? nullptr : f.second.c_str();
+		ok = yr_compiler_add_file(compiler, file, ns, nullptr) == 0;
+		fclose(file);
+		if (!ok)
+			break;
+	}
+
+	YR_RULES* rules = nullptr;
+	if (ok && yr_compiler_get_rules(compiler, &rules) != ERROR_SUCCESS)
+		rules = nullptr;
+
+	yr_compiler_destroy(compiler);
+	return rules;
+}
+
+/**
+ * Store compiled rules into the given file. The file is replaced atomically,
+ * so other processes never load partially written rules.
+ */
+void saveRules(YR_RULES* rules, const std::string& pathToFile)
+{
+	const auto tmpPath = pathToFile + "."
+			+ std::to_string(std::random_device{}()) + ".tmp";
+	if (yr_rules_save(rules, tmpPath.c_str()) != ERROR_SUCCESS
+			|| std::rename(tmpPath.c_str(), pathToFile.c_str()) != 0)
+	{
+		std::remove(tmpPath.c_str());
+	}
+}
+
+/**
+ * Read the content of the given rule file.
+ * @return @c true if the file was read, @c false otherwise.
+ */
+bool readRuleFile(const std::string& pathToFile, std::string& content)
+{
+	std::ifstream file(pathToFile, std::ios::in | std::ios::binary);
+	if (!file)
+		return false;
+
+	std::ostringstream str;
+	str << file.rdbuf();
+	content = str.str();
+	return true;
+}
+
+/**
+ * Find out whether the given content of a rule file is compiled rules.
+ * Compiled rules start with the magic of YARA arenas.
+ */
+bool isPrecompiledRules(const std::string& content)
+{
+	return content.compare(0, 4, "YARA") == 0;
+}
+
+/**
+ * Get information about the given rule file. The file is read and hashed
+ * only if its size or time of the last modification changed since the last
+ * call. The cache has to be locked.
+ * @param cache Rules cache
+ * @param pathToFile Path to rule file
+ * @param info Into this parameter the information is stored
+ * @return @c true if the file was read, @c false otherwise
+ */
+bool getRuleFileInfo(
+		RulesCache& cache,
+		const std::string& pathToFile,
+		RuleFileInfo& info)
+{
+	std::error_code ec;
+	const auto size = fs::file_size(pathToFile, ec);
+	if (ec)
+		return false;
+
+	const auto time = fs::last_write_time(pathToFile, ec);
+	if (ec)
+		return false;
+
+	auto f = cache.files.find(pathToFile);
+	if (f != cache.files.end()
+			&& f->second.size == size
+			&& f->second.time == time)
+	{
+		info = f->second;
+		return true;
+	}
+
+	std::string content;
+	if (!readRuleFile(pathToFile, content))
+		return false;
+
+	info.size = size;
+	info.time = time;
+	info.hash = getRulesHash(content, std::string());
+	info.precompiled = isPrecompiledRules(content);
+	cache.files[pathToFile] = info;
+	return true;
+}
+
+/**
+ * Make rules shared by detectors.
+ */
+std::shared_ptr<YR_RULES> makeSharedRules(YR_RULES* rules)
+{
+	return std::shared_ptr<YR_RULES>(rules, [](YR_RULES* r)
+	{
+		yr_rules_destroy(r);
+	});
+}
+
+/**
+ * Get rules from the given precompiled file from the cache. If they are not
+ * there, load them and add them to the cache. The cache has to be locked.
+ * @param cache Rules cache
+ * @param hash Hash identifying the rules
+ * @param pathToFile Path to precompiled rule file
+ * @return Rules or @c nullptr on error
+ */
+std::shared_ptr<YR_RULES> getPrecompiledFileRules(
+		RulesCache& cache,
+		const std::string& hash,
+		const std::string& pathToFile)
+{
+	auto result = cache.find(hash);
+	if (result)
+		return result;
+
+	YR_RULES* rules = nullptr;
+	if (yr_rules_load(pathToFile.c_str(), &rules) != ERROR_SUCCESS)
+		return nullptr;
+
+	result = makeSharedRules(rules);
+	cache.insert(hash, result);
+	return result;
+}
+
+/**
+ * Get rules compiled from the given text files from the cache. If they are
+ * not there, load them from the cache directory or compile them, and add
+ * them to the cache. The cache has to be locked.
+ * @param cache Rules cache
+ * @param hash  Hash identifying the rules
+ * @param files Text rule files and namespaces of their rules
+ * @return Rules or @c nullptr on error
+ */
+std::shared_ptr<YR_RULES> getTextFileRules(
+		RulesCache& cache,
+		const std::string& hash,
+		const RuleFileNamespaces& files)
+{
+	auto result = cache.find(hash);
+	if (result)
+		return result;
+
+	YR_RULES* rules = nullptr;
+	const auto cachePath = cache.directory.empty()
+			? std::string()
+			: cache.directory + "/" + hash + ".yarac";
+	if (cachePath.empty()
+			|| yr_rules_load(cachePath.c_str(), &rules) != ERROR_SUCCESS)
+	{
+		rules = compileRuleFiles(files);
+		if (!rules)
+			return nullptr;
+
+		if (!cachePath.empty())
+			saveRules(rules, cachePath);
+	}
+
+	result = makeSharedRules(rules);
+	cache.insert(hash, result);
+	return result;
+}
+
+/**
+ * Get rules from the given file. Each file (identified by its content and
+ * namespace) is compiled only once while its rules are cached, or not at all
+ * if its compiled rules are found in the cache directory. The cache has to
+ * be locked.
+ * @param cache Rules cache
+ * @param pathToFile Path to rule file (text or precompiled)
+ * @param nameSpace Namespace of rules from a text file
+ * @return Rules or @c nullptr on error
+ */
+std::shared_ptr<YR_RULES> getFileRules(
+		RulesCache& cache,
+		const std::string& pathToFile,
+		const std::string& nameSpace)
+{
+	RuleFileInfo info;
+	if (!getRuleFileInfo(cache, pathToFile, info))
+		return nullptr;
+
+	if (info.precompiled)
+		return getPrecompiledFileRules(cache, info.hash, pathToFile);
+
+	return getTextFileRules(
+			cache,
+			getRulesHash(info.hash, nameSpace),
+			{{pathToFile, nameSpace}});
+}
+
 /**
  * Interface for YARA scanning interface. Uses template specialization
  * to decide whether to scan file or memory buffer.
@@ -67,6 +464,29 @@ struct Scanner<std::vector<std::uint8_t>>
 	}
 };
 
+/**
+ * Specialization for scanning memory buffers given by pointer and size.
+ */
+template <>
+struct Scanner<MemoryBuffer>
+{
+	static bool scan(
+			YR_RULES* rules,
+			YR_CALLBACK_FUNC callback,
+			YaraDetector::CallbackSettings& settings,
+			const MemoryBuffer& buffer)
+	{
+		return yr_rules_scan_mem(
+				rules,
+				const_cast<uint8_t*>(buffer.data),
+				buffer.size,
+				0,
+				callback,
+				&settings, 0
+		) == ERROR_SUCCESS;
+	}
+};
+
 /**
  * Interface for Scanner. Provides template type deduction and
  * always passes correct type into Scanner template.
@@ -104,29 +524,17 @@ YaraDetector::YaraDetector()
  */
 YaraDetector::~YaraDetector()
 {
-	for (auto* file : files)
-	{
-		if (file)
-			fclose(file);
-	}
-
-	files.clear();
 	detectedRules.clear();
 	undetectedRules.clear();
+	fileRules.clear();
 
 	if (compiler)
 	{
 		yr_compiler_destroy(compiler);
 	}
 
-	if (textFilesRules)
-		yr_rules_destroy(textFilesRules);
-
-	for (auto* rules : precompiledRules)
-	{
-		if (rules)
-			yr_rules_destroy(rules);
-	}
+	if (textRules)
+		yr_rules_destroy(textRules);
 
 	yr_finalize();
 }
@@ -226,6 +634,7 @@ int YaraDetector::yaraCallback(
 
 	YaraRule actual;
 	actual.setName(actRule->identifier);
+	actual.setNamespace(actRule->ns->name);
 	YR_META *meta;
 	yr_rule_metas_foreach(actRule, meta)
 	{
@@ -290,8 +699,8 @@ bool YaraDetector::addRules(const char *string)
 }
 
 /**
- * Add external file with text rules
- * @param pathToFile Path to rule file
+ * Add external file with rules
+ * @param pathToFile Path to rule file (text or precompiled)
  * @param nameSpace Namespace to use for the given rule file. If the file is
  *                  already compiled, this has no effect. If it is a text file,
  *                  this allows to have multiple rules with the same ID across
@@ -301,33 +710,140 @@ bool YaraDetector::addRuleFile(
 		const std::string &pathToFile,
 		const std::string &nameSpace)
 {
-	// AT first, try to load the files as precompiled file
-	YR_RULES* rules = nullptr;
-	if (yr_rules_load(pathToFile.c_str(), &rules) == ERROR_SUCCESS)
-	{
-		precompiledRules.push_back(rules);
-	}
-	// If we didn't succeeded consider it as text file
-	else
+	auto& cache = getRulesCache();
+	std::lock_guard<std::mutex> lock(cache.mutex);
+
+	auto rules = getFileRules(cache, pathToFile, nameSpace);
+	if (!rules)
+		return false;
+
+	fileRules.push_back(std::move(rules));
+	return true;
+}
+
+/**
+ * Add external files with rules. Rules from each text file are in a namespace
+ * named by the path to the file (see YaraRule::getNamespace()), so the files
+ * may use the same rule IDs.
+ * @param pathsToFiles Paths to rule files (text or precompiled)
+ * @return @c true if all the files were added, @c false otherwise. In such
+ *         a case, none of the files is added.
+ */
+bool YaraDetector::addRuleFiles(const std::vector<std::string> &pathsToFiles)
+{
+	return addRuleFiles(pathsToFiles, pathsToFiles);
+}
+
+/**
+ * Add external files with rules. All text files are compiled together into
+ * a single set of rules, so that the input is scanned only once for all of
+ * them and their rules may refer to rules from the other files in the same
+ * namespace. Precompiled files cannot be merged with other rules, they are
+ * added one by one as by addRuleFile().
+ * @param pathsToFiles Paths to rule files (text or precompiled)
+ * @param nameSpaces Namespaces of rules from the files (empty string for the
+ *                   default namespace), one for each file
+ * @return @c true if all the files were added, @c false otherwise. In such
+ *         a case, none of the files is added.
+ */
+bool YaraDetector::addRuleFiles(
+		const std::vector<std::string> &pathsToFiles,
+		const std::vector<std::string> &nameSpaces)
+{
+	if (pathsToFiles.size() != nameSpaces.size())
+		return false;
+
+	auto& cache = getRulesCache();
+	std::lock_guard<std::mutex> lock(cache.mutex);
+
+	std::vector<std::shared_ptr<YR_RULES>> rules;
+	RuleFileNamespaces textFiles;
+	std::string textHashes;
+	for (std::size_t i = 0, e = pathsToFiles.size(); i < e; ++i)
 	{
-		auto file = fopen(pathToFile.c_str(), "r");
-		if (!file)
+		RuleFileInfo info;
+		if (!getRuleFileInfo(cache, pathsToFiles[i], info))
 			return false;
 
-		const char* ns = nameSpace.empty() ? nullptr : nameSpace.c_str();
-		if (yr_compiler_add_file(compiler, file, ns, nullptr) != 0)
+		if (info.precompiled)
 		{
-			fclose(file);
-			return false;
+			auto r = getPrecompiledFileRules(cache, info.hash, pathsToFiles[i]);
+			if (!r)
+				return false;
+			rules.push_back(std::move(r));
+		}
+		else
+		{
+			textFiles.emplace_back(pathsToFiles[i], nameSpaces[i]);
+			textHashes += getRulesHash(info.hash, nameSpaces[i]);
 		}
+	}
 
-		files.push_back(file);
-		needsRecompilation = true;
+	if (!textFiles.empty())
+	{
+		auto r = getTextFileRules(
+				cache,
+				getRulesHash(textHashes, std::string()),
+				textFiles);
+		if (!r)
+			return false;
+		rules.push_back(std::move(r));
 	}
 
+	fileRules.insert(fileRules.end(), rules.begin(), rules.end());
 	return true;
 }
 
+/**
+ * Find out whether the given file contains precompiled rules.
+ * @param pathToFile Path to rule file
+ * @return @c true if the file contains precompiled rules, @c false if it
+ *         is a text file or it cannot be read
+ */
+bool YaraDetector::isPrecompiledRuleFile(const std::string &pathToFile)
+{
+	std::ifstream file(pathToFile, std::ios::in | std::ios::binary);
+	char magic[4] = {};
+	return file.read(magic, sizeof(magic))
+			&& isPrecompiledRules(std::string(magic, sizeof(magic)));
+}
+
+/**
+ * Set directory where compiled rules from text files are stored and looked up.
+ * The directory must exist. Empty path disables the on-disk cache.
+ * @param pathToDirectory Path to the directory
+ */
+void YaraDetector::setCacheDirectory(const std::string &pathToDirectory)
+{
+	auto& cache = getRulesCache();
+	std::lock_guard<std::mutex> lock(cache.mutex);
+	cache.directory = pathToDirectory;
+}
+
+/**
+ * Set number of the most recently used rules from files which are kept
+ * compiled even if no detector uses them. Rules used by some detector are
+ * always kept.
+ * @param capacity Number of the rules
+ */
+void YaraDetector::setCacheCapacity(std::size_t capacity)
+{
+	auto& cache = getRulesCache();
+	std::lock_guard<std::mutex> lock(cache.mutex);
+	cache.setCapacity(capacity);
+}
+
+/**
+ * Get number of rules from files which are compiled in the cache
+ * @return Number of the rules
+ */
+std::size_t YaraDetector::getNumberOfCachedRules()
+{
+	auto& cache = getRulesCache();
+	std::lock_guard<std::mutex> lock(cache.mutex);
+	return cache.size();
+}
+
 /**
  * Getter for state of instance
  * @return @c true if all is OK, @c false otherwise
@@ -358,11 +874,29 @@ bool YaraDetector::analyze(
  *                      store all rules (not only detected)
  * @return @c true if analysis completed without any error, otherwise @c false.
  */
-bool YaraDetector::analyze(std::vector<std::uint8_t> &bytes, bool storeAllRules)
+bool YaraDetector::analyze(
+		const std::vector<std::uint8_t> &bytes,
+		bool storeAllRules)
 {
 	return analyzeWithScan(bytes, storeAllRules);
 }
 
+/**
+ * Analyze input bytes
+ * @param data Input bytes
+ * @param size Number of input bytes
+ * @param storeAllRules If this parameter is set to @c true,
+ *                      store all rules (not only detected)
+ * @return @c true if analysis completed without any error, otherwise @c false.
+ */
+bool YaraDetector::analyze(
+		const std::uint8_t *data,
+		std::size_t size,
+		bool storeAllRules)
+{
+	return analyzeWithScan(MemoryBuffer{data, size}, storeAllRules);
+}
+
 /**
  * Get detected rules
  * @return Detected rules
@@ -397,16 +931,19 @@ bool YaraDetector::analyzeWithScan(T&& value, bool storeAllRules)
 			undetectedRules
 	);
 
-	auto rules = getCompiledRules();
-	if (!(rules))
-		return false;
+	if (needsRecompilation || textRules)
+	{
+		auto rules = getCompiledRules();
+		if (!(rules))
+			return false;
 
-	if (!scan(rules, yaraCallback, settings, std::forward<T>(value)))
-		return false;
+		if (!scan(rules, yaraCallback, settings, value))
+			return false;
+	}
 
-	for (auto* rules : precompiledRules)
+	for (const auto& rules : fileRules)
 	{
-		if (!scan(rules, yaraCallback, settings, std::forward<T>(value)))
+		if (!scan(rules.get(), yaraCallback, settings, value))
 			return false;
 	}
 
@@ -414,15 +951,14 @@ bool YaraDetector::analyzeWithScan(T&& value, bool storeAllRules)
 }
 
 /**
- * Returns the compiled rules from text files.
+ * Returns the compiled rules from text strings.
  * @return Compiled rules.
  */
 YR_RULES* YaraDetector::getCompiledRules()
 {
-	// File is text file and needs to be compiled first
-	// All text files are compiled into single YR_RULES structure and
+	// All text strings are compiled into single YR_RULES structure and
 	// we shouldn't compile it twice if it's not needed
-	// analyze() called for the first time or the file was added since the
+	// analyze() called for the first time or the string was added since the
 	// last analyze() call
 	if (needsRecompilation)
 	{
@@ -430,14 +966,14 @@ YR_RULES* YaraDetector::getCompiledRules()
 		if (yr_compiler_get_rules(compiler, &rules) != ERROR_SUCCESS)
 			return nullptr;
 
-		if (textFilesRules)
-			yr_rules_destroy(textFilesRules);
+		if (textRules)
+			yr_rules_destroy(textRules);
 
-		textFilesRules = rules;
+		textRules = rules;
 		needsRecompilation = false;
 	}
 
-	return textFilesRules;
+	return textRules;
 }
 
 } // namespace yaracpp
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+
+"""Create an index of ordinal numbers from *.ord files.
+Usage: index-ordinals.py ordinals-path index-path
+    ordinals-path Path to the directory with *.ord files of one architecture.
+    index-path    Path to the index file to create.
+
+Each *.ord file maps ordinal numbers of functions exported from a single
+library to their names. A library is identified by the name of its file
+without the ".ord" suffix. Each line of the file contains an ordinal number
+and a function name separated by whitespace.
+
+The index is a single hash table keyed by (library name, ordinal number), so
+a name can be looked up without reading or parsing any *.ord file. All numbers
+are stored in little endian:
+    header       magic "RDORDIDX", format version (u32), number of slots (u32)
+    slots        hash (u32), ordinal (u32), library offset (u32),
+                 name offset (u32) for each slot; a zero name offset marks an
+                 empty slot
+    string pool  null-terminated library and function names; the offsets above
+                 are relative to the beginning of the pool
+The keys are hashed by 32-bit FNV-1a over the library name followed by the
+ordinal number. Collisions are resolved by linear probing.
+
+The lookup side is implemented in src/bin2llvmir/utils/ordinals.cpp. Keep the
+two in sync.
+"""
+
+import os
+import struct
+import sys
+
+MAGIC = b'RDORDIDX'
+VERSION = 1
+ORD_SUFFIX = '.ord'
+
+FNV_OFFSET_BASIS = 0x811c9dc5
+FNV_PRIME = 0x01000193
+
+
+def print_help():
+    print('Usage: %s ordinals-path index-path' % sys.argv[0])
+
+
+def get_arguments():
+    if len(sys.argv) != 3:
+        print_help()
+        sys.exit(1)
+    return sys.argv[1], sys.argv[2]
+
+
+def fnv1a(data, h=FNV_OFFSET_BASIS):
+    for b in data:
+        h = ((h ^ b) * FNV_PRIME) & 0xffffffff
+    return h
+
+
+def key_hash(lib, ordinal):
+    return fnv1a(struct.pack('<I', ordinal), fnv1a(lib))
+
+
+def parse_ord_file(path):
+    """ Return a dictionary (ordinal -> name) of the given *.ord file.
+    Lines that do not start with a non-negative ordinal number are skipped.
+    If an ordinal is listed several times, the last name wins.
+    """
+    ords = {}
+    with open(path, 'rb') as f:
+        for line in f:
+            parts = line.split()
+            if not parts:
+                continue
+            try:
+                ordinal = int(parts[0])
+            except ValueError:
+                continue
+            if 0 <= ordinal <= 0xffffffff and len(parts) > 1:
+                ords[ordinal] = parts[1]
+    return ords
+
+
+def read_ordinals(ordinals_dir):
+    """ Return a dictionary (library name -> (ordinal -> name)) of all *.ord
+    files in the given directory.
+    """
+    libs = {}
+    for filename in sorted(os.listdir(ordinals_dir)):
+        if filename.endswith(ORD_SUFFIX):
+            lib = filename[:-len(ORD_SUFFIX)].encode('utf-8')
+            libs[lib] = parse_ord_file(os.path.join(ordinals_dir, filename))
+    return libs
+
+
+def create_index(libs):
+    entries = sum(len(ords) for ords in libs.values())
+
+    # Keep the load factor at most 0.5 so that probe sequences stay short.
+    slot_count = 1
+    while slot_count < 2 * entries:
+        slot_count *= 2
+    mask = slot_count - 1
+
+    # Offset 0 is reserved for empty slots.
+    pool = bytearray(b'\0')
+    strings = {}
+
+    def add_string(s):
+        offset = strings.get(s)
+        if offset is None:
+            offset = len(pool)
+            pool.extend(s + b'\0')
+            strings[s] = offset
+        return offset
+
+    slots = [None] * slot_count
+    for lib, ords in libs.items():
+        lib_offset = add_string(lib)
+        for ordinal, name in sorted(ords.items()):
+            h = key_hash(lib, ordinal)
+            i = h & mask
+            while slots[i] is not None:
+                i = (i + 1) & mask
+            slots[i] = (h, ordinal, lib_offset, add_string(name))
+
+    data = bytearray(MAGIC)
+    data.extend(struct.pack('<II', VERSION, slot_count))
+    empty = struct.pack('<IIII', 0, 0, 0, 0)
+    for slot in slots:
+        data.extend(empty if slot is None else struct.pack('<IIII', *slot))
+    data.extend(pool)
+    return data
+
+
+def main():
+    ordinals_dir, index_path = get_arguments()
+    index = create_index(read_ordinals(ordinals_dir))
+
+    os.makedirs(os.path.dirname(os.path.abspath(index_path)), exist_ok=True)
+    tmp_path = index_path + '.tmp'
+    with open(tmp_path, 'wb') as f:
+        f.write(index)
+    os.replace(tmp_path, index_path)
+
+    sys.exit(0)
+
+
+if __name__ == '__main__':
+    main()
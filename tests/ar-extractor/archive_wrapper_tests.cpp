@@ -0,0 +1,213 @@
+/**
+ * @file tests/ar-extractor/archive_wrapper_tests.cpp
+ * @brief Tests for the @c archive_wrapper module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/ar-extractor/archive_wrapper.h"
+#include "retdec/utils/filesystem.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace ar_extractor {
+namespace tests {
+
+const std::vector<std::uint8_t> firstObject = {
+	'f', 'i', 'r', 's', 't'
+};
+
+const std::vector<std::uint8_t> secondObject = {
+	's', 'e', 'c', 'o', 'n', 'd', '!', '\n'
+};
+
+/**
+ * Create content of a normal archive with the given objects.
+ */
+std::vector<std::uint8_t> createArchive(
+		const std::vector<std::pair<std::string, std::vector<std::uint8_t>>>& objects)
+{
+	std::string content = "!<arch>\n";
+	for (const auto& object : objects)
+	{
+		auto field = [&](const std::string& value, std::size_t width)
+		{
+			content += value + std::string(width - value.size(), ' ');
+		};
+		field(object.first + "/", 16);
+		field("0", 12);
+		field("0", 6);
+		field("0", 6);
+		field("644", 8);
+		field(std::to_string(object.second.size()), 10);
+		content += "`\n";
+		content.append(object.second.begin(), object.second.end());
+		if (object.second.size() % 2)
+		{
+			content += '\n';
+		}
+	}
+	return std::vector<std::uint8_t>(content.begin(), content.end());
+}
+
+/**
+ * Tests for the @c archive_wrapper module.
+ */
+class ArchiveWrapperTests : public Test
+{
+	protected:
+		std::vector<std::uint8_t> archiveBytes = createArchive({
+			{"first.o", firstObject},
+			{"second.o", secondObject},
+			{"first.o", secondObject}
+		});
+		std::vector<std::string> files;
+
+	public:
+		~ArchiveWrapperTests()
+		{
+			for (const auto& f : files)
+			{
+				fs::remove(f);
+			}
+		}
+
+		std::string tempPath(const std::string& name)
+		{
+			auto path = (fs::temp_directory_path()
+					/ ("retdec-tests-ar-extractor-" + name)).string();
+			files.push_back(path);
+			return path;
+		}
+
+		std::vector<std::uint8_t> readFile(const std::string& path)
+		{
+			std::ifstream file(path, std::ios::binary);
+			return std::vector<std::uint8_t>(
+					std::istreambuf_iterator<char>(file),
+					std::istreambuf_iterator<char>());
+		}
+};
+
+TEST_F(ArchiveWrapperTests, ArchiveIsReadFromMemory)
+{
+	bool success = false;
+	std::string error;
+	ArchiveWrapper archive(archiveBytes.data(), archiveBytes.size(), success, error);
+
+	ASSERT_TRUE(success) << error;
+	EXPECT_EQ(3, archive.getNumberOfObjects());
+	EXPECT_FALSE(archive.isThinArchive());
+	EXPECT_FALSE(archive.isEmptyArchive());
+
+	std::string list;
+	EXPECT_TRUE(archive.getPlainTextList(list, error));
+	EXPECT_EQ("0\tfirst.o\n1\tsecond.o\n2\tfirst.o\n", list);
+}
+
+TEST_F(ArchiveWrapperTests, EmptyArchiveIsReadFromMemory)
+{
+	const auto bytes = createArchive({});
+	bool success = false;
+	std::string error;
+	ArchiveWrapper archive(bytes.data(), bytes.size(), success, error);
+
+	ASSERT_TRUE(success) << error;
+	EXPECT_EQ(0, archive.getNumberOfObjects());
+	EXPECT_TRUE(archive.isEmptyArchive());
+}
+
+TEST_F(ArchiveWrapperTests, InvalidArchiveInMemoryIsRejected)
+{
+	const std::vector<std::uint8_t> bytes = {
+		'!', '<', 'a', 'r', 'c', 'h', '>', '\n', 'x'
+	};
+	bool success = true;
+	std::string error;
+	ArchiveWrapper archive(bytes.data(), bytes.size(), success, error);
+
+	EXPECT_FALSE(success);
+	EXPECT_FALSE(error.empty());
+}
+
+TEST_F(ArchiveWrapperTests, ObjectsAreExtractedByIndexIntoMemory)
+{
+	bool success = false;
+	std::string error;
+	ArchiveWrapper archive(archiveBytes.data(), archiveBytes.size(), success, error);
+	ASSERT_TRUE(success) << error;
+	std::vector<std::uint8_t> data;
+
+	EXPECT_TRUE(archive.extractByIndex(0, error, data));
+	EXPECT_EQ(firstObject, data);
+	EXPECT_TRUE(archive.extractByIndex(1, error, data));
+	EXPECT_EQ(secondObject, data);
+	EXPECT_TRUE(archive.extractByIndex(2, error, data));
+	EXPECT_EQ(secondObject, data);
+}
+
+TEST_F(ArchiveWrapperTests, ObjectsAreExtractedByNameIntoMemory)
+{
+	bool success = false;
+	std::string error;
+	ArchiveWrapper archive(archiveBytes.data(), archiveBytes.size(), success, error);
+	ASSERT_TRUE(success) << error;
+	std::vector<std::uint8_t> data;
+
+	EXPECT_TRUE(archive.extractByName("second.o", error, data));
+	EXPECT_EQ(secondObject, data);
+	// Only the first of the objects with the same name is extracted.
+	EXPECT_TRUE(archive.extractByName("first.o", error, data));
+	EXPECT_EQ(firstObject, data);
+}
+
+TEST_F(ArchiveWrapperTests, MissingObjectIsNotExtractedIntoMemory)
+{
+	bool success = false;
+	std::string error;
+	ArchiveWrapper archive(archiveBytes.data(), archiveBytes.size(), success, error);
+	ASSERT_TRUE(success) << error;
+	std::vector<std::uint8_t> data;
+
+	EXPECT_FALSE(archive.extractByIndex(3, error, data));
+	EXPECT_EQ("Could not find desired file", error);
+	error.clear();
+	EXPECT_FALSE(archive.extractByName("third.o", error, data));
+	EXPECT_EQ("Could not find desired file", error);
+	EXPECT_TRUE(data.empty());
+}
+
+TEST_F(ArchiveWrapperTests, ExtractionIntoMemoryGivesSameContentAsExtractionIntoFile)
+{
+	const auto archivePath = tempPath("archive.a");
+	std::ofstream(archivePath, std::ios::binary).write(
+			reinterpret_cast<const char*>(archiveBytes.data()),
+			archiveBytes.size());
+	bool success = false;
+	std::string error;
+	ArchiveWrapper fileArchive(archivePath, success, error);
+	ASSERT_TRUE(success) << error;
+	ArchiveWrapper memoryArchive(archiveBytes.data(), archiveBytes.size(), success, error);
+	ASSERT_TRUE(success) << error;
+
+	for (std::size_t i = 0; i < memoryArchive.getNumberOfObjects(); ++i)
+	{
+		const auto path = tempPath("object-" + std::to_string(i) + ".o");
+		std::vector<std::uint8_t> data;
+		EXPECT_TRUE(fileArchive.extractByIndex(i, error, path)) << error;
+		EXPECT_TRUE(memoryArchive.extractByIndex(i, error, data)) << error;
+		EXPECT_EQ(readFile(path), data);
+	}
+}
+
+} // namespace tests
+} // namespace ar_extractor
+} // namespace retdec
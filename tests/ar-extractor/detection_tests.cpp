@@ -0,0 +1,82 @@
+/**
+ * @file tests/ar-extractor/detection_tests.cpp
+ * @brief Tests for the @c detection module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/ar-extractor/detection.h"
+#include "retdec/utils/filesystem.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace ar_extractor {
+namespace tests {
+
+/**
+ * Tests for the @c detection module.
+ */
+class DetectionTests : public Test
+{
+	protected:
+		std::string path = (fs::temp_directory_path()
+				/ "retdec-tests-ar-extractor-detection").string();
+
+	public:
+		~DetectionTests()
+		{
+			fs::remove(path);
+		}
+
+		/**
+		 * Check that detection in memory agrees with detection in a file
+		 * with the same content and return its result.
+		 */
+		bool isArchiveContent(const std::string& content)
+		{
+			std::ofstream(path, std::ios::binary) << content;
+			const auto* data = reinterpret_cast<const std::uint8_t*>(
+					content.data());
+			bool result = isArchive(data, content.size());
+			EXPECT_EQ(isArchive(path), result) << content;
+			return result;
+		}
+};
+
+TEST_F(DetectionTests, NormalArchiveIsDetectedInMemory)
+{
+	EXPECT_TRUE(isArchiveContent("!<arch>"));
+	EXPECT_TRUE(isArchiveContent("!<arch>\n"));
+	EXPECT_TRUE(isArchiveContent("!<arch>\nfirst.o/"));
+}
+
+TEST_F(DetectionTests, ThinArchiveIsDetectedInMemory)
+{
+	EXPECT_TRUE(isArchiveContent("!<thin>"));
+	EXPECT_TRUE(isArchiveContent("!<thin>\n"));
+	EXPECT_TRUE(isArchiveContent("!<thin>\nfirst.o/"));
+}
+
+TEST_F(DetectionTests, OtherContentIsNotDetectedInMemory)
+{
+	EXPECT_FALSE(isArchiveContent(""));
+	EXPECT_FALSE(isArchiveContent("!<arch"));
+	EXPECT_FALSE(isArchiveContent("!<thin"));
+	EXPECT_FALSE(isArchiveContent("\x7f" "ELF\x01\x01\x01\x00"));
+	EXPECT_FALSE(isArchiveContent(" !<arch>\n"));
+}
+
+TEST_F(DetectionTests, NullDataOfZeroSizeIsNotArchive)
+{
+	EXPECT_FALSE(isArchive(nullptr, 0));
+}
+
+} // namespace tests
+} // namespace ar_extractor
+} // namespace retdec
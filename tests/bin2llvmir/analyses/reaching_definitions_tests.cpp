@@ -44,6 +44,145 @@ DummyTest)
 	EXPECT_EQ( nullptr, module->getGlobalVariable("glob1") );
 }
 
+TEST_F(ReachingDefinitionsTests,
+useInSameBasicBlockHasOnlyLastDefinitionBeforeIt)
+{
+	parseInput(R"(
+		@r = global i32 0
+		define void @fnc() {
+			store i32 1, i32* @r
+			store i32 2, i32* @r
+			%x = load i32, i32* @r
+			ret void
+		}
+	)");
+	auto* s2 = getNthInstruction<StoreInst>(1);
+	auto* x = getInstructionByName("x");
+
+	RDA.runOnModule(*module);
+
+	ASSERT_EQ(1, RDA.defsFromUse(x).size());
+	EXPECT_EQ(s2, (*RDA.defsFromUse(x).begin())->def);
+}
+
+TEST_F(ReachingDefinitionsTests,
+useGetsDefinitionsFromAllPredecessors)
+{
+	parseInput(R"(
+		@r = global i32 0
+		define void @fnc(i1 %c) {
+		entry:
+			br i1 %c, label %left, label %right
+		left:
+			store i32 1, i32* @r
+			br label %end
+		right:
+			store i32 2, i32* @r
+			br label %end
+		end:
+			%x = load i32, i32* @r
+			ret void
+		}
+	)");
+	auto* s1 = getNthInstruction<StoreInst>(0);
+	auto* s2 = getNthInstruction<StoreInst>(1);
+	auto* x = getInstructionByName("x");
+
+	RDA.runOnModule(*module);
+
+	std::set<llvm::Instruction*> defs;
+	for (auto* d : RDA.defsFromUse(x))
+	{
+		defs.insert(d->def);
+	}
+	EXPECT_EQ(std::set<llvm::Instruction*>({s1, s2}), defs);
+	EXPECT_EQ(1, RDA.usesFromDef(s1).size());
+	EXPECT_EQ(1, RDA.usesFromDef(s2).size());
+}
+
+TEST_F(ReachingDefinitionsTests,
+definitionInLoopReachesLoopHeader)
+{
+	parseInput(R"(
+		@r = global i32 0
+		define void @fnc(i1 %c) {
+		entry:
+			store i32 1, i32* @r
+			br label %loop
+		loop:
+			%x = load i32, i32* @r
+			br i1 %c, label %body, label %end
+		body:
+			store i32 2, i32* @r
+			br label %loop
+		end:
+			%y = load i32, i32* @r
+			ret void
+		}
+	)");
+	auto* s1 = getNthInstruction<StoreInst>(0);
+	auto* s2 = getNthInstruction<StoreInst>(1);
+	auto* x = getInstructionByName("x");
+	auto* y = getInstructionByName("y");
+
+	RDA.runOnModule(*module);
+
+	std::set<llvm::Instruction*> xDefs;
+	for (auto* d : RDA.defsFromUse(x))
+	{
+		xDefs.insert(d->def);
+	}
+	std::set<llvm::Instruction*> yDefs;
+	for (auto* d : RDA.defsFromUse(y))
+	{
+		yDefs.insert(d->def);
+	}
+	EXPECT_EQ(std::set<llvm::Instruction*>({s1, s2}), xDefs);
+	EXPECT_EQ(std::set<llvm::Instruction*>({s1, s2}), yDefs);
+}
+
+TEST_F(ReachingDefinitionsTests,
+parallelRunGivesSameResultsAsSerialRun)
+{
+	parseInput(R"(
+		@r = global i32 0
+		define void @f1(i1 %c) {
+		entry:
+			store i32 1, i32* @r
+			br i1 %c, label %a, label %b
+		a:
+			store i32 2, i32* @r
+			br label %b
+		b:
+			%x1 = load i32, i32* @r
+			ret void
+		}
+		define void @f2() {
+			store i32 3, i32* @r
+			%x2 = load i32, i32* @r
+			ret void
+		}
+		define void @f3() {
+			%x3 = load i32, i32* @r
+			ret void
+		}
+	)");
+	auto* x1 = getInstructionByName("x1");
+	auto* x2 = getInstructionByName("x2");
+	auto* x3 = getInstructionByName("x3");
+
+	ReachingDefinitionsAnalysis serial;
+	serial.runOnModule(*module);
+	RDA.runOnModule(*module, nullptr, false, 4);
+
+	EXPECT_EQ(2, RDA.defsFromUse(x1).size());
+	EXPECT_EQ(1, RDA.defsFromUse(x2).size());
+	EXPECT_EQ(0, RDA.defsFromUse(x3).size());
+	EXPECT_EQ(serial.defsFromUse(x1).size(), RDA.defsFromUse(x1).size());
+	EXPECT_EQ(serial.defsFromUse(x2).size(), RDA.defsFromUse(x2).size());
+	EXPECT_EQ(serial.defsFromUse(x3).size(), RDA.defsFromUse(x3).size());
+}
+
 } // namespace tests
 } // namespace bin2llvmir
 } // namespace retdec
@@ -0,0 +1,135 @@
+/**
+* @file tests/bin2llvmir/analyses/symbolic_tree_tests.cpp
+* @brief Tests for the @c SymbolicTree analysis.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include "retdec/bin2llvmir/analyses/symbolic_tree.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c SymbolicTree analysis.
+ */
+class SymbolicTreeTests: public LlvmIrTests
+{
+	protected:
+		/**
+		 * Check that levels of all the nodes in @a tree follow from their
+		 * depth in the tree.
+		 */
+		void checkLevels(SymbolicTree& tree)
+		{
+			for (auto* node : tree.getPreOrder())
+			{
+				for (auto& op : node->ops)
+				{
+					EXPECT_EQ(node->getLevel() + 1, op.getLevel());
+				}
+			}
+		}
+};
+
+TEST_F(SymbolicTreeTests,
+subtreeReachedSeveralTimesIsInTheTreeEveryTime)
+{
+	parseInput(R"(
+		@g = global i32 0
+		define void @fnc() {
+			%a0 = load i32, i32* @g
+			%a1 = add i32 %a0, %a0
+			%a2 = add i32 %a1, %a1
+			%a3 = add i32 %a2, %a2
+			%a4 = add i32 %a3, %a3
+			ret void
+		}
+	)");
+	auto* a4 = getValueByName("a4");
+	auto* a0 = getValueByName("a0");
+	auto* g = getValueByName("g");
+
+	auto root = SymbolicTree::OnDemandRda(a4);
+
+	// 31 additions and loads, each load with the global and its initializer.
+	EXPECT_EQ(63, root.getPostOrder().size());
+	auto& leftLoad = root.ops[0].ops[0].ops[0].ops[0];
+	auto& rightLoad = root.ops[1].ops[1].ops[1].ops[1];
+	EXPECT_EQ(a0, leftLoad.value);
+	EXPECT_EQ(a0, rightLoad.value);
+	ASSERT_EQ(1, rightLoad.ops.size());
+	EXPECT_EQ(g, rightLoad.ops[0].value);
+	EXPECT_EQ(5, rightLoad.ops[0].getLevel());
+	checkLevels(root);
+}
+
+TEST_F(SymbolicTreeTests,
+subtreeReachedOnDifferentLevelsIsExpandedToTheLevelLimit)
+{
+	parseInput(R"(
+		@g = global i32 0
+		define void @fnc(i32 %y) {
+			%x = add i32 %y, 1
+			store i32 %x, i32* @g
+			%a = load i32, i32* @g
+			%b = add i32 %a, %a
+			%c = add i32 %b, 1
+			%d = add i32 %b, %c
+			ret void
+		}
+	)");
+	auto* b = getValueByName("b");
+
+	auto root = SymbolicTree::OnDemandRda(getValueByName("d"), 4);
+
+	// %b is reached on levels 1 and 2, its loads are reached twice on each.
+	auto& shallowB = root.ops[0];
+	auto& deepB = root.ops[1].ops[0];
+	EXPECT_EQ(b, shallowB.value);
+	EXPECT_EQ(b, deepB.value);
+	EXPECT_EQ(9, shallowB.getPostOrder().size());
+	EXPECT_EQ(5, deepB.getPostOrder().size());
+	for (auto* node : root.getPostOrder())
+	{
+		EXPECT_GE(4, node->getLevel());
+	}
+	checkLevels(root);
+}
+
+TEST_F(SymbolicTreeTests,
+copiesOfSharedSubtreeAreIndependent)
+{
+	parseInput(R"(
+		@g = global i32 0
+		define void @fnc() {
+			%a = load i32, i32* @g
+			%b = add i32 %a, 1
+			%c = add i32 %b, %b
+			%d = add i32 %c, %b
+			ret void
+		}
+	)");
+	auto* b = getValueByName("b");
+	auto* g = getValueByName("g");
+
+	auto root = SymbolicTree::OnDemandRda(getValueByName("d"));
+	auto& first = root.ops[0].ops[0];
+	auto& second = root.ops[0].ops[1];
+	auto& third = root.ops[1];
+	first.ops.clear();
+	second.ops[0].ops[0].value = b;
+
+	EXPECT_EQ(2, third.ops.size());
+	EXPECT_EQ(g, third.ops[0].ops[0].value);
+	EXPECT_EQ(2, second.ops.size());
+	EXPECT_EQ(b, second.ops[0].ops[0].value);
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include "retdec/bin2llvmir/providers/asm_instruction.h"
+#include "retdec/bin2llvmir/providers/capstone_insn_store.h"
 #include "bin2llvmir/utils/llvmir_tests.h"
 
 using namespace ::testing;
@@ -21,7 +22,22 @@ namespace tests {
  */
 class AsmInstructionTests: public LlvmIrTests
 {
-
+	protected:
+		/// x86 @c nop decoded by Capstone.
+		static cs_insn* createCapstoneInsn()
+		{
+			const std::uint8_t nop[] = {0x90};
+			const std::uint8_t* code = nop;
+			std::size_t size = sizeof(nop);
+			std::uint64_t address = 1234;
+
+			csh ce = 0;
+			cs_open(CS_ARCH_X86, CS_MODE_32, &ce);
+			auto* insn = cs_malloc(ce);
+			cs_disasm_iter(ce, &code, &size, &address, insn);
+			cs_close(&ce);
+			return insn;
+		}
 };
 
 //
@@ -357,6 +373,48 @@ TEST_F(AsmInstructionTests, AsmInstructionCtorAddressConstructsValidForGoodAddre
 	EXPECT_EQ(ref, a.getLlvmToAsmInstruction());
 }
 
+TEST_F(AsmInstructionTests, AsmInstructionCtorAddressConstructsValidForIndexedAddress)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto* ref = getNthInstruction<StoreInst>();
+	auto* insn = createCapstoneInsn();
+	AsmInstruction::addCapstoneInsn(module.get(), ref, insn, CS_MODE_32);
+	auto a = AsmInstruction(module.get(), 1234);
+
+	EXPECT_TRUE(a.isValid());
+	EXPECT_EQ(ref, a.getLlvmToAsmInstruction());
+	EXPECT_EQ(insn, a.getCapstoneInsn());
+}
+
+TEST_F(AsmInstructionTests, AsmInstructionCtorAddressConstructsInvalidForErasedIndexedAddress)
+{
+	parseInput(R"(
+		define void @fnc() {
+			store volatile i64 1234, i64* @llvm2asm
+			ret void
+		}
+		@llvm2asm = global i64 0
+	)");
+	auto* mapGv = getGlobalByName("llvm2asm");
+	AsmInstruction::setLlvmToAsmGlobalVariable(module.get(), mapGv);
+	auto* s = getNthInstruction<StoreInst>();
+	AsmInstruction::addCapstoneInsn(
+			module.get(), s, createCapstoneInsn(), CS_MODE_32);
+	AsmInstruction::getCapstoneInsnStore(module.get()).erase(s);
+	s->eraseFromParent();
+	auto a = AsmInstruction(module.get(), 1234);
+
+	EXPECT_TRUE(a.isInvalid());
+}
+
 //
 // AsmInstruction(llvm::Function*)
 //
@@ -0,0 +1,198 @@
+/**
+ * @file tests/bin2llvmir/providers/capstone_insn_store_tests.cpp
+ * @brief Tests for the @c CapstoneInsnStore class.
+ * @copyright (c) 2021 Avast Software, licensed under the MIT license
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/bin2llvmir/providers/capstone_insn_store.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+class CapstoneInsnStoreTests: public LlvmIrTests
+{
+	protected:
+		void SetUp() override
+		{
+			LlvmIrTests::SetUp();
+			cs_open(CS_ARCH_X86, CS_MODE_32, &engine);
+			cs_option(engine, CS_OPT_DETAIL, CS_OPT_ON);
+
+			parseInput(R"(
+				@llvm2asm = global i64 0
+				define void @fnc() {
+					store volatile i64 4096, i64* @llvm2asm
+					store volatile i64 4097, i64* @llvm2asm
+					store volatile i64 4102, i64* @llvm2asm
+					ret void
+				}
+			)");
+			for (auto& i : getFunctionByName("fnc")->front())
+			{
+				if (auto* s = dyn_cast<StoreInst>(&i))
+				{
+					stores.push_back(s);
+				}
+			}
+		}
+
+		void TearDown() override
+		{
+			cs_close(&engine);
+			LlvmIrTests::TearDown();
+		}
+
+		/// Decode instruction @a bytes at address @a addr.
+		cs_insn* decode(const std::vector<std::uint8_t>& bytes, uint64_t addr)
+		{
+			const std::uint8_t* code = bytes.data();
+			std::size_t size = bytes.size();
+			auto* insn = cs_malloc(engine);
+			cs_disasm_iter(engine, &code, &size, &addr, insn);
+			return insn;
+		}
+
+		/// Add three instructions: nop, mov eax, 1 and ret.
+		void addInstructions(CapstoneInsnStore& store)
+		{
+			store.add(stores[0], decode({0x90}, 0x1000), CS_MODE_32);
+			store.add(
+					stores[1],
+					decode({0xb8, 0x01, 0x00, 0x00, 0x00}, 0x1001),
+					CS_MODE_32);
+			store.add(stores[2], decode({0xc3}, 0x1006), CS_MODE_32);
+		}
+
+	protected:
+		csh engine = 0;
+		std::vector<StoreInst*> stores;
+};
+
+TEST_F(CapstoneInsnStoreTests, addedInstructionIsReturnedAsIs)
+{
+	CapstoneInsnStore store;
+	auto* insn = decode({0x90}, 0x1000);
+
+	store.add(stores[0], insn, CS_MODE_32);
+
+	EXPECT_EQ(1, store.size());
+	EXPECT_EQ(insn, store.get(stores[0]));
+	EXPECT_EQ(nullptr, store.get(stores[1]));
+}
+
+TEST_F(CapstoneInsnStoreTests, instructionsAreKeptWithoutEngine)
+{
+	CapstoneInsnStore store(1);
+	store.add(stores[0], decode({0x90}, 0x1000), CS_MODE_32);
+	store.add(stores[1], decode({0xc3}, 0x1001), CS_MODE_32);
+
+	ASSERT_NE(nullptr, store.get(stores[0]));
+	EXPECT_EQ("nop", std::string(store.get(stores[0])->mnemonic));
+	ASSERT_NE(nullptr, store.get(stores[1]));
+	EXPECT_EQ("ret", std::string(store.get(stores[1])->mnemonic));
+}
+
+TEST_F(CapstoneInsnStoreTests, instructionsDroppedFromCacheAreDecodedAgain)
+{
+	CapstoneInsnStore store(1);
+	ASSERT_TRUE(store.setEngine(CS_ARCH_X86, CS_MODE_32));
+	addInstructions(store);
+
+	auto* insn = store.get(stores[1]);
+
+	ASSERT_NE(nullptr, insn);
+	EXPECT_EQ(X86_INS_MOV, insn->id);
+	EXPECT_EQ(0x1001, insn->address);
+	EXPECT_EQ(5, insn->size);
+	EXPECT_EQ("mov", std::string(insn->mnemonic));
+	EXPECT_EQ("eax, 1", std::string(insn->op_str));
+	ASSERT_NE(nullptr, insn->detail);
+	EXPECT_EQ(2, insn->detail->x86.op_count);
+	EXPECT_EQ("nop", std::string(store.get(stores[0])->mnemonic));
+	EXPECT_EQ("ret", std::string(store.get(stores[2])->mnemonic));
+}
+
+TEST_F(CapstoneInsnStoreTests, instructionsInItBlocksKeepTheirCondition)
+{
+	csh thumb = 0;
+	ASSERT_EQ(CS_ERR_OK, cs_open(CS_ARCH_ARM, CS_MODE_THUMB, &thumb));
+	cs_option(thumb, CS_OPT_DETAIL, CS_OPT_ON);
+	// it eq; addeq r0, r0, r1; nop
+	const std::vector<std::uint8_t> bytes = {
+		0x08, 0xbf, 0x40, 0x18, 0x00, 0xbf
+	};
+	const std::uint8_t* code = bytes.data();
+	std::size_t size = bytes.size();
+	std::uint64_t addr = 0x1000;
+	CapstoneInsnStore store(1);
+	ASSERT_TRUE(store.setEngine(CS_ARCH_ARM, CS_MODE_THUMB));
+	for (auto* s : stores)
+	{
+		auto* insn = cs_malloc(thumb);
+		ASSERT_TRUE(cs_disasm_iter(thumb, &code, &size, &addr, insn));
+		store.add(s, insn, CS_MODE_THUMB);
+	}
+	cs_close(&thumb);
+
+	// Ask for the conditional instruction first so that the engine has not
+	// just decoded the IT instruction.
+	auto* add = store.get(stores[1]);
+	ASSERT_NE(nullptr, add);
+	EXPECT_EQ("addeq", std::string(add->mnemonic));
+	EXPECT_EQ(ARM_CC_EQ, add->detail->arm.cc);
+	EXPECT_FALSE(add->detail->arm.update_flags);
+	auto* nop = store.get(stores[2]);
+	ASSERT_NE(nullptr, nop);
+	EXPECT_EQ("nop", std::string(nop->mnemonic));
+	EXPECT_EQ(ARM_CC_AL, nop->detail->arm.cc);
+	auto* it = store.get(stores[0]);
+	ASSERT_NE(nullptr, it);
+	EXPECT_EQ(ARM_INS_IT, it->id);
+}
+
+TEST_F(CapstoneInsnStoreTests, unlimitedCacheKeepsAllInstructions)
+{
+	CapstoneInsnStore store(1);
+	ASSERT_TRUE(store.setEngine(CS_ARCH_X86, CS_MODE_32));
+	addInstructions(store);
+	store.setCacheSize(0);
+
+	auto* insn0 = store.get(stores[0]);
+	auto* insn1 = store.get(stores[1]);
+	auto* insn2 = store.get(stores[2]);
+
+	EXPECT_EQ(insn0, store.get(stores[0]));
+	EXPECT_EQ(insn1, store.get(stores[1]));
+	EXPECT_EQ(insn2, store.get(stores[2]));
+}
+
+TEST_F(CapstoneInsnStoreTests, erasedAndClearedInstructionsAreNotReturned)
+{
+	CapstoneInsnStore store;
+	addInstructions(store);
+
+	store.erase(stores[1]);
+
+	EXPECT_EQ(2, store.size());
+	EXPECT_EQ(nullptr, store.get(stores[1]));
+	EXPECT_NE(nullptr, store.get(stores[2]));
+
+	store.clear();
+
+	EXPECT_TRUE(store.empty());
+	EXPECT_EQ(nullptr, store.get(stores[0]));
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
@@ -0,0 +1,123 @@
+/**
+* @file tests/bin2llvmir/providers/provider_context_tests.cpp
+* @brief Tests for the @c ProviderContext.
+* @copyright (c) 2021 Avast Software, licensed under the MIT license
+*/
+
+#include <thread>
+#include <vector>
+
+#include "retdec/bin2llvmir/providers/provider_context.h"
+#include "bin2llvmir/utils/llvmir_tests.h"
+
+using namespace ::testing;
+using namespace llvm;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+/**
+ * @brief Tests for the @c ProviderContext.
+ */
+class ProviderContextTests: public LlvmIrTests
+{
+
+};
+
+TEST_F(ProviderContextTests, getReturnsNullptrIfModuleHasNoContext)
+{
+	EXPECT_EQ(nullptr, ProviderContext::get(module.get()));
+}
+
+TEST_F(ProviderContextTests, getOrCreateCreatesContextOnlyOnce)
+{
+	auto& ctx1 = ProviderContext::getOrCreate(module.get());
+	auto& ctx2 = ProviderContext::getOrCreate(module.get());
+
+	EXPECT_EQ(&ctx1, &ctx2);
+	EXPECT_EQ(&ctx1, ProviderContext::get(module.get()));
+}
+
+TEST_F(ProviderContextTests, releaseDropsOnlyDataOfGivenModule)
+{
+	auto otherModule = std::make_unique<Module>("other", context);
+	retdec::config::Config c;
+	auto* c1 = ConfigProvider::addConfig(module.get(), c);
+	auto* c2 = ConfigProvider::addConfig(otherModule.get(), c);
+
+	ProviderContext::release(module.get());
+
+	EXPECT_NE(c1, c2);
+	EXPECT_EQ(nullptr, ConfigProvider::getConfig(module.get()));
+	EXPECT_EQ(c2, ConfigProvider::getConfig(otherModule.get()));
+}
+
+TEST_F(ProviderContextTests, guardReleasesContextWhenDestroyed)
+{
+	retdec::config::Config c;
+	{
+		ProviderContextGuard guard(module.get());
+		ConfigProvider::addConfig(module.get(), c);
+		AsmInstruction::getCapstoneInsnStore(module.get());
+	}
+
+	EXPECT_EQ(nullptr, ProviderContext::get(module.get()));
+	EXPECT_EQ(nullptr, ConfigProvider::getConfig(module.get()));
+}
+
+TEST_F(ProviderContextTests, contextsOfDifferentModulesCanBeUsedFromDifferentThreads)
+{
+	const std::size_t count = 8;
+	std::vector<std::unique_ptr<LLVMContext>> contexts;
+	std::vector<std::unique_ptr<Module>> modules;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		contexts.push_back(std::make_unique<LLVMContext>());
+		modules.push_back(std::make_unique<Module>("m", *contexts.back()));
+	}
+
+	std::vector<GlobalVariable*> globals;
+	for (auto& m : modules)
+	{
+		globals.push_back(new GlobalVariable(
+				*m,
+				Type::getInt32Ty(m->getContext()),
+				false,
+				GlobalValue::ExternalLinkage,
+				nullptr));
+	}
+
+	std::vector<std::thread> threads;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		threads.emplace_back([&, i]()
+		{
+			auto* m = modules[i].get();
+			for (int j = 0; j < 100; ++j)
+			{
+				AsmInstruction::setLlvmToAsmGlobalVariable(m, globals[i]);
+				EXPECT_EQ(
+						globals[i],
+						AsmInstruction::getLlvmToAsmGlobalVariable(m));
+				ProviderContext::release(m);
+			}
+			AsmInstruction::setLlvmToAsmGlobalVariable(m, globals[i]);
+		});
+	}
+	for (auto& t : threads)
+	{
+		t.join();
+	}
+
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		EXPECT_EQ(
+				globals[i],
+				AsmInstruction::getLlvmToAsmGlobalVariable(modules[i].get()));
+	}
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
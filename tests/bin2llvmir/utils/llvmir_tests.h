@@ -33,6 +33,7 @@
 #include "retdec/bin2llvmir/providers/fileimage.h"
 #include "retdec/bin2llvmir/providers/lti.h"
 #include "retdec/bin2llvmir/providers/names.h"
+#include "retdec/bin2llvmir/providers/provider_context.h"
 #include "retdec/bin2llvmir/utils/debug.h"
 #include "retdec/utils/string.h"
 
@@ -67,6 +68,7 @@ class LlvmIrTests : public ::testing::Test
 			FileImageProvider::clear();
 			LtiProvider::clear();
 			NamesProvider::clear();
+			ProviderContext::clear();
 			SymbolicTree::clear();
 			CallingConventionProvider::clear();
 		}
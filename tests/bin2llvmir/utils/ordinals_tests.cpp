@@ -0,0 +1,115 @@
+/**
+ * @file tests/bin2llvmir/utils/ordinals_tests.cpp
+ * @brief Tests for the @c ordinals utils module.
+ * @copyright (c) 2021 Avast Software, licensed under the MIT license
+ */
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+
+#include "retdec/bin2llvmir/utils/ordinals.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace bin2llvmir {
+namespace tests {
+
+class OrdinalDatabaseTests : public Test
+{
+	protected:
+		void SetUp() override
+		{
+			llvm::SmallString<128> path;
+			ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("ordinals", path));
+			dir = path.str().str();
+		}
+
+		void TearDown() override
+		{
+			llvm::sys::fs::remove_directories(dir);
+		}
+
+		void writeFile(const std::string& name, const std::string& content)
+		{
+			std::ofstream out(dir + "/" + name, std::ios::binary);
+			out << content;
+		}
+
+		static std::string uint32ToBytes(std::uint32_t n)
+		{
+			std::string bytes;
+			for (int i = 0; i < 4; ++i, n >>= 8)
+			{
+				bytes += char(n & 0xff);
+			}
+			return bytes;
+		}
+
+		/// Index with a single slot holding (libName, ord) -> name.
+		static std::string createIndex(
+				const std::string& libName,
+				std::uint32_t ord,
+				const std::string& name)
+		{
+			std::uint32_t h = 0x811c9dc5;
+			for (char c : libName + uint32ToBytes(ord))
+			{
+				h = (h ^ static_cast<unsigned char>(c)) * 0x01000193;
+			}
+
+			return std::string("RDORDIDX")
+					+ uint32ToBytes(1) + uint32ToBytes(1)
+					+ uint32ToBytes(h) + uint32ToBytes(ord)
+					+ uint32ToBytes(1) + uint32ToBytes(libName.size() + 2)
+					+ std::string(1, '\0')
+					+ libName + std::string(1, '\0')
+					+ name + std::string(1, '\0');
+		}
+
+	protected:
+		std::string dir;
+};
+
+TEST_F(OrdinalDatabaseTests, namesAreReadFromOrdFiles)
+{
+	writeFile("ws2_32.ord", "1 accept\n2\tbind\n  3   closesocket  \n\n");
+
+	auto& db = OrdinalDatabase::get(dir);
+
+	EXPECT_EQ("accept", db.getName("ws2_32", 1));
+	EXPECT_EQ("bind", db.getName("ws2_32", 2));
+	EXPECT_EQ("closesocket", db.getName("ws2_32", 3));
+	EXPECT_EQ("", db.getName("ws2_32", 4));
+}
+
+TEST_F(OrdinalDatabaseTests, unknownLibraryHasNoNames)
+{
+	auto& db = OrdinalDatabase::get(dir);
+
+	EXPECT_EQ("", db.getName("ws2_32", 1));
+	// Libraries without .ord files are remembered as empty.
+	writeFile("ws2_32.ord", "1 accept\n");
+	EXPECT_EQ("", db.getName("ws2_32", 1));
+}
+
+TEST_F(OrdinalDatabaseTests, namesAreLookedUpInIndexIfThereIsOne)
+{
+	writeFile(
+			OrdinalDatabase::indexFileName,
+			createIndex("oleaut32", 2, "SysAllocString"));
+	writeFile("oleaut32.ord", "2 SomethingElse\n");
+
+	auto& db = OrdinalDatabase::get(dir);
+
+	EXPECT_EQ("SysAllocString", db.getName("oleaut32", 2));
+	EXPECT_EQ("", db.getName("oleaut32", 3));
+	EXPECT_EQ("", db.getName("ws2_32", 2));
+}
+
+} // namespace tests
+} // namespace bin2llvmir
+} // namespace retdec
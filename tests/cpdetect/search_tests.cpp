@@ -0,0 +1,258 @@
+/**
+* @file tests/cpdetect/search_tests.cpp
+* @brief Tests for the @c search module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/cpdetect/search.h"
+#include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
+#include "retdec/utils/conversion.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace cpdetect {
+namespace tests {
+
+const std::vector<std::uint8_t> searchBytes = {
+	0x55, 0x8b, 0xec, 0x6a, 0xff, 0x68, 0x00, 0x12, 0x40, 0x00, 0xe9, 0x04,
+	0x00, 0x00, 0x00, 0x90, 0x90, 0x90, 0x90, 0x50, 0x4b, 0x03, 0x04, 0x0a,
+	0x55, 0x50, 0x58, 0x21, 0x0d, 0x09, 0x08, 0x0a
+};
+
+/**
+ * Tests for the @c search module.
+ */
+class SearchTests : public Test
+{
+	protected:
+		std::unique_ptr<RawDataFormat> parser;
+
+	public:
+		SearchTests()
+		{
+			parser = std::make_unique<RawDataFormat>(
+					searchBytes.data(),
+					searchBytes.size());
+		}
+};
+
+TEST_F(SearchTests, PlainStringIsViewOfLoadedBytes)
+{
+	Search search(*parser);
+
+	const auto &bytes = parser->getLoadedBytes();
+	const auto plain = search.getPlainString();
+	EXPECT_TRUE(search.isFileLoaded());
+	EXPECT_EQ(reinterpret_cast<const char*>(bytes.data()), plain.data());
+	EXPECT_EQ(bytes.size(), plain.size());
+}
+
+TEST_F(SearchTests, NibblesOfLittleEndianFileAreComputedFromLoadedBytes)
+{
+	Search search(*parser);
+
+	std::string expected;
+	bytesToHexString(parser->getLoadedBytes(), expected);
+	EXPECT_TRUE(search.isFileSupported());
+	EXPECT_EQ(expected, search.getNibbles());
+}
+
+TEST_F(SearchTests, NibblesOfBigEndianFileAreSwappedByWords)
+{
+	parser->setEndianness(Endianness::BIG);
+	Search search(*parser);
+
+	const auto nibbles = search.getNibbles();
+	EXPECT_TRUE(search.isFileSupported());
+	ASSERT_EQ(2 * searchBytes.size(), nibbles.size());
+	EXPECT_EQ("6AEC8B55120068FF", nibbles.substr(0, 16));
+}
+
+TEST_F(SearchTests, StringsAreFoundInLoadedBytes)
+{
+	Search search(*parser);
+
+	EXPECT_TRUE(search.hasString("UPX!"));
+	EXPECT_TRUE(search.hasString("UPX!", 24));
+	EXPECT_FALSE(search.hasString("UPX!", 23));
+	EXPECT_TRUE(search.hasString("PK", 0, 21));
+	EXPECT_FALSE(search.hasString("PK", 0, 19));
+	EXPECT_FALSE(search.hasString("UPX!", 30));
+}
+
+TEST_F(SearchTests, SignatureIsFoundInLoadedBytes)
+{
+	Search search(*parser);
+
+	EXPECT_EQ(8, search.findUnslashedSignature("558BEC6A", 0, 31));
+	EXPECT_EQ(0, search.findUnslashedSignature("558BEC6A", 1, 31));
+	EXPECT_EQ(8, search.exactComparison("558BEC6A", 0));
+	EXPECT_EQ(0, search.exactComparison("558BEC6A", 1));
+}
+
+/**
+ * Tests which compare matching of signature patterns on the loaded bytes
+ * with matching on the hexadecimal representation of file.
+ *
+ * Nibbles of big endian file with one byte words are the same as nibbles of
+ * little endian file, but they are stored and matched as a string.
+ */
+class SearchMatchingTests : public Test
+{
+	protected:
+		std::vector<std::uint8_t> bytes;
+		std::unique_ptr<RawDataFormat> littleParser;
+		std::unique_ptr<RawDataFormat> bigParser;
+		std::unique_ptr<Search> bytesSearch;
+		std::unique_ptr<Search> stringSearch;
+		std::string nibbles;
+		std::mt19937 generator;
+
+	public:
+		SearchMatchingTests()
+		{
+			// Few distinct values, so that patterns match on many places.
+			const std::uint8_t values[] = {0x00, 0x55, 0x5A, 0x8B, 0xA5, 0xEC, 0xFF};
+			for (std::size_t i = 0; i < 256; ++i)
+			{
+				bytes.push_back(values[generator() % sizeof(values)]);
+			}
+
+			littleParser = std::make_unique<RawDataFormat>(bytes.data(), bytes.size());
+			bigParser = std::make_unique<RawDataFormat>(bytes.data(), bytes.size());
+			bigParser->setEndianness(Endianness::BIG);
+			bigParser->setBytesPerWord(1);
+			bytesSearch = std::make_unique<Search>(*littleParser);
+			stringSearch = std::make_unique<Search>(*bigParser);
+			nibbles = bytesSearch->getNibbles();
+		}
+
+		/**
+		 * Create pattern from nibbles of file with some of them replaced by
+		 * wildcards and mismatches.
+		 */
+		std::string createPattern()
+		{
+			const auto length = 1 + generator() % 24;
+			const auto start = generator() % (nibbles.length() - length);
+			auto pattern = nibbles.substr(start, length);
+			for (auto &c : pattern)
+			{
+				switch (generator() % 12)
+				{
+					case 0:
+						c = '-';
+						break;
+					case 1:
+						c = '?';
+						break;
+					case 2:
+						c = c == '0' ? '1' : '0';
+						break;
+					default:
+						break;
+				}
+			}
+
+			if (generator() % 4 == 0)
+			{
+				pattern += ";" + nibbles.substr(generator() % nibbles.length(), 4);
+			}
+			return pattern;
+		}
+};
+
+TEST_F(SearchMatchingTests, BothRepresentationsHaveTheSameNibbles)
+{
+	EXPECT_TRUE(stringSearch->isFileSupported());
+	EXPECT_EQ(nibbles, stringSearch->getNibbles());
+}
+
+TEST_F(SearchMatchingTests, UnslashedSignaturesAreFoundOnTheSamePlaces)
+{
+	for (std::size_t i = 0; i < 2000; ++i)
+	{
+		const auto pattern = createPattern();
+		const auto start = generator() % (bytes.size() + 4);
+		const auto stop = start + generator() % 64;
+		EXPECT_EQ(
+				stringSearch->findUnslashedSignature(pattern, start, stop),
+				bytesSearch->findUnslashedSignature(pattern, start, stop))
+				<< pattern << " in <" << start << ", " << stop << ">";
+	}
+}
+
+TEST_F(SearchMatchingTests, UnslashedSignaturesMayStartOnLowNibble)
+{
+	const auto pattern = nibbles.substr(11, 7);
+	const auto byteOffset = 5;
+
+	// Only the high nibble of the stop byte belongs to the searched area.
+	EXPECT_EQ(7, bytesSearch->findUnslashedSignature(pattern, byteOffset, byteOffset + 4));
+	EXPECT_EQ(7, stringSearch->findUnslashedSignature(pattern, byteOffset, byteOffset + 4));
+	EXPECT_EQ(0, bytesSearch->findUnslashedSignature(pattern, byteOffset, byteOffset + 3));
+	EXPECT_EQ(0, stringSearch->findUnslashedSignature(pattern, byteOffset, byteOffset + 3));
+	EXPECT_EQ(0, bytesSearch->findUnslashedSignature(pattern, byteOffset + 1, bytes.size()));
+}
+
+TEST_F(SearchMatchingTests, WildcardsMatchAnyNibble)
+{
+	auto pattern = nibbles.substr(0, 8);
+	pattern[1] = '-';
+	pattern[4] = '?';
+	pattern[6] = '-';
+
+	EXPECT_EQ(5, bytesSearch->findUnslashedSignature(pattern, 0, 4));
+	EXPECT_EQ(5, stringSearch->findUnslashedSignature(pattern, 0, 4));
+	EXPECT_EQ(0, bytesSearch->findUnslashedSignature("-/--", 0, bytes.size()));
+	EXPECT_EQ(0, stringSearch->findUnslashedSignature("-/--", 0, bytes.size()));
+	EXPECT_EQ(
+			stringSearch->findUnslashedSignature("----", 0, bytes.size()),
+			bytesSearch->findUnslashedSignature("----", 0, bytes.size()));
+}
+
+TEST_F(SearchMatchingTests, SignaturesAtEndOfFileAreFoundOnTheSamePlaces)
+{
+	for (std::size_t length = 1; length <= 8; ++length)
+	{
+		const auto pattern = nibbles.substr(nibbles.length() - length);
+		for (std::size_t start = bytes.size() - 5; start <= bytes.size(); ++start)
+		{
+			EXPECT_EQ(
+					stringSearch->findUnslashedSignature(pattern, start, bytes.size()),
+					bytesSearch->findUnslashedSignature(pattern, start, bytes.size()))
+					<< pattern << " from " << start;
+		}
+	}
+}
+
+TEST_F(SearchMatchingTests, AreaSimilarityIsTheSame)
+{
+	for (std::size_t i = 0; i < 1000; ++i)
+	{
+		const auto pattern = createPattern();
+		const auto start = generator() % (bytes.size() + 4);
+		const auto stop = start + generator() % 64;
+		Similarity bytesSim, stringSim;
+		EXPECT_EQ(
+				stringSearch->areaSimilarity(pattern, stringSim, start, stop),
+				bytesSearch->areaSimilarity(pattern, bytesSim, start, stop))
+				<< pattern << " in <" << start << ", " << stop << ">";
+		EXPECT_EQ(stringSim.same, bytesSim.same) << pattern;
+		EXPECT_EQ(stringSim.total, bytesSim.total) << pattern;
+	}
+}
+
+} // namespace tests
+} // namespace cpdetect
+} // namespace retdec
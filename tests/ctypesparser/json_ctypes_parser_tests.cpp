@@ -1952,6 +1952,136 @@ ParsingCircularTypedefsBreaksLoopAndSetsTypedefToUnknownType)
 	EXPECT_EQ(retdec::ctypes::UnknownType::create(), type3->getAliasedType());
 }
 
+//
+// index(), parseIndexedFunction()
+//
+
+TEST_F(JSONCTypesParserTests,
+IndexingBadInputThrowsException)
+{
+	std::string json(R"(
+		{
+			"missing bracket": 1
+	)");
+	auto context = std::make_shared<retdec::ctypes::Context>();
+
+	ASSERT_THROW(parser.index(json.data(), json.size(), context), CTypesParseError);
+}
+
+TEST_F(JSONCTypesParserTests,
+IndexingJSONWithoutFunctionsItemThrowsException)
+{
+	std::string json(R"(
+		{
+			"types": {}
+		}
+	)");
+	auto context = std::make_shared<retdec::ctypes::Context>();
+
+	ASSERT_THROW(parser.index(json.data(), json.size(), context), CTypesParseError);
+}
+
+TEST_F(JSONCTypesParserTests,
+IndexingJSONWithoutTypesItemThrowsException)
+{
+	std::string json(R"(
+		{
+			"functions": {},
+			"types": "no types info"
+		}
+	)");
+	auto context = std::make_shared<retdec::ctypes::Context>();
+
+	ASSERT_THROW(parser.index(json.data(), json.size(), context), CTypesParseError);
+}
+
+TEST_F(JSONCTypesParserTests,
+IndexedFunctionIsParsedOnlyWhenRequested)
+{
+	std::string json(R"(
+		{
+			"functions": {
+				"ff": {
+					"decl": "int ff(struct s *b);",
+					"header": "CHeader.h",
+					"name": "ff",
+					"params": [
+						{
+							"name": "b",
+							"type": "b"
+						}
+					],
+					"ret_type": "a"
+				},
+				"gg": {
+					"decl": "int gg();",
+					"header": "CHeader.h",
+					"name": "gg",
+					"params": [],
+					"ret_type": "a"
+				}
+			},
+			"types": {
+				"a": {
+					"name": "int",
+					"type": "integral_type"
+				},
+				"b": {
+					"type": "pointer",
+					"pointed_type": "c"
+				},
+				"c": {
+					"name": "s",
+					"type": "structure",
+					"members": [
+						{
+							"name": "next",
+							"type": "b"
+						}
+					]
+				}
+			}
+		}
+	)");
+	auto context = std::make_shared<retdec::ctypes::Context>();
+	parser.index(json.data(), json.size(), context);
+
+	EXPECT_TRUE(parser.hasIndexedFunction("ff"));
+	EXPECT_TRUE(parser.hasIndexedFunction("gg"));
+	EXPECT_FALSE(context->hasFunctionWithName("ff"));
+
+	auto func = parser.parseIndexedFunction("ff");
+	ASSERT_TRUE(func);
+	EXPECT_EQ("ff", func->getName());
+	EXPECT_EQ("int", func->getReturnType()->getName());
+	ASSERT_EQ(1, func->getParameterCount());
+	EXPECT_EQ("b", func->getParameterName(1));
+	auto paramType = std::dynamic_pointer_cast<retdec::ctypes::PointerType>(
+		func->getParameterType(1));
+	ASSERT_TRUE(paramType);
+	EXPECT_EQ("s", paramType->getPointedType()->getName());
+
+	EXPECT_TRUE(context->hasFunctionWithName("ff"));
+	EXPECT_FALSE(context->hasFunctionWithName("gg"));
+	EXPECT_EQ(func, parser.parseIndexedFunction("ff"));
+}
+
+TEST_F(JSONCTypesParserTests,
+ParseIndexedFunctionReturnsNullForUnknownFunction)
+{
+	std::string json(R"(
+		{
+			"functions": {},
+			"types": {}
+		}
+	)");
+	auto context = std::make_shared<retdec::ctypes::Context>();
+	parser.index(json.data(), json.size(), context);
+
+	EXPECT_FALSE(parser.hasIndexedFunction("ff"));
+	EXPECT_FALSE(parser.parseIndexedFunction("ff"));
+}
+
 } // namespace tests
 } // namespace ctypesparser
 } // namespace retdec
@@ -0,0 +1,86 @@
+/**
+* @file tests/fileformat/crypto_tests.cpp
+* @brief Tests for the @c crypto module.
+* @copyright (c) 2021 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/utils/crypto.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace fileformat {
+namespace tests {
+
+/**
+ * Tests for the @c crypto module.
+ */
+class CryptoTests : public Test
+{
+	protected:
+		static std::vector<unsigned char> createData(std::size_t size)
+		{
+			std::vector<unsigned char> data(size);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				data[i] = static_cast<unsigned char>(i * 31 + (i >> 8));
+			}
+			return data;
+		}
+};
+
+TEST_F(CryptoTests, HashesOfKnownInputAreCorrect)
+{
+	const std::string input = "abc";
+	const auto *data = reinterpret_cast<const unsigned char*>(input.data());
+	std::string crc32, md5, sha256;
+
+	getHashes(data, input.size(), &crc32, &md5, &sha256);
+
+	EXPECT_EQ("352441c2", crc32);
+	EXPECT_EQ("900150983cd24fb0d6963f7d28e17f72", md5);
+	EXPECT_EQ("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", sha256);
+}
+
+TEST_F(CryptoTests, HashesOfChunkedInputAreSameAsOneShotHashes)
+{
+	const auto data = createData(3 * 64 * 1024 + 123);
+	std::string crc32, md5, sha256;
+
+	getHashes(data.data(), data.size(), &crc32, &md5, &sha256);
+
+	EXPECT_EQ(getCrc32(data.data(), data.size()), crc32);
+	EXPECT_EQ(getMd5(data.data(), data.size()), md5);
+	EXPECT_EQ(getSha256(data.data(), data.size()), sha256);
+}
+
+TEST_F(CryptoTests, HashesOfLargeInputComputedInParallelAreSameAsOneShotHashes)
+{
+	const auto data = createData(5 * 1024 * 1024 + 7);
+	std::string crc32, md5, sha256;
+
+	getHashes(data.data(), data.size(), &crc32, &md5, &sha256);
+
+	EXPECT_EQ(getCrc32(data.data(), data.size()), crc32);
+	EXPECT_EQ(getMd5(data.data(), data.size()), md5);
+	EXPECT_EQ(getSha256(data.data(), data.size()), sha256);
+}
+
+TEST_F(CryptoTests, OnlyRequestedHashesAreComputed)
+{
+	const auto data = createData(100);
+	std::string sha256;
+
+	getHashes(data.data(), data.size(), nullptr, nullptr, &sha256);
+
+	EXPECT_EQ(getSha256(data.data(), data.size()), sha256);
+}
+
+} // namespace tests
+} // namespace fileformat
+} // namespace retdec
@@ -1224,6 +1224,19 @@ DelegationOfMethodsToAliasAnalysis) {
 	va->initAliasAnalysis(module);
 }
 
+TEST_F(ValueAnalysisTests,
+AnalysisWithSharedAliasAnalysisDoesNotReinitializeIt) {
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(true);
+
+	ShPtr<ValueAnalysis> sharingVa(va->createWithSharedAliasAnalysis());
+
+	ASSERT_NE(va, sharingVa);
+	EXPECT_TRUE(sharingVa->isCachingEnabled());
+	EXPECT_CALL(*aliasAnalysisMock, init(module))
+		.Times(0);
+	sharingVa->initAliasAnalysis(module);
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
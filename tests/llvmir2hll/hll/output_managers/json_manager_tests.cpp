@@ -247,6 +247,19 @@ TEST_F(JsonOutputManagerTests, address_push_and_pop_do_nothing)
 		emitSingleToken());
 }
 
+//
+// streaming
+//
+
+TEST_F(JsonOutputManagerTests, tokens_are_written_before_finalization)
+{
+	manager->functionId("f");
+
+	EXPECT_EQ(
+		R"({"tokens":[{"addr":""},{"kind":"i_fnc","val":"f"})",
+		codeStream.str());
+}
+
 } // namespace tests
 } // namespace llvmir2hll
 } // namespace retdec
\ No newline at end of file
@@ -303,6 +303,59 @@ IfElseConditionIsConvertedCorrectly) {
 	ASSERT_TRUE(isCallOfFuncTest(after, 3));
 }
 
+TEST_F(StructureConverterTests,
+LongSequenceOfIfConditionsIsConvertedWithoutGotos) {
+	const int count = 200;
+	std::string code = R"(
+		declare void @test(i32)
+
+		define void @function(i32 %val) {
+		entry:
+			br label %cond0
+	)";
+	for (int i = 0; i < count; ++i) {
+		auto n = std::to_string(i);
+		code += "cond" + n + ":\n"
+			"	%c" + n + " = icmp eq i32 %val, " + n + "\n"
+			"	br i1 %c" + n + ", label %iftrue" + n
+				+ ", label %cond" + std::to_string(i + 1) + "\n"
+			"iftrue" + n + ":\n"
+			"	call void @test(i32 " + n + ")\n"
+			"	br label %cond" + std::to_string(i + 1) + "\n";
+	}
+	code += "cond" + std::to_string(count) + ":\n"
+		"	ret void\n"
+		"}\n";
+	auto module = convertLLVMIR2BIR(code);
+
+	//
+	// if (val == 0) {
+	//     test(0);
+	// }
+	// if (val == 1) {
+	//     test(1);
+	// }
+	// ...
+	// return;
+	//
+	auto f = module->getFuncByName("function");
+	ASSERT_TRUE(f);
+	int ifCount = 0;
+	for (auto stmt = skipEmptyStmts(f->getBody()); stmt;
+			stmt = getFirstNonEmptySuccOf(stmt)) {
+		ASSERT_FALSE(isa<GotoStmt>(stmt));
+		if (auto ifStmt = cast<IfStmt>(stmt)) {
+			ASSERT_TRUE(isComparison<EqOpExpr>(ifStmt->getFirstIfCond(),
+				f->getParam(1), ifCount));
+			ASSERT_TRUE(isCallOfFuncTest(
+				skipEmptyStmts(ifStmt->getFirstIfBody()), ifCount));
+			ASSERT_FALSE(ifStmt->hasElseClause());
+			++ifCount;
+		}
+	}
+	ASSERT_EQ(count, ifCount);
+}
+
 TEST_F(StructureConverterTests,
 IfElseConditionWithPhiNodeAfterIsConvertedCorrectly) {
 	auto module = convertLLVMIR2BIR(R"(
@@ -0,0 +1,151 @@
+/**
+* @file tests/llvmir2hll/optimizer/optimizer_manager_tests.cpp
+* @brief Tests for the @c optimizer_manager module.
+* @copyright (c) 2017 Avast Software, licensed under the MIT license
+*/
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include "llvmir2hll/analysis/tests_with_value_analysis.h"
+#include "llvmir2hll/hll/hll_writers/hll_writer_tests.h"
+#include "retdec/llvmir2hll/evaluator/arithm_expr_evaluators/strict_arithm_expr_evaluator.h"
+#include "retdec/llvmir2hll/hll/hll_writer.h"
+#include "retdec/llvmir2hll/hll/hll_writers/c_hll_writer.h"
+#include "retdec/llvmir2hll/ir/add_op_expr.h"
+#include "retdec/llvmir2hll/ir/assign_stmt.h"
+#include "retdec/llvmir2hll/ir/call_expr.h"
+#include "retdec/llvmir2hll/ir/const_int.h"
+#include "retdec/llvmir2hll/ir/function_builder.h"
+#include "retdec/llvmir2hll/ir/int_type.h"
+#include "retdec/llvmir2hll/ir/return_stmt.h"
+#include "retdec/llvmir2hll/ir/var_def_stmt.h"
+#include "retdec/llvmir2hll/ir/variable.h"
+#include "retdec/llvmir2hll/obtainer/call_info_obtainers/optim_call_info_obtainer.h"
+#include "retdec/llvmir2hll/optimizer/optimizer_manager.h"
+#include "retdec/llvmir2hll/support/types.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace llvmir2hll {
+namespace tests {
+
+/**
+* @brief Tests for the @c optimizer_manager module.
+*
+* The emission of code is set-up by HLLWriterTests.
+*/
+class OptimizerManagerTests: public HLLWriterTests {
+protected:
+	void createModuleWithCallChain(std::size_t funcCount);
+	std::string optimizeAndEmit(std::size_t threads);
+};
+
+/**
+* @brief Replaces @c module with a new module with @a funcCount functions,
+*        where every function calls an external function and the next
+*        function.
+*
+* @code
+* int g;
+* int ext();
+*
+* int fI() {
+*     int a = ext();
+*     int b = a;
+*     g = b;
+*     int c = fJ(); // ext() in the last function
+*     int d = c;
+*     return d + g;
+* }
+* @endcode
+*/
+void OptimizerManagerTests::createModuleWithCallChain(std::size_t funcCount) {
+	module = std::make_shared<Module>(&llvmModule,
+		llvmModule.getModuleIdentifier(), semanticsMock, configMock);
+
+	ShPtr<Variable> varG(Variable::create("g", IntType::create(32)));
+	module->addGlobalVar(varG, ConstInt::create(0, 32));
+	ShPtr<Function> ext(Function::create(nullptr, IntType::create(32), "ext",
+		VarVector(), VarSet(), ShPtr<Statement>(), false));
+	module->addFunc(ext);
+
+	// Functions are created from the last one, so every function can call the
+	// next one.
+	ShPtr<Function> next(ext);
+	FuncVector funcs;
+	for (std::size_t i = funcCount; i > 0; --i) {
+		ShPtr<Variable> varA(Variable::create("a", IntType::create(32)));
+		ShPtr<Variable> varB(Variable::create("b", IntType::create(32)));
+		ShPtr<Variable> varC(Variable::create("c", IntType::create(32)));
+		ShPtr<Variable> varD(Variable::create("d", IntType::create(32)));
+		ShPtr<ReturnStmt> returnDG(ReturnStmt::create(
+			AddOpExpr::create(varD, varG)));
+		ShPtr<VarDefStmt> varDefD(VarDefStmt::create(varD, varC, returnDG));
+		ShPtr<VarDefStmt> varDefC(VarDefStmt::create(varC,
+			CallExpr::create(next->getAsVar()), varDefD));
+		ShPtr<AssignStmt> assignGB(AssignStmt::create(varG, varB, varDefC));
+		ShPtr<VarDefStmt> varDefB(VarDefStmt::create(varB, varA, assignGB));
+		ShPtr<VarDefStmt> varDefA(VarDefStmt::create(varA,
+			CallExpr::create(ext->getAsVar()), varDefB));
+		next = FunctionBuilder("f" + std::to_string(i - 1))
+			.definitionWithBody(varDefA)
+			.withRetType(IntType::create(32))
+			.withLocalVar(varA)
+			.withLocalVar(varB)
+			.withLocalVar(varC)
+			.withLocalVar(varD)
+			.build();
+		funcs.insert(funcs.begin(), next);
+	}
+	for (const auto &func : funcs) {
+		module->addFunc(func);
+	}
+}
+
+/**
+* @brief Optimizes @c module by OptimizerManager with the given number of
+*        threads and returns the emitted code.
+*/
+std::string OptimizerManagerTests::optimizeAndEmit(std::size_t threads) {
+	INSTANTIATE_ALIAS_ANALYSIS_AND_VALUE_ANALYSIS(module);
+
+	OptimizerManager optimizerManager(StringSet(), StringSet(), writer, va,
+		OptimCallInfoObtainer::create(), StrictArithmExprEvaluator::create(),
+		false, threads);
+	optimizerManager.optimize(module);
+
+	std::string code;
+	llvm::raw_string_ostream codeStream(code);
+	CHLLWriter::create(codeStream)->emitTargetCode(module);
+	return codeStream.str();
+}
+
+TEST_F(OptimizerManagerTests,
+OptimizationInParallelGivesSameCodeAsOptimizationInSingleThread) {
+	createModuleWithCallChain(32);
+	auto serialCode = optimizeAndEmit(1);
+	createModuleWithCallChain(32);
+	auto parallelCode = optimizeAndEmit(4);
+
+	EXPECT_EQ(serialCode, parallelCode);
+}
+
+TEST_F(OptimizerManagerTests,
+CallsOfDeclaredFunctionsAreOptimizedInParallel) {
+	createModuleWithCallChain(4);
+	auto parallelCode = optimizeAndEmit(4);
+
+	// The copies of values returned from ext() are propagated.
+	EXPECT_EQ(std::string::npos, parallelCode.find("b = a")) << parallelCode;
+	EXPECT_EQ(std::string::npos, parallelCode.find("d = c")) << parallelCode;
+	EXPECT_NE(std::string::npos, parallelCode.find("return ext() + g;")) <<
+		parallelCode;
+}
+
+} // namespace tests
+} // namespace llvmir2hll
+} // namespace retdec
@@ -85,6 +85,88 @@ GlobalVarTestOptimized) {
 		"got `" << outConstInt << "`";
 }
 
+TEST_F(SimplifyArithmExprOptimizerTests,
+OptimizeFuncOptimizesOnlyTheGivenFunction) {
+	// int a = 2 + 5;
+	// void test() {
+	//     return 2 + 5;
+	// }
+	// void other() {
+	//     return 2 + 5;
+	// }
+	//
+	// Optimized (only test()) to
+	// int a = 2 + 5;
+	// void test() {
+	//     return 7;
+	// }
+	// void other() {
+	//     return 2 + 5;
+	// }
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(16)));
+	module->addGlobalVar(varA, AddOpExpr::create(ConstInt::create(2, 64),
+		ConstInt::create(5, 64)));
+	ShPtr<ReturnStmt> testReturnStmt(ReturnStmt::create(AddOpExpr::create(
+		ConstInt::create(2, 64), ConstInt::create(5, 64))));
+	testFunc->setBody(testReturnStmt);
+	ShPtr<Function> otherFunc(addFuncDef("other"));
+	ShPtr<ReturnStmt> otherReturnStmt(ReturnStmt::create(AddOpExpr::create(
+		ConstInt::create(2, 64), ConstInt::create(5, 64))));
+	otherFunc->setBody(otherReturnStmt);
+
+	ShPtr<SimplifyArithmExprOptimizer> optimizer(
+		new SimplifyArithmExprOptimizer(module,
+			StrictArithmExprEvaluator::create()));
+	ASSERT_TRUE(optimizer->canOptimizePartsSeparately());
+	optimizer->optimizeFunc(testFunc);
+
+	ShPtr<ConstInt> outConstInt(cast<ConstInt>(testReturnStmt->getRetVal()));
+	ASSERT_TRUE(outConstInt) <<
+		"expected `ConstInt`, "
+		"got `" << testReturnStmt->getRetVal() << "`";
+	EXPECT_EQ(ConstInt::create(7, 64)->getValue(), outConstInt->getValue());
+	EXPECT_TRUE(isa<AddOpExpr>(otherReturnStmt->getRetVal())) <<
+		"expected `AddOpExpr`, "
+		"got `" << otherReturnStmt->getRetVal() << "`";
+	EXPECT_TRUE(isa<AddOpExpr>(module->getInitForGlobalVar(varA))) <<
+		"expected `AddOpExpr`, "
+		"got `" << module->getInitForGlobalVar(varA) << "`";
+}
+
+TEST_F(SimplifyArithmExprOptimizerTests,
+OptimizeGlobalVarsOptimizesOnlyInitializersOfGlobalVars) {
+	// int a = 2 + 5;
+	// void test() {
+	//     return 2 + 5;
+	// }
+	//
+	// Optimized (only global variables) to
+	// int a = 7;
+	// void test() {
+	//     return 2 + 5;
+	// }
+	ShPtr<Variable> varA(Variable::create("a", IntType::create(16)));
+	module->addGlobalVar(varA, AddOpExpr::create(ConstInt::create(2, 64),
+		ConstInt::create(5, 64)));
+	ShPtr<ReturnStmt> returnStmt(ReturnStmt::create(AddOpExpr::create(
+		ConstInt::create(2, 64), ConstInt::create(5, 64))));
+	testFunc->setBody(returnStmt);
+
+	ShPtr<SimplifyArithmExprOptimizer> optimizer(
+		new SimplifyArithmExprOptimizer(module,
+			StrictArithmExprEvaluator::create()));
+	optimizer->optimizeGlobalVars();
+
+	ShPtr<ConstInt> outConstInt(cast<ConstInt>(module->getInitForGlobalVar(varA)));
+	ASSERT_TRUE(outConstInt) <<
+		"expected `ConstInt`, "
+		"got `" << module->getInitForGlobalVar(varA) << "`";
+	EXPECT_EQ(ConstInt::create(7, 64)->getValue(), outConstInt->getValue());
+	EXPECT_TRUE(isa<AddOpExpr>(returnStmt->getRetVal())) <<
+		"expected `AddOpExpr`, "
+		"got `" << returnStmt->getRetVal() << "`";
+}
+
 TEST_F(SimplifyArithmExprOptimizerTests,
 MultipleVarSubNumAddNumConstIntOptimized) {
 	// return (a - 5) + 6;
@@ -127,6 +127,24 @@ GetNameOfParamForKnownFunctionsReturnsCorrectAnswer) {
 	EXPECT_EQ("uStyle", openFileParam3Name.value());
 }
 
+TEST_F(WinAPISemanticsTests,
+GetNameOfParamForFunctionsAtBoundariesOfTablesReturnsCorrectAnswer) {
+	// _hread (underscore is stored in the same table as A)
+	std::optional<std::string> hreadParam1Name(semantics->getNameOfParam("_hread", 1));
+	ASSERT_TRUE(hreadParam1Name) << "no name of the first parameter of `_hread`";
+	EXPECT_EQ("hFile", hreadParam1Name.value());
+
+	// keybd_event (lowercase names are stored together with uppercase ones)
+	std::optional<std::string> keybdEventParam1Name(semantics->getNameOfParam("keybd_event", 1));
+	ASSERT_TRUE(keybdEventParam1Name) << "no name of the first parameter of `keybd_event`";
+	EXPECT_EQ("bVk", keybdEventParam1Name.value());
+
+	// ZombifyActCtx (the last table)
+	std::optional<std::string> zombifyActCtxParam1Name(semantics->getNameOfParam("ZombifyActCtx", 1));
+	ASSERT_TRUE(zombifyActCtxParam1Name) << "no name of the first parameter of `ZombifyActCtx`";
+	EXPECT_EQ("hActCtx", zombifyActCtxParam1Name.value());
+}
+
 TEST_F(WinAPISemanticsTests,
 GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 	// foo
@@ -134,6 +152,13 @@ GetNameOfParamForUnknownFunctionsReturnsNoAnswer) {
 	EXPECT_FALSE(fooParam1Name) << "there should be no information for `foo`";
 }
 
+TEST_F(WinAPISemanticsTests,
+GetNameOfParamForUnknownParameterOfKnownFunctionReturnsNoAnswer) {
+	// OpenFile has only three parameters
+	std::optional<std::string> openFileParam4Name(semantics->getNameOfParam("OpenFile", 4));
+	EXPECT_FALSE(openFileParam4Name) << "`OpenFile` has no fourth parameter";
+}
+
 //
 // getSymbolicNamesForParam()
 //
@@ -0,0 +1,251 @@
+/**
+ * @file tests/loader/image_tests.cpp
+ * @brief Tests for the @c image module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <gtest/gtest.h>
+
+#include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
+#include "retdec/fileformat/utils/crypto.h"
+#include "retdec/loader/loader/image.h"
+
+using namespace ::testing;
+using namespace retdec::utils;
+
+namespace retdec {
+namespace loader {
+namespace tests {
+
+const std::vector<std::uint8_t> imageData = {
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+	0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+
+/**
+ * Image with segments added by tests.
+ */
+class TestImage : public Image
+{
+public:
+	TestImage() : Image(std::make_shared<retdec::fileformat::RawDataFormat>(imageData.data(), imageData.size())) {}
+
+	virtual bool load() override
+	{
+		return true;
+	}
+
+	Segment* addSegment(std::uint64_t address, std::uint64_t size, std::uint64_t dataSize = 0)
+	{
+		llvm::StringRef dataRef = llvm::StringRef(reinterpret_cast<const char*>(imageData.data()), dataSize);
+		auto dataSource = dataSize ? std::make_unique<SegmentDataSource>(dataRef) : nullptr;
+		return insertSegment(std::make_unique<Segment>(nullptr, address, size, std::move(dataSource)));
+	}
+
+	Segment* addFileSegment(std::uint64_t address)
+	{
+		const auto* fileFormat = getFileFormat();
+		llvm::StringRef dataRef = llvm::StringRef(reinterpret_cast<const char*>(fileFormat->getBytesData()), fileFormat->getFileLength());
+		return insertSegment(std::make_unique<Segment>(nullptr, address, dataRef.size(), std::make_unique<SegmentDataSource>(dataRef)));
+	}
+
+	void deleteSegment(Segment* segment)
+	{
+		removeSegment(segment);
+	}
+
+	void sortSegmentsByAddress()
+	{
+		sortSegments();
+	}
+};
+
+class ImageTests : public Test
+{
+public:
+	TestImage image;
+};
+
+TEST_F(ImageTests,
+SegmentFromAddressRespectsSegmentBoundaries) {
+	auto* seg1 = image.addSegment(0x2000, 0x10);
+	auto* seg2 = image.addSegment(0x1000, 0x100);
+	auto* seg3 = image.addSegment(0x1100, 0x100);
+
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x0));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0xfff));
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x1000));
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x10ff));
+	EXPECT_EQ(seg3, image.getSegmentFromAddress(0x1100));
+	EXPECT_EQ(seg3, image.getSegmentFromAddress(0x11ff));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x1200));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x1fff));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x2000));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x200f));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x2010));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(UINT64_MAX));
+}
+
+TEST_F(ImageTests,
+SegmentFromAddressReturnsFirstOfOverlappingSegments) {
+	auto* seg1 = image.addSegment(0x1080, 0x100);
+	auto* seg2 = image.addSegment(0x1000, 0x100);
+
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x1000));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x1080));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x10ff));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x1100));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x117f));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x1180));
+
+	// Order of the segments decides, not their addresses.
+	image.sortSegmentsByAddress();
+
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x1080));
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x10ff));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x1100));
+}
+
+TEST_F(ImageTests,
+SegmentFromAddressLooksBehindNestedSegments) {
+	auto* outer = image.addSegment(0x1000, 0x1000);
+	auto* inner1 = image.addSegment(0x1100, 0x100);
+	auto* inner2 = image.addSegment(0x1300, 0x100);
+	auto* after = image.addSegment(0x2000, 0x100);
+
+	EXPECT_EQ(outer, image.getSegmentFromAddress(0x1150));
+	EXPECT_EQ(outer, image.getSegmentFromAddress(0x1350));
+	EXPECT_EQ(outer, image.getSegmentFromAddress(0x1800));
+	EXPECT_EQ(outer, image.getSegmentFromAddress(0x1fff));
+	EXPECT_EQ(after, image.getSegmentFromAddress(0x2000));
+
+	image.deleteSegment(outer);
+
+	EXPECT_EQ(inner1, image.getSegmentFromAddress(0x1150));
+	EXPECT_EQ(inner2, image.getSegmentFromAddress(0x1350));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x1800));
+	EXPECT_EQ(after, image.getSegmentFromAddress(0x2000));
+}
+
+TEST_F(ImageTests,
+SegmentFromAddressDoesNotReuseOverlappedSegment) {
+	auto* seg1 = image.addSegment(0x1000, 0x100);
+	auto* seg2 = image.addSegment(0x1080, 0x100);
+
+	// The last hit must not hide the segment which precedes it.
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x1150));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x1090));
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x1150));
+}
+
+TEST_F(ImageTests,
+SegmentFromAddressSeesInsertedAndRemovedSegments) {
+	auto* seg1 = image.addSegment(0x1000, 0x100);
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x1010));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x2010));
+
+	auto* seg2 = image.addSegment(0x2000, 0x100);
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x2010));
+	EXPECT_EQ(seg1, image.getSegmentFromAddress(0x1010));
+
+	image.deleteSegment(seg1);
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x1010));
+	EXPECT_EQ(seg2, image.getSegmentFromAddress(0x2010));
+
+	auto* seg3 = image.addSegment(0x1000, 0x10);
+	EXPECT_EQ(seg3, image.getSegmentFromAddress(0x1000));
+	EXPECT_EQ(nullptr, image.getSegmentFromAddress(0x1010));
+}
+
+TEST_F(ImageTests,
+GetXByteReadsInFileEndianness) {
+	image.addSegment(0x1000, 0x10, 0x10);
+	std::uint64_t res = 0;
+
+	EXPECT_TRUE(image.getXByte(0x1000, 4, res));
+	EXPECT_EQ(0x13121110, res);
+	EXPECT_TRUE(image.getXByte(0x1001, 2, res, Endianness::BIG));
+	EXPECT_EQ(0x1112, res);
+	EXPECT_TRUE(image.getXByte(0x1008, 8, res));
+	EXPECT_EQ(0x1f1e1d1c1b1a1918, res);
+	EXPECT_TRUE(image.getXByte(0x100f, 1, res));
+	EXPECT_EQ(0x1f, res);
+}
+
+TEST_F(ImageTests,
+GetXByteDoesNotReadAcrossSegmentEnd) {
+	image.addSegment(0x1000, 0x8, 0x8);
+	image.addSegment(0x1008, 0x8, 0x8);
+	std::uint64_t res = 0;
+
+	EXPECT_TRUE(image.getXByte(0x1004, 4, res));
+	EXPECT_EQ(0x17161514, res);
+	EXPECT_FALSE(image.getXByte(0x1005, 4, res));
+	EXPECT_FALSE(image.getXByte(0x1010, 1, res));
+	EXPECT_FALSE(image.getXByte(0x0fff, 2, res));
+}
+
+TEST_F(ImageTests,
+GetXByteReadsZeroesBeyondPhysicalData) {
+	image.addSegment(0x1000, 0x10, 0x4);
+	std::uint64_t res = 0;
+
+	EXPECT_TRUE(image.getXByte(0x1002, 4, res));
+	EXPECT_EQ(0x1312, res);
+	EXPECT_TRUE(image.getXByte(0x1008, 8, res));
+	EXPECT_EQ(0x0, res);
+
+	std::vector<std::uint8_t> bytes;
+	EXPECT_TRUE(image.getXBytes(0x1002, 4, bytes));
+	EXPECT_EQ(std::vector<std::uint8_t>({0x12, 0x13, 0x00, 0x00}), bytes);
+}
+
+TEST_F(ImageTests,
+GetXByteRejectsInvalidSizes) {
+	image.addSegment(0x1000, 0x10, 0x10);
+	std::uint64_t res = 0;
+
+	EXPECT_FALSE(image.getXByte(0x1000, 0, res));
+	EXPECT_FALSE(image.getXByte(0x1000, 9, res));
+}
+
+TEST_F(ImageTests,
+FileHashesAreComputedFromOriginalBytes) {
+	image.addFileSegment(0x1000);
+	const auto crc32 = retdec::fileformat::getCrc32(imageData.data(), imageData.size());
+	const auto md5 = retdec::fileformat::getMd5(imageData.data(), imageData.size());
+	const auto sha256 = retdec::fileformat::getSha256(imageData.data(), imageData.size());
+	std::uint64_t res = 0;
+
+	EXPECT_TRUE(image.setXByte(0x1004, 4, 0xdeadbeef));
+	EXPECT_TRUE(image.setXByte(0x1006, 4, 0x01020304));
+	EXPECT_TRUE(image.setXByte(0x100e, 4, 0xffffffff));
+
+	EXPECT_TRUE(image.getXByte(0x1004, 4, res));
+	EXPECT_EQ(0x0304beef, res);
+	EXPECT_EQ(crc32, image.getFileFormat()->getCrc32());
+
+	EXPECT_TRUE(image.setXByte(0x1000, 4, 0x0));
+	EXPECT_EQ(md5, image.getFileFormat()->getMd5());
+	EXPECT_EQ(sha256, image.getFileFormat()->getSha256());
+}
+
+TEST_F(ImageTests,
+OriginalBytesAreKeptWhenFileIsOverwritten) {
+	image.addFileSegment(0x1000);
+	const auto* fileFormat = image.getFileFormat();
+	EXPECT_EQ(&fileFormat->getBytes(), &fileFormat->getOriginalBytes());
+
+	EXPECT_TRUE(image.setXByte(0x1004, 4, 0xdeadbeef));
+	EXPECT_EQ(imageData, fileFormat->getOriginalBytes());
+	EXPECT_NE(imageData, fileFormat->getBytes());
+
+	// Overwrites after the original bytes were restored are undone as well.
+	EXPECT_TRUE(image.setXByte(0x1006, 4, 0x01020304));
+	EXPECT_EQ(imageData, fileFormat->getOriginalBytes());
+	EXPECT_EQ(0x04, fileFormat->getBytes()[6]);
+}
+
+} // namespace tests
+} // namespace loader
+} // namespace retdec
@@ -0,0 +1,172 @@
+/**
+ * @file tests/macho-extractor/break_fat_tests.cpp
+ * @brief Tests for the @c break_fat module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/macho-extractor/break_fat.h"
+#include "retdec/utils/filesystem.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace macho_extractor {
+namespace tests {
+
+/**
+ * Tests for the @c break_fat module.
+ *
+ * The universal binary contains an ARM slice at 0x1000 and an x86 slice at
+ * 0x2000. Every byte of a slice is set to its CPU type.
+ */
+class BreakFatTests : public Test
+{
+	protected:
+		static const std::uint32_t cpuTypeX86 = 7;
+		static const std::uint32_t cpuTypeArm = 12;
+		static const std::size_t sliceSize = 0x100;
+
+		std::vector<std::string> files;
+
+	public:
+		~BreakFatTests()
+		{
+			for (const auto& f : files)
+			{
+				fs::remove(f);
+			}
+		}
+
+		std::string tempPath(const std::string& name)
+		{
+			auto path = (fs::temp_directory_path()
+					/ ("retdec-tests-macho-extractor-" + name)).string();
+			files.push_back(path);
+			return path;
+		}
+
+		std::string writeUniversalBinary()
+		{
+			std::vector<std::uint8_t> bytes(0x2000 + sliceSize, 0);
+			auto put = [&](std::size_t offset, std::uint32_t value)
+			{
+				// Headers of universal binaries are big endian.
+				bytes[offset] = value >> 24;
+				bytes[offset + 1] = value >> 16;
+				bytes[offset + 2] = value >> 8;
+				bytes[offset + 3] = value;
+			};
+			put(0x0, 0xcafebabe);
+			put(0x4, 2);
+			// cputype, cpusubtype, offset, size, align
+			put(0x8, cpuTypeArm);
+			put(0xc, 9);
+			put(0x10, 0x1000);
+			put(0x14, sliceSize);
+			put(0x18, 12);
+			put(0x1c, cpuTypeX86);
+			put(0x20, 3);
+			put(0x24, 0x2000);
+			put(0x28, sliceSize);
+			put(0x2c, 12);
+			std::fill_n(bytes.begin() + 0x1000, sliceSize, cpuTypeArm);
+			std::fill_n(bytes.begin() + 0x2000, sliceSize, cpuTypeX86);
+
+			const auto path = tempPath("fat");
+			std::ofstream(path, std::ios::binary).write(
+					reinterpret_cast<const char*>(bytes.data()),
+					bytes.size());
+			return path;
+		}
+
+		std::vector<std::uint8_t> slice(std::uint32_t cpuType)
+		{
+			return std::vector<std::uint8_t>(sliceSize, cpuType);
+		}
+
+		std::vector<std::uint8_t> readFile(const std::string& path)
+		{
+			std::ifstream file(path, std::ios::binary);
+			return std::vector<std::uint8_t>(
+					std::istreambuf_iterator<char>(file),
+					std::istreambuf_iterator<char>());
+		}
+};
+
+TEST_F(BreakFatTests, BestArchiveIsExtractedIntoMemory)
+{
+	BreakMachOUniversal binary(writeUniversalBinary());
+	ASSERT_TRUE(binary.isValid());
+	EXPECT_FALSE(binary.isStaticLibrary());
+	std::vector<std::uint8_t> data;
+
+	// x86 is preferred to ARM.
+	EXPECT_TRUE(binary.extractBestArchive(data));
+	EXPECT_EQ(slice(cpuTypeX86), data);
+}
+
+TEST_F(BreakFatTests, ArchiveForFamilyIsExtractedIntoMemory)
+{
+	BreakMachOUniversal binary(writeUniversalBinary());
+	ASSERT_TRUE(binary.isValid());
+	std::vector<std::uint8_t> data;
+
+	EXPECT_TRUE(binary.extractArchiveForFamily("arm", data));
+	EXPECT_EQ(slice(cpuTypeArm), data);
+	EXPECT_TRUE(binary.extractArchiveForFamily("thumb", data));
+	EXPECT_EQ(slice(cpuTypeArm), data);
+	EXPECT_TRUE(binary.extractArchiveForFamily("x86", data));
+	EXPECT_EQ(slice(cpuTypeX86), data);
+}
+
+TEST_F(BreakFatTests, MissingFamilyIsNotExtractedIntoMemory)
+{
+	BreakMachOUniversal binary(writeUniversalBinary());
+	ASSERT_TRUE(binary.isValid());
+	std::vector<std::uint8_t> data;
+
+	EXPECT_FALSE(binary.extractArchiveForFamily("powerpc", data));
+	EXPECT_FALSE(binary.extractArchiveForFamily("unknown", data));
+	EXPECT_TRUE(data.empty());
+}
+
+TEST_F(BreakFatTests, InvalidBinaryIsNotExtractedIntoMemory)
+{
+	const auto path = tempPath("invalid");
+	std::ofstream(path, std::ios::binary) << "not a universal binary";
+	BreakMachOUniversal binary(path);
+	std::vector<std::uint8_t> data;
+
+	EXPECT_FALSE(binary.isValid());
+	EXPECT_FALSE(binary.extractBestArchive(data));
+	EXPECT_FALSE(binary.extractArchiveForFamily("x86", data));
+}
+
+TEST_F(BreakFatTests, ExtractionIntoMemoryGivesSameContentAsExtractionIntoFile)
+{
+	BreakMachOUniversal binary(writeUniversalBinary());
+	ASSERT_TRUE(binary.isValid());
+	const auto bestPath = tempPath("best");
+	const auto armPath = tempPath("arm");
+	std::vector<std::uint8_t> best;
+	std::vector<std::uint8_t> arm;
+
+	EXPECT_TRUE(binary.extractBestArchive(bestPath));
+	EXPECT_TRUE(binary.extractBestArchive(best));
+	EXPECT_EQ(readFile(bestPath), best);
+	EXPECT_TRUE(binary.extractArchiveForFamily("arm", armPath));
+	EXPECT_TRUE(binary.extractArchiveForFamily("arm", arm));
+	EXPECT_EQ(readFile(armPath), arm);
+}
+
+} // namespace tests
+} // namespace macho_extractor
+} // namespace retdec
@@ -0,0 +1,109 @@
+/**
+ * @file tests/retdec/callback_ostream_tests.cpp
+ * @brief Tests for the @c callback_ostream module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/retdec/callback_ostream.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace tests {
+
+/**
+ * Tests for the @c callback_ostream module.
+ */
+class CallbackOstreamTests : public Test
+{
+	protected:
+		std::vector<std::string> chunks;
+		OutputCallback callback = [this](const char* data, std::size_t size)
+		{
+			chunks.emplace_back(data, size);
+		};
+
+		std::string joinedChunks() const
+		{
+			std::string result;
+			for (const auto& chunk : chunks)
+			{
+				result += chunk;
+			}
+			return result;
+		}
+};
+
+TEST_F(CallbackOstreamTests, SmallWritesArePassedInOneChunk)
+{
+	{
+		CallbackOstream out(callback);
+		out << "int main() {" << "\n" << "}" << "\n";
+		EXPECT_TRUE(chunks.empty());
+		EXPECT_EQ(15, out.tell());
+	}
+
+	ASSERT_EQ(1, chunks.size());
+	EXPECT_EQ("int main() {\n}\n", chunks[0]);
+}
+
+TEST_F(CallbackOstreamTests, LargeWriteIsSplitIntoChunksOfBufferSize)
+{
+	const auto size = 2 * CallbackOstream::BufferSize + 10;
+	std::string data;
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		data += static_cast<char>('a' + i % 26);
+	}
+
+	{
+		CallbackOstream out(callback);
+		out << data;
+		EXPECT_EQ(size, out.tell());
+	}
+
+	ASSERT_EQ(3, chunks.size());
+	EXPECT_EQ(CallbackOstream::BufferSize, chunks[0].size());
+	EXPECT_EQ(CallbackOstream::BufferSize, chunks[1].size());
+	EXPECT_EQ(10, chunks[2].size());
+	EXPECT_EQ(data, joinedChunks());
+}
+
+TEST_F(CallbackOstreamTests, NoChunkIsLargerThanBufferSize)
+{
+	std::string expected;
+	{
+		CallbackOstream out(callback);
+		for (std::size_t i = 1; i < 40; ++i)
+		{
+			std::string data(i * 7919, static_cast<char>('a' + i % 26));
+			out << data;
+			expected += data;
+		}
+	}
+
+	for (const auto& chunk : chunks)
+	{
+		EXPECT_GE(CallbackOstream::BufferSize, chunk.size());
+	}
+	EXPECT_EQ(expected, joinedChunks());
+}
+
+TEST_F(CallbackOstreamTests, FlushPassesBufferedData)
+{
+	CallbackOstream out(callback);
+	out << "abc";
+	out.flush();
+	out << "def";
+	out.flush();
+
+	EXPECT_EQ(std::vector<std::string>({"abc", "def"}), chunks);
+}
+
+} // namespace tests
+} // namespace retdec
@@ -0,0 +1,453 @@
+/**
+ * @file tests/stacofin/stacofin_tests.cpp
+ * @brief Tests for the @c stacofin module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/config/config.h"
+#include "retdec/fileformat/file_format/raw_data/raw_data_format.h"
+#include "retdec/fileformat/types/sec_seg/section.h"
+#include "retdec/loader/loader/image.h"
+#include "retdec/stacofin/stacofin.h"
+#include "retdec/utils/filesystem.h"
+#include "retdec/yaracpp/yara_detector.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+using namespace retdec::loader;
+using namespace retdec::yaracpp;
+
+namespace retdec {
+namespace stacofin {
+namespace tests {
+
+const std::vector<std::uint8_t> codeBytes = {
+	0x90, 0x90, 0x90, 0x90, 0x55, 0x8b, 0xec, 0x6a, 0xff, 0x68, 0x00, 0x12,
+	0x40, 0x00, 0xc3, 0x90, 0x55, 0x8b, 0xec, 0x6a, 0xff, 0x68, 0x34, 0x12,
+	0x40, 0x00, 0xc3, 0x90, 0x90, 0x90, 0x90, 0x90
+};
+
+const std::string functionRule = R"(
+rule function
+{
+	meta:
+		name = "function"
+		size = 11
+	strings:
+		$1 = { 55 8B EC 6A FF 68 ?? 12 40 00 C3 }
+	condition:
+		$1
+}
+)";
+
+/**
+ * Code with functions whose detections are confirmed or rejected:
+ *   - 0x00 caller: calls callee and refers to missing 0x500000
+ *   - 0x0c before: refers to missing 0x500000 and overlaps callee
+ *   - 0x14 callee, alias: the same address
+ *   - 0x16 inner: overlaps callee
+ *   - 0x1f other: refers to missing 0x500000
+ */
+const std::vector<std::uint8_t> confirmBytes = {
+	0xe8, 0x0f, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00,
+	0x50, 0x00, 0xc3, 0x90, 0xb8, 0x00, 0x00, 0x50,
+	0x00, 0x90, 0x90, 0x90, 0x55, 0x8b, 0xec, 0x5d,
+	0xc3, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+	0xb8, 0x00, 0x00, 0x50, 0x00, 0xc3, 0x90, 0x90,
+	0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90
+};
+
+/**
+ * Create a copy of @c confirmBytes which refers to the given missing address.
+ */
+std::vector<std::uint8_t> createConfirmBytes(std::uint32_t missing)
+{
+	auto bytes = confirmBytes;
+	for (std::size_t offset : {0x06, 0x0d, 0x21})
+	{
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			bytes[offset + i] = (missing >> (8 * i)) & 0xff;
+		}
+	}
+	return bytes;
+}
+
+const std::string confirmRules = R"(
+rule caller
+{
+	meta:
+		name = "caller"
+		size = 11
+		refs = "1 callee 6 missing"
+	strings:
+		$1 = { E8 0F 00 00 00 B8 ?? ?? ?? ?? C3 }
+	condition:
+		$1
+}
+rule before
+{
+	meta:
+		name = "before"
+		size = 16
+		refs = "1 missing"
+	strings:
+		$1 = { B8 ?? ?? ?? ?? 90 90 90 55 8B }
+	condition:
+		$1
+}
+rule callee
+{
+	meta:
+		name = "callee"
+		size = 8
+	strings:
+		$1 = { 55 8B EC 5D C3 90 90 90 }
+	condition:
+		$1
+}
+rule alias
+{
+	meta:
+		name = "alias"
+		size = 4
+	strings:
+		$1 = { 55 8B EC 5D }
+	condition:
+		$1
+}
+rule inner
+{
+	meta:
+		name = "inner"
+		size = 4
+	strings:
+		$1 = { EC 5D C3 90 }
+	condition:
+		$1
+}
+rule other
+{
+	meta:
+		name = "other"
+		size = 7
+		refs = "2 missing"
+	strings:
+		$1 = { 90 B8 ?? ?? ?? ?? C3 }
+	condition:
+		$1
+}
+)";
+
+/**
+ * Image with segments over the given buffers.
+ */
+class TestImage : public Image
+{
+	public:
+		TestImage() : Image(std::make_shared<RawDataFormat>(
+				codeBytes.data(),
+				codeBytes.size()))
+		{
+		}
+
+		virtual bool load() override
+		{
+			return true;
+		}
+
+		void addSegment(
+				std::uint64_t address,
+				const std::vector<std::uint8_t>& data,
+				const SecSeg* secSeg = nullptr)
+		{
+			llvm::StringRef dataRef(
+					reinterpret_cast<const char*>(data.data()),
+					data.size());
+			insertSegment(std::make_unique<loader::Segment>(
+					secSeg,
+					address,
+					data.size(),
+					std::make_unique<SegmentDataSource>(dataRef)));
+		}
+};
+
+/**
+ * Tests for the @c stacofin module.
+ */
+class StacofinTests : public Test
+{
+	protected:
+		TestImage image;
+		std::vector<std::string> ruleFiles;
+
+	public:
+		~StacofinTests()
+		{
+			for (const auto& f : ruleFiles)
+			{
+				fs::remove(f);
+			}
+		}
+
+		std::string writeRuleFile(const std::string& name, const std::string& text)
+		{
+			auto path = (fs::temp_directory_path()
+					/ ("retdec-tests-stacofin-" + name + ".yar")).string();
+			std::ofstream(path) << text;
+			ruleFiles.push_back(path);
+			return path;
+		}
+
+		/**
+		 * Compile the given rules and write them into a precompiled rule file.
+		 * The rules are compiled through the cache directory, the only place
+		 * where the detector stores compiled rules.
+		 */
+		std::string writePrecompiledRuleFile(
+				const std::string& name,
+				const std::string& text)
+		{
+			const auto textPath = writeRuleFile(name, text);
+			const auto cacheDir = fs::temp_directory_path()
+					/ ("retdec-tests-stacofin-" + name + "-cache");
+			fs::create_directory(cacheDir);
+			YaraDetector::setCacheDirectory(cacheDir.string());
+			{
+				YaraDetector detector;
+				EXPECT_TRUE(detector.addRuleFile(textPath));
+			}
+			YaraDetector::setCacheDirectory("");
+
+			auto path = (fs::temp_directory_path()
+					/ ("retdec-tests-stacofin-" + name + ".yarac")).string();
+			for (const auto& entry : fs::directory_iterator(cacheDir))
+			{
+				fs::rename(entry.path(), path);
+			}
+			fs::remove_all(cacheDir);
+			ruleFiles.push_back(path);
+			return path;
+		}
+
+		/**
+		 * Get signature paths of functions detected on the given address.
+		 */
+		std::multiset<std::string> getSignaturePaths(
+				const Finder& finder,
+				common::Address address)
+		{
+			std::multiset<std::string> result;
+			auto range = finder.getAllDetections().equal_range(address);
+			for (auto it = range.first; it != range.second; ++it)
+			{
+				result.insert(it->second.signaturePath);
+			}
+			return result;
+		}
+
+		/**
+		 * Search the image for functions from the given rule file and
+		 * confirm them using the given number of threads.
+		 * @return Names of the confirmed functions by their addresses.
+		 */
+		std::map<common::Address, std::string> searchAndConfirm(
+				const std::string& yaraFile,
+				std::size_t threads)
+		{
+			config::Config config;
+			config.architecture.setIsX86();
+			config.parameters.setThreads(threads);
+			config.parameters.userStaticSignaturePaths.insert(yaraFile);
+			Finder finder;
+
+			finder.searchAndConfirm(image, config);
+
+			std::map<common::Address, std::string> result;
+			for (const auto& p : finder.getConfirmedDetections())
+			{
+				result.emplace(p.first, p.second->getName());
+			}
+			return result;
+		}
+};
+
+TEST_F(StacofinTests, CodeIsScannedRightInTheSegment)
+{
+	image.addSegment(0x401000, codeBytes);
+	Finder finder;
+
+	finder.search(image, writeRuleFile("function", functionRule));
+
+	const auto& detections = finder.getAllDetections();
+	ASSERT_EQ(2, detections.size());
+	auto it = detections.begin();
+	EXPECT_EQ(0x401004, it->first);
+	EXPECT_EQ(0x4, it->second.offset);
+	EXPECT_EQ(11, it->second.size);
+	EXPECT_EQ("function", it->second.getName());
+	++it;
+	EXPECT_EQ(0x401010, it->first);
+	EXPECT_EQ(0x10, it->second.offset);
+}
+
+TEST_F(StacofinTests, EachSegmentIsScannedSeparately)
+{
+	// The function is split between the segments, so it must not be found.
+	std::vector<std::uint8_t> first(codeBytes.begin(), codeBytes.begin() + 8);
+	std::vector<std::uint8_t> second(codeBytes.begin() + 8, codeBytes.end());
+	image.addSegment(0x401000, first);
+	image.addSegment(0x401008, second);
+	Finder finder;
+
+	finder.search(image, writeRuleFile("function", functionRule));
+
+	const auto& detections = finder.getAllDetections();
+	ASSERT_EQ(1, detections.size());
+	EXPECT_EQ(0x401010, detections.begin()->first);
+	EXPECT_EQ(0x8, detections.begin()->second.offset);
+}
+
+TEST_F(StacofinTests, OnlyCodeSegmentsAreScanned)
+{
+	Section code;
+	code.setType(SecSeg::Type::CODE);
+	Section data;
+	data.setType(SecSeg::Type::DATA);
+	image.addSegment(0x401000, codeBytes, &code);
+	image.addSegment(0x402000, codeBytes, &data);
+	image.addSegment(0x403000, codeBytes);
+	Finder finder;
+
+	finder.search(image, writeRuleFile("function", functionRule));
+
+	const auto& detections = finder.getAllDetections();
+	ASSERT_EQ(4, detections.size());
+	EXPECT_EQ(1, detections.count(0x401004));
+	EXPECT_EQ(1, detections.count(0x401010));
+	EXPECT_EQ(0, detections.count(0x402004));
+	EXPECT_EQ(0, detections.count(0x402010));
+	EXPECT_EQ(1, detections.count(0x403004));
+	EXPECT_EQ(1, detections.count(0x403010));
+}
+
+TEST_F(StacofinTests, TextFilesAreSearchedAtOnceWithRulesInTheirNamespaces)
+{
+	// Both files use the same rule ID.
+	image.addSegment(0x401000, codeBytes);
+	const auto path = writeRuleFile("function", functionRule);
+	const auto otherPath = writeRuleFile("other-function", functionRule);
+	Finder finder;
+
+	finder.search(image, std::set<std::string>{path, otherPath});
+
+	EXPECT_EQ(4, finder.getAllDetections().size());
+	EXPECT_EQ(
+			std::multiset<std::string>({path, otherPath}),
+			getSignaturePaths(finder, 0x401004));
+	EXPECT_EQ(
+			std::multiset<std::string>({path, otherPath}),
+			getSignaturePaths(finder, 0x401010));
+}
+
+TEST_F(StacofinTests, BrokenTextFileDoesNotHideOtherFiles)
+{
+	image.addSegment(0x401000, codeBytes);
+	const auto path = writeRuleFile("function", functionRule);
+	const auto brokenPath = writeRuleFile("broken", "rule broken {");
+	Finder finder;
+
+	finder.search(image, std::set<std::string>{path, brokenPath});
+
+	EXPECT_EQ(2, finder.getAllDetections().size());
+	EXPECT_EQ(
+			std::multiset<std::string>({path}),
+			getSignaturePaths(finder, 0x401004));
+	EXPECT_EQ(
+			std::multiset<std::string>({path}),
+			getSignaturePaths(finder, 0x401010));
+}
+
+TEST_F(StacofinTests, PrecompiledFilesAreSearchedSeparatelyFromTextFiles)
+{
+	image.addSegment(0x401000, codeBytes);
+	const auto precompiledPath = writePrecompiledRuleFile(
+			"precompiled-function",
+			functionRule);
+	const auto path = writeRuleFile("function", functionRule);
+	Finder finder;
+
+	finder.search(image, std::set<std::string>{precompiledPath, path});
+
+	EXPECT_EQ(4, finder.getAllDetections().size());
+	EXPECT_EQ(
+			std::multiset<std::string>({precompiledPath, path}),
+			getSignaturePaths(finder, 0x401004));
+	EXPECT_EQ(
+			std::multiset<std::string>({precompiledPath, path}),
+			getSignaturePaths(finder, 0x401010));
+}
+
+TEST_F(StacofinTests, ConflictingDetectionsAreRejectedAndSharedReferencesConfirmed)
+{
+	Section code;
+	code.setType(SecSeg::Type::CODE);
+	image.addSegment(0x401000, confirmBytes, &code);
+	const auto path = writeRuleFile("confirm", confirmRules);
+
+	// The caller is confirmed with half of its references and confirms the
+	// callee, which rejects all the overlapping detections, including the one
+	// starting before it. The missing reference confirmed by the caller makes
+	// all references of the other detections ok, so the other detection which
+	// was not rejected is confirmed as well.
+	EXPECT_EQ(
+			(std::map<common::Address, std::string>{
+					{0x401000, "caller"},
+					{0x401014, "callee"},
+					{0x40101f, "other"}}),
+			searchAndConfirm(path, 1));
+}
+
+TEST_F(StacofinTests, DetectionsConfirmedInParallelAreTheSameAsInOneThread)
+{
+	// Enough detections to solve their references in several chunks.
+	const std::size_t copies = 256;
+	Section code;
+	code.setType(SecSeg::Type::CODE);
+	std::vector<std::vector<std::uint8_t>> codes;
+	std::map<common::Address, std::string> expected;
+	for (std::size_t i = 0; i < copies; ++i)
+	{
+		// Each copy refers to its own missing address, so that confirmation
+		// of one copy does not affect the others.
+		codes.push_back(createConfirmBytes(0x600000 + i * 0x10));
+	}
+	for (std::size_t i = 0; i < copies; ++i)
+	{
+		common::Address address = 0x401000 + i * 0x100;
+		image.addSegment(address, codes[i], &code);
+		expected.emplace(address, "caller");
+		expected.emplace(address + 0x14, "callee");
+		expected.emplace(address + 0x1f, "other");
+	}
+	const auto path = writeRuleFile("confirm", confirmRules);
+
+	const auto serial = searchAndConfirm(path, 1);
+	const auto parallel = searchAndConfirm(path, 4);
+
+	EXPECT_EQ(expected, serial);
+	EXPECT_EQ(serial, parallel);
+}
+
+} // namespace tests
+} // namespace stacofin
+} // namespace retdec
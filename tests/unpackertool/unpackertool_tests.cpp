@@ -0,0 +1,180 @@
+/**
+ * @file tests/unpackertool/unpackertool_tests.cpp
+ * @brief Tests for the @c unpackertool module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/ar-extractor/archive_wrapper.h"
+#include "retdec/macho-extractor/break_fat.h"
+#include "retdec/unpackertool/unpackertool.h"
+#include "retdec/utils/filesystem.h"
+
+using namespace ::testing;
+using namespace retdec::fileformat;
+
+namespace retdec {
+namespace unpackertool {
+namespace tests {
+
+/**
+ * ELF file without any packer.
+ */
+const std::vector<std::uint8_t> elfBytes = {
+	0x7f, 0x45, 0x4c, 0x46, 0x01, 0x01, 0x01, 0x48, 0x69, 0x20, 0x57, 0x6f, 0x72, 0x6c, 0x64, 0x0a,
+	0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x80, 0x04, 0x08, 0x34, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x20, 0x00, 0x02, 0x00, 0x28, 0x00,
+	0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x08,
+	0x00, 0x80, 0x04, 0x08, 0xa2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0x90, 0x04, 0x08,
+	0xa4, 0x90, 0x04, 0x08, 0x09, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xba, 0x09, 0x00, 0x00, 0x00, 0xb9, 0x07, 0x90, 0x04, 0x08, 0xbb, 0x01, 0x00, 0x00, 0x00, 0xb8,
+	0x04, 0x00, 0x00, 0x00, 0xcd, 0x80, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x00,
+	0xcd, 0x80, 0x00, 0x00
+};
+
+/**
+ * Tests for the @c unpackertool module.
+ */
+class UnpackertoolTests : public Test
+{
+	protected:
+		std::string inputFile = tempPath("input");
+		std::string workFile = tempPath("input-unpacked");
+
+	public:
+		~UnpackertoolTests()
+		{
+			fs::remove(inputFile);
+			fs::remove(workFile);
+		}
+
+		static std::string tempPath(const std::string& name)
+		{
+			return (fs::temp_directory_path()
+					/ ("retdec-tests-unpackertool-" + name)).string();
+		}
+
+		void writeFile(const std::string& path, const std::vector<std::uint8_t>& bytes)
+		{
+			std::ofstream(path, std::ios::binary).write(
+					reinterpret_cast<const char*>(bytes.data()),
+					bytes.size());
+		}
+
+		/**
+		 * Check that the input without packers in @a bytes was parsed and
+		 * that the parsed input and the detected tools are kept for reuse.
+		 */
+		void checkNothingUnpacked(
+				const UnpackResult& result,
+				const std::vector<std::uint8_t>& bytes)
+		{
+			EXPECT_EQ(EXIT_CODE_NOTHING_TO_DO, result.code);
+			ASSERT_NE(nullptr, result.input);
+			EXPECT_EQ(Format::ELF, result.input->getFileFormat());
+			EXPECT_EQ(bytes.size(), result.input->getFileLength());
+			ASSERT_NE(nullptr, result.inputTools);
+			EXPECT_TRUE(result.inputTools->detectedTools.empty());
+			EXPECT_TRUE(result.unpacked.empty());
+			// Nothing is written if there is no plugin to run.
+			EXPECT_FALSE(fs::exists(inputFile));
+			EXPECT_FALSE(fs::exists(workFile));
+		}
+};
+
+TEST_F(UnpackertoolTests, InputFromMemoryWithoutPackerIsParsedAndNotWritten)
+{
+	auto result = unpack(inputFile, &elfBytes, workFile);
+
+	checkNothingUnpacked(result, elfBytes);
+}
+
+TEST_F(UnpackertoolTests, InputFromMemoryIsDetectedAsInputFromFile)
+{
+	writeFile(inputFile, elfBytes);
+	auto fileResult = unpack(inputFile, nullptr, workFile);
+	fs::remove(inputFile);
+	auto memoryResult = unpack(inputFile, &elfBytes, workFile);
+
+	checkNothingUnpacked(memoryResult, elfBytes);
+	ASSERT_NE(nullptr, fileResult.input);
+	ASSERT_NE(nullptr, fileResult.inputTools);
+	EXPECT_EQ(fileResult.code, memoryResult.code);
+	EXPECT_EQ(fileResult.inputToolsStatus, memoryResult.inputToolsStatus);
+	EXPECT_EQ(fileResult.input->getFileFormat(), memoryResult.input->getFileFormat());
+	EXPECT_EQ(fileResult.input->getFileLength(), memoryResult.input->getFileLength());
+	EXPECT_EQ(fileResult.inputTools->epAddress, memoryResult.inputTools->epAddress);
+	EXPECT_EQ(fileResult.inputTools->epBytes, memoryResult.inputTools->epBytes);
+}
+
+TEST_F(UnpackertoolTests, UnknownInputFromMemoryIsNotParsed)
+{
+	const std::vector<std::uint8_t> bytes = {'u', 'n', 'k', 'n', 'o', 'w', 'n'};
+
+	auto result = unpack(inputFile, &bytes, workFile);
+
+	EXPECT_EQ(EXIT_CODE_PREPROCESSING_ERROR, result.code);
+	EXPECT_EQ(nullptr, result.input);
+	EXPECT_EQ(nullptr, result.inputTools);
+	EXPECT_FALSE(fs::exists(inputFile));
+}
+
+TEST_F(UnpackertoolTests, ObjectExtractedFromArchiveInMemoryIsParsed)
+{
+	std::string archive = "!<arch>\n";
+	archive += "input.o/        0           0     0     644     ";
+	archive += std::to_string(elfBytes.size());
+	archive += std::string(10 - std::to_string(elfBytes.size()).size(), ' ');
+	archive += "`\n";
+	archive.append(elfBytes.begin(), elfBytes.end());
+	const std::vector<std::uint8_t> archiveBytes(archive.begin(), archive.end());
+	bool success = false;
+	std::string error;
+	ar_extractor::ArchiveWrapper wrapper(
+			archiveBytes.data(), archiveBytes.size(), success, error);
+	ASSERT_TRUE(success) << error;
+	std::vector<std::uint8_t> extracted;
+	ASSERT_TRUE(wrapper.extractByName("input.o", error, extracted)) << error;
+
+	auto result = unpack(inputFile, &extracted, workFile);
+
+	checkNothingUnpacked(result, elfBytes);
+}
+
+TEST_F(UnpackertoolTests, ObjectExtractedFromUniversalBinaryIntoMemoryIsParsed)
+{
+	std::vector<std::uint8_t> fatBytes = {
+		// magic, nfat_arch
+		0xca, 0xfe, 0xba, 0xbe, 0x00, 0x00, 0x00, 0x01,
+		// x86: cputype, cpusubtype, offset, size, align
+		0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03,
+		0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x0c
+	};
+	// Size of the x86 slice.
+	fatBytes[0x17] = elfBytes.size();
+	fatBytes.resize(0x1000, 0);
+	fatBytes.insert(fatBytes.end(), elfBytes.begin(), elfBytes.end());
+	const auto fatFile = tempPath("fat");
+	writeFile(fatFile, fatBytes);
+	macho_extractor::BreakMachOUniversal fat(fatFile);
+	ASSERT_TRUE(fat.isValid());
+	std::vector<std::uint8_t> extracted;
+	ASSERT_TRUE(fat.extractBestArchive(extracted));
+	fs::remove(fatFile);
+
+	auto result = unpack(inputFile, &extracted, workFile);
+
+	checkNothingUnpacked(result, elfBytes);
+}
+
+} // namespace tests
+} // namespace unpackertool
+} // namespace retdec
@@ -0,0 +1,145 @@
+/**
+* @file tests/utils/thread_pool_tests.cpp
+* @brief Tests for the @c thread_pool module.
+* @copyright (c) 2021 Avast Software, licensed under the MIT license
+*/
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/thread_pool.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace utils {
+namespace tests {
+
+/**
+* @brief Tests for the @c thread_pool module.
+*/
+class ThreadPoolTests: public Test {};
+
+//
+// ThreadPool()
+//
+
+TEST_F(ThreadPoolTests,
+PoolWithOneThreadIsNotParallel) {
+	ThreadPool pool(1);
+
+	ASSERT_FALSE(pool.isParallel());
+	ASSERT_EQ(1, pool.getThreadCount());
+}
+
+TEST_F(ThreadPoolTests,
+PoolWithMoreThreadsIsParallel) {
+	ThreadPool pool(3);
+
+	ASSERT_TRUE(pool.isParallel());
+	ASSERT_EQ(3, pool.getThreadCount());
+}
+
+TEST_F(ThreadPoolTests,
+PoolWithZeroThreadsUsesHardwareThreadCount) {
+	ThreadPool pool(0);
+
+	ASSERT_EQ(ThreadPool::getHardwareThreadCount(), pool.getThreadCount());
+}
+
+//
+// submit()
+//
+
+TEST_F(ThreadPoolTests,
+SubmitReturnsResultOfTask) {
+	ThreadPool pool(2);
+
+	auto future = pool.submit([]() { return 42; });
+
+	ASSERT_EQ(42, future.get());
+}
+
+TEST_F(ThreadPoolTests,
+SubmitInSynchronousModeRunsTaskInCallingThread) {
+	ThreadPool pool(1);
+
+	auto future = pool.submit([]() { return std::this_thread::get_id(); });
+
+	ASSERT_EQ(std::this_thread::get_id(), future.get());
+}
+
+TEST_F(ThreadPoolTests,
+SubmitPropagatesExceptionThroughFuture) {
+	ThreadPool pool(2);
+
+	auto future = pool.submit([]() -> int { throw std::runtime_error("x"); });
+
+	ASSERT_THROW(future.get(), std::runtime_error);
+}
+
+//
+// wait()
+//
+
+TEST_F(ThreadPoolTests,
+WaitReturnsAfterAllSubmittedTasksFinish) {
+	ThreadPool pool(4);
+	std::atomic<int> counter(0);
+
+	for (int i = 0; i < 100; ++i) {
+		pool.submit([&counter]() { ++counter; });
+	}
+	pool.wait();
+
+	ASSERT_EQ(100, counter);
+}
+
+//
+// parallelFor()
+//
+
+TEST_F(ThreadPoolTests,
+ParallelForCallsFunctionForEveryIndexExactlyOnce) {
+	ThreadPool pool(4);
+	std::vector<int> calls(1000, 0);
+
+	pool.parallelFor(calls.size(), [&calls](std::size_t i) { ++calls[i]; });
+
+	ASSERT_EQ(std::vector<int>(1000, 1), calls);
+}
+
+TEST_F(ThreadPoolTests,
+ParallelForInSynchronousModeCallsFunctionInIncreasingOrder) {
+	ThreadPool pool(1);
+	std::vector<std::size_t> order;
+
+	pool.parallelFor(5, [&order](std::size_t i) { order.push_back(i); });
+
+	ASSERT_EQ(std::vector<std::size_t>({0, 1, 2, 3, 4}), order);
+}
+
+TEST_F(ThreadPoolTests,
+ParallelForRethrowsExceptionAfterAllCallsFinish) {
+	ThreadPool pool(4);
+	std::atomic<int> counter(0);
+
+	ASSERT_THROW(
+		pool.parallelFor(50, [&counter](std::size_t i) {
+			++counter;
+			if (i == 10) {
+				throw std::runtime_error("x");
+			}
+		}),
+		std::runtime_error
+	);
+	ASSERT_EQ(50, counter);
+}
+
+} // namespace tests
+} // namespace utils
+} // namespace retdec
@@ -0,0 +1,292 @@
+/**
+ * @file tests/yaracpp/yara_detector_tests.cpp
+ * @brief Tests for the @c yara_detector module.
+ * @copyright (c) 2017 Avast Software, licensed under the MIT license
+ */
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "retdec/utils/filesystem.h"
+#include "retdec/yaracpp/yara_detector.h"
+
+using namespace ::testing;
+
+namespace retdec {
+namespace yaracpp {
+namespace tests {
+
+const std::vector<std::uint8_t> inputBytes = {
+	'x', 'x', 'a', 'b', 'c', 'x', 'x', 'd', 'e', 'f', 'x', 'x'
+};
+
+const std::string abcRule = R"(
+rule abc
+{
+	strings:
+		$1 = "abc"
+	condition:
+		$1
+}
+)";
+
+const std::string defRule = R"(
+rule def
+{
+	strings:
+		$1 = "def"
+	condition:
+		$1
+}
+)";
+
+/**
+ * Tests for the @c yara_detector module.
+ */
+class YaraDetectorTests : public Test
+{
+	protected:
+		std::vector<std::string> ruleFiles;
+
+	public:
+		YaraDetectorTests()
+		{
+			// Keep only the rules used by some detector.
+			YaraDetector::setCacheCapacity(0);
+		}
+
+		~YaraDetectorTests()
+		{
+			for (const auto& f : ruleFiles)
+			{
+				fs::remove(f);
+			}
+		}
+
+		std::string writeRuleFile(const std::string& name, const std::string& text)
+		{
+			auto path = (fs::temp_directory_path()
+					/ ("retdec-tests-yaracpp-" + name + ".yar")).string();
+			std::ofstream(path) << text;
+			ruleFiles.push_back(path);
+			return path;
+		}
+
+		/**
+		 * Compile the given rules and write them into a precompiled rule file.
+		 * The rules are compiled through the cache directory, the only place
+		 * where the detector stores compiled rules.
+		 */
+		std::string writePrecompiledRuleFile(
+				const std::string& name,
+				const std::string& text)
+		{
+			const auto textPath = writeRuleFile(name, text);
+			const auto cacheDir = fs::temp_directory_path()
+					/ ("retdec-tests-yaracpp-" + name + "-cache");
+			fs::create_directory(cacheDir);
+			YaraDetector::setCacheDirectory(cacheDir.string());
+			{
+				YaraDetector detector;
+				EXPECT_TRUE(detector.addRuleFile(textPath, name));
+			}
+			YaraDetector::setCacheDirectory("");
+
+			auto path = (fs::temp_directory_path()
+					/ ("retdec-tests-yaracpp-" + name + ".yarac")).string();
+			for (const auto& entry : fs::directory_iterator(cacheDir))
+			{
+				fs::rename(entry.path(), path);
+			}
+			fs::remove_all(cacheDir);
+			ruleFiles.push_back(path);
+			return path;
+		}
+
+		std::vector<std::string> detect(YaraDetector& detector)
+		{
+			std::vector<std::string> result;
+			EXPECT_TRUE(detector.analyze(inputBytes));
+			for (const auto& rule : detector.getDetectedRules())
+			{
+				result.push_back(rule.getName());
+			}
+			return result;
+		}
+};
+
+TEST_F(YaraDetectorTests, RulesFromTheSameFileAreSharedByDetectors)
+{
+	const auto path = writeRuleFile("abc", abcRule);
+	YaraDetector detector1;
+	YaraDetector detector2;
+
+	EXPECT_TRUE(detector1.addRuleFile(path));
+	EXPECT_TRUE(detector2.addRuleFile(path));
+
+	EXPECT_EQ(1, YaraDetector::getNumberOfCachedRules());
+	EXPECT_EQ(std::vector<std::string>({"abc"}), detect(detector1));
+	EXPECT_EQ(std::vector<std::string>({"abc"}), detect(detector2));
+}
+
+TEST_F(YaraDetectorTests, RulesInDifferentNamespacesAreNotShared)
+{
+	const auto path = writeRuleFile("abc", abcRule);
+	YaraDetector detector1;
+	YaraDetector detector2;
+
+	EXPECT_TRUE(detector1.addRuleFile(path, "first"));
+	EXPECT_TRUE(detector2.addRuleFile(path, "second"));
+
+	EXPECT_EQ(2, YaraDetector::getNumberOfCachedRules());
+}
+
+TEST_F(YaraDetectorTests, UnusedRulesAreEvicted)
+{
+	const auto path = writeRuleFile("abc", abcRule);
+	{
+		YaraDetector detector;
+		EXPECT_TRUE(detector.addRuleFile(path));
+		EXPECT_EQ(1, YaraDetector::getNumberOfCachedRules());
+	}
+
+	EXPECT_EQ(0, YaraDetector::getNumberOfCachedRules());
+}
+
+TEST_F(YaraDetectorTests, RecentlyUsedRulesAreKept)
+{
+	YaraDetector::setCacheCapacity(1);
+	const auto abcPath = writeRuleFile("abc", abcRule);
+	const auto defPath = writeRuleFile("def", defRule);
+	{
+		YaraDetector detector;
+		EXPECT_TRUE(detector.addRuleFile(abcPath));
+	}
+	EXPECT_EQ(1, YaraDetector::getNumberOfCachedRules());
+
+	{
+		YaraDetector detector;
+		EXPECT_TRUE(detector.addRuleFile(defPath));
+	}
+	EXPECT_EQ(1, YaraDetector::getNumberOfCachedRules());
+
+	YaraDetector::setCacheCapacity(0);
+	EXPECT_EQ(0, YaraDetector::getNumberOfCachedRules());
+}
+
+TEST_F(YaraDetectorTests, ChangedFileIsCompiledAgain)
+{
+	const auto path = writeRuleFile("changed", abcRule);
+	YaraDetector detector1;
+	EXPECT_TRUE(detector1.addRuleFile(path));
+
+	writeRuleFile("changed", abcRule + defRule);
+	YaraDetector detector2;
+	EXPECT_TRUE(detector2.addRuleFile(path));
+
+	EXPECT_EQ(2, YaraDetector::getNumberOfCachedRules());
+	EXPECT_EQ(std::vector<std::string>({"abc"}), detect(detector1));
+	EXPECT_EQ(std::vector<std::string>({"abc", "def"}), detect(detector2));
+}
+
+TEST_F(YaraDetectorTests, RulesFromFilesInOneNamespaceMayReferToEachOther)
+{
+	const auto abcPath = writeRuleFile("abc", abcRule);
+	const auto refPath = writeRuleFile("ref", R"(
+rule abc_and_def
+{
+	strings:
+		$1 = "def"
+	condition:
+		abc and $1
+}
+)");
+	YaraDetector detector;
+
+	EXPECT_TRUE(detector.addRuleFiles({abcPath, refPath}, {"", ""}));
+
+	EXPECT_EQ(1, YaraDetector::getNumberOfCachedRules());
+	EXPECT_EQ(std::vector<std::string>({"abc", "abc_and_def"}), detect(detector));
+}
+
+TEST_F(YaraDetectorTests, FilesAreNotAddedIfSomeOfThemIsBroken)
+{
+	const auto abcPath = writeRuleFile("abc", abcRule);
+	const auto brokenPath = writeRuleFile("broken", "rule broken {");
+	YaraDetector detector;
+
+	EXPECT_FALSE(detector.addRuleFiles({abcPath, brokenPath}));
+	EXPECT_FALSE(detector.addRuleFiles({abcPath}, {"", ""}));
+
+	EXPECT_EQ(0, YaraDetector::getNumberOfCachedRules());
+	EXPECT_TRUE(detect(detector).empty());
+}
+
+TEST_F(YaraDetectorTests, RulesAreInTheirNamespace)
+{
+	const auto path = writeRuleFile("abc", abcRule);
+	YaraDetector detector;
+
+	EXPECT_TRUE(detector.addRuleFile(path, "first"));
+
+	EXPECT_TRUE(detector.analyze(inputBytes));
+	const auto& rules = detector.getDetectedRules();
+	ASSERT_EQ(1, rules.size());
+	EXPECT_EQ("abc", rules[0].getName());
+	EXPECT_EQ("first", rules[0].getNamespace());
+}
+
+TEST_F(YaraDetectorTests, FilesWithTheSameRuleIdAreMergedIntoTheirOwnNamespaces)
+{
+	const auto abcPath = writeRuleFile("abc", abcRule);
+	const auto otherAbcPath = writeRuleFile("other-abc", abcRule);
+	YaraDetector detector;
+
+	EXPECT_TRUE(detector.addRuleFiles({abcPath, otherAbcPath}));
+
+	EXPECT_EQ(1, YaraDetector::getNumberOfCachedRules());
+	EXPECT_TRUE(detector.analyze(inputBytes));
+	const auto& rules = detector.getDetectedRules();
+	ASSERT_EQ(2, rules.size());
+	EXPECT_EQ("abc", rules[0].getName());
+	EXPECT_EQ(abcPath, rules[0].getNamespace());
+	EXPECT_EQ("abc", rules[1].getName());
+	EXPECT_EQ(otherAbcPath, rules[1].getNamespace());
+}
+
+TEST_F(YaraDetectorTests, FilesWithTheSameRuleIdCannotShareNamespace)
+{
+	const auto abcPath = writeRuleFile("abc", abcRule);
+	const auto otherAbcPath = writeRuleFile("other-abc", abcRule);
+	YaraDetector detector;
+
+	EXPECT_FALSE(detector.addRuleFiles({abcPath, otherAbcPath}, {"", ""}));
+}
+
+TEST_F(YaraDetectorTests, PrecompiledFilesAreAddedSeparatelyFromTextFiles)
+{
+	const auto abcPath = writePrecompiledRuleFile("abc", abcRule);
+	const auto defPath = writeRuleFile("def", defRule);
+	EXPECT_TRUE(YaraDetector::isPrecompiledRuleFile(abcPath));
+	EXPECT_FALSE(YaraDetector::isPrecompiledRuleFile(defPath));
+	YaraDetector detector;
+
+	EXPECT_TRUE(detector.addRuleFiles({abcPath, defPath}));
+
+	EXPECT_EQ(2, YaraDetector::getNumberOfCachedRules());
+	EXPECT_TRUE(detector.analyze(inputBytes));
+	const auto& rules = detector.getDetectedRules();
+	ASSERT_EQ(2, rules.size());
+	// Precompiled rules keep the namespace they were compiled with.
+	EXPECT_EQ("abc", rules[0].getName());
+	EXPECT_EQ("abc", rules[0].getNamespace());
+	EXPECT_EQ("def", rules[1].getName());
+	EXPECT_EQ(defPath, rules[1].getNamespace());
+}
+
+} // namespace tests
+} // namespace yaracpp
+} // namespace retdec